@@ -0,0 +1,143 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Measures reading the attributes of loaded instances the way the generated    *
+* schema accessors do, i.e. through getArgument() and the conversions of       *
+* Argument, per kind of attribute value.                                       *
+*                                                                              *
+* Usage: IfcAttributeBenchmark [file.ifc]                                      *
+*                                                                              *
+* Without a file a synthetic model of 64 MB is used. The kinds of values are   *
+* read from the IfcCartesianPoint, IfcPolyline and IfcWall instances.          *
+*                                                                              *
+********************************************************************************/
+
+#include "benchmark.h"
+
+#include "../ifcparse/IfcFile.h"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace {
+
+	// Receives the values read, so that the reads are not optimized away
+	volatile size_t sink;
+
+	struct attribute_access {
+		const char* name;
+		const char* type;
+		// Reads the attributes of an instance, returns a value that depends on them
+		std::function<size_t(const IfcEntityInstanceData&)> read;
+	};
+
+	// Mirrors the generated accessors of optional attributes, which check
+	// for null before converting the argument.
+	template <typename T>
+	bool read_optional(const IfcEntityInstanceData& data, size_t i, T& value) {
+		if (!data.getArgument(i) || data.getArgument(i)->isNull()) {
+			return false;
+		}
+		T v = *data.getArgument(i);
+		value = v;
+		return true;
+	}
+
+}
+
+int main(int argc, char** argv) {
+	const std::string contents = argc > 1
+		? benchmark::read_file(argv[1])
+		: benchmark::mixed_model(64 << 20);
+
+	char* data = new char[contents.size()];
+	std::memcpy(data, contents.data(), contents.size());
+	IfcParse::IfcFile f(data, contents.size());
+	if (!f.good()) {
+		throw std::runtime_error("Unable to parse file");
+	}
+
+	const std::vector<attribute_access> accesses = {
+		{ "real list", "IfcCartesianPoint", [](const IfcEntityInstanceData& d) {
+			std::vector<double> v = *d.getArgument(0);
+			return v.size();
+		} },
+		{ "instance list", "IfcPolyline", [](const IfcEntityInstanceData& d) {
+			aggregate_of_instance::ptr v = *d.getArgument(0);
+			return (size_t) v->size();
+		} },
+		{ "string", "IfcWall", [](const IfcEntityInstanceData& d) {
+			std::string v = *d.getArgument(0);
+			return v.size();
+		} },
+		{ "instance", "IfcWall", [](const IfcEntityInstanceData& d) {
+			IfcUtil::IfcBaseClass* v = *d.getArgument(1);
+			return (size_t) (v != nullptr);
+		} },
+		{ "optional null", "IfcWall", [](const IfcEntityInstanceData& d) {
+			std::string v;
+			return (size_t) read_optional(d, 4, v);
+		} },
+		{ "enumeration", "IfcWall", [](const IfcEntityInstanceData& d) {
+			return (size_t) d.getArgument(8)->enumeration_index();
+		} },
+		{ "type of all", "IfcWall", [](const IfcEntityInstanceData& d) {
+			size_t n = 0;
+			for (size_t i = 0; i < d.getArgumentCount(); ++i) {
+				n += d.getArgument(i)->type();
+			}
+			return n;
+		} },
+	};
+
+	std::printf("%-16s %-20s %12s %12s\n", "attribute", "entity", "instances", "ns/instance");
+
+	for (auto& a : accesses) {
+		aggregate_of_instance::ptr instances = f.instances_by_type(a.type);
+		if (!instances || instances->size() == 0) {
+			std::printf("%-16s %-20s %12s %12s\n", a.name, a.type, "0", "n/a");
+			continue;
+		}
+		std::vector<const IfcEntityInstanceData*> datas;
+		for (auto& inst : *instances) {
+			datas.push_back(&inst->data());
+		}
+		size_t checksum = 0;
+		// The first pass loads the instances
+		for (auto& d : datas) {
+			checksum += a.read(*d);
+		}
+		const double seconds = benchmark::fastest([&]() {
+			for (int repeat = 0; repeat < 10; ++repeat) {
+				for (auto& d : datas) {
+					checksum += a.read(*d);
+				}
+			}
+		});
+		sink = checksum;
+		std::printf("%-16s %-20s %12zu %12.1f\n", a.name, a.type, datas.size(), seconds * 1e9 / datas.size() / 10);
+	}
+
+	return 0;
+}
@@ -0,0 +1,130 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Helpers shared by the IfcParse benchmarks. The models are synthetic and      *
+* generated deterministically, so that results are reproducible without test   *
+* data, but a file can be passed to the benchmarks instead.                    *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCPARSE_BENCHMARK_H
+#define IFCPARSE_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace benchmark {
+
+	const char* const header =
+		"ISO-10303-21;\n"
+		"HEADER;\n"
+		"FILE_DESCRIPTION(('ViewDefinition [CoordinationView]'),'2;1');\n"
+		"FILE_NAME('benchmark','',(),(),'','','');\n"
+		"FILE_SCHEMA(('IFC4'));\n"
+		"ENDSEC;\n"
+		"DATA;\n";
+
+	const char* const footer =
+		"ENDSEC;\n"
+		"END-ISO-10303-21;\n";
+
+	/// A linear congruential generator, so that models do not depend on the
+	/// standard library implementation
+	class random {
+		uint64_t state_;
+	public:
+		random() : state_(1) {}
+
+		uint32_t next() {
+			state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+			return (uint32_t) (state_ >> 33);
+		}
+
+		/// Returns a value in [0, 1)
+		double uniform() {
+			return next() / 2147483648.;
+		}
+	};
+
+	inline std::string read_file(const std::string& fn) {
+		std::ifstream ifs(fn.c_str(), std::ios_base::binary);
+		if (!ifs.good()) {
+			throw std::runtime_error("Unable to open " + fn);
+		}
+		return std::string((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+	}
+
+	/// Returns a model of at least size bytes that mixes geometry and
+	/// products with string attributes and comments
+	inline std::string mixed_model(size_t size) {
+		static const char guid_chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_$";
+		random rng;
+		std::ostringstream ss;
+		ss.precision(17);
+		ss << header << "#1=IFCOWNERHISTORY($,$,$,.ADDED.,$,$,$,0);\n";
+		unsigned id = 2;
+		while ((size_t) ss.tellp() < size) {
+			const unsigned first_point = id;
+			for (int i = 0; i < 4; ++i) {
+				ss << "#" << id++ << "=IFCCARTESIANPOINT((" << rng.uniform() * 100. << "," << rng.uniform() * 100. << "," << i << ".));\n";
+			}
+			ss << "#" << id++ << "=IFCPOLYLINE((#" << first_point << ",#" << first_point + 1 << ",#" << first_point + 2 << ",#" << first_point + 3 << "));\n";
+			if (id % 8 == 0) {
+				ss << "/* Walls of storey " << id / 8 << " */\n";
+			}
+			std::string guid(22, '0');
+			for (size_t i = 1; i < guid.size(); ++i) {
+				guid[i] = guid_chars[rng.next() % 64];
+			}
+			ss << "#" << id << "=IFCWALL('" << guid << "',#1,'Basic Wall:Interior - 138mm Partition (1-hr):" << id
+			   << "','Gypsum wallboard on metal studs, fire rated partition',$,$,$,'" << rng.next() << "',.STANDARD.);\n";
+			++id;
+		}
+		ss << footer;
+		return ss.str();
+	}
+
+	/// Returns the duration in seconds of the fastest of repeated calls to fn
+	template <typename Fn>
+	double fastest(Fn fn, int repeats = 3) {
+		double best = 0.;
+		for (int i = 0; i < repeats; ++i) {
+			const auto begin = std::chrono::steady_clock::now();
+			fn();
+			const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+			best = i ? (std::min)(best, seconds) : seconds;
+		}
+		return best;
+	}
+
+	inline double megabytes_per_second(size_t bytes, double seconds) {
+		return bytes / seconds / (1 << 20);
+	}
+
+}
+
+#endif
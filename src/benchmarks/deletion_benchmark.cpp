@@ -0,0 +1,104 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Measures removing 10%, 50% and 90% of the instances of a model, selected at  *
+* random, with removeEntity() in batch mode and, for small numbers, one at a   *
+* time.                                                                        *
+*                                                                              *
+* Usage: IfcDeletionBenchmark [file.ifc]                                       *
+*                                                                              *
+* Without a file a synthetic model of 16 MB is used.                           *
+*                                                                              *
+********************************************************************************/
+
+#include "benchmark.h"
+
+#include "../ifcparse/IfcFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+	// Removing instances one at a time is only measured up to this number
+	const size_t max_unbatched_removals = 20000;
+
+	/// Opens the contents, removes a fraction of the instances and returns
+	/// the duration of the removal in seconds
+	double remove(const std::string& contents, double fraction, bool batch, size_t& removed) {
+		char* data = new char[contents.size()];
+		std::memcpy(data, contents.data(), contents.size());
+		IfcParse::IfcFile f(data, contents.size());
+		if (!f.good()) {
+			throw std::runtime_error("Unable to parse file");
+		}
+
+		std::vector<int> ids;
+		for (auto it = f.begin(); it != f.end(); ++it) {
+			ids.push_back(it->first);
+		}
+		// A deterministic shuffle, std::shuffle() depends on the implementation
+		benchmark::random rng;
+		for (size_t i = ids.size(); i > 1; --i) {
+			std::swap(ids[i - 1], ids[rng.next() % i]);
+		}
+		ids.resize((size_t) (ids.size() * fraction));
+		removed = ids.size();
+
+		return benchmark::fastest([&]() {
+			if (batch) {
+				f.batch();
+			}
+			for (int id : ids) {
+				f.removeEntity(f.instance_by_id(id));
+			}
+			if (batch) {
+				f.unbatch();
+			}
+		}, 1);
+	}
+
+}
+
+int main(int argc, char** argv) {
+	const std::string contents = argc > 1
+		? benchmark::read_file(argv[1])
+		: benchmark::mixed_model(16 << 20);
+
+	std::printf("%-10s %12s %12s %16s\n", "removed", "instances", "batch (s)", "unbatched (s)");
+
+	for (double fraction : {0.1, 0.5, 0.9}) {
+		size_t removed = 0;
+		const double batch_seconds = remove(contents, fraction, true, removed);
+		const std::string name = std::to_string((int) (fraction * 100)) + "%";
+		if (removed <= max_unbatched_removals) {
+			const double unbatched_seconds = remove(contents, fraction, false, removed);
+			std::printf("%-10s %12zu %12.2f %16.2f\n", name.c_str(), removed, batch_seconds, unbatched_seconds);
+		} else {
+			std::printf("%-10s %12zu %12.2f %16s\n", name.c_str(), removed, batch_seconds, "n/a");
+		}
+	}
+
+	return 0;
+}
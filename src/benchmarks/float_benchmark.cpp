@@ -0,0 +1,178 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Compares ParseFloat() and ParseInt() to std::strtod() and std::strtol() on   *
+* numbers formatted like in exported models, and measures the throughput of    *
+* lexing a model that consists mostly of coordinates.                          *
+*                                                                              *
+* Usage: IfcFloatBenchmark                                                     *
+*                                                                              *
+********************************************************************************/
+
+#include "benchmark.h"
+
+#include "../ifcparse/IfcParse.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+	/// Returns count numbers formatted with the given number of significant
+	/// digits, in the notation SPF writers use: a decimal point is always
+	/// present and exponents are written for large and small magnitudes.
+	std::vector<std::string> numbers(size_t count, int digits) {
+		benchmark::random rng;
+		std::vector<std::string> result;
+		result.reserve(count);
+		char buffer[64];
+		for (size_t i = 0; i < count; ++i) {
+			const double magnitude = (rng.next() % 3 == 0) ? 1e-7 : 1e4;
+			const double v = (rng.uniform() - 0.5) * magnitude;
+			std::snprintf(buffer, sizeof(buffer), "%.*G", digits, v);
+			std::string s = buffer;
+			if (s.find_first_of(".E") == std::string::npos) {
+				s += ".";
+			} else if (s.find('.') == std::string::npos) {
+				s.insert(s.find('E'), ".");
+			}
+			result.push_back(s);
+		}
+		return result;
+	}
+
+	std::vector<std::string> integers(size_t count) {
+		benchmark::random rng;
+		std::vector<std::string> result;
+		result.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			result.push_back(std::to_string(rng.next() % 1000000));
+		}
+		return result;
+	}
+
+	/// Returns a model of at least size bytes of point lists with coordinates
+	/// formatted with the given number of significant digits
+	std::string point_list_model(size_t size, int digits) {
+		const std::vector<std::string> coordinates = numbers(3 * 1024, digits);
+		std::ostringstream ss;
+		ss << benchmark::header;
+		unsigned id = 1;
+		size_t n = 0;
+		while ((size_t) ss.tellp() < size) {
+			ss << "#" << id++ << "=IFCCARTESIANPOINTLIST3D((";
+			for (int i = 0; i < 256; ++i) {
+				ss << (i ? ",(" : "(");
+				for (int j = 0; j < 3; ++j) {
+					ss << (j ? "," : "") << coordinates[n++ % coordinates.size()];
+				}
+				ss << ")";
+			}
+			ss << "),$);\n";
+		}
+		ss << benchmark::footer;
+		return ss.str();
+	}
+
+	size_t lex(const std::string& contents) {
+		char* data = new char[contents.size()];
+		std::memcpy(data, contents.data(), contents.size());
+		IfcParse::IfcSpfStream stream(data, contents.size());
+		IfcParse::IfcSpfLexer lexer(&stream, nullptr);
+		size_t count = 0;
+		IfcParse::Token token;
+		while ((token = lexer.Next()).type != IfcParse::Token_NONE) {
+			count += token.type == IfcParse::Token_FLOAT;
+		}
+		return count;
+	}
+
+}
+
+int main() {
+	const size_t count = 1 << 20;
+
+	std::printf("%-24s %14s %14s %10s\n", "numbers", "IfcParse (ns)", "libc (ns)", "mismatch");
+
+	for (int digits : {6, 10, 17}) {
+		const std::vector<std::string> input = numbers(count, digits);
+		std::vector<double> parsed(count), reference(count);
+
+		const double parse_seconds = benchmark::fastest([&]() {
+			for (size_t i = 0; i < count; ++i) {
+				IfcParse::ParseFloat(input[i].c_str(), parsed[i]);
+			}
+		});
+		const double strtod_seconds = benchmark::fastest([&]() {
+			for (size_t i = 0; i < count; ++i) {
+				reference[i] = std::strtod(input[i].c_str(), nullptr);
+			}
+		});
+
+		size_t mismatches = 0;
+		for (size_t i = 0; i < count; ++i) {
+			mismatches += std::memcmp(&parsed[i], &reference[i], sizeof(double)) != 0;
+		}
+
+		const std::string name = "REAL, " + std::to_string(digits) + " digits";
+		std::printf("%-24s %14.1f %14.1f %10zu\n", name.c_str(),
+			parse_seconds / count * 1e9, strtod_seconds / count * 1e9, mismatches);
+	}
+
+	{
+		const std::vector<std::string> input = integers(count);
+		std::vector<int> parsed(count), reference(count);
+
+		const double parse_seconds = benchmark::fastest([&]() {
+			for (size_t i = 0; i < count; ++i) {
+				IfcParse::ParseInt(input[i].c_str(), parsed[i]);
+			}
+		});
+		const double strtol_seconds = benchmark::fastest([&]() {
+			for (size_t i = 0; i < count; ++i) {
+				reference[i] = (int) std::strtol(input[i].c_str(), nullptr, 10);
+			}
+		});
+
+		std::printf("%-24s %14.1f %14.1f %10zu\n", "INTEGER",
+			parse_seconds / count * 1e9, strtol_seconds / count * 1e9,
+			(size_t) (parsed != reference));
+	}
+
+	std::printf("\n%-24s %14s %14s\n", "point lists", "lexer (MB/s)", "REAL tokens");
+
+	for (int digits : {6, 17}) {
+		const std::string contents = point_list_model(32 << 20, digits);
+		size_t floats = 0;
+		const double seconds = benchmark::fastest([&]() {
+			floats = lex(contents);
+		});
+		const std::string name = std::to_string(digits) + " digits";
+		std::printf("%-24s %14.1f %14zu\n", name.c_str(),
+			benchmark::megabytes_per_second(contents.size(), seconds), floats);
+	}
+
+	return 0;
+}
@@ -0,0 +1,88 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Compares the implementations of find_first_of() on the contents of an SPF    *
+* file, both in isolation and as part of lexing the file.                      *
+*                                                                              *
+* Usage: IfcLexerBenchmark [file.ifc]                                          *
+*                                                                              *
+* Without a file a synthetic model of 64 MB is used.                           *
+*                                                                              *
+********************************************************************************/
+
+#include "benchmark.h"
+
+#include "../ifcparse/IfcCharacterScan.h"
+#include "../ifcparse/IfcParse.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+	const std::string contents = argc > 1
+		? benchmark::read_file(argv[1])
+		: benchmark::mixed_model(64 << 20);
+
+	// The stream takes ownership of a copy of the contents, every run lexes
+	// through a cursor on it.
+	char* data = new char[contents.size()];
+	std::memcpy(data, contents.data(), contents.size());
+	IfcParse::IfcSpfStream stream(data, contents.size());
+
+	const IfcParse::character_set delimiters("()=,;/'", 7);
+	const std::string default_implementation = IfcParse::find_first_of_implementation();
+
+	std::printf("%.1f MB\n", contents.size() / (double) (1 << 20));
+	std::printf("%-16s %16s %12s %16s %12s\n", "implementation", "search (MB/s)", "delimiters", "lexer (MB/s)", "tokens");
+
+	for (const auto& name : IfcParse::find_first_of_implementations()) {
+		IfcParse::find_first_of_implementation(name);
+
+		size_t delimiter_count = 0;
+		const double search_seconds = benchmark::fastest([&]() {
+			delimiter_count = 0;
+			size_t i = 0;
+			while ((i = IfcParse::find_first_of(contents.data(), i, contents.size(), delimiters)) != contents.size()) {
+				++delimiter_count;
+				++i;
+			}
+		});
+
+		size_t token_count = 0;
+		const double lexer_seconds = benchmark::fastest([&]() {
+			IfcParse::IfcSpfStream cursor(stream, 0);
+			IfcParse::IfcSpfLexer lexer(&cursor, nullptr);
+			token_count = 0;
+			while (lexer.Next().type != IfcParse::Token_NONE) {
+				++token_count;
+			}
+		});
+
+		std::printf("%-16s %16.1f %12zu %16.1f %12zu\n", name.c_str(),
+			benchmark::megabytes_per_second(contents.size(), search_seconds), delimiter_count,
+			benchmark::megabytes_per_second(contents.size(), lexer_seconds), token_count);
+	}
+
+	IfcParse::find_first_of_implementation(default_implementation);
+	return 0;
+}
@@ -0,0 +1,148 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Compares the ways IfcFile reads a file from disk: memory mapped (when built  *
+* with USE_MMAP), read synchronously before parsing, and read by a read-ahead  *
+* thread while it is being parsed. Each is measured with the file in the page  *
+* cache (warm) and, on Linux, with the file evicted from it first (cold).      *
+*                                                                              *
+* Usage: IfcReadBenchmark [file.ifc]                                           *
+*                                                                              *
+* Without a file a synthetic model of 256 MB is written to the working         *
+* directory and removed afterwards. Files smaller than 8 MB are always read    *
+* synchronously, also in the read-ahead mode. Evicting a file from the page    *
+* cache by posix_fadvise() is only a request, for reliable cold timings run as *
+* root, so that /proc/sys/vm/drop_caches is used as well.                      *
+*                                                                              *
+********************************************************************************/
+
+#include "benchmark.h"
+
+#include "../ifcparse/IfcFile.h"
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+	/// Attempts to remove the file from the page cache, returns whether
+	/// this is supported on the platform
+	bool evict(const std::string& fn) {
+#ifdef __linux__
+		sync();
+		std::ofstream drop_caches("/proc/sys/vm/drop_caches");
+		if (drop_caches.good()) {
+			drop_caches << "1" << std::endl;
+		}
+		const int fd = open(fn.c_str(), O_RDONLY);
+		if (fd == -1) {
+			return false;
+		}
+		posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+		close(fd);
+		return true;
+#else
+		(void) fn;
+		return false;
+#endif
+	}
+
+	size_t instance_count(IfcParse::IfcFile& f) {
+		if (!f.good()) {
+			throw std::runtime_error("Unable to parse file");
+		}
+		return f.instances_by_type("IfcRoot")->size();
+	}
+
+}
+
+int main(int argc, char** argv) {
+	std::string fn;
+	bool generated = false;
+	if (argc > 1) {
+		fn = argv[1];
+	} else {
+		fn = "IfcReadBenchmark.ifc";
+		generated = true;
+		std::ofstream ofs(fn.c_str(), std::ios_base::binary);
+		ofs << benchmark::mixed_model(256 << 20);
+	}
+
+	std::vector<std::pair<std::string, std::function<size_t()>>> modes;
+#ifdef USE_MMAP
+	modes.emplace_back("mmap", [&fn]() {
+		IfcParse::IfcFile f(fn, true);
+		return instance_count(f);
+	});
+#endif
+	modes.emplace_back("synchronous", [&fn]() {
+		std::ifstream ifs(fn.c_str(), std::ios_base::binary);
+		ifs.seekg(0, std::ios_base::end);
+		const size_t size = (size_t) ifs.tellg();
+		ifs.seekg(0, std::ios_base::beg);
+		IfcParse::IfcFile f(ifs, size);
+		return instance_count(f);
+	});
+	modes.emplace_back("read-ahead", [&fn]() {
+		IfcParse::IfcFile f(fn);
+		return instance_count(f);
+	});
+
+	std::printf("%-16s %12s %12s %12s\n", "mode", "warm (s)", "cold (s)", "IfcRoot");
+
+	for (auto& mode : modes) {
+		size_t roots = 0;
+		// The first run populates the page cache
+		mode.second();
+		const double warm = benchmark::fastest([&]() {
+			roots = mode.second();
+		});
+		double cold = 0.;
+		bool has_cold = true;
+		for (int i = 0; i < 3 && has_cold; ++i) {
+			has_cold = evict(fn);
+			const double seconds = benchmark::fastest([&]() {
+				mode.second();
+			}, 1);
+			cold = i ? (std::min)(cold, seconds) : seconds;
+		}
+		if (has_cold) {
+			std::printf("%-16s %12.2f %12.2f %12zu\n", mode.first.c_str(), warm, cold, roots);
+		} else {
+			std::printf("%-16s %12.2f %12s %12zu\n", mode.first.c_str(), warm, "n/a", roots);
+		}
+	}
+
+	if (generated) {
+		std::remove(fn.c_str());
+	}
+
+	return 0;
+}
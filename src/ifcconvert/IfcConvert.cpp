@@ -51,10 +51,12 @@
 
 #include <boost/program_options.hpp>
 #include <boost/make_shared.hpp>
+#include <boost/algorithm/string/join.hpp>
 
 #include <fstream>
 #include <sstream>
 #include <set>
+#include <algorithm>
 #include <time.h>
 
 #if USE_VLD
@@ -184,7 +186,7 @@ size_t read_filters_from_file(const std::string&, inclusion_filter&, inclusion_t
 void parse_filter(geom_filter &, const std::vector<std::string>&);
 std::vector<IfcGeom::filter_t> setup_filters(const std::vector<geom_filter>&, const std::string&);
 
-bool init_input_file(const std::string& filename, IfcParse::IfcFile*& ifc_file, bool no_progress, bool mmap);
+bool init_input_file(const std::string& filename, IfcParse::IfcFile*& ifc_file, bool no_progress, bool mmap, unsigned int scan_threads);
 
 // from https://stackoverflow.com/questions/31696328/boost-program-options-using-zero-parameter-options-multiple-times
 struct verbosity_counter {
@@ -217,12 +219,14 @@ int main(int argc, char** argv) {
 	path_t log_file;
 	path_t cache_file;
 	std::string log_format;
+	int scan_threads;
 
     po::options_description generic_options("Command line options");
 	verbosity_counter vcounter;
 	generic_options.add_options()
 		("help,h", "display usage information")
 		("version", "display version information")
+		("probe", "display the header and the number of instances by entity of the input file, without converting it")
 		("verbose,v", po::value(&vcounter)->zero_tokens(), "more verbose log messages. Use twice (-vv) for debugging level.")
 		("debug,d", "write boolean operands to file in current directory for debugging purposes")
 		("quiet,q", "less status and progress output")
@@ -232,6 +236,9 @@ int main(int argc, char** argv) {
 		("stderr-progress", "output progress to stderr stream")
 		("yes,y", "answer 'yes' automatically to possible confirmation queries (e.g. overwriting an existing output file)")
 		("no-progress", "suppress possible progress bar type of prints that use carriage return")
+		("scan-threads", po::value<int>(&scan_threads)->default_value(1),
+			"Number of parallel threads for scanning the input IFC file. "
+			"Use 0 to use all available cores.")
 		("log-format", po::value<std::string>(&log_format), "log format: plain or json")
 		("log-file", new po::typed_value<path_t, char_t>(&log_file), "redirect log output to file");
 
@@ -240,6 +247,8 @@ int main(int argc, char** argv) {
 #ifdef USE_MMAP
 		("mmap", "use memory-mapped file for input")
 #endif
+		("index", "use an index stored next to the input file (with an .idx suffix) "
+			"to skip scanning the file when it has not changed, the index is written otherwise")
 		("input-file", new po::typed_value<path_t, char_t>(0), "input IFC file")
 		("output-file", new po::typed_value<path_t, char_t>(0), "output geometry file")
 #ifdef WITH_HDF5
@@ -258,7 +267,8 @@ int main(int argc, char** argv) {
 	po::options_description geom_options("Geometry options");
 	geom_options.add_options()
 		("threads,j", po::value<int>(&num_threads)->default_value(1),
-			"Number of parallel processing threads for geometry interpretation.")
+			"Number of parallel processing threads for geometry interpretation, "
+			"also used for formatting IFC output.")
 		("plan",
 			"Specifies whether to include curves in the output result. Typically "
 			"these are representations of type Plan or Axis. Excluded by default.")
@@ -499,6 +509,10 @@ int main(int argc, char** argv) {
     po::notify(vmap);
 
 	const bool mmap = vmap.count("mmap") != 0;
+	if (scan_threads <= 0) {
+		scan_threads = std::thread::hardware_concurrency();
+	}
+	IfcParse::IfcFile::persistent_index(vmap.count("index") != 0);
 	const bool no_progress = vmap.count("no-progress") != 0;
 	const bool quiet = vmap.count("quiet") != 0;
 	const bool stderr_progress = vmap.count("stderr-progress") != 0;
@@ -648,6 +662,41 @@ int main(int argc, char** argv) {
         return EXIT_FAILURE;
     }
 
+	if (vmap.count("probe")) {
+		const IfcParse::file_probe probe = IfcParse::IfcFile::probe(IfcUtil::path::to_utf8(input_filename), true);
+		if (probe.status == IfcParse::file_open_status::READ_ERROR) {
+			cerr_ << "[Error] Unable to open input file '" << input_filename << "'" << std::endl;
+			return EXIT_FAILURE;
+		} else if (probe.status == IfcParse::file_open_status::NO_HEADER) {
+			cerr_ << "[Error] Unable to parse the header of input file '" << input_filename << "'" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		cout_ << "Size: " << probe.size << " bytes\n";
+		cout_ << "Name: " << probe.name.c_str() << "\n";
+		cout_ << "Time stamp: " << probe.time_stamp.c_str() << "\n";
+		cout_ << "Originating system: " << probe.originating_system.c_str() << "\n";
+		cout_ << "Preprocessor version: " << probe.preprocessor_version.c_str() << "\n";
+		cout_ << "Schema: " << boost::algorithm::join(probe.schema_identifiers, ", ").c_str();
+		if (probe.status == IfcParse::file_open_status::UNSUPPORTED_SCHEMA) {
+			cout_ << " (unsupported)";
+		}
+		cout_ << "\n";
+		cout_ << "Instances: " << probe.instance_count << "\n";
+		cout_ << "Maximum id: " << probe.max_id << "\n";
+
+		// Most frequent entities first
+		std::vector<std::pair<std::string, size_t>> counts(probe.entity_counts.begin(), probe.entity_counts.end());
+		std::stable_sort(counts.begin(), counts.end(), [](const std::pair<std::string, size_t>& a, const std::pair<std::string, size_t>& b) {
+			return a.second > b.second;
+		});
+		for (const auto& pair : counts) {
+			cout_ << "    " << pair.first.c_str() << " " << pair.second << "\n";
+		}
+		cout_ << std::flush;
+		return EXIT_SUCCESS;
+	}
+
 	// If no output filename is specified a Wavefront OBJ file will be output
 	// to maintain backwards compatibility with the obsolete IfcObj executable.
 	const path_t output_filename = vmap.count("output-file") == 1 
@@ -731,7 +780,7 @@ int main(int argc, char** argv) {
 	if (output_extension == XML) {
 		int exit_code = EXIT_FAILURE;
 		try {
-			if (init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap)) {
+			if (init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap, scan_threads)) {
 				time_t start, end;
 				time(&start);
 				XmlSerializer s(ifc_file, IfcUtil::path::to_utf8(output_temp_filename));
@@ -751,19 +800,15 @@ int main(int argc, char** argv) {
 	} else if (output_extension == IFC) {
 		int exit_code = EXIT_FAILURE;
 		try {
-			if (init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap)) {
+			if (init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap, scan_threads)) {
                 time_t start, end;
 				time(&start);
-				std::ofstream fs(output_filename.c_str());
-				if (fs.is_open()) {
-					if (vmap.count("calculate-quantities")) {
-						fix_quantities(*ifc_file, no_progress, quiet, stderr_progress);
-					}
-					fs << *ifc_file;
-					exit_code = EXIT_SUCCESS;
-				} else {
-					Logger::Error("Unable to open output file for writing");
+				if (vmap.count("calculate-quantities")) {
+					fix_quantities(*ifc_file, no_progress, quiet, stderr_progress);
 				}
+				const unsigned int write_threads = num_threads <= 0 ? std::thread::hardware_concurrency() : (unsigned int) num_threads;
+				ifc_file->write(IfcUtil::path::to_utf8(output_filename), write_threads);
+				exit_code = EXIT_SUCCESS;
                 time(&end);
                 Logger::Status("Done! Writing IFC took " +  format_duration(start, end));
 			}
@@ -932,7 +977,7 @@ int main(int argc, char** argv) {
 	time_t start,end;
 	time(&start);
 	
-    if (!init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap)) {
+    if (!init_input_file(IfcUtil::path::to_utf8(input_filename), ifc_file, no_progress || quiet, mmap, scan_threads)) {
         write_log(!quiet);
 		serializer.reset();
         IfcUtil::path::delete_file(IfcUtil::path::to_utf8(output_temp_filename)); /**< @todo Windows Unicode support */
@@ -1269,7 +1314,7 @@ void write_log(bool header) {
 
 #include <boost/algorithm/string/predicate.hpp>
 
-bool init_input_file(const std::string& filename, IfcParse::IfcFile*& ifc_file, bool no_progress, bool mmap) {
+bool init_input_file(const std::string& filename, IfcParse::IfcFile*& ifc_file, bool no_progress, bool mmap, unsigned int scan_threads) {
     time_t start, end;
 
     // Prevent IfcFile::Init() prints by setting output to null temporarily
@@ -1285,10 +1330,10 @@ bool init_input_file(const std::string& filename, IfcParse::IfcFile*& ifc_file,
 
 	{
 #ifdef USE_MMAP
-		ifc_file = new IfcParse::IfcFile(filename, mmap);
+		ifc_file = new IfcParse::IfcFile(filename, mmap, scan_threads);
 #else
 		(void)mmap;
-		ifc_file = new IfcParse::IfcFile(filename);
+		ifc_file = new IfcParse::IfcFile(filename, scan_threads);
 #endif
 	}
 
@@ -1504,7 +1549,7 @@ namespace latebound_access {
 		} else {
 			IfcWrite::IfcWriteArgument* a = new IfcWrite::IfcWriteArgument;
 			a->set(t);
-			inst->data().attributes()[i] = a;
+			inst->data().setArgument(i, a);
 		}
 	}
 
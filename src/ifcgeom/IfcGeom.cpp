@@ -163,13 +163,13 @@ namespace {
 
 				// Set unit information from file
 
-				IfcSchema::IfcProject::list::ptr projects = file->instances_by_type<IfcSchema::IfcProject>();
-				if (projects->size() == 1) {
-					IfcSchema::IfcProject* project = *projects->begin();
+				auto projects = file->instances_by_type_range<IfcSchema::IfcProject>();
+				if (projects.size() == 1) {
+					IfcSchema::IfcProject* project = *projects.begin();
 					std::pair<std::string, double> unit_info = k->initializeUnits(project->UnitsInContext());
 					unit_magnitude = unit_info.second;
 				} else {
-					Logger::Warning("A single IfcProject is expected (encountered " + boost::lexical_cast<std::string>(projects->size()) + "); unable to read unit information.");
+					Logger::Warning("A single IfcProject is expected (encountered " + boost::lexical_cast<std::string>(projects.size()) + "); unable to read unit information.");
 				}
 
 				// Set precision from file
@@ -177,11 +177,9 @@ namespace {
 				double lowest_precision_encountered = std::numeric_limits<double>::infinity();
 				bool any_precision_encountered = false;
 
-				IfcSchema::IfcGeometricRepresentationContext::list::it it;
-				IfcSchema::IfcGeometricRepresentationContext::list::ptr contexts =
-					file->instances_by_type_excl_subtypes<IfcSchema::IfcGeometricRepresentationContext>();
+				auto contexts = file->instances_by_type_excl_subtypes_range<IfcSchema::IfcGeometricRepresentationContext>();
 
-				for (it = contexts->begin(); it != contexts->end(); ++it) {
+				for (auto it = contexts.begin(); it != contexts.end(); ++it) {
 					IfcSchema::IfcGeometricRepresentationContext* context = *it;
 					if (context->Precision() && (*context->Precision() * unit_magnitude * 10.) < lowest_precision_encountered) {
 						// Some arbitrary factor that has proven to work better for the models in the set of test files.
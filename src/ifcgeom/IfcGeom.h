@@ -115,26 +115,28 @@ private:
 		std::set<typename std::conditional<std::is_pointer<LP>::value, LP, const LP*>::type> duplicates_;
 		std::map<const void*, int> vertex_mapping_;
 		std::map<std::pair<int, int>, TopoDS_Edge> edges_;
-		// not always in use
-		const std::vector<std::vector<double>>* points_ = nullptr;
+		// Not copied, for numeric spans the caller holds an attribute lease
+		// on the file for as long as the helper is used
+		const std::vector<CP>* points_;
 		double eps_;
 		bool non_manifold_;
 		
 		void loop_(const LP& lp, const std::function<void(int, int, bool)>& callback);
 
 		bool construct(const IfcSchema::IfcCartesianPoint* cp, gp_Pnt* l);
-		bool construct(const std::vector<double>& cp, gp_Pnt* l);
+		bool construct(const IfcParse::numeric_span<double>& cp, gp_Pnt* l);
 
 		const void* get_idx(const IfcSchema::IfcCartesianPoint* cp) {
 			return cp;
 		}
 
-		const void* get_idx(const std::vector<double>& cp) {
-			return &cp;
+		const void* get_idx(const IfcParse::numeric_span<double>& cp) {
+			return cp.begin();
 		}
 
 		std::vector<const void*> get_idxs(const IfcSchema::IfcPolyLoop* lp);
 		std::vector<const void*> get_idxs(const std::vector<int>& it);
+		std::vector<const void*> get_idxs(const IfcParse::numeric_span<int>& it);
 	public:
 		faceset_helper(
 			MAKE_TYPE_NAME(Kernel)* kernel, 
@@ -181,14 +181,14 @@ namespace IfcGeom {
         };
 
 		void initUnits() {
-			IfcSchema::IfcProject::list::ptr projects = ifc_file->instances_by_type<IfcSchema::IfcProject>();
-			if (projects->size() == 1) {
-				IfcSchema::IfcProject* project = *projects->begin();
+			auto projects = ifc_file->instances_by_type_range<IfcSchema::IfcProject>();
+			if (projects.size() == 1) {
+				IfcSchema::IfcProject* project = *projects.begin();
 				std::pair<std::string, double> length_unit = kernel.initializeUnits(project->UnitsInContext());
 				unit_name = length_unit.first;
 				unit_magnitude = length_unit.second;
 			} else {
-				Logger::Warning("A single IfcProject is expected (encountered " + boost::lexical_cast<std::string>(projects->size()) + "); unable to read unit information.");
+				Logger::Warning("A single IfcProject is expected (encountered " + boost::lexical_cast<std::string>(projects.size()) + "); unable to read unit information.");
 			}
 		}
 
@@ -409,9 +409,7 @@ namespace IfcGeom {
 					}
 				} while (++num_created, next());
 			} else {
-				IfcSchema::IfcProduct::list::ptr products = ifc_file->instances_by_type<IfcSchema::IfcProduct>();
-				for (IfcSchema::IfcProduct::list::it iter = products->begin(); iter != products->end(); ++iter) {
-					IfcSchema::IfcProduct* product = *iter;
+				for (IfcSchema::IfcProduct* product : ifc_file->instances_by_type_range<IfcSchema::IfcProduct>()) {
 					if (product->ObjectPlacement()) {
 						// Use a fresh trsf every time in order to prevent the result to be concatenated
 						gp_Trsf trsf;
@@ -518,13 +516,11 @@ namespace IfcGeom {
 
 			IfcSchema::IfcGeometricRepresentationContext::list::it it;
 			IfcSchema::IfcGeometricRepresentationSubContext::list::it jt;
-			IfcSchema::IfcGeometricRepresentationContext::list::ptr contexts =
-				ifc_file->instances_by_type<IfcSchema::IfcGeometricRepresentationContext>();
+			auto contexts = ifc_file->instances_by_type_range<IfcSchema::IfcGeometricRepresentationContext>();
 
 			IfcSchema::IfcGeometricRepresentationContext::list::ptr filtered_contexts (new IfcSchema::IfcGeometricRepresentationContext::list);
 
-			for (it = contexts->begin(); it != contexts->end(); ++it) {
-				IfcSchema::IfcGeometricRepresentationContext* context = *it;
+			for (IfcSchema::IfcGeometricRepresentationContext* context : contexts) {
 				if (context->declaration().is(IfcSchema::IfcGeometricRepresentationSubContext::Class())) {
 					// Continue, as the list of subcontexts will be considered
 					// by the parent's context inverse attributes.
@@ -550,8 +546,7 @@ namespace IfcGeom {
 			// In case no contexts are identified based on their ContextType, all contexts are
 			// considered. Note that sub contexts are excluded as they are considered later on.
 			if (filtered_contexts->size() == 0) {
-				for (it = contexts->begin(); it != contexts->end(); ++it) {
-					IfcSchema::IfcGeometricRepresentationContext* context = *it;
+				for (IfcSchema::IfcGeometricRepresentationContext* context : contexts) {
 					if (!context->declaration().is(IfcSchema::IfcGeometricRepresentationSubContext::Class())) {
 						filtered_contexts->push(context);
 					}
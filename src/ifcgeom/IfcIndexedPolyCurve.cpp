@@ -33,17 +33,22 @@
 bool IfcGeom::Kernel::convert(const IfcSchema::IfcIndexedPolyCurve* l, TopoDS_Wire& result) {
 	
 	IfcSchema::IfcCartesianPointList* point_list = l->Points();
-	std::vector< std::vector<double> > coordinates;
+	// See IfcGeom::Kernel::convert(const IfcSchema::IfcTriangulatedFaceSet*, TopoDS_Shape&)
+	IfcParse::IfcFile::attribute_lease lease(l->data().file);
+	std::vector< std::vector<double> > coordinates_storage;
+	std::vector< IfcParse::numeric_span<double> > coordinates;
 	if (point_list->as<IfcSchema::IfcCartesianPointList2D>()) {
-		coordinates = point_list->as<IfcSchema::IfcCartesianPointList2D>()->CoordList();
+		static const size_t coord_list_index = IfcSchema::IfcCartesianPointList2D::Class().attribute_index("CoordList");
+		coordinates = IfcParse::numeric_row_spans(point_list->data().getArgument(coord_list_index), coordinates_storage);
 	} else if (point_list->as<IfcSchema::IfcCartesianPointList3D>()) {
-		coordinates = point_list->as<IfcSchema::IfcCartesianPointList3D>()->CoordList();
+		static const size_t coord_list_index = IfcSchema::IfcCartesianPointList3D::Class().attribute_index("CoordList");
+		coordinates = IfcParse::numeric_row_spans(point_list->data().getArgument(coord_list_index), coordinates_storage);
 	}
 
 	std::vector<gp_Pnt> points;
 	points.reserve(coordinates.size());
-	for (std::vector< std::vector<double> >::const_iterator it = coordinates.begin(); it != coordinates.end(); ++it) {
-		const std::vector<double>& coords = *it;
+	for (auto it = coordinates.begin(); it != coordinates.end(); ++it) {
+		const IfcParse::numeric_span<double>& coords = *it;
 		points.push_back(gp_Pnt(
 			coords.size() < 1 ? 0. : coords[0] * getValue(GV_LENGTH_UNIT),
 			coords.size() < 2 ? 0. : coords[1] * getValue(GV_LENGTH_UNIT),
@@ -31,7 +31,15 @@
 
 bool IfcGeom::Kernel::convert(const IfcSchema::IfcPolygonalFaceSet* pfs, TopoDS_Shape& shape) {
 	IfcSchema::IfcCartesianPointList3D* point_list = pfs->Coordinates();
-	auto coord_list = point_list->CoordList();
+
+	// The coordinates are used in place when stored contiguously by the
+	// parser, otherwise they are copied into coord_list_storage. The lease
+	// keeps them from being freed to meet the memory budget of the file
+	// while the faces are read.
+	IfcParse::IfcFile::attribute_lease lease(pfs->data().file);
+	static const size_t coord_list_index = IfcSchema::IfcCartesianPointList3D::Class().attribute_index("CoordList");
+	std::vector<std::vector<double>> coord_list_storage;
+	auto coord_list = IfcParse::numeric_row_spans(point_list->data().getArgument(coord_list_index), coord_list_storage);
 	auto polygonal_faces = pfs->Faces();
 
 	std::vector<std::vector<int>> indices;
@@ -54,7 +62,7 @@ bool IfcGeom::Kernel::convert(const IfcSchema::IfcPolygonalFaceSet* pfs, TopoDS_
 	}
 
 	faceset_helper<
-		std::vector<double>,
+		IfcParse::numeric_span<double>,
 		std::vector<int>
 	> helper(this, coord_list, indices, pfs->Closed().get_value_or(false));
 
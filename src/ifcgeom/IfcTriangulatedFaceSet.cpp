@@ -29,12 +29,21 @@
 
 bool IfcGeom::Kernel::convert(const IfcSchema::IfcTriangulatedFaceSet* l, TopoDS_Shape& shape) {
 	IfcSchema::IfcCartesianPointList3D* point_list = l->Coordinates();
-	auto coord_list = point_list->CoordList();
-	std::vector<std::vector<int>> indices = l->CoordIndex();
+
+	// The coordinates and indices are used in place when stored contiguously
+	// by the parser, otherwise they are copied into these vectors. The lease
+	// keeps them from being freed to meet the memory budget of the file.
+	IfcParse::IfcFile::attribute_lease lease(l->data().file);
+	static const size_t coord_list_index = IfcSchema::IfcCartesianPointList3D::Class().attribute_index("CoordList");
+	static const size_t coord_index_index = IfcSchema::IfcTriangulatedFaceSet::Class().attribute_index("CoordIndex");
+	std::vector<std::vector<double>> coord_list_storage;
+	std::vector<std::vector<int>> indices_storage;
+	auto coord_list = IfcParse::numeric_row_spans(point_list->data().getArgument(coord_list_index), coord_list_storage);
+	auto indices = IfcParse::numeric_row_spans(l->data().getArgument(coord_index_index), indices_storage);
 
 	faceset_helper<
-		std::vector<double>,
-		std::vector<int>
+		IfcParse::numeric_span<double>,
+		IfcParse::numeric_span<int>
 	> helper(this, coord_list, indices, l->Closed().get_value_or(false));
 
 	TopTools_ListOfShape faces;
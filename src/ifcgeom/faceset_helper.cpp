@@ -27,16 +27,6 @@ namespace {
 	}
 }
 
-namespace {
-	const std::vector<std::vector<double>>* store_cache(const std::vector<std::vector<double>>& p) {
-		return &p;
-	}
-
-	const std::vector<std::vector<double>>* store_cache(const std::vector<const IfcSchema::IfcCartesianPoint*>& /*p*/) {
-		return nullptr;
-	}
-}
-
 template <typename CP, typename LP>
 IfcGeom::Kernel::faceset_helper<CP, LP>::faceset_helper(
 	Kernel* kernel,
@@ -45,8 +35,8 @@ IfcGeom::Kernel::faceset_helper<CP, LP>::faceset_helper(
 	bool should_be_closed
 )
 	: kernel_(kernel)
+	, points_(&points)
 	, non_manifold_(false)
-	, points_(store_cache(points))
 {
 	std::vector<std::unique_ptr<gp_Pnt>> pnts(std::distance(points.begin(), points.end()));
 	std::vector<TopoDS_Vertex> vertices(pnts.size());
@@ -232,6 +222,13 @@ std::vector<const void*> IfcGeom::Kernel::faceset_helper<CP, LP>::get_idxs(const
 	return idxs;
 }
 
+template <typename CP, typename LP>
+std::vector<const void*> IfcGeom::Kernel::faceset_helper<CP, LP>::get_idxs(const IfcParse::numeric_span<int>& it) {
+	std::vector<const void*> idxs;
+	std::transform(it.begin(), it.end(), std::back_inserter(idxs), [this](int i) { return get_idx((*points_)[i - 1]); });
+	return idxs;
+}
+
 template <typename CP, typename LP>
 bool IfcGeom::Kernel::faceset_helper<CP, LP>::edge(int A, int B, TopoDS_Edge& e) {
 	auto it = edges_.find({ A, B });
@@ -303,7 +300,7 @@ bool IfcGeom::Kernel::faceset_helper<CP, LP>::construct(const IfcSchema::IfcCart
 }
 
 template <typename CP, typename LP>
-bool IfcGeom::Kernel::faceset_helper<CP, LP>::construct(const std::vector<double>& cp, gp_Pnt* l) {
+bool IfcGeom::Kernel::faceset_helper<CP, LP>::construct(const IfcParse::numeric_span<double>& cp, gp_Pnt* l) {
 	if (cp.size() != 3) {
 		return false;
 	}
@@ -313,4 +310,5 @@ bool IfcGeom::Kernel::faceset_helper<CP, LP>::construct(const std::vector<double
 }
 
 template class IfcGeom::Kernel::faceset_helper<const IfcSchema::IfcCartesianPoint*, const IfcSchema::IfcPolyLoop*>;
-template class IfcGeom::Kernel::faceset_helper<std::vector<double>, std::vector<int>>;
\ No newline at end of file
+template class IfcGeom::Kernel::faceset_helper<IfcParse::numeric_span<double>, IfcParse::numeric_span<int>>;
+template class IfcGeom::Kernel::faceset_helper<IfcParse::numeric_span<double>, std::vector<int>>;
\ No newline at end of file
@@ -59,7 +59,7 @@ import sys
 import zipfile
 import tempfile
 from pathlib import Path
-from typing import Optional, Union
+from typing import Optional, Sequence, Union
 
 
 if hasattr(os, "uname"):
@@ -120,15 +120,26 @@ class SchemaError(Error):
     pass
 
 
-def open(path: Union[os.PathLike, str], format: Optional[str] = None, should_stream: bool = False) -> file:
+def open(
+    path: Union[os.PathLike, str],
+    format: Optional[str] = None,
+    should_stream: bool = False,
+    root_types: Optional[Sequence[str]] = None,
+) -> file:
     """Loads an IFC dataset from a filepath
 
     You can specify a file format. If no format is given, it is guessed from
     its extension. Currently supported specified format: .ifc | .ifcZIP |
-    .ifcXML.
+    .ifcXML. IFC-SPF files compressed with gzip or Zstandard are detected
+    from their contents and decompressed on demand.
 
     You can then filter by element ID, class, etc, and subscript by id or guid.
 
+    For IFC-SPF files, root_types limits loading to the instances of these
+    entity types (including their subtypes) and the instances they refer to,
+    directly or indirectly. Other instances, including the ones that only
+    refer to the loaded instances, are not available from the file.
+
     Example:
 
     .. code:: python
@@ -136,6 +147,7 @@ def open(path: Union[os.PathLike, str], format: Optional[str] = None, should_str
         model = ifcopenshell.open("/path/to/model.ifc")
         model = ifcopenshell.open("/path/to/model.ifcXML")
         model = ifcopenshell.open("/path/to/model.any_extension", ".ifc")
+        model = ifcopenshell.open("/path/to/model.ifc", root_types=["IfcWall"])
 
         products = model.by_type("IfcProduct")
         print(products[0].id(), products[0].GlobalId) # 122 2XQ$n5SLP5MBLyL442paFx
@@ -153,7 +165,13 @@ def open(path: Union[os.PathLike, str], format: Optional[str] = None, should_str
         with tempfile.TemporaryDirectory() as unzipped_path:
             with zipfile.ZipFile(path) as zf:
                 for name in zf.namelist():
-                    if Path(name).suffix.lower() in (".ifc", ".ifcxml"):
+                    suffix = Path(name).suffix.lower()
+                    if suffix == ".ifc":
+                        # Decompressed on demand directly from the archive when built with zlib support
+                        f = ifcopenshell_wrapper.open(str(path.absolute()))
+                        if f.good():
+                            return file(f)
+                    if suffix in (".ifc", ".ifcxml"):
                         return open(zf.extract(name, unzipped_path))
                 else:
                     raise LookupError(f"No .ifc or .ifcXML file found in {path}")
@@ -161,7 +179,10 @@ def open(path: Union[os.PathLike, str], format: Optional[str] = None, should_str
         return sqlite(path)
     if should_stream:
         return stream(path)
-    f = ifcopenshell_wrapper.open(str(path.absolute()))
+    if root_types is not None:
+        f = ifcopenshell_wrapper.open(str(path.absolute()), list(root_types))
+    else:
+        f = ifcopenshell_wrapper.open(str(path.absolute()))
     if f.good():
         return file(f)
     else:
@@ -176,6 +197,40 @@ def open(path: Union[os.PathLike, str], format: Optional[str] = None, should_str
         raise exc(msg)
 
 
+def probe(path: Union[os.PathLike, str], statistics: bool = False) -> dict:
+    """Reads the header of an IFC-SPF file without loading the model
+
+    This is considerably faster than :func:`open` and also works for files
+    with a schema that is not supported. Use it to inspect a file before
+    deciding how to process it.
+
+    The returned dictionary contains the ``status`` (one of ``READ_ERROR``,
+    ``NO_HEADER``, ``UNSUPPORTED_SCHEMA`` or 0 for success), the ``size`` of
+    the file contents in bytes, the ``schema_identifiers`` and the other
+    header attributes, such as ``name`` and ``originating_system``. The size
+    of compressed contents is 0 unless stored in the zip archive or when
+    ``statistics`` are requested.
+
+    :param path: The path to the IFC-SPF file, which can be gzip, zip or
+        Zstandard compressed
+    :param statistics: When set, the instances are also counted in a fast
+        pass over the file. This adds ``instance_count``, ``max_id`` and
+        ``entity_counts``, which maps upper case entity names to their
+        number of instances. The counts are approximate, as the instances
+        are not validated.
+    :return: A dictionary describing the file
+
+    Example:
+
+    .. code:: python
+
+        info = ifcopenshell.probe("/path/to/model.ifc", statistics=True)
+        print(info["schema_identifiers"]) # ('IFC4',)
+        print(info["entity_counts"]["IFCWALL"]) # 42
+    """
+    return ifcopenshell_wrapper.probe(str(Path(path).absolute()), statistics)
+
+
 def create_entity(type, schema="IFC4", *args, **kwargs):
     """Creates a new IFC entity that does not belong to an IFC file object
 
@@ -25,7 +25,7 @@ import operator
 import subprocess
 import sys
 import time
-from typing import Union, Any, Callable, TypeVar, overload
+from typing import Union, Any, Callable, Optional, TypeVar, overload
 
 from . import ifcopenshell_wrapper
 from . import settings
@@ -291,6 +291,24 @@ class entity_instance:
         attr_idx = attr if isinstance(attr, numbers.Integral) else self.wrapped_data.get_argument_index(attr)
         return self.wrapped_data.get_argument_type(attr_idx)
 
+    def attribute_buffer(self, attr: Union[int, str]) -> Optional[memoryview]:
+        """Return a read-only view of a list of lists of numbers, such as
+        IfcCartesianPointList3D.CoordList, without creating a Python object
+        for every value
+
+        The view has two dimensions, one row per point, and holds a copy of
+        the values, so it is not affected by later modifications. None is
+        returned when the values are not stored contiguously, e.g. when the
+        attribute has been set from Python or the rows differ in length.
+
+        :param attr: The index or name of the attribute
+        :type attr: Union[int, str]
+        :rtype: Optional[memoryview]
+        """
+        attr_idx = attr if isinstance(attr, numbers.Integral) else self.wrapped_data.get_argument_index(attr)
+        buffer = self.wrapped_data.get_argument_buffer(attr_idx)
+        return None if buffer is None else memoryview(buffer)
+
     def attribute_name(self, attr_idx: int) -> str:
         """Return the name of a positional attribute of the element
 
@@ -19,6 +19,8 @@
 import itertools
 import functools
 
+from collections import defaultdict
+
 
 def indent(n, s):
     if isinstance(s, str):
@@ -29,6 +31,60 @@ def indent(n, s):
     return "\n".join(" "*n + l for l in splitted)
 
 
+def keyword_hash(name):
+    # FNV-1a over the upper case name, needs to match the implementation in IfcSchema.cpp
+    h = 2166136261
+    for c in name.upper().encode("ascii"):
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def keyword_rehash(h, seed):
+    # Mixes the hash of a name with the displacement of its bucket, needs to
+    # match the implementation in IfcSchema.cpp
+    h = (h ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+
+def perfect_hash(names):
+    """
+    Builds a perfect hash for the names using hash and displace: names are
+    distributed over buckets by their hash, then for every bucket a seed is
+    found that, mixed into the hash, maps its names to slots that are still
+    free. Returns the seeds per bucket and the index of the name in every
+    slot (or -1).
+    """
+    num_buckets = max(1, len(names) // 4)
+    num_slots = max(1, len(names) + len(names) // 4)
+
+    hashes = list(map(keyword_hash, names))
+    buckets = defaultdict(list)
+    for i, h in enumerate(hashes):
+        buckets[h % num_buckets].append(i)
+
+    displacements = [0] * num_buckets
+    slots = [-1] * num_slots
+
+    for b, indices in sorted(buckets.items(), key=lambda p: -len(p[1])):
+        for seed in range(1, 1 << 16):
+            positions = [keyword_rehash(hashes[i], seed) % num_slots for i in indices]
+            if len(set(positions)) == len(positions) and all(slots[p] == -1 for p in positions):
+                break
+        else:
+            raise ValueError("Unable to construct keyword hash table")
+        displacements[b] = seed
+        for i, p in zip(indices, positions):
+            slots[p] = i
+
+    return displacements, slots
+
+
 class Base:
     """
     A base class for all code generation classes. Currently only working around
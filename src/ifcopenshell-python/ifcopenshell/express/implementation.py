@@ -43,7 +43,7 @@ class Implementation(codegen.Base):
 
         for name, enum in mapping.schema.enumerations.items():
             short_name = name[:-4] if name.endswith("Enum") else name
-            context = locals()
+            displacements, slots = codegen.perfect_hash(enum.values)
             write(
                 templates.enumeration_function,
                 max_id=len(enum.values),
@@ -51,8 +51,12 @@ class Implementation(codegen.Base):
                 schema_name=schema_name,
                 schema_name_upper=schema_name_upper,
                 values=catc(map(stringify, enum.values)),
-                from_string_statements=catnl(
-                    templates.enum_from_string_stmt % dict(context, **locals()) for value in enum.values
+                num_buckets=len(displacements),
+                num_slots=len(slots),
+                keyword_displacements=catc(map(str, displacements)),
+                keyword_slots=catc(map(str, slots)),
+                values_by_item=catc(
+                    "%s_%s" % (short_name, value) for value in sorted(enum.values)
                 ),
             )
             
@@ -269,7 +269,7 @@ __attribute__((optnone))
             self.statements.append("    declarations.push_back(%(schema_name)s_%(type_name)s_type);" % locals())
 
         self.statements.append(
-            '    return new schema_definition("%(schema_name)s", declarations, new %(schema_name)s_instance_factory());'
+            '    return new schema_definition("%(schema_name)s", declarations, new %(schema_name)s_instance_factory(), &%(schema_name)s_keywords);'
             % locals()
         )
 
@@ -325,6 +325,16 @@ __attribute__((optnone))
             )
         )
 
+        displacements, slots = codegen.perfect_hash(self.names)
+        num_buckets, num_slots = len(displacements), len(slots)
+
+        def format_table(values):
+            values = list(map(str, values))
+            return ",\n".join("    " + ", ".join(values[i : i + 16]) for i in range(0, len(values), 16))
+
+        keyword_displacements = format_table(displacements)
+        keyword_slots = format_table(slots)
+
         self.statements[self.statements.index("{factory_placeholder}")] = (
             """
 class %(schema_name)s_instance_factory : public IfcParse::instance_factory {
@@ -332,6 +342,16 @@ class %(schema_name)s_instance_factory : public IfcParse::instance_factory {
         %(instance_mapping)s
     }
 };
+
+static const uint16_t %(schema_name)s_keyword_displacements[%(num_buckets)d] = {
+%(keyword_displacements)s
+};
+
+static const int16_t %(schema_name)s_keyword_slots[%(num_slots)d] = {
+%(keyword_slots)s
+};
+
+static const keyword_table %(schema_name)s_keywords = { %(schema_name)s_keyword_displacements, %(num_buckets)d, %(schema_name)s_keyword_slots, %(num_slots)d };
 """
             % locals()
         )
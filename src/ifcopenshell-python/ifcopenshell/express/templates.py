@@ -152,6 +152,7 @@ public:
     typedef enum {%(values)s} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -206,12 +207,24 @@ const char* %(schema_name)s::%(name)s::ToString(Value v) {
 }
 
 %(schema_name)s::%(name)s::Value %(schema_name)s::%(name)s::FromString(const std::string& s) {
-%(from_string_statements)s
+    static const uint16_t displacements[] = { %(keyword_displacements)s };
+    static const int16_t slots[] = { %(keyword_slots)s };
+    static const IfcParse::keyword_table keywords = { displacements, %(num_buckets)d, slots, %(num_slots)d };
+    const int i = keywords.lookup(s.data(), s.size());
+    if (i >= 0 && s == ToString((Value) i)) return (Value) i;
     throw IfcException("Unable to find keyword in schema: " + s);
 }
 
+%(schema_name)s::%(name)s::Value %(schema_name)s::%(name)s::FromArgument(const Argument& a) {
+    // Values resolved while parsing are stored by their offset in the sorted enumeration items
+    static const Value by_item[] = { %(values_by_item)s };
+    const int i = a.enumeration_index();
+    if (i >= 0 && i < %(max_id)d) return by_item[i];
+    return FromString(a);
+}
+
 %(schema_name)s::%(name)s::operator %(schema_name)s::%(name)s::Value() const {
-    return FromString((std::string) *data_->getArgument(0));
+    return FromArgument(*data_->getArgument(0));
 }
 """
 
@@ -241,8 +254,6 @@ list_list_type = "aggregate_of_aggregate_of< %(instance_type)s >::ptr"
 untyped_list = "aggregate_of_instance::ptr"
 inverse_attr = "aggregate_of< %(entity)s >::ptr %(name)s() const; // INVERSE %(entity)s::%(attribute)s"
 
-enum_from_string_stmt = '    if (s == "%(value)s") return ::%(schema_name)s::%(name)s::%(short_name)s_%(value)s;'
-
 schema_entity_stmt = "        case Type::%(name)s: return new %(name)s(e); break;"
 string_map_statement = '    string_map["%(uppercase_name)s"%(padding)s] = Type::%(name)s;'
 parent_type_stmt = "    if(v==%(name)s%(padding)s) { return %(parent)s; }"
@@ -252,7 +263,7 @@ parent_type_test = " || %s::is(v)"
 optional_attr_stmt = "return !data_->getArgument(%(index)d)->isNull();"
 
 get_attr_stmt = "%(null_check)s %(non_optional_type)s v = *data_->getArgument(%(index)d); return v;"
-get_attr_stmt_enum = "%(null_check)s return %(non_optional_type)s::FromString(*data_->getArgument(%(index)d));"
+get_attr_stmt_enum = "%(null_check)s return %(non_optional_type)s::FromArgument(*data_->getArgument(%(index)d));"
 get_attr_stmt_entity = "%(null_check)s return ((IfcUtil::IfcBaseClass*)(*data_->getArgument(%(index)d)))->as<%(non_optional_type_no_pointer)s>(true);"
 get_attr_stmt_array = "%(null_check)s aggregate_of_instance::ptr es = *data_->getArgument(%(index)d); return es->as< %(list_instance_type)s >();"
 get_attr_stmt_nested_array = "%(null_check)s aggregate_of_aggregate_of_instance::ptr es = *data_->getArgument(%(index)d); return es->as< %(list_instance_type)s >();"
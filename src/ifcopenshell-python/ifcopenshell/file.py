@@ -268,6 +268,20 @@ class file:
         while len(self.history) > self.history_size:
             self.history.pop(0)
 
+    def set_memory_budget(self, budget: int) -> None:
+        """Limit the memory used by the attributes of instances read from file
+
+        When the attributes of the instances accessed exceed approximately
+        budget bytes, those of unmodified instances that have not been
+        accessed recently are released and read from file again on their
+        next access. Instances accessed before the budget is set are not
+        released.
+
+        :param budget: The number of bytes, 0 (the default) for no limit
+        :type budget: int
+        """
+        self.wrapped_data.memory_budget(budget)
+
     def begin_transaction(self) -> None:
         if self.history_size:
             self.transaction = Transaction(self)
@@ -476,6 +490,54 @@ class file:
             return [entity_instance(e, self) for e in self.wrapped_data.by_type(type)]
         return [entity_instance(e, self) for e in self.wrapped_data.by_type_excl_subtypes(type)]
 
+    def by_attribute(
+        self, type: str, attribute: str, value: Union[str, int, float, bool, ifcopenshell.entity_instance]
+    ) -> list[ifcopenshell.entity_instance]:
+        """Return IFC objects of an IFC Type of which an attribute has the given value.
+
+        The first query for an attribute of a type builds an index of the values of
+        that attribute, which is reused by later queries until an instance of the
+        type is added, removed or has that attribute changed. Strings also match
+        enumeration values, numbers match integer and real values alike and typed
+        values, e.g. IfcLabel, match the value they wrap.
+
+        :param type: The case insensitive type of IFC class to return, including subtypes.
+        :type type: string
+        :param attribute: The name of the attribute to compare.
+        :type attribute: string
+        :param value: The value to compare the attribute to.
+        :type value: str|int|float|bool|ifcopenshell.entity_instance
+
+        :raises RuntimeError: If `type` is not an entity or `attribute` is not found on it.
+        :raises OverflowError: If `value` is an integer beyond 2^53 in magnitude,
+            which cannot be compared to real values exactly.
+
+        :returns: A list of ifcopenshell.entity_instance objects
+        :rtype: list[ifcopenshell.entity_instance]
+        """
+        if isinstance(value, entity_instance):
+            value = value.wrapped_data
+        return [entity_instance(e, self) for e in self.wrapped_data.by_attribute_value(type, attribute, value)]
+
+    def by_attribute_prefix(self, type: str, attribute: str, prefix: str) -> list[ifcopenshell.entity_instance]:
+        """Return IFC objects of an IFC Type of which a string or enumeration attribute starts with the given prefix.
+
+        Uses the same index as by_attribute().
+
+        :param type: The case insensitive type of IFC class to return, including subtypes.
+        :type type: string
+        :param attribute: The name of the attribute to compare.
+        :type attribute: string
+        :param prefix: The start of the attribute value.
+        :type prefix: string
+
+        :raises RuntimeError: If `type` is not an entity or `attribute` is not found on it.
+
+        :returns: A list of ifcopenshell.entity_instance objects
+        :rtype: list[ifcopenshell.entity_instance]
+        """
+        return [entity_instance(e, self) for e in self.wrapped_data.by_attribute_prefix(type, attribute, prefix)]
+
     def traverse(
         self, inst: ifcopenshell.entity_instance, max_levels=None, breadth_first=False
     ) -> list[ifcopenshell.entity_instance]:
@@ -500,6 +562,29 @@ class file:
 
         return [entity_instance(e, self) for e in fn(inst.wrapped_data, max_levels)]
 
+    def traverse_many(
+        self, insts: list[ifcopenshell.entity_instance], max_levels=None
+    ) -> list[ifcopenshell.entity_instance]:
+        """Get a list of all instances referenced by any of the instances including themselves
+
+        Equivalent to combining the results of traverse() for every instance,
+        but every instance is only returned once. Without max_levels every
+        instance is also only visited once.
+
+        :param insts: The entity instances to get all sub instances
+        :type insts: list[ifcopenshell.entity_instance]
+        :param max_levels: How far deep to recursively fetch sub instances. None or -1 means infinite.
+        :type max_levels: None|int
+        :returns: A list of ifcopenshell.entity_instance objects
+        :rtype: list[ifcopenshell.entity_instance]
+        """
+        if max_levels is None:
+            max_levels = -1
+
+        return [
+            entity_instance(e, self) for e in self.wrapped_data.traverse_many([i.wrapped_data for i in insts], max_levels)
+        ]
+
     def get_inverse(
         self, inst: ifcopenshell.entity_instance, allow_duplicate: bool = False, with_attribute_indices: bool = False
     ) -> list[ifcopenshell.entity_instance]:
@@ -512,7 +597,9 @@ class file:
 
         :param inst: The entity instance to get inverse relationships
         :type inst: ifcopenshell.entity_instance
-        :param allow_duplicate: Returns a `list` when True, `set` when False
+        :param allow_duplicate: Returns a `list` when True, `set` when False.
+           The list is in the order in which the references were read from
+           file or assigned, an entity is repeated for every reference.
         :param with_attribute_indices: Returns pairs of <i, idx>
            where i[idx] is inst or contains inst. Requires allow_duplicate=True
         :returns: A list of ifcopenshell.entity_instance objects
@@ -575,7 +662,13 @@ class file:
     def __iter__(self) -> Generator[ifcopenshell.entity_instance, None, None]:
         return iter(self[id] for id in self.wrapped_data.entity_names())
 
-    def write(self, path: "os.PathLike | str", format: Optional[str] = None, zipped: bool = False) -> None:
+    def write(
+        self,
+        path: "os.PathLike | str",
+        format: Optional[str] = None,
+        zipped: bool = False,
+        threads: Optional[int] = None,
+    ) -> None:
         """Write ifc model to file.
 
         :param format: Force use of a specific format. Guessed from file name
@@ -585,6 +678,9 @@ class file:
         :type format: str
         :param zipped: zip the file after it is written
         :type zipped: bool
+        :param threads: Number of threads used to format the instances of an
+            .ifc file, by default the number of processors
+        :type threads: int
 
         Example:
 
@@ -611,8 +707,10 @@ class file:
                 unzipped_path.unlink()
             return
         if format == ".ifcZIP":
-            return self.write(path, ".ifc", zipped=True)
-        self.wrapped_data.write(str(path))
+            return self.write(path, ".ifc", zipped=True, threads=threads)
+        if threads is None:
+            threads = os.cpu_count() or 1
+        self.wrapped_data.write(str(path), threads)
         if zipped:
             unzipped_path = path.with_suffix(format)
             path.rename(unzipped_path)
@@ -67,3 +67,17 @@ class IFC2X3:
 
         ifcopenshell.api.pre_listeners = {}
         ifcopenshell.api.post_listeners = {}
+
+
+def spf(data: str, schema: str = "IFC4") -> str:
+    """Wraps the instances in data in a minimal IFC-SPF header and footer"""
+    return (
+        "ISO-10303-21;\n"
+        "HEADER;\n"
+        "FILE_DESCRIPTION(('ViewDefinition [CoordinationView]'),'2;1');\n"
+        "FILE_NAME('','',(),(),'','','');\n"
+        "FILE_SCHEMA(('%s'));\n"
+        "ENDSEC;\n"
+        "DATA;\n%sENDSEC;\n"
+        "END-ISO-10303-21;\n" % (schema, data)
+    )
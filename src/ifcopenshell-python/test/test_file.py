@@ -220,6 +220,26 @@ class TestFile(test.bootstrap.IFC4):
         element = self.file.createIfcWall(OwnerHistory=owner)
         assert self.file.traverse(element, max_levels=1) == [element, owner]
 
+    def test_traversing_an_element_referencing_a_sparse_id(self):
+        owner = self.file.create_entity("IfcOwnerHistory", id=2000000000)
+        element = self.file.createIfcWall(OwnerHistory=owner)
+        assert self.file.traverse(element) == [element, owner]
+        assert self.file.traverse_many([element, owner]) == [element, owner]
+
+    def test_traversing_many_elements_is_the_union_of_traversing_each_element(self):
+        app = self.file.createIfcApplication()
+        owner = self.file.createIfcOwnerHistory(OwningApplication=app)
+        placement = self.file.createIfcLocalPlacement()
+        wall = self.file.createIfcWall(OwnerHistory=owner)
+        slab = self.file.createIfcSlab(OwnerHistory=owner, ObjectPlacement=placement)
+        door = self.file.createIfcDoor()
+        roots = [wall, slab, owner, door, wall]
+        for max_levels in (None, 1):
+            expected = []
+            for root in roots:
+                expected.extend(e for e in self.file.traverse(root, max_levels=max_levels) if e not in expected)
+            assert self.file.traverse_many(roots, max_levels=max_levels) == expected
+
     def test_getting_inverse_references_of_an_element(self):
         owner = self.file.createIfcOwnerHistory()
         element = self.file.createIfcWall(OwnerHistory=owner)
@@ -230,6 +250,27 @@ class TestFile(test.bootstrap.IFC4):
         owner = self.file.createIfcOwnerHistory(OwningUser=user, LastModifyingUser=user)
         assert self.file.get_inverse(user, allow_duplicate=True) == [owner, owner]
 
+    def test_getting_inverses_in_the_order_the_references_are_read_and_assigned(self):
+        f = ifcopenshell.file.from_string(
+            test.bootstrap.spf(
+                "#1=IFCCARTESIANPOINT((0.,0.,0.));\n"
+                "#2=IFCDIRECTION((1.,0.,0.));\n"
+                "#3=IFCCARTESIANTRANSFORMATIONOPERATOR3D(#2,$,#1,$,#2);\n"
+                "#4=IFCPOLYLINE((#1,#1));\n"
+                "#5=IFCAXIS2PLACEMENT3D(#1,#2,$);\n"
+            )
+        )
+        point, direction, operator, polyline, placement = (f.by_id(i) for i in range(1, 6))
+        assert f.get_inverse(point, allow_duplicate=True) == [operator, polyline, polyline, placement]
+        assert f.get_inverse(direction, allow_duplicate=True, with_attribute_indices=True) == [
+            (operator, 0),
+            (operator, 4),
+            (placement, 1),
+        ]
+        new_placement = f.createIfcAxis2Placement3D(Location=point)
+        f.remove(polyline)
+        assert f.get_inverse(point, allow_duplicate=True) == [operator, placement, new_placement]
+
     def test_removing_an_element(self):
         element = self.file.createIfcWall(GlobalId="global_id")
         self.file.remove(element)
@@ -275,7 +316,100 @@ class TestFile(test.bootstrap.IFC4):
         self.file.unbatch()
         assert len(list(self.file)) == 0
 
+    def test_getting_elements_by_attribute(self):
+        wall = self.file.createIfcWall(Name="foo", PredefinedType="SHEAR")
+        wall2 = self.file.createIfcWall(Name="bar", PredefinedType="SHEAR")
+        slab = self.file.createIfcSlab(Name="foo")
+        assert self.file.by_attribute("IfcWall", "Name", "foo") == [wall]
+        assert self.file.by_attribute("IfcElement", "Name", "foo") == [wall, slab]
+        assert self.file.by_attribute("IfcWall", "PredefinedType", "SHEAR") == [wall, wall2]
+        assert self.file.by_attribute("IfcWall", "Name", "baz") == []
+
+    def test_getting_elements_by_an_instance_attribute(self):
+        owner = self.file.createIfcOwnerHistory()
+        wall = self.file.createIfcWall(OwnerHistory=owner)
+        self.file.createIfcWall()
+        assert self.file.by_attribute("IfcWall", "OwnerHistory", owner) == [wall]
+
+    def test_getting_elements_by_a_numeric_attribute(self):
+        circle = self.file.createIfcCircle(Radius=2.0)
+        self.file.createIfcCircle(Radius=3.0)
+        assert self.file.by_attribute("IfcCircle", "Radius", 2.0) == [circle]
+        assert self.file.by_attribute("IfcCircle", "Radius", 2) == [circle]
+
+    def test_getting_elements_by_negative_zero(self):
+        circle = self.file.createIfcCircle(Radius=-0.0)
+        self.file.createIfcCircle(Radius=1.0)
+        assert self.file.by_attribute("IfcCircle", "Radius", 0.0) == [circle]
+        assert self.file.by_attribute("IfcCircle", "Radius", 0) == [circle]
+        assert self.file.by_attribute("IfcCircle", "Radius", -0.0) == [circle]
+
+    def test_getting_elements_by_an_integer_out_of_range(self):
+        self.file.createIfcCircle(Radius=2.0)
+        assert self.file.by_attribute("IfcCircle", "Radius", 2**40) == []
+        with pytest.raises(OverflowError):
+            self.file.by_attribute("IfcCircle", "Radius", 2**53 + 1)
+        with pytest.raises(OverflowError):
+            self.file.by_attribute("IfcCircle", "Radius", -(2**70))
+
+    def test_getting_elements_by_an_attribute_prefix(self):
+        wall = self.file.createIfcWall(Name="Wall-001")
+        wall2 = self.file.createIfcWall(Name="Wall-002")
+        wall3 = self.file.createIfcWall(Name="Slab-001")
+        self.file.createIfcWall()
+        assert self.file.by_attribute_prefix("IfcWall", "Name", "Wall-") == [wall, wall2]
+        assert self.file.by_attribute_prefix("IfcWall", "Name", "") == [wall, wall2, wall3]
+
+    def test_getting_elements_by_an_invalid_attribute(self):
+        self.file.createIfcWall()
+        with pytest.raises(RuntimeError):
+            self.file.by_attribute("IfcWall", "Foo", "foo")
+        with pytest.raises(RuntimeError):
+            self.file.by_attribute("IfcLabel", "Name", "foo")
+
+    def test_getting_elements_by_attribute_after_editing_the_attribute(self):
+        wall = self.file.createIfcWall(Name="foo")
+        assert self.file.by_attribute("IfcWall", "Name", "foo") == [wall]
+        wall.Name = "bar"
+        assert self.file.by_attribute("IfcWall", "Name", "foo") == []
+        assert self.file.by_attribute("IfcWall", "Name", "bar") == [wall]
+
+    def test_getting_elements_by_attribute_after_adding_and_removing_elements(self):
+        wall = self.file.createIfcWall(Name="foo")
+        assert self.file.by_attribute("IfcWall", "Name", "foo") == [wall]
+        wall2 = self.file.createIfcWall(Name="foo")
+        assert self.file.by_attribute("IfcWall", "Name", "foo") == [wall, wall2]
+        self.file.remove(wall)
+        assert self.file.by_attribute("IfcWall", "Name", "foo") == [wall2]
+        self.file.batch()
+        self.file.remove(wall2)
+        self.file.unbatch()
+        assert self.file.by_attribute("IfcWall", "Name", "foo") == []
+
     def test_creating_ifc_data_from_a_string(self):
         element = self.file.createIfcWall()
         g = ifcopenshell.file.from_string(self.file.wrapped_data.to_string())
         assert g.by_id(1).is_a("IfcWall")
+
+
+class TestMemoryBudget:
+    def setup_method(self):
+        data = "".join("#%d=IFCCARTESIANPOINT((%d.,0.5,-1.E-3));\n" % (i, i) for i in range(1, 2001))
+        data += "#2001=IFCPOLYLINE((%s));\n" % ",".join("#%d" % i for i in range(1, 2001))
+        self.file = ifcopenshell.file.from_string(test.bootstrap.spf(data))
+        self.file.set_memory_budget(4096)
+
+    def test_reading_instances_again_after_their_attributes_are_released(self):
+        for _ in range(2):
+            for i in range(1, 2001):
+                assert self.file.by_id(i).Coordinates == (float(i), 0.5, -0.001)
+                assert self.file.wrapped_data.memory_usage() <= 2 * 4096
+        assert [p.id() for p in self.file.by_id(2001).Points] == list(range(1, 2001))
+
+    def test_modified_instances_are_not_released(self):
+        point = self.file.by_id(1)
+        point.Coordinates = (7.0, 8.0, 9.0)
+        for i in range(2, 2001):
+            self.file.by_id(i).Coordinates
+        assert self.file.by_id(1).Coordinates == (7.0, 8.0, 9.0)
+        assert "#1=IFCCARTESIANPOINT((7.,8.,9.));" in self.file.to_string()
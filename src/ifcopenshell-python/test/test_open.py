@@ -16,12 +16,18 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with IfcOpenShell.  If not, see <http://www.gnu.org/licenses/>.
 
+import collections
+import gzip
+import os
+import tempfile
 from pathlib import Path
 import pytest
 import ifcopenshell
+import ifcopenshell.guid
 
 
 TEST_FILE_DIR = Path("../../test/input/")
+FIXTURES_DIR = Path(os.path.dirname(__file__)) / "fixtures"
 
 
 class TestOpen:
@@ -63,6 +69,45 @@ class TestOpen:
             ".ifcXML",
         )
 
+    def test_open_gzip_compressed_ifcspf(self):
+        # Spans several of the blocks that are decompressed on demand
+        model = ifcopenshell.file(schema="IFC4")
+        for i in range(50000):
+            model.createIfcCartesianPoint((float(i), 0.5, 1.0))
+        data = model.to_string().split("DATA;")[1]
+        with tempfile.TemporaryDirectory() as temp_dir:
+            path = Path(temp_dir) / "model.ifc"
+            with gzip.open(path, "wb") as f:
+                f.write(model.to_string().encode())
+            compressed = ifcopenshell.open(path)
+            assert compressed[25000].Coordinates == (24999.0, 0.5, 1.0)
+            assert compressed.to_string().split("DATA;")[1] == data
+            info = ifcopenshell.probe(path, statistics=True)
+            assert info["status"] == 0
+            assert info["entity_counts"] == {"IFCCARTESIANPOINT": 50000}
+            del compressed
+
+    def test_open_only_the_instances_of_root_types(self):
+        model = ifcopenshell.file(schema="IFC4")
+        point = model.createIfcCartesianPoint((0.0, 0.0, 0.0))
+        placement = model.createIfcLocalPlacement(None, model.createIfcAxis2Placement3D(point))
+        wall = model.createIfcWall(ifcopenshell.guid.new(), ObjectPlacement=placement)
+        unrelated = model.createIfcCartesianPoint((1.0, 0.0, 0.0))
+        model.createIfcPolyline((point, unrelated))
+        model.createIfcSlab(ifcopenshell.guid.new())
+        with tempfile.TemporaryDirectory() as temp_dir:
+            path = Path(temp_dir) / "model.ifc"
+            model.write(path)
+            f = ifcopenshell.open(path, root_types=["IfcWall"])
+            assert sorted(e.id() for e in f) == sorted(e.id() for e in model.traverse(wall))
+            assert f.by_guid(wall.GlobalId).ObjectPlacement.RelativePlacement.Location.id() == point.id()
+            assert f.by_type("IfcPolyline") == []
+            assert f.by_type("IfcSlab") == []
+            with pytest.raises(RuntimeError):
+                f.by_id(unrelated.id())
+            assert [e.id() for e in f.get_inverse(f.by_id(point.id()))] == [placement.RelativePlacement.id()]
+            del f
+
     def test_invalid_ifcspf(self):
         with pytest.raises(ifcopenshell.Error):
             assert ifcopenshell.open(TEST_FILE_DIR / "invalid.ifc")
@@ -70,3 +115,111 @@ class TestOpen:
     def test_invalid_ifcxml(self):
         with pytest.raises(IOError):
             assert ifcopenshell.open(TEST_FILE_DIR / "invalid.ifcxml")
+
+
+class TestPersistentIndex:
+    def setup_method(self):
+        ifcopenshell.ifcopenshell_wrapper.file.persistent_index(True)
+        self.temp_dir = tempfile.TemporaryDirectory()
+        self.path = Path(self.temp_dir.name) / "model.ifc"
+        model = ifcopenshell.file(schema="IFC4")
+        points = [model.createIfcCartesianPoint((float(i), 0.5, 1.0)) for i in range(1000)]
+        model.createIfcPolyline(points[0:3])
+        model.createIfcWall(ifcopenshell.guid.new(), Name="Wall")
+        model.write(self.path)
+
+    def teardown_method(self):
+        ifcopenshell.ifcopenshell_wrapper.file.persistent_index(False)
+        self.temp_dir.cleanup()
+
+    def index(self):
+        return Path(str(self.path) + ".idx").read_bytes()
+
+    def test_opening_a_file_from_its_index_is_equivalent_to_scanning_it(self):
+        scanned = ifcopenshell.open(self.path)
+        index = self.index()
+        indexed = ifcopenshell.open(self.path)
+        assert self.index() == index
+        assert indexed.to_string() == scanned.to_string()
+        assert [e.id() for e in indexed.by_type("IfcCartesianPoint")] == [e.id() for e in scanned.by_type("IfcCartesianPoint")]
+        assert [e.id() for e in indexed.get_inverse(indexed.by_id(2))] == [e.id() for e in scanned.get_inverse(scanned.by_id(2))]
+        wall = scanned.by_type("IfcWall")[0]
+        assert indexed.by_guid(wall.GlobalId).id() == wall.id()
+
+    def test_an_index_of_a_changed_file_is_not_used_and_written_again(self):
+        ifcopenshell.open(self.path)
+        index = self.index()
+        # The same size and modification time, only the contents differ
+        stat = self.path.stat()
+        self.path.write_bytes(self.path.read_bytes().replace(b"IFCPOLYLINE((#1,#2,#3))", b"IFCPOLYLINE((#3,#2,#1))"))
+        os.utime(self.path, ns=(stat.st_atime_ns, stat.st_mtime_ns))
+        assert self.path.stat().st_size == stat.st_size
+        f = ifcopenshell.open(self.path)
+        assert [p.id() for p in f.by_type("IfcPolyline")[0].Points] == [3, 2, 1]
+        assert self.index() != index
+
+    def test_an_index_of_a_touched_file_is_not_used_and_written_again(self):
+        ifcopenshell.open(self.path)
+        index = self.index()
+        stat = self.path.stat()
+        os.utime(self.path, ns=(stat.st_atime_ns, stat.st_mtime_ns + 1000000000))
+        f = ifcopenshell.open(self.path)
+        assert len(f.by_type("IfcCartesianPoint")) == 1000
+        assert self.index() != index
+
+
+class TestProbe:
+    @pytest.mark.parametrize(
+        "path",
+        [
+            FIXTURES_DIR / "units" / "beam-standard-case.ifc",
+            FIXTURES_DIR / "units" / "polygonal-faces.ifc",
+            FIXTURES_DIR / "rules" / "fail-2-projects-ifc2x3.ifc",
+            FIXTURES_DIR / "bug_2517_lib.ifc",
+        ],
+    )
+    def test_probing_is_consistent_with_opening(self, path):
+        info = ifcopenshell.probe(path, statistics=True)
+        f = ifcopenshell.open(path)
+        header = f.wrapped_data.header
+        assert info["status"] == 0
+        assert info["size"] == os.path.getsize(path)
+        assert info["schema_identifiers"] == tuple(header.file_schema.schema_identifiers)
+        assert info["schema_identifiers"][0].upper() == f.schema_identifier.upper()
+        assert info["description"] == tuple(header.file_description.description)
+        assert info["implementation_level"] == header.file_description.implementation_level
+        assert info["name"] == header.file_name.name
+        assert info["time_stamp"] == header.file_name.time_stamp
+        assert info["author"] == tuple(header.file_name.author)
+        assert info["organization"] == tuple(header.file_name.organization)
+        assert info["preprocessor_version"] == header.file_name.preprocessor_version
+        assert info["originating_system"] == header.file_name.originating_system
+        assert info["authorization"] == header.file_name.authorization
+        instances = list(f)
+        assert info["instance_count"] == len(instances)
+        assert info["max_id"] == max(e.id() for e in instances)
+        assert info["entity_counts"] == collections.Counter(e.is_a().upper() for e in instances)
+
+    def test_probing_a_file_that_is_read_in_several_blocks(self):
+        model = ifcopenshell.file(schema="IFC4")
+        for i in range(50000):
+            model.createIfcCartesianPoint((float(i), 0.5, 1.0))
+        model.createIfcPropertySingleValue("a;'b", None, model.createIfcLabel("x;y"))
+        with tempfile.TemporaryDirectory() as temp_dir:
+            path = Path(temp_dir) / "model.ifc"
+            model.write(path)
+            info = ifcopenshell.probe(path, statistics=True)
+            assert info["status"] == 0
+            assert info["size"] == os.path.getsize(path)
+            assert info["instance_count"] == 50001
+            assert info["max_id"] == 50001
+            assert info["entity_counts"] == {"IFCCARTESIANPOINT": 50000, "IFCPROPERTYSINGLEVALUE": 1}
+
+    def test_probing_without_statistics(self):
+        info = ifcopenshell.probe(FIXTURES_DIR / "units" / "polygonal-faces.ifc")
+        assert info["schema_identifiers"] == ("IFC4",)
+        assert "instance_count" not in info
+
+    def test_probing_a_file_that_does_not_exist(self):
+        info = ifcopenshell.probe(FIXTURES_DIR / "does-not-exist.ifc")
+        assert info["status"] != 0
@@ -0,0 +1,102 @@
+# IfcOpenShell - IFC toolkit and geometry engine
+# Copyright (C) 2021 Thomas Krijnen <thomas@aecgeeks.com>
+#
+# This file is part of IfcOpenShell.
+#
+# IfcOpenShell is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# IfcOpenShell is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with IfcOpenShell.  If not, see <http://www.gnu.org/licenses/>.
+
+import struct
+import test.bootstrap
+import ifcopenshell
+
+
+# Literals around the limits of the exact fast path of the real number
+# parser (at most 2^53 for the significand and 10^22 for the power of ten),
+# with more significant digits than it handles and subnormals, which are
+# parsed by strtod() instead. Python's float() is correctly rounded as well.
+REALS = [
+    "0.",
+    "-0.",
+    "1.",
+    "1.E5",
+    "-1.E-5",
+    "1.5E+3",
+    "0.1",
+    "0.30000000000000004",
+    "123456.789",
+    "9007199254740992.",
+    "9007199254740993.",
+    "9007199254740994.",
+    "18014398509481985.",
+    "1.E22",
+    "1.E23",
+    "1.E-22",
+    "1.E-23",
+    "9007199254740991.E22",
+    "9007199254740991.E-22",
+    "123.E20",
+    "123.E21",
+    "1234567890123456789.",
+    "12345678901234567890.",
+    "1.2345678901234567890123",
+    "0.000000000000000000000000000001",
+    "3.14159265358979323846264338327950288",
+    "2.2250738585072014E-308",
+    "2.2250738585072011E-308",
+    "4.9E-324",
+    "2.4E-324",
+    "1.E-400",
+    "1.7976931348623157E308",
+    "-1.7976931348623157E308",
+    "1.E308",
+    "2.E-7",
+]
+
+
+def bits(value):
+    return struct.pack("<d", value)
+
+
+class TestParseReal:
+    def test_parsing_reals_is_correctly_rounded(self):
+        data = "".join("#%d=IFCCARTESIANPOINT((%s,0.,0.));\n" % (i, literal) for i, literal in enumerate(REALS, start=1))
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(data))
+        for i, literal in enumerate(REALS, start=1):
+            assert bits(f.by_id(i).Coordinates[0]) == bits(float(literal)), literal
+
+    def test_parsing_reals_in_numeric_aggregates_is_correctly_rounded(self):
+        data = "#1=IFCCARTESIANPOINTLIST3D((%s));\n" % ",".join("(%s,0.,0.)" % literal for literal in REALS)
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(data))
+        coordinates = f.by_id(1).CoordList
+        assert len(coordinates) == len(REALS)
+        for coordinate, literal in zip(coordinates, REALS):
+            assert bits(coordinate[0]) == bits(float(literal)), literal
+
+
+class TestParseNumericAggregates:
+    def test_reading_the_coordinates_and_indices_of_a_triangulated_face_set(self):
+        data = (
+            "#1=IFCCARTESIANPOINTLIST3D(((0.,0.,0.),(1.,0.,0.), ( 0.,1.,0.) ,(0.,0.,/* apex */1.E-3)),$);\n"
+            "#2=IFCTRIANGULATEDFACESET(#1,$,.T.,((1,3,2),(1,2,4),(2,3,4),(3,1,4)),$);\n"
+        )
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(data))
+        faceset = f.by_id(2)
+        coordinates = ((0.0, 0.0, 0.0), (1.0, 0.0, 0.0), (0.0, 1.0, 0.0), (0.0, 0.0, 0.001))
+        indices = ((1, 3, 2), (1, 2, 4), (2, 3, 4), (3, 1, 4))
+        assert faceset.Coordinates.CoordList == coordinates
+        assert faceset.CoordIndex == indices
+        assert faceset.get_info(recursive=True)["Coordinates"]["CoordList"] == coordinates
+        assert faceset.Coordinates.attribute_buffer("CoordList").tolist() == [list(c) for c in coordinates]
+        assert faceset.attribute_buffer("CoordIndex").tolist() == [list(i) for i in indices]
+        assert all(type(i) is int for row in faceset.CoordIndex for i in row)
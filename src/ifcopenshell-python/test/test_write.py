@@ -16,9 +16,11 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with IfcOpenShell.  If not, see <http://www.gnu.org/licenses/>.
 
+import struct
 import tempfile
 from pathlib import Path
 import pytest
+import test.bootstrap
 import ifcopenshell
 
 
@@ -64,3 +66,117 @@ class TestWrite:
 
     def test_write_to_non_existing_dir(self):
         self.assert_model_is_written("tmp/model.ifczip")
+
+
+# Instances with formatting that differs from how IfcOpenShell formats them,
+# i.e. reals, escaped strings, comments and white space within instances.
+SPF_DATA = """#1=IFCPERSON($,'O''Brien',$,$,$,$,$,$);
+#2=IFCORGANIZATION($,'Org /* not a comment */',$,$,$);
+#3=IFCPERSONANDORGANIZATION(#1,#2,$);
+#4=IFCAPPLICATION(#2,'1.0','App','App');
+#5=IFCOWNERHISTORY(#3,#4,$,.ADDED.,$,$,$,1700000000);
+#6=IFCCARTESIANPOINT((0.,1.E-3,  2.50000));
+#7=IFCPROPERTYSINGLEVALUE('Name',$,IFCLABEL('Value'),$);
+#8=IFCPROPERTYSINGLEVALUE('Length',$,IFCLENGTHMEASURE(1.E1),$);
+#9=IFCPROPERTYSET('0nV9AOBj99CvOmgSgxDBZF',#5,'Pset',/* comment */$,(#7,#8));
+#10=IFCWALL('1nV9AOBj99CvOmgSgxDBZF',#5,'Wall',$,$,$,$,$,.SOLIDWALL.);
+#11=IFCRELDEFINESBYPROPERTIES('2nV9AOBj99CvOmgSgxDBZF',#5,$,$,(#10),#9);
+"""
+
+
+def written_data(f, threads=1):
+    with tempfile.TemporaryDirectory() as temp_dir:
+        path = Path(temp_dir) / "model.ifc"
+        f.write(path, threads=threads)
+        text = path.read_text()
+    return text[text.index("DATA;\n") + len("DATA;\n") : text.rindex("ENDSEC;")]
+
+
+class TestWriteUnmodified:
+    def test_unmodified_instances_are_written_as_read(self):
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(SPF_DATA))
+        assert written_data(f) == SPF_DATA
+
+    def test_unmodified_instances_are_written_as_read_after_reading_them(self):
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(SPF_DATA))
+        for element in f:
+            element.get_info(recursive=True)
+        assert written_data(f) == SPF_DATA
+
+    def test_modifying_a_nested_value_only_formats_that_instance(self):
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(SPF_DATA))
+        prop = f.by_id(7)
+        prop.NominalValue.wrappedValue = "Other"
+        lines = SPF_DATA.splitlines(True)
+        lines[6] = "#7=IFCPROPERTYSINGLEVALUE('Name',$,IFCLABEL('Other'),$);\n"
+        assert written_data(f) == "".join(lines)
+
+    def test_modifying_an_attribute_only_formats_that_instance(self):
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(SPF_DATA))
+        f.by_id(10).Name = "Other"
+        lines = SPF_DATA.splitlines(True)
+        lines[9] = "#10=IFCWALL('1nV9AOBj99CvOmgSgxDBZF',#5,'Other',$,$,$,$,$,.SOLIDWALL.);\n"
+        assert written_data(f) == "".join(lines)
+
+    def test_removing_a_referenced_instance_formats_its_referrers(self):
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(SPF_DATA))
+        f.remove(f.by_id(8))
+        lines = SPF_DATA.splitlines(True)
+        del lines[7]
+        lines[7] = "#9=IFCPROPERTYSET('0nV9AOBj99CvOmgSgxDBZF',#5,'Pset',$,(#7));\n"
+        assert written_data(f) == "".join(lines)
+
+    def test_instances_copied_from_another_file_are_formatted(self):
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(SPF_DATA))
+        g = ifcopenshell.file(schema="IFC4")
+        g.add(f.by_id(6))
+        g.add(f.by_id(9))
+        assert written_data(g) == (
+            "#1=IFCCARTESIANPOINT((0.,0.001,2.5));\n"
+            "#2=IFCPERSON($,'O''Brien',$,$,$,$,$,$);\n"
+            "#3=IFCORGANIZATION($,'Org /* not a comment */',$,$,$);\n"
+            "#4=IFCPERSONANDORGANIZATION(#2,#3,$);\n"
+            "#5=IFCAPPLICATION(#3,'1.0','App','App');\n"
+            "#6=IFCOWNERHISTORY(#4,#5,$,.ADDED.,$,$,$,1700000000);\n"
+            "#7=IFCPROPERTYSINGLEVALUE('Name',$,IFCLABEL('Value'),$);\n"
+            "#8=IFCPROPERTYSINGLEVALUE('Length',$,IFCLENGTHMEASURE(10.),$);\n"
+            "#9=IFCPROPERTYSET('0nV9AOBj99CvOmgSgxDBZF',#6,'Pset',$,(#7,#8));\n"
+        )
+
+
+class TestWriteThreads:
+    def test_writing_with_multiple_threads_is_identical(self):
+        data = "".join("#%d=IFCCARTESIANPOINT((%d.,%d.5,1.E-%d));\n" % (i, i, i, i % 300) for i in range(1, 5001))
+        f = ifcopenshell.file.from_string(test.bootstrap.spf(data))
+        for i in range(1, 5001, 7):
+            f.by_id(i).Coordinates = (i / 3.0, 0.1 * i, 1.0)
+        written = written_data(f)
+        for threads in (2, 3, 8):
+            assert written_data(f, threads=threads) == written
+
+    def test_writing_reals_round_trips(self):
+        values = [
+            0.1,
+            1.0 / 3.0,
+            2.0 / 3.0,
+            1e-300,
+            5e-324,
+            2.2250738585072014e-308,
+            1.7976931348623157e308,
+            123456789.123456789,
+            9007199254740993.0,
+            -0.0,
+            1e22,
+            1e23,
+        ]
+        f = ifcopenshell.file(schema="IFC4")
+        for value in values:
+            f.createIfcCartesianPoint((value, 0.0, 0.0))
+        g = ifcopenshell.file.from_string(test.bootstrap.spf(written_data(f)))
+        for element, value in zip(g.by_type("IfcCartesianPoint"), values):
+            assert struct.pack("<d", element.Coordinates[0]) == struct.pack("<d", value)
+
+    def test_writing_reals_uses_the_shortest_representation(self):
+        f = ifcopenshell.file(schema="IFC4")
+        f.createIfcCartesianPoint((0.1, 0.25, 1e-05))
+        assert written_data(f) == "#1=IFCCARTESIANPOINT((0.1,0.25,1.E-05));\n"
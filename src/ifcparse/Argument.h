@@ -82,6 +82,10 @@ public:
 	virtual operator std::vector< std::vector<double> >() const;
 	virtual operator aggregate_of_aggregate_of_instance::ptr() const;
 
+	/// Returns the offset of an enumeration value in the items of the
+	/// enumeration type of the attribute when resolved while parsing, or -1
+	virtual int enumeration_index() const;
+
 	virtual bool isNull() const = 0;
 	virtual unsigned int size() const = 0;
 
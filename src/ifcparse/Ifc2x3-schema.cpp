@@ -1953,6 +1953,107 @@ class IFC2X3_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC2X3_keyword_displacements[245] = {
+    12, 2, 7, 5, 1, 3, 18, 1, 3, 7, 56, 14, 24, 44, 14, 3,
+    1, 1, 1, 16, 1, 15, 3, 2, 4, 73, 7, 1, 1, 3, 1, 37,
+    1, 19, 1, 3, 19, 14, 2, 9, 2, 5, 7, 32, 1, 7, 7, 4,
+    25, 33, 31, 30, 13, 14, 2, 1, 7, 12, 9, 7, 31, 3, 4, 9,
+    1, 20, 12, 24, 12, 4, 22, 3, 2, 25, 4, 6, 2, 4, 31, 51,
+    1, 1, 2, 1, 15, 1, 10, 5, 29, 4, 8, 41, 21, 7, 17, 11,
+    2, 28, 5, 7, 31, 45, 13, 2, 11, 5, 5, 41, 10, 0, 24, 36,
+    3, 2, 8, 6, 11, 3, 129, 9, 6, 2, 1, 10, 2, 5, 27, 1,
+    43, 34, 44, 2, 1, 12, 8, 5, 15, 2, 44, 34, 0, 92, 12, 7,
+    1, 9, 15, 113, 5, 2, 1, 0, 3, 5, 22, 6, 0, 3, 6, 3,
+    49, 2, 12, 0, 31, 22, 2, 16, 48, 7, 9, 2, 25, 20, 15, 6,
+    1, 12, 22, 33, 19, 16, 4, 6, 1, 4, 9, 47, 14, 8, 7, 17,
+    9, 2, 4, 10, 65, 3, 19, 9, 9, 1, 51, 7, 6, 1, 37, 12,
+    83, 9, 10, 2, 33, 7, 50, 29, 3, 1, 51, 26, 7, 1, 40, 12,
+    2, 29, 1, 6, 4, 18, 13, 3, 0, 45, 2, 3, 9, 72, 4, 4,
+    78, 6, 5, 16, 12
+};
+
+static const int16_t IFC2X3_keyword_slots[1225] = {
+    -1, 789, 516, 151, -1, -1, 410, -1, 846, 968, 129, 644, 856, 345, -1, 289,
+    718, 672, 191, 406, 42, 450, -1, 308, 130, 230, 525, 128, 352, 401, -1, 692,
+    346, 341, 142, 759, 50, 333, 317, 911, 880, 787, 519, 480, 37, 870, 91, 927,
+    -1, 503, -1, 383, 881, 792, 390, 148, 414, -1, 569, 319, 173, 396, 673, 584,
+    -1, 513, 62, 656, 894, 940, -1, 521, 864, 526, 144, 518, 257, 163, 509, 836,
+    -1, 84, 802, 147, 900, -1, 185, 274, 975, 213, 810, 481, -1, 398, 385, 301,
+    640, -1, 375, 580, 138, 700, -1, 530, -1, -1, 797, 266, 446, 842, 643, 238,
+    784, 812, 828, 241, 27, 440, 265, -1, 666, 442, 280, 552, -1, -1, 703, 951,
+    625, -1, 252, 152, 790, 48, 976, 384, 939, 273, 11, -1, 933, -1, 310, 452,
+    455, 892, 599, 664, 439, 704, 561, -1, -1, -1, 680, 116, 799, 378, 45, 307,
+    568, 965, 334, 746, 365, -1, 321, 271, -1, -1, 33, 298, 26, 132, -1, -1,
+    620, 417, 879, 71, 591, -1, 14, 844, 756, 322, 332, 438, 296, 829, 218, 903,
+    920, 527, 865, 809, 499, 87, 593, -1, 353, 587, 588, 53, -1, 394, 608, 861,
+    854, 501, 86, 232, 560, 921, 200, 226, 6, 36, -1, 517, 952, 878, 613, -1,
+    16, 696, 181, 260, 444, 595, 515, 327, -1, 413, 141, -1, -1, 832, 67, 205,
+    549, 364, 557, 937, 198, 368, 49, -1, 562, -1, 466, 263, 565, 791, -1, 337,
+    -1, 72, 871, -1, 733, 695, 285, 895, 233, 647, 621, -1, -1, -1, -1, 343,
+    -1, -1, 887, 206, 435, 815, -1, 928, 961, 941, -1, 170, 278, 326, -1, 597,
+    -1, 272, 77, 258, 335, 779, 331, -1, 508, 838, 43, -1, 102, 851, 796, -1,
+    187, 28, -1, -1, 665, 626, -1, 32, 616, 174, 56, 373, 400, 415, -1, 683,
+    -1, 395, 277, 781, 804, 98, 717, 663, 960, -1, 139, 350, 255, -1, -1, 662,
+    245, 818, 21, -1, 178, 839, 863, 197, 766, 876, 135, -1, 709, 884, 161, 462,
+    610, 705, 295, 924, 763, 645, 92, 554, 330, 827, -1, 788, 449, 101, 164, 388,
+    651, 967, 424, 202, 768, 932, 309, 762, -1, 85, 349, 572, 711, 445, -1, 623,
+    39, -1, -1, 465, 896, 325, 654, 855, -1, 847, 816, -1, 545, -1, 929, 606,
+    347, 582, 945, -1, 419, -1, 538, -1, 628, 219, 627, 908, 65, 180, 678, -1,
+    -1, 212, 573, 826, 612, -1, -1, -1, 602, 748, 246, -1, -1, -1, 153, -1,
+    822, 203, 754, 642, 38, 720, -1, 794, 474, 366, 708, 473, 448, 209, 240, -1,
+    556, 835, 950, 872, 494, 81, 399, -1, 201, 540, 899, 336, 600, 800, 775, 490,
+    636, 418, -1, 13, 376, -1, 186, 29, -1, 377, 133, 269, 886, 609, 483, 41,
+    107, 229, 78, 69, -1, -1, 811, 747, 731, -1, 150, 458, -1, -1, 712, -1,
+    194, -1, 795, 624, 930, -1, 96, 823, 579, 596, -1, 953, -1, 239, 963, 729,
+    426, 88, 728, 873, 422, -1, -1, 524, 631, 323, 537, 741, 630, 919, 674, 563,
+    660, 284, 182, 134, 727, 821, 351, 8, 742, 782, -1, 482, 850, 808, 684, 689,
+    848, 853, 357, 707, 306, 15, 676, 948, 89, 493, 735, 605, 758, 99, 725, -1,
+    740, -1, 25, -1, -1, 90, 798, -1, 737, 777, 559, 583, 686, 786, -1, 17,
+    276, -1, -1, 243, 44, -1, 914, 126, -1, 592, 125, 917, -1, 668, 803, 898,
+    736, 698, 242, 340, 231, 721, 603, 533, -1, 617, -1, -1, 80, 387, -1, 214,
+    172, 7, -1, 702, -1, 978, 288, 131, 511, 55, 360, 491, -1, 938, -1, 311,
+    287, 813, -1, -1, 764, 962, 907, 954, 247, -1, 454, -1, 912, 312, 635, 633,
+    447, 282, -1, 443, -1, 785, 369, 409, 974, 420, -1, -1, 430, 765, 51, 877,
+    604, 188, 234, 136, 423, -1, -1, -1, 140, 122, 646, -1, 825, -1, -1, 12,
+    228, 611, 0, -1, 681, 402, 261, 852, -1, -1, 760, 699, -1, 381, 922, 270,
+    528, 22, 567, 34, 502, 882, -1, 739, 64, 425, 830, 220, 543, 619, 157, 956,
+    19, 942, -1, 679, 408, 355, -1, 281, 411, 885, 657, 622, 973, 109, 955, 893,
+    421, 652, 461, 167, 104, 371, 318, 114, -1, 566, 47, 868, -1, 302, 154, 553,
+    177, -1, -1, -1, 934, -1, 58, 943, 190, 259, 958, 183, 915, 661, 669, 479,
+    30, 250, 506, 857, 103, 771, 168, 244, 267, 171, -1, -1, 208, 772, 564, 476,
+    964, -1, 916, 496, 946, 61, -1, 112, 706, 713, 429, 162, 477, 361, -1, -1,
+    358, 824, 253, 20, 589, 761, 805, 581, 889, 497, 977, 279, -1, 184, -1, -1,
+    251, 405, 248, 778, 671, 472, 127, 320, 715, 10, -1, -1, 484, 959, -1, 76,
+    638, 40, 931, 701, 348, 392, 773, -1, 283, 858, 143, 124, 677, -1, 216, 108,
+    -1, -1, 210, 750, 57, 719, 653, 235, 780, 262, 73, 189, 207, -1, 514, 757,
+    -1, 753, 294, 571, 745, 195, 687, 397, -1, 875, -1, 416, 468, 843, -1, 24,
+    -1, 286, 947, -1, -1, 972, 935, 649, -1, -1, 598, 393, 495, -1, 391, 520,
+    542, 264, 469, -1, -1, -1, 441, 146, 969, 500, 675, 594, 79, -1, 897, 691,
+    60, 221, 716, 389, -1, 658, -1, -1, 770, 145, -1, 949, 211, 688, 222, -1,
+    783, 577, 550, 356, -1, -1, 31, 641, 535, 374, 293, 694, 586, 403, 97, 105,
+    290, 54, 585, 744, 380, 303, -1, 632, 667, 574, 5, 488, -1, 869, 115, 338,
+    254, 890, 618, 904, 339, -1, 166, 685, -1, 225, 63, 910, 121, 883, 436, -1,
+    926, 498, 35, 891, 328, 831, 412, 714, -1, 575, 874, 639, 316, 504, -1, 486,
+    236, 697, 70, 382, 615, 769, 268, 862, 845, -1, 531, 297, 451, 217, 299, 120,
+    113, 512, 607, 971, 979, -1, -1, 379, 918, 407, 522, -1, 367, 833, 902, 634,
+    464, 59, 576, 570, 460, 546, 523, -1, 93, 909, 160, 463, 629, -1, 478, -1,
+    -1, -1, 432, 670, 487, 724, 75, 776, -1, 159, 925, 690, 906, 199, 601, 18,
+    558, 637, 137, 52, 359, 431, 507, 437, 614, 841, 547, -1, 362, 551, 536, 315,
+    83, 475, 204, -1, 752, 82, 94, 817, 860, 372, 837, -1, 249, 726, 659, -1,
+    467, 751, 179, 3, 722, -1, -1, 532, 648, -1, 175, -1, 840, 738, 682, 767,
+    -1, 923, -1, 111, 370, 730, 966, 849, 215, 227, 457, -1, 117, -1, 541, 734,
+    578, -1, 344, 732, 710, 471, 224, 46, 404, 970, 459, 223, 866, 693, -1, 834,
+    158, -1, 755, 650, -1, 470, 819, 801, -1, 749, 655, 123, 9, 534, 342, 723,
+    193, 118, 743, 74, 95, 901, 119, 548, -1, 434, -1, 196, -1, 324, 329, 237,
+    859, 275, -1, -1, 555, 510, -1, 169, 300, 165, 23, 539, 433, 936, 66, 590,
+    820, -1, 354, 156, 793, 192, 106, 305, 888, 492, -1, 905, 314, 428, -1, 155,
+    -1, 485, 1, 100, 807, 292, -1, 944, 386, 176, 363, 814, 957, 427, 505, 456,
+    2, 806, 256, -1, 529, 4, -1, 149, 453, 291, -1, 774, 489, 544, -1, -1,
+    -1, 867, 110, 68, -1, 313, 913, 304, -1
+};
+
+static const keyword_table IFC2X3_keywords = { IFC2X3_keyword_displacements, 245, IFC2X3_keyword_slots, 1225 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -12522,7 +12623,7 @@ IfcParse::schema_definition* IFC2X3_populate_schema() {
     declarations.push_back(IFC2X3_IfcYearNumber_type);
     declarations.push_back(IFC2X3_IfcZone_type);
     declarations.push_back(IFC2X3_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC2X3", declarations, new IFC2X3_instance_factory());
+    return new schema_definition("IFC2X3", declarations, new IFC2X3_instance_factory(), &IFC2X3_keywords);
 }
 
 
@@ -732,6 +732,7 @@ public:
     typedef enum {IfcActionSourceType_DEAD_LOAD_G, IfcActionSourceType_COMPLETION_G1, IfcActionSourceType_LIVE_LOAD_Q, IfcActionSourceType_SNOW_S, IfcActionSourceType_WIND_W, IfcActionSourceType_PRESTRESSING_P, IfcActionSourceType_SETTLEMENT_U, IfcActionSourceType_TEMPERATURE_T, IfcActionSourceType_EARTHQUAKE_E, IfcActionSourceType_FIRE, IfcActionSourceType_IMPULSE, IfcActionSourceType_IMPACT, IfcActionSourceType_TRANSPORT, IfcActionSourceType_ERECTION, IfcActionSourceType_PROPPING, IfcActionSourceType_SYSTEM_IMPERFECTION, IfcActionSourceType_SHRINKAGE, IfcActionSourceType_CREEP, IfcActionSourceType_LACK_OF_FIT, IfcActionSourceType_BUOYANCY, IfcActionSourceType_ICE, IfcActionSourceType_CURRENT, IfcActionSourceType_WAVE, IfcActionSourceType_RAIN, IfcActionSourceType_BRAKES, IfcActionSourceType_USERDEFINED, IfcActionSourceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -752,6 +753,7 @@ public:
     typedef enum {IfcActionType_PERMANENT_G, IfcActionType_VARIABLE_Q, IfcActionType_EXTRAORDINARY_A, IfcActionType_USERDEFINED, IfcActionType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -781,6 +783,7 @@ public:
     typedef enum {IfcActuatorType_ELECTRICACTUATOR, IfcActuatorType_HANDOPERATEDACTUATOR, IfcActuatorType_HYDRAULICACTUATOR, IfcActuatorType_PNEUMATICACTUATOR, IfcActuatorType_THERMOSTATICACTUATOR, IfcActuatorType_USERDEFINED, IfcActuatorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -805,6 +808,7 @@ public:
     typedef enum {IfcAddressType_OFFICE, IfcAddressType_SITE, IfcAddressType_HOME, IfcAddressType_DISTRIBUTIONPOINT, IfcAddressType_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -819,6 +823,7 @@ public:
     typedef enum {IfcAheadOrBehind_AHEAD, IfcAheadOrBehind_BEHIND} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -843,6 +848,7 @@ public:
     typedef enum {IfcAirTerminalBoxType_CONSTANTFLOW, IfcAirTerminalBoxType_VARIABLEFLOWPRESSUREDEPENDANT, IfcAirTerminalBoxType_VARIABLEFLOWPRESSUREINDEPENDANT, IfcAirTerminalBoxType_USERDEFINED, IfcAirTerminalBoxType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -869,6 +875,7 @@ public:
     typedef enum {IfcAirTerminalType_GRILLE, IfcAirTerminalType_REGISTER, IfcAirTerminalType_DIFFUSER, IfcAirTerminalType_EYEBALL, IfcAirTerminalType_IRIS, IfcAirTerminalType_LINEARGRILLE, IfcAirTerminalType_LINEARDIFFUSER, IfcAirTerminalType_USERDEFINED, IfcAirTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -898,6 +905,7 @@ public:
     typedef enum {IfcAirToAirHeatRecoveryType_FIXEDPLATECOUNTERFLOWEXCHANGER, IfcAirToAirHeatRecoveryType_FIXEDPLATECROSSFLOWEXCHANGER, IfcAirToAirHeatRecoveryType_FIXEDPLATEPARALLELFLOWEXCHANGER, IfcAirToAirHeatRecoveryType_ROTARYWHEEL, IfcAirToAirHeatRecoveryType_RUNAROUNDCOILLOOP, IfcAirToAirHeatRecoveryType_HEATPIPE, IfcAirToAirHeatRecoveryType_TWINTOWERENTHALPYRECOVERYLOOPS, IfcAirToAirHeatRecoveryType_THERMOSIPHONSEALEDTUBEHEATEXCHANGERS, IfcAirToAirHeatRecoveryType_THERMOSIPHONCOILTYPEHEATEXCHANGERS, IfcAirToAirHeatRecoveryType_USERDEFINED, IfcAirToAirHeatRecoveryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -925,6 +933,7 @@ public:
     typedef enum {IfcAlarmType_BELL, IfcAlarmType_BREAKGLASSBUTTON, IfcAlarmType_LIGHT, IfcAlarmType_MANUALPULLBOX, IfcAlarmType_SIREN, IfcAlarmType_WHISTLE, IfcAlarmType_USERDEFINED, IfcAlarmType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -944,6 +953,7 @@ public:
     typedef enum {IfcAnalysisModelType_IN_PLANE_LOADING_2D, IfcAnalysisModelType_OUT_PLANE_LOADING_2D, IfcAnalysisModelType_LOADING_3D, IfcAnalysisModelType_USERDEFINED, IfcAnalysisModelType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -964,6 +974,7 @@ public:
     typedef enum {IfcAnalysisTheoryType_FIRST_ORDER_THEORY, IfcAnalysisTheoryType_SECOND_ORDER_THEORY, IfcAnalysisTheoryType_THIRD_ORDER_THEORY, IfcAnalysisTheoryType_FULL_NONLINEAR_THEORY, IfcAnalysisTheoryType_USERDEFINED, IfcAnalysisTheoryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -989,6 +1000,7 @@ public:
     typedef enum {IfcArithmeticOperator_ADD, IfcArithmeticOperator_DIVIDE, IfcArithmeticOperator_MULTIPLY, IfcArithmeticOperator_SUBTRACT} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1014,6 +1026,7 @@ public:
     typedef enum {IfcAssemblyPlace_SITE, IfcAssemblyPlace_FACTORY, IfcAssemblyPlace_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1041,6 +1054,7 @@ public:
     typedef enum {IfcBSplineCurveForm_POLYLINE_FORM, IfcBSplineCurveForm_CIRCULAR_ARC, IfcBSplineCurveForm_ELLIPTIC_ARC, IfcBSplineCurveForm_PARABOLIC_ARC, IfcBSplineCurveForm_HYPERBOLIC_ARC, IfcBSplineCurveForm_UNSPECIFIED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1093,6 +1107,7 @@ public:
     typedef enum {IfcBeamType_BEAM, IfcBeamType_JOIST, IfcBeamType_LINTEL, IfcBeamType_T_BEAM, IfcBeamType_USERDEFINED, IfcBeamType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1146,6 +1161,7 @@ public:
     typedef enum {IfcBenchmark_GREATERTHAN, IfcBenchmark_GREATERTHANOREQUALTO, IfcBenchmark_LESSTHAN, IfcBenchmark_LESSTHANOREQUALTO, IfcBenchmark_EQUALTO, IfcBenchmark_NOTEQUALTO} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1168,6 +1184,7 @@ public:
     typedef enum {IfcBoilerType_WATER, IfcBoilerType_STEAM, IfcBoilerType_USERDEFINED, IfcBoilerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1190,6 +1207,7 @@ public:
     typedef enum {IfcBooleanOperator_UNION, IfcBooleanOperator_INTERSECTION, IfcBooleanOperator_DIFFERENCE} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1214,6 +1232,7 @@ public:
     typedef enum {IfcBuildingElementProxyType_USERDEFINED, IfcBuildingElementProxyType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1237,6 +1256,7 @@ public:
     typedef enum {IfcCableCarrierFittingType_BEND, IfcCableCarrierFittingType_CROSS, IfcCableCarrierFittingType_REDUCER, IfcCableCarrierFittingType_TEE, IfcCableCarrierFittingType_USERDEFINED, IfcCableCarrierFittingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1260,6 +1280,7 @@ public:
     typedef enum {IfcCableCarrierSegmentType_CABLELADDERSEGMENT, IfcCableCarrierSegmentType_CABLETRAYSEGMENT, IfcCableCarrierSegmentType_CABLETRUNKINGSEGMENT, IfcCableCarrierSegmentType_CONDUITSEGMENT, IfcCableCarrierSegmentType_USERDEFINED, IfcCableCarrierSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1285,6 +1306,7 @@ public:
     typedef enum {IfcCableSegmentType_CABLESEGMENT, IfcCableSegmentType_CONDUCTORSEGMENT, IfcCableSegmentType_USERDEFINED, IfcCableSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1309,6 +1331,7 @@ public:
     typedef enum {IfcChangeAction_NOCHANGE, IfcChangeAction_MODIFIED, IfcChangeAction_ADDED, IfcChangeAction_DELETED, IfcChangeAction_MODIFIEDADDED, IfcChangeAction_MODIFIEDDELETED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1332,6 +1355,7 @@ public:
     typedef enum {IfcChillerType_AIRCOOLED, IfcChillerType_WATERCOOLED, IfcChillerType_HEATRECOVERY, IfcChillerType_USERDEFINED, IfcChillerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1367,6 +1391,7 @@ public:
     typedef enum {IfcCoilType_DXCOOLINGCOIL, IfcCoilType_WATERCOOLINGCOIL, IfcCoilType_STEAMHEATINGCOIL, IfcCoilType_WATERHEATINGCOIL, IfcCoilType_ELECTRICHEATINGCOIL, IfcCoilType_GASHEATINGCOIL, IfcCoilType_USERDEFINED, IfcCoilType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1394,6 +1419,7 @@ public:
     typedef enum {IfcColumnType_COLUMN, IfcColumnType_USERDEFINED, IfcColumnType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1429,6 +1455,7 @@ public:
     typedef enum {IfcCompressorType_DYNAMIC, IfcCompressorType_RECIPROCATING, IfcCompressorType_ROTARY, IfcCompressorType_SCROLL, IfcCompressorType_TROCHOIDAL, IfcCompressorType_SINGLESTAGE, IfcCompressorType_BOOSTER, IfcCompressorType_OPENTYPE, IfcCompressorType_HERMETIC, IfcCompressorType_SEMIHERMETIC, IfcCompressorType_WELDEDSHELLHERMETIC, IfcCompressorType_ROLLINGPISTON, IfcCompressorType_ROTARYVANE, IfcCompressorType_SINGLESCREW, IfcCompressorType_TWINSCREW, IfcCompressorType_USERDEFINED, IfcCompressorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1455,6 +1482,7 @@ public:
     typedef enum {IfcCondenserType_WATERCOOLEDSHELLTUBE, IfcCondenserType_WATERCOOLEDSHELLCOIL, IfcCondenserType_WATERCOOLEDTUBEINTUBE, IfcCondenserType_WATERCOOLEDBRAZEDPLATE, IfcCondenserType_AIRCOOLED, IfcCondenserType_EVAPORATIVECOOLED, IfcCondenserType_USERDEFINED, IfcCondenserType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1488,6 +1516,7 @@ public:
     typedef enum {IfcConnectionType_ATPATH, IfcConnectionType_ATSTART, IfcConnectionType_ATEND, IfcConnectionType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1518,6 +1547,7 @@ public:
     typedef enum {IfcConstraint_HARD, IfcConstraint_SOFT, IfcConstraint_ADVISORY, IfcConstraint_USERDEFINED, IfcConstraint_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1545,6 +1575,7 @@ public:
     typedef enum {IfcControllerType_FLOATING, IfcControllerType_PROPORTIONAL, IfcControllerType_PROPORTIONALINTEGRAL, IfcControllerType_PROPORTIONALINTEGRALDERIVATIVE, IfcControllerType_TIMEDTWOPOSITION, IfcControllerType_TWOPOSITION, IfcControllerType_USERDEFINED, IfcControllerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1577,6 +1608,7 @@ public:
     typedef enum {IfcCooledBeamType_ACTIVE, IfcCooledBeamType_PASSIVE, IfcCooledBeamType_USERDEFINED, IfcCooledBeamType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1602,6 +1634,7 @@ public:
     typedef enum {IfcCoolingTowerType_NATURALDRAFT, IfcCoolingTowerType_MECHANICALINDUCEDDRAFT, IfcCoolingTowerType_MECHANICALFORCEDDRAFT, IfcCoolingTowerType_USERDEFINED, IfcCoolingTowerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1628,6 +1661,7 @@ public:
     typedef enum {IfcCostScheduleType_BUDGET, IfcCostScheduleType_COSTPLAN, IfcCostScheduleType_ESTIMATE, IfcCostScheduleType_TENDER, IfcCostScheduleType_PRICEDBILLOFQUANTITIES, IfcCostScheduleType_UNPRICEDBILLOFQUANTITIES, IfcCostScheduleType_SCHEDULEOFRATES, IfcCostScheduleType_USERDEFINED, IfcCostScheduleType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1684,6 +1718,7 @@ public:
     typedef enum {IfcCoveringType_CEILING, IfcCoveringType_FLOORING, IfcCoveringType_CLADDING, IfcCoveringType_ROOFING, IfcCoveringType_INSULATION, IfcCoveringType_MEMBRANE, IfcCoveringType_SLEEVING, IfcCoveringType_WRAPPING, IfcCoveringType_USERDEFINED, IfcCoveringType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1698,6 +1733,7 @@ public:
     typedef enum {IfcCurrency_AED, IfcCurrency_AES, IfcCurrency_ATS, IfcCurrency_AUD, IfcCurrency_BBD, IfcCurrency_BEG, IfcCurrency_BGL, IfcCurrency_BHD, IfcCurrency_BMD, IfcCurrency_BND, IfcCurrency_BRL, IfcCurrency_BSD, IfcCurrency_BWP, IfcCurrency_BZD, IfcCurrency_CAD, IfcCurrency_CBD, IfcCurrency_CHF, IfcCurrency_CLP, IfcCurrency_CNY, IfcCurrency_CYS, IfcCurrency_CZK, IfcCurrency_DDP, IfcCurrency_DEM, IfcCurrency_DKK, IfcCurrency_EGL, IfcCurrency_EST, IfcCurrency_EUR, IfcCurrency_FAK, IfcCurrency_FIM, IfcCurrency_FJD, IfcCurrency_FKP, IfcCurrency_FRF, IfcCurrency_GBP, IfcCurrency_GIP, IfcCurrency_GMD, IfcCurrency_GRX, IfcCurrency_HKD, IfcCurrency_HUF, IfcCurrency_ICK, IfcCurrency_IDR, IfcCurrency_ILS, IfcCurrency_INR, IfcCurrency_IRP, IfcCurrency_ITL, IfcCurrency_JMD, IfcCurrency_JOD, IfcCurrency_JPY, IfcCurrency_KES, IfcCurrency_KRW, IfcCurrency_KWD, IfcCurrency_KYD, IfcCurrency_LKR, IfcCurrency_LUF, IfcCurrency_MTL, IfcCurrency_MUR, IfcCurrency_MXN, IfcCurrency_MYR, IfcCurrency_NLG, IfcCurrency_NZD, IfcCurrency_OMR, IfcCurrency_PGK, IfcCurrency_PHP, IfcCurrency_PKR, IfcCurrency_PLN, IfcCurrency_PTN, IfcCurrency_QAR, IfcCurrency_RUR, IfcCurrency_SAR, IfcCurrency_SCR, IfcCurrency_SEK, IfcCurrency_SGD, IfcCurrency_SKP, IfcCurrency_THB, IfcCurrency_TRL, IfcCurrency_TTD, IfcCurrency_TWD, IfcCurrency_USD, IfcCurrency_VEB, IfcCurrency_VND, IfcCurrency_XEU, IfcCurrency_ZAR, IfcCurrency_ZWD, IfcCurrency_NOK} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1720,6 +1756,7 @@ public:
     typedef enum {IfcCurtainWallType_USERDEFINED, IfcCurtainWallType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1750,6 +1787,7 @@ public:
     typedef enum {IfcDamperType_CONTROLDAMPER, IfcDamperType_FIREDAMPER, IfcDamperType_SMOKEDAMPER, IfcDamperType_FIRESMOKEDAMPER, IfcDamperType_BACKDRAFTDAMPER, IfcDamperType_RELIEFDAMPER, IfcDamperType_BLASTDAMPER, IfcDamperType_GRAVITYDAMPER, IfcDamperType_GRAVITYRELIEFDAMPER, IfcDamperType_BALANCINGDAMPER, IfcDamperType_FUMEHOODEXHAUST, IfcDamperType_USERDEFINED, IfcDamperType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1771,6 +1809,7 @@ public:
     typedef enum {IfcDataOrigin_MEASURED, IfcDataOrigin_PREDICTED, IfcDataOrigin_SIMULATED, IfcDataOrigin_USERDEFINED, IfcDataOrigin_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1841,6 +1880,7 @@ public:
     typedef enum {IfcDerivedUnit_ANGULARVELOCITYUNIT, IfcDerivedUnit_COMPOUNDPLANEANGLEUNIT, IfcDerivedUnit_DYNAMICVISCOSITYUNIT, IfcDerivedUnit_HEATFLUXDENSITYUNIT, IfcDerivedUnit_INTEGERCOUNTRATEUNIT, IfcDerivedUnit_ISOTHERMALMOISTURECAPACITYUNIT, IfcDerivedUnit_KINEMATICVISCOSITYUNIT, IfcDerivedUnit_LINEARVELOCITYUNIT, IfcDerivedUnit_MASSDENSITYUNIT, IfcDerivedUnit_MASSFLOWRATEUNIT, IfcDerivedUnit_MOISTUREDIFFUSIVITYUNIT, IfcDerivedUnit_MOLECULARWEIGHTUNIT, IfcDerivedUnit_SPECIFICHEATCAPACITYUNIT, IfcDerivedUnit_THERMALADMITTANCEUNIT, IfcDerivedUnit_THERMALCONDUCTANCEUNIT, IfcDerivedUnit_THERMALRESISTANCEUNIT, IfcDerivedUnit_THERMALTRANSMITTANCEUNIT, IfcDerivedUnit_VAPORPERMEABILITYUNIT, IfcDerivedUnit_VOLUMETRICFLOWRATEUNIT, IfcDerivedUnit_ROTATIONALFREQUENCYUNIT, IfcDerivedUnit_TORQUEUNIT, IfcDerivedUnit_MOMENTOFINERTIAUNIT, IfcDerivedUnit_LINEARMOMENTUNIT, IfcDerivedUnit_LINEARFORCEUNIT, IfcDerivedUnit_PLANARFORCEUNIT, IfcDerivedUnit_MODULUSOFELASTICITYUNIT, IfcDerivedUnit_SHEARMODULUSUNIT, IfcDerivedUnit_LINEARSTIFFNESSUNIT, IfcDerivedUnit_ROTATIONALSTIFFNESSUNIT, IfcDerivedUnit_MODULUSOFSUBGRADEREACTIONUNIT, IfcDerivedUnit_ACCELERATIONUNIT, IfcDerivedUnit_CURVATUREUNIT, IfcDerivedUnit_HEATINGVALUEUNIT, IfcDerivedUnit_IONCONCENTRATIONUNIT, IfcDerivedUnit_LUMINOUSINTENSITYDISTRIBUTIONUNIT, IfcDerivedUnit_MASSPERLENGTHUNIT, IfcDerivedUnit_MODULUSOFLINEARSUBGRADEREACTIONUNIT, IfcDerivedUnit_MODULUSOFROTATIONALSUBGRADEREACTIONUNIT, IfcDerivedUnit_PHUNIT, IfcDerivedUnit_ROTATIONALMASSUNIT, IfcDerivedUnit_SECTIONAREAINTEGRALUNIT, IfcDerivedUnit_SECTIONMODULUSUNIT, IfcDerivedUnit_SOUNDPOWERUNIT, IfcDerivedUnit_SOUNDPRESSUREUNIT, IfcDerivedUnit_TEMPERATUREGRADIENTUNIT, IfcDerivedUnit_THERMALEXPANSIONCOEFFICIENTUNIT, IfcDerivedUnit_WARPINGCONSTANTUNIT, IfcDerivedUnit_WARPINGMOMENTUNIT, IfcDerivedUnit_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1855,6 +1895,7 @@ public:
     typedef enum {IfcDimensionExtentUsage_ORIGIN, IfcDimensionExtentUsage_TARGET} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1876,6 +1917,7 @@ public:
     typedef enum {IfcDirectionSense_POSITIVE, IfcDirectionSense_NEGATIVE} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1905,6 +1947,7 @@ public:
     typedef enum {IfcDistributionChamberElementType_FORMEDDUCT, IfcDistributionChamberElementType_INSPECTIONCHAMBER, IfcDistributionChamberElementType_INSPECTIONPIT, IfcDistributionChamberElementType_MANHOLE, IfcDistributionChamberElementType_METERCHAMBER, IfcDistributionChamberElementType_SUMP, IfcDistributionChamberElementType_TRENCH, IfcDistributionChamberElementType_VALVECHAMBER, IfcDistributionChamberElementType_USERDEFINED, IfcDistributionChamberElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1930,6 +1973,7 @@ public:
     typedef enum {IfcDocumentConfidentiality_PUBLIC, IfcDocumentConfidentiality_RESTRICTED, IfcDocumentConfidentiality_CONFIDENTIAL, IfcDocumentConfidentiality_PERSONAL, IfcDocumentConfidentiality_USERDEFINED, IfcDocumentConfidentiality_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1946,6 +1990,7 @@ public:
     typedef enum {IfcDocumentStatus_DRAFT, IfcDocumentStatus_FINALDRAFT, IfcDocumentStatus_FINAL, IfcDocumentStatus_REVISION, IfcDocumentStatus_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1992,6 +2037,7 @@ public:
     typedef enum {IfcDoorPanelOperation_SWINGING, IfcDoorPanelOperation_DOUBLE_ACTING, IfcDoorPanelOperation_SLIDING, IfcDoorPanelOperation_FOLDING, IfcDoorPanelOperation_REVOLVING, IfcDoorPanelOperation_ROLLINGUP, IfcDoorPanelOperation_USERDEFINED, IfcDoorPanelOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2012,6 +2058,7 @@ public:
     typedef enum {IfcDoorPanelPosition_LEFT, IfcDoorPanelPosition_MIDDLE, IfcDoorPanelPosition_RIGHT, IfcDoorPanelPosition_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2032,6 +2079,7 @@ public:
     typedef enum {IfcDoorStyleConstruction_ALUMINIUM, IfcDoorStyleConstruction_HIGH_GRADE_STEEL, IfcDoorStyleConstruction_STEEL, IfcDoorStyleConstruction_WOOD, IfcDoorStyleConstruction_ALUMINIUM_WOOD, IfcDoorStyleConstruction_ALUMINIUM_PLASTIC, IfcDoorStyleConstruction_PLASTIC, IfcDoorStyleConstruction_USERDEFINED, IfcDoorStyleConstruction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2214,6 +2262,7 @@ public:
     typedef enum {IfcDoorStyleOperation_SINGLE_SWING_LEFT, IfcDoorStyleOperation_SINGLE_SWING_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_SINGLE_SWING, IfcDoorStyleOperation_DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_LEFT, IfcDoorStyleOperation_DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_RIGHT, IfcDoorStyleOperation_DOUBLE_SWING_LEFT, IfcDoorStyleOperation_DOUBLE_SWING_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_DOUBLE_SWING, IfcDoorStyleOperation_SLIDING_TO_LEFT, IfcDoorStyleOperation_SLIDING_TO_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_SLIDING, IfcDoorStyleOperation_FOLDING_TO_LEFT, IfcDoorStyleOperation_FOLDING_TO_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_FOLDING, IfcDoorStyleOperation_REVOLVING, IfcDoorStyleOperation_ROLLINGUP, IfcDoorStyleOperation_USERDEFINED, IfcDoorStyleOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2260,6 +2309,7 @@ public:
     typedef enum {IfcDuctFittingType_BEND, IfcDuctFittingType_CONNECTOR, IfcDuctFittingType_ENTRY, IfcDuctFittingType_EXIT, IfcDuctFittingType_JUNCTION, IfcDuctFittingType_OBSTRUCTION, IfcDuctFittingType_TRANSITION, IfcDuctFittingType_USERDEFINED, IfcDuctFittingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2288,6 +2338,7 @@ public:
     typedef enum {IfcDuctSegmentType_RIGIDSEGMENT, IfcDuctSegmentType_FLEXIBLESEGMENT, IfcDuctSegmentType_USERDEFINED, IfcDuctSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2311,6 +2362,7 @@ public:
     typedef enum {IfcDuctSilencerType_FLATOVAL, IfcDuctSilencerType_RECTANGULAR, IfcDuctSilencerType_ROUND, IfcDuctSilencerType_USERDEFINED, IfcDuctSilencerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2353,6 +2405,7 @@ public:
     typedef enum {IfcElectricApplianceType_COMPUTER, IfcElectricApplianceType_DIRECTWATERHEATER, IfcElectricApplianceType_DISHWASHER, IfcElectricApplianceType_ELECTRICCOOKER, IfcElectricApplianceType_ELECTRICHEATER, IfcElectricApplianceType_FACSIMILE, IfcElectricApplianceType_FREESTANDINGFAN, IfcElectricApplianceType_FREEZER, IfcElectricApplianceType_FRIDGE_FREEZER, IfcElectricApplianceType_HANDDRYER, IfcElectricApplianceType_INDIRECTWATERHEATER, IfcElectricApplianceType_MICROWAVE, IfcElectricApplianceType_PHOTOCOPIER, IfcElectricApplianceType_PRINTER, IfcElectricApplianceType_REFRIGERATOR, IfcElectricApplianceType_RADIANTHEATER, IfcElectricApplianceType_SCANNER, IfcElectricApplianceType_TELEPHONE, IfcElectricApplianceType_TUMBLEDRYER, IfcElectricApplianceType_TV, IfcElectricApplianceType_VENDINGMACHINE, IfcElectricApplianceType_WASHINGMACHINE, IfcElectricApplianceType_WATERHEATER, IfcElectricApplianceType_WATERCOOLER, IfcElectricApplianceType_USERDEFINED, IfcElectricApplianceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2367,6 +2420,7 @@ public:
     typedef enum {IfcElectricCurrent_ALTERNATING, IfcElectricCurrent_DIRECT, IfcElectricCurrent_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2381,6 +2435,7 @@ public:
     typedef enum {IfcElectricDistributionPointFunction_ALARMPANEL, IfcElectricDistributionPointFunction_CONSUMERUNIT, IfcElectricDistributionPointFunction_CONTROLPANEL, IfcElectricDistributionPointFunction_DISTRIBUTIONBOARD, IfcElectricDistributionPointFunction_GASDETECTORPANEL, IfcElectricDistributionPointFunction_INDICATORPANEL, IfcElectricDistributionPointFunction_MIMICPANEL, IfcElectricDistributionPointFunction_MOTORCONTROLCENTRE, IfcElectricDistributionPointFunction_SWITCHBOARD, IfcElectricDistributionPointFunction_USERDEFINED, IfcElectricDistributionPointFunction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2404,6 +2459,7 @@ public:
     typedef enum {IfcElectricFlowStorageDeviceType_BATTERY, IfcElectricFlowStorageDeviceType_CAPACITORBANK, IfcElectricFlowStorageDeviceType_HARMONICFILTER, IfcElectricFlowStorageDeviceType_INDUCTORBANK, IfcElectricFlowStorageDeviceType_UPS, IfcElectricFlowStorageDeviceType_USERDEFINED, IfcElectricFlowStorageDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2427,6 +2483,7 @@ public:
     typedef enum {IfcElectricGeneratorType_USERDEFINED, IfcElectricGeneratorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2441,6 +2498,7 @@ public:
     typedef enum {IfcElectricHeaterType_ELECTRICPOINTHEATER, IfcElectricHeaterType_ELECTRICCABLEHEATER, IfcElectricHeaterType_ELECTRICMATHEATER, IfcElectricHeaterType_USERDEFINED, IfcElectricHeaterType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2465,6 +2523,7 @@ public:
     typedef enum {IfcElectricMotorType_DC, IfcElectricMotorType_INDUCTION, IfcElectricMotorType_POLYPHASE, IfcElectricMotorType_RELUCTANCESYNCHRONOUS, IfcElectricMotorType_SYNCHRONOUS, IfcElectricMotorType_USERDEFINED, IfcElectricMotorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2487,6 +2546,7 @@ public:
     typedef enum {IfcElectricTimeControlType_TIMECLOCK, IfcElectricTimeControlType_TIMEDELAY, IfcElectricTimeControlType_RELAY, IfcElectricTimeControlType_USERDEFINED, IfcElectricTimeControlType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2519,6 +2579,7 @@ public:
     typedef enum {IfcElementAssemblyType_ACCESSORY_ASSEMBLY, IfcElementAssemblyType_ARCH, IfcElementAssemblyType_BEAM_GRID, IfcElementAssemblyType_BRACED_FRAME, IfcElementAssemblyType_GIRDER, IfcElementAssemblyType_REINFORCEMENT_UNIT, IfcElementAssemblyType_RIGID_FRAME, IfcElementAssemblyType_SLAB_FIELD, IfcElementAssemblyType_TRUSS, IfcElementAssemblyType_USERDEFINED, IfcElementAssemblyType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2544,6 +2605,7 @@ public:
     typedef enum {IfcElementComposition_COMPLEX, IfcElementComposition_ELEMENT, IfcElementComposition_PARTIAL} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2558,6 +2620,7 @@ public:
     typedef enum {IfcEnergySequence_PRIMARY, IfcEnergySequence_SECONDARY, IfcEnergySequence_TERTIARY, IfcEnergySequence_AUXILIARY, IfcEnergySequence_USERDEFINED, IfcEnergySequence_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2572,6 +2635,7 @@ public:
     typedef enum {IfcEnvironmentalImpactCategory_COMBINEDVALUE, IfcEnvironmentalImpactCategory_DISPOSAL, IfcEnvironmentalImpactCategory_EXTRACTION, IfcEnvironmentalImpactCategory_INSTALLATION, IfcEnvironmentalImpactCategory_MANUFACTURE, IfcEnvironmentalImpactCategory_TRANSPORTATION, IfcEnvironmentalImpactCategory_USERDEFINED, IfcEnvironmentalImpactCategory_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2601,6 +2665,7 @@ public:
     typedef enum {IfcEvaporativeCoolerType_DIRECTEVAPORATIVERANDOMMEDIAAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVERIGIDMEDIAAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVESLINGERSPACKAGEDAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVEPACKAGEDROTARYAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVEAIRWASHER, IfcEvaporativeCoolerType_INDIRECTEVAPORATIVEPACKAGEAIRCOOLER, IfcEvaporativeCoolerType_INDIRECTEVAPORATIVEWETCOIL, IfcEvaporativeCoolerType_INDIRECTEVAPORATIVECOOLINGTOWERORCOILCOOLER, IfcEvaporativeCoolerType_INDIRECTDIRECTCOMBINATION, IfcEvaporativeCoolerType_USERDEFINED, IfcEvaporativeCoolerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2627,6 +2692,7 @@ public:
     typedef enum {IfcEvaporatorType_DIRECTEXPANSIONSHELLANDTUBE, IfcEvaporatorType_DIRECTEXPANSIONTUBEINTUBE, IfcEvaporatorType_DIRECTEXPANSIONBRAZEDPLATE, IfcEvaporatorType_FLOODEDSHELLANDTUBE, IfcEvaporatorType_SHELLANDCOIL, IfcEvaporatorType_USERDEFINED, IfcEvaporatorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2654,6 +2720,7 @@ public:
     typedef enum {IfcFanType_CENTRIFUGALFORWARDCURVED, IfcFanType_CENTRIFUGALRADIAL, IfcFanType_CENTRIFUGALBACKWARDINCLINEDCURVED, IfcFanType_CENTRIFUGALAIRFOIL, IfcFanType_TUBEAXIAL, IfcFanType_VANEAXIAL, IfcFanType_PROPELLORAXIAL, IfcFanType_USERDEFINED, IfcFanType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2680,6 +2747,7 @@ public:
     typedef enum {IfcFilterType_AIRPARTICLEFILTER, IfcFilterType_ODORFILTER, IfcFilterType_OILFILTER, IfcFilterType_STRAINER, IfcFilterType_WATERFILTER, IfcFilterType_USERDEFINED, IfcFilterType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2706,6 +2774,7 @@ public:
     typedef enum {IfcFireSuppressionTerminalType_BREECHINGINLET, IfcFireSuppressionTerminalType_FIREHYDRANT, IfcFireSuppressionTerminalType_HOSEREEL, IfcFireSuppressionTerminalType_SPRINKLER, IfcFireSuppressionTerminalType_SPRINKLERDEFLECTOR, IfcFireSuppressionTerminalType_USERDEFINED, IfcFireSuppressionTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2727,6 +2796,7 @@ public:
     typedef enum {IfcFlowDirection_SOURCE, IfcFlowDirection_SINK, IfcFlowDirection_SOURCEANDSINK, IfcFlowDirection_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2756,6 +2826,7 @@ public:
     typedef enum {IfcFlowInstrumentType_PRESSUREGAUGE, IfcFlowInstrumentType_THERMOMETER, IfcFlowInstrumentType_AMMETER, IfcFlowInstrumentType_FREQUENCYMETER, IfcFlowInstrumentType_POWERFACTORMETER, IfcFlowInstrumentType_PHASEANGLEMETER, IfcFlowInstrumentType_VOLTMETER_PEAK, IfcFlowInstrumentType_VOLTMETER_RMS, IfcFlowInstrumentType_USERDEFINED, IfcFlowInstrumentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2784,6 +2855,7 @@ public:
     typedef enum {IfcFlowMeterType_ELECTRICMETER, IfcFlowMeterType_ENERGYMETER, IfcFlowMeterType_FLOWMETER, IfcFlowMeterType_GASMETER, IfcFlowMeterType_OILMETER, IfcFlowMeterType_WATERMETER, IfcFlowMeterType_USERDEFINED, IfcFlowMeterType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2811,6 +2883,7 @@ public:
     typedef enum {IfcFootingType_FOOTING_BEAM, IfcFootingType_PAD_FOOTING, IfcFootingType_PILE_CAP, IfcFootingType_STRIP_FOOTING, IfcFootingType_USERDEFINED, IfcFootingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2825,6 +2898,7 @@ public:
     typedef enum {IfcGasTerminalType_GASAPPLIANCE, IfcGasTerminalType_GASBOOSTER, IfcGasTerminalType_GASBURNER, IfcGasTerminalType_USERDEFINED, IfcGasTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2879,6 +2953,7 @@ public:
     typedef enum {IfcGeometricProjection_GRAPH_VIEW, IfcGeometricProjection_SKETCH_VIEW, IfcGeometricProjection_MODEL_VIEW, IfcGeometricProjection_PLAN_VIEW, IfcGeometricProjection_REFLECTED_PLAN_VIEW, IfcGeometricProjection_SECTION_VIEW, IfcGeometricProjection_ELEVATION_VIEW, IfcGeometricProjection_USERDEFINED, IfcGeometricProjection_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2898,6 +2973,7 @@ public:
     typedef enum {IfcGlobalOrLocal_GLOBAL_COORDS, IfcGlobalOrLocal_LOCAL_COORDS} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2920,6 +2996,7 @@ public:
     typedef enum {IfcHeatExchangerType_PLATE, IfcHeatExchangerType_SHELLANDTUBE, IfcHeatExchangerType_USERDEFINED, IfcHeatExchangerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2953,6 +3030,7 @@ public:
     typedef enum {IfcHumidifierType_STEAMINJECTION, IfcHumidifierType_ADIABATICAIRWASHER, IfcHumidifierType_ADIABATICPAN, IfcHumidifierType_ADIABATICWETTEDELEMENT, IfcHumidifierType_ADIABATICATOMIZING, IfcHumidifierType_ADIABATICULTRASONIC, IfcHumidifierType_ADIABATICRIGIDMEDIA, IfcHumidifierType_ADIABATICCOMPRESSEDAIRNOZZLE, IfcHumidifierType_ASSISTEDELECTRIC, IfcHumidifierType_ASSISTEDNATURALGAS, IfcHumidifierType_ASSISTEDPROPANE, IfcHumidifierType_ASSISTEDBUTANE, IfcHumidifierType_ASSISTEDSTEAM, IfcHumidifierType_USERDEFINED, IfcHumidifierType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3021,6 +3099,7 @@ public:
     typedef enum {IfcInternalOrExternal_INTERNAL, IfcInternalOrExternal_EXTERNAL, IfcInternalOrExternal_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3043,6 +3122,7 @@ public:
     typedef enum {IfcInventoryType_ASSETINVENTORY, IfcInventoryType_SPACEINVENTORY, IfcInventoryType_FURNITUREINVENTORY, IfcInventoryType_USERDEFINED, IfcInventoryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3063,6 +3143,7 @@ public:
     typedef enum {IfcJunctionBoxType_USERDEFINED, IfcJunctionBoxType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3093,6 +3174,7 @@ public:
     typedef enum {IfcLampType_COMPACTFLUORESCENT, IfcLampType_FLUORESCENT, IfcLampType_HIGHPRESSUREMERCURY, IfcLampType_HIGHPRESSURESODIUM, IfcLampType_METALHALIDE, IfcLampType_TUNGSTENFILAMENT, IfcLampType_USERDEFINED, IfcLampType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3115,6 +3197,7 @@ public:
     typedef enum {IfcLayerSetDirection_AXIS1, IfcLayerSetDirection_AXIS2, IfcLayerSetDirection_AXIS3} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3142,6 +3225,7 @@ public:
     typedef enum {IfcLightDistributionCurve_TYPE_A, IfcLightDistributionCurve_TYPE_B, IfcLightDistributionCurve_TYPE_C, IfcLightDistributionCurve_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3172,6 +3256,7 @@ public:
     typedef enum {IfcLightEmissionSource_COMPACTFLUORESCENT, IfcLightEmissionSource_FLUORESCENT, IfcLightEmissionSource_HIGHPRESSUREMERCURY, IfcLightEmissionSource_HIGHPRESSURESODIUM, IfcLightEmissionSource_LIGHTEMITTINGDIODE, IfcLightEmissionSource_LOWPRESSURESODIUM, IfcLightEmissionSource_LOWVOLTAGEHALOGEN, IfcLightEmissionSource_MAINVOLTAGEHALOGEN, IfcLightEmissionSource_METALHALIDE, IfcLightEmissionSource_TUNGSTENFILAMENT, IfcLightEmissionSource_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3196,6 +3281,7 @@ public:
     typedef enum {IfcLightFixtureType_POINTSOURCE, IfcLightFixtureType_DIRECTIONSOURCE, IfcLightFixtureType_USERDEFINED, IfcLightFixtureType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3230,6 +3316,7 @@ public:
     typedef enum {IfcLoadGroupType_LOAD_GROUP, IfcLoadGroupType_LOAD_CASE, IfcLoadGroupType_LOAD_COMBINATION_GROUP, IfcLoadGroupType_LOAD_COMBINATION, IfcLoadGroupType_USERDEFINED, IfcLoadGroupType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3487,6 +3574,7 @@ public:
     typedef enum {IfcLogicalOperator_LOGICALAND, IfcLogicalOperator_LOGICALOR} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3543,6 +3631,7 @@ public:
     typedef enum {IfcMemberType_BRACE, IfcMemberType_CHORD, IfcMemberType_COLLAR, IfcMemberType_MEMBER, IfcMemberType_MULLION, IfcMemberType_PLATE, IfcMemberType_POST, IfcMemberType_PURLIN, IfcMemberType_RAFTER, IfcMemberType_STRINGER, IfcMemberType_STRUT, IfcMemberType_STUD, IfcMemberType_USERDEFINED, IfcMemberType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3565,6 +3654,7 @@ public:
     typedef enum {IfcMotorConnectionType_BELTDRIVE, IfcMotorConnectionType_COUPLING, IfcMotorConnectionType_DIRECTDRIVE, IfcMotorConnectionType_USERDEFINED, IfcMotorConnectionType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3586,6 +3676,7 @@ public:
     typedef enum {IfcNullStyle_NULL} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3602,6 +3693,7 @@ public:
     typedef enum {IfcObjectType_PRODUCT, IfcObjectType_PROCESS, IfcObjectType_CONTROL, IfcObjectType_RESOURCE, IfcObjectType_ACTOR, IfcObjectType_GROUP, IfcObjectType_PROJECT, IfcObjectType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3644,6 +3736,7 @@ public:
     typedef enum {IfcObjective_CODECOMPLIANCE, IfcObjective_DESIGNINTENT, IfcObjective_HEALTHANDSAFETY, IfcObjective_REQUIREMENT, IfcObjective_SPECIFICATION, IfcObjective_TRIGGERCONDITION, IfcObjective_USERDEFINED, IfcObjective_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3670,6 +3763,7 @@ public:
     typedef enum {IfcOccupantType_ASSIGNEE, IfcOccupantType_ASSIGNOR, IfcOccupantType_LESSEE, IfcOccupantType_LESSOR, IfcOccupantType_LETTINGAGENT, IfcOccupantType_OWNER, IfcOccupantType_TENANT, IfcOccupantType_USERDEFINED, IfcOccupantType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3696,6 +3790,7 @@ public:
     typedef enum {IfcOutletType_AUDIOVISUALOUTLET, IfcOutletType_COMMUNICATIONSOUTLET, IfcOutletType_POWEROUTLET, IfcOutletType_USERDEFINED, IfcOutletType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3731,6 +3826,7 @@ public:
     typedef enum {IfcPermeableCoveringOperation_GRILL, IfcPermeableCoveringOperation_LOUVER, IfcPermeableCoveringOperation_SCREEN, IfcPermeableCoveringOperation_USERDEFINED, IfcPermeableCoveringOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3767,6 +3863,7 @@ public:
     typedef enum {IfcPhysicalOrVirtual_PHYSICAL, IfcPhysicalOrVirtual_VIRTUAL, IfcPhysicalOrVirtual_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3802,6 +3899,7 @@ public:
     typedef enum {IfcPileConstruction_CAST_IN_PLACE, IfcPileConstruction_COMPOSITE, IfcPileConstruction_PRECAST_CONCRETE, IfcPileConstruction_PREFAB_STEEL, IfcPileConstruction_USERDEFINED, IfcPileConstruction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3828,6 +3926,7 @@ public:
     typedef enum {IfcPileType_COHESION, IfcPileType_FRICTION, IfcPileType_SUPPORT, IfcPileType_USERDEFINED, IfcPileType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3872,6 +3971,7 @@ public:
     typedef enum {IfcPipeFittingType_BEND, IfcPipeFittingType_CONNECTOR, IfcPipeFittingType_ENTRY, IfcPipeFittingType_EXIT, IfcPipeFittingType_JUNCTION, IfcPipeFittingType_OBSTRUCTION, IfcPipeFittingType_TRANSITION, IfcPipeFittingType_USERDEFINED, IfcPipeFittingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3900,6 +4000,7 @@ public:
     typedef enum {IfcPipeSegmentType_FLEXIBLESEGMENT, IfcPipeSegmentType_RIGIDSEGMENT, IfcPipeSegmentType_GUTTER, IfcPipeSegmentType_SPOOL, IfcPipeSegmentType_USERDEFINED, IfcPipeSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3931,6 +4032,7 @@ public:
     typedef enum {IfcPlateType_CURTAIN_PANEL, IfcPlateType_SHEET, IfcPlateType_USERDEFINED, IfcPlateType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3958,6 +4060,7 @@ public:
     typedef enum {IfcProcedureType_ADVICE_CAUTION, IfcProcedureType_ADVICE_NOTE, IfcProcedureType_ADVICE_WARNING, IfcProcedureType_CALIBRATION, IfcProcedureType_DIAGNOSTIC, IfcProcedureType_SHUTDOWN, IfcProcedureType_STARTUP, IfcProcedureType_USERDEFINED, IfcProcedureType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3979,6 +4082,7 @@ public:
     typedef enum {IfcProfileType_CURVE, IfcProfileType_AREA} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3993,6 +4097,7 @@ public:
     typedef enum {IfcProjectOrderRecordType_CHANGE, IfcProjectOrderRecordType_MAINTENANCE, IfcProjectOrderRecordType_MOVE, IfcProjectOrderRecordType_PURCHASE, IfcProjectOrderRecordType_WORK, IfcProjectOrderRecordType_USERDEFINED, IfcProjectOrderRecordType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4017,6 +4122,7 @@ public:
     typedef enum {IfcProjectOrderType_CHANGEORDER, IfcProjectOrderType_MAINTENANCEWORKORDER, IfcProjectOrderType_MOVEORDER, IfcProjectOrderType_PURCHASEORDER, IfcProjectOrderType_WORKORDER, IfcProjectOrderType_USERDEFINED, IfcProjectOrderType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4036,6 +4142,7 @@ public:
     typedef enum {IfcProjectedOrTrueLength_PROJECTED_LENGTH, IfcProjectedOrTrueLength_TRUE_LENGTH} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4050,6 +4157,7 @@ public:
     typedef enum {IfcPropertySource_DESIGN, IfcPropertySource_DESIGNMAXIMUM, IfcPropertySource_DESIGNMINIMUM, IfcPropertySource_SIMULATED, IfcPropertySource_ASBUILT, IfcPropertySource_COMMISSIONING, IfcPropertySource_MEASURED, IfcPropertySource_USERDEFINED, IfcPropertySource_NOTKNOWN} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4078,6 +4186,7 @@ public:
     typedef enum {IfcProtectiveDeviceType_FUSEDISCONNECTOR, IfcProtectiveDeviceType_CIRCUITBREAKER, IfcProtectiveDeviceType_EARTHFAILUREDEVICE, IfcProtectiveDeviceType_RESIDUALCURRENTCIRCUITBREAKER, IfcProtectiveDeviceType_RESIDUALCURRENTSWITCH, IfcProtectiveDeviceType_VARISTOR, IfcProtectiveDeviceType_USERDEFINED, IfcProtectiveDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4119,6 +4228,7 @@ public:
     typedef enum {IfcPumpType_CIRCULATOR, IfcPumpType_ENDSUCTION, IfcPumpType_SPLITCASE, IfcPumpType_VERTICALINLINE, IfcPumpType_VERTICALTURBINE, IfcPumpType_USERDEFINED, IfcPumpType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4152,6 +4262,7 @@ public:
     typedef enum {IfcRailingType_HANDRAIL, IfcRailingType_GUARDRAIL, IfcRailingType_BALUSTRADE, IfcRailingType_USERDEFINED, IfcRailingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4176,6 +4287,7 @@ public:
     typedef enum {IfcRampFlightType_STRAIGHT, IfcRampFlightType_SPIRAL, IfcRampFlightType_USERDEFINED, IfcRampFlightType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4237,6 +4349,7 @@ public:
     typedef enum {IfcRampType_STRAIGHT_RUN_RAMP, IfcRampType_TWO_STRAIGHT_RUN_RAMP, IfcRampType_QUARTER_TURN_RAMP, IfcRampType_TWO_QUARTER_TURN_RAMP, IfcRampType_HALF_TURN_RAMP, IfcRampType_SPIRAL_RAMP, IfcRampType_USERDEFINED, IfcRampType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4266,6 +4379,7 @@ public:
     typedef enum {IfcReflectanceMethod_BLINN, IfcReflectanceMethod_FLAT, IfcReflectanceMethod_GLASS, IfcReflectanceMethod_MATT, IfcReflectanceMethod_METAL, IfcReflectanceMethod_MIRROR, IfcReflectanceMethod_PHONG, IfcReflectanceMethod_PLASTIC, IfcReflectanceMethod_STRAUSS, IfcReflectanceMethod_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4298,6 +4412,7 @@ public:
     typedef enum {IfcReinforcingBarRole_MAIN, IfcReinforcingBarRole_SHEAR, IfcReinforcingBarRole_LIGATURE, IfcReinforcingBarRole_STUD, IfcReinforcingBarRole_PUNCHING, IfcReinforcingBarRole_EDGE, IfcReinforcingBarRole_RING, IfcReinforcingBarRole_USERDEFINED, IfcReinforcingBarRole_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4320,6 +4435,7 @@ public:
     typedef enum {IfcReinforcingBarSurface_PLAIN, IfcReinforcingBarSurface_TEXTURED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4345,6 +4461,7 @@ public:
     typedef enum {IfcResourceConsumption_CONSUMED, IfcResourceConsumption_PARTIALLYCONSUMED, IfcResourceConsumption_NOTCONSUMED, IfcResourceConsumption_OCCUPIED, IfcResourceConsumption_PARTIALLYOCCUPIED, IfcResourceConsumption_NOTOCCUPIED, IfcResourceConsumption_USERDEFINED, IfcResourceConsumption_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4359,6 +4476,7 @@ public:
     typedef enum {IfcRibPlateDirection_DIRECTION_X, IfcRibPlateDirection_DIRECTION_Y} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4401,6 +4519,7 @@ public:
     typedef enum {IfcRole_SUPPLIER, IfcRole_MANUFACTURER, IfcRole_CONTRACTOR, IfcRole_SUBCONTRACTOR, IfcRole_ARCHITECT, IfcRole_STRUCTURALENGINEER, IfcRole_COSTENGINEER, IfcRole_CLIENT, IfcRole_BUILDINGOWNER, IfcRole_BUILDINGOPERATOR, IfcRole_MECHANICALENGINEER, IfcRole_ELECTRICALENGINEER, IfcRole_PROJECTMANAGER, IfcRole_FACILITIESMANAGER, IfcRole_CIVILENGINEER, IfcRole_COMISSIONINGENGINEER, IfcRole_ENGINEER, IfcRole_OWNER, IfcRole_CONSULTANT, IfcRole_CONSTRUCTIONMANAGER, IfcRole_FIELDCONSTRUCTIONMANAGER, IfcRole_RESELLER, IfcRole_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4480,6 +4599,7 @@ public:
     typedef enum {IfcRoofType_FLAT_ROOF, IfcRoofType_SHED_ROOF, IfcRoofType_GABLE_ROOF, IfcRoofType_HIP_ROOF, IfcRoofType_HIPPED_GABLE_ROOF, IfcRoofType_GAMBREL_ROOF, IfcRoofType_MANSARD_ROOF, IfcRoofType_BARREL_ROOF, IfcRoofType_RAINBOW_ROOF, IfcRoofType_BUTTERFLY_ROOF, IfcRoofType_PAVILION_ROOF, IfcRoofType_DOME_ROOF, IfcRoofType_FREEFORM, IfcRoofType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4520,6 +4640,7 @@ public:
     typedef enum {IfcSIPrefix_EXA, IfcSIPrefix_PETA, IfcSIPrefix_TERA, IfcSIPrefix_GIGA, IfcSIPrefix_MEGA, IfcSIPrefix_KILO, IfcSIPrefix_HECTO, IfcSIPrefix_DECA, IfcSIPrefix_DECI, IfcSIPrefix_CENTI, IfcSIPrefix_MILLI, IfcSIPrefix_MICRO, IfcSIPrefix_NANO, IfcSIPrefix_PICO, IfcSIPrefix_FEMTO, IfcSIPrefix_ATTO} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4572,6 +4693,7 @@ public:
     typedef enum {IfcSIUnitName_AMPERE, IfcSIUnitName_BECQUEREL, IfcSIUnitName_CANDELA, IfcSIUnitName_COULOMB, IfcSIUnitName_CUBIC_METRE, IfcSIUnitName_DEGREE_CELSIUS, IfcSIUnitName_FARAD, IfcSIUnitName_GRAM, IfcSIUnitName_GRAY, IfcSIUnitName_HENRY, IfcSIUnitName_HERTZ, IfcSIUnitName_JOULE, IfcSIUnitName_KELVIN, IfcSIUnitName_LUMEN, IfcSIUnitName_LUX, IfcSIUnitName_METRE, IfcSIUnitName_MOLE, IfcSIUnitName_NEWTON, IfcSIUnitName_OHM, IfcSIUnitName_PASCAL, IfcSIUnitName_RADIAN, IfcSIUnitName_SECOND, IfcSIUnitName_SIEMENS, IfcSIUnitName_SIEVERT, IfcSIUnitName_SQUARE_METRE, IfcSIUnitName_STERADIAN, IfcSIUnitName_TESLA, IfcSIUnitName_VOLT, IfcSIUnitName_WATT, IfcSIUnitName_WEBER} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4604,6 +4726,7 @@ public:
     typedef enum {IfcSanitaryTerminalType_BATH, IfcSanitaryTerminalType_BIDET, IfcSanitaryTerminalType_CISTERN, IfcSanitaryTerminalType_SHOWER, IfcSanitaryTerminalType_SINK, IfcSanitaryTerminalType_SANITARYFOUNTAIN, IfcSanitaryTerminalType_TOILETPAN, IfcSanitaryTerminalType_URINAL, IfcSanitaryTerminalType_WASHHANDBASIN, IfcSanitaryTerminalType_WCSEAT, IfcSanitaryTerminalType_USERDEFINED, IfcSanitaryTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4627,6 +4750,7 @@ public:
     typedef enum {IfcSectionType_UNIFORM, IfcSectionType_TAPERED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4668,6 +4792,7 @@ public:
     typedef enum {IfcSensorType_CO2SENSOR, IfcSensorType_FIRESENSOR, IfcSensorType_FLOWSENSOR, IfcSensorType_GASSENSOR, IfcSensorType_HEATSENSOR, IfcSensorType_HUMIDITYSENSOR, IfcSensorType_LIGHTSENSOR, IfcSensorType_MOISTURESENSOR, IfcSensorType_MOVEMENTSENSOR, IfcSensorType_PRESSURESENSOR, IfcSensorType_SMOKESENSOR, IfcSensorType_SOUNDSENSOR, IfcSensorType_TEMPERATURESENSOR, IfcSensorType_USERDEFINED, IfcSensorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4686,6 +4811,7 @@ public:
     typedef enum {IfcSequence_START_START, IfcSequence_START_FINISH, IfcSequence_FINISH_START, IfcSequence_FINISH_FINISH, IfcSequence_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4700,6 +4826,7 @@ public:
     typedef enum {IfcServiceLifeFactorType_A_QUALITYOFCOMPONENTS, IfcServiceLifeFactorType_B_DESIGNLEVEL, IfcServiceLifeFactorType_C_WORKEXECUTIONLEVEL, IfcServiceLifeFactorType_D_INDOORENVIRONMENT, IfcServiceLifeFactorType_E_OUTDOORENVIRONMENT, IfcServiceLifeFactorType_F_INUSECONDITIONS, IfcServiceLifeFactorType_G_MAINTENANCELEVEL, IfcServiceLifeFactorType_USERDEFINED, IfcServiceLifeFactorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4714,6 +4841,7 @@ public:
     typedef enum {IfcServiceLifeType_ACTUALSERVICELIFE, IfcServiceLifeType_EXPECTEDSERVICELIFE, IfcServiceLifeType_OPTIMISTICREFERENCESERVICELIFE, IfcServiceLifeType_PESSIMISTICREFERENCESERVICELIFE, IfcServiceLifeType_REFERENCESERVICELIFE} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4759,6 +4887,7 @@ public:
     typedef enum {IfcSlabType_FLOOR, IfcSlabType_ROOF, IfcSlabType_LANDING, IfcSlabType_BASESLAB, IfcSlabType_USERDEFINED, IfcSlabType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4773,6 +4902,7 @@ public:
     typedef enum {IfcSoundScale_DBA, IfcSoundScale_DBB, IfcSoundScale_DBC, IfcSoundScale_NC, IfcSoundScale_NR, IfcSoundScale_USERDEFINED, IfcSoundScale_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4798,6 +4928,7 @@ public:
     typedef enum {IfcSpaceHeaterType_SECTIONALRADIATOR, IfcSpaceHeaterType_PANELRADIATOR, IfcSpaceHeaterType_TUBULARRADIATOR, IfcSpaceHeaterType_CONVECTOR, IfcSpaceHeaterType_BASEBOARDHEATER, IfcSpaceHeaterType_FINNEDTUBEUNIT, IfcSpaceHeaterType_UNITHEATER, IfcSpaceHeaterType_USERDEFINED, IfcSpaceHeaterType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4846,6 +4977,7 @@ public:
     typedef enum {IfcSpaceType_USERDEFINED, IfcSpaceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4868,6 +5000,7 @@ public:
     typedef enum {IfcStackTerminalType_BIRDCAGE, IfcStackTerminalType_COWL, IfcStackTerminalType_RAINWATERHOPPER, IfcStackTerminalType_USERDEFINED, IfcStackTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4896,6 +5029,7 @@ public:
     typedef enum {IfcStairFlightType_STRAIGHT, IfcStairFlightType_WINDER, IfcStairFlightType_SPIRAL, IfcStairFlightType_CURVED, IfcStairFlightType_FREEFORM, IfcStairFlightType_USERDEFINED, IfcStairFlightType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5002,6 +5136,7 @@ public:
     typedef enum {IfcStairType_STRAIGHT_RUN_STAIR, IfcStairType_TWO_STRAIGHT_RUN_STAIR, IfcStairType_QUARTER_WINDING_STAIR, IfcStairType_QUARTER_TURN_STAIR, IfcStairType_HALF_WINDING_STAIR, IfcStairType_HALF_TURN_STAIR, IfcStairType_TWO_QUARTER_WINDING_STAIR, IfcStairType_TWO_QUARTER_TURN_STAIR, IfcStairType_THREE_QUARTER_WINDING_STAIR, IfcStairType_THREE_QUARTER_TURN_STAIR, IfcStairType_SPIRAL_STAIR, IfcStairType_DOUBLE_RETURN_STAIR, IfcStairType_CURVED_RUN_STAIR, IfcStairType_TWO_CURVED_RUN_STAIR, IfcStairType_USERDEFINED, IfcStairType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5028,6 +5163,7 @@ public:
     typedef enum {IfcState_READWRITE, IfcState_READONLY, IfcState_LOCKED, IfcState_READWRITELOCKED, IfcState_READONLYLOCKED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5042,6 +5178,7 @@ public:
     typedef enum {IfcStructuralCurveType_RIGID_JOINED_MEMBER, IfcStructuralCurveType_PIN_JOINED_MEMBER, IfcStructuralCurveType_CABLE, IfcStructuralCurveType_TENSION_MEMBER, IfcStructuralCurveType_COMPRESSION_MEMBER, IfcStructuralCurveType_USERDEFINED, IfcStructuralCurveType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5056,6 +5193,7 @@ public:
     typedef enum {IfcStructuralSurfaceType_BENDING_ELEMENT, IfcStructuralSurfaceType_MEMBRANE_ELEMENT, IfcStructuralSurfaceType_SHELL, IfcStructuralSurfaceType_USERDEFINED, IfcStructuralSurfaceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5080,6 +5218,7 @@ public:
     typedef enum {IfcSurfaceSide_POSITIVE, IfcSurfaceSide_NEGATIVE, IfcSurfaceSide_BOTH} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5094,6 +5233,7 @@ public:
     typedef enum {IfcSurfaceTexture_BUMP, IfcSurfaceTexture_OPACITY, IfcSurfaceTexture_REFLECTION, IfcSurfaceTexture_SELFILLUMINATION, IfcSurfaceTexture_SHININESS, IfcSurfaceTexture_SPECULAR, IfcSurfaceTexture_TEXTURE, IfcSurfaceTexture_TRANSPARENCYMAP, IfcSurfaceTexture_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5123,6 +5263,7 @@ public:
     typedef enum {IfcSwitchingDeviceType_CONTACTOR, IfcSwitchingDeviceType_EMERGENCYSTOP, IfcSwitchingDeviceType_STARTER, IfcSwitchingDeviceType_SWITCHDISCONNECTOR, IfcSwitchingDeviceType_TOGGLESWITCH, IfcSwitchingDeviceType_USERDEFINED, IfcSwitchingDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5159,6 +5300,7 @@ public:
     typedef enum {IfcTankType_PREFORMED, IfcTankType_SECTIONAL, IfcTankType_EXPANSION, IfcTankType_PRESSUREVESSEL, IfcTankType_USERDEFINED, IfcTankType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5173,6 +5315,7 @@ public:
     typedef enum {IfcTendonType_STRAND, IfcTendonType_WIRE, IfcTendonType_BAR, IfcTendonType_COATED, IfcTendonType_USERDEFINED, IfcTendonType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5193,6 +5336,7 @@ public:
     typedef enum {IfcTextPath_LEFT, IfcTextPath_RIGHT, IfcTextPath_UP, IfcTextPath_DOWN} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5207,6 +5351,7 @@ public:
     typedef enum {IfcThermalLoadSource_PEOPLE, IfcThermalLoadSource_LIGHTING, IfcThermalLoadSource_EQUIPMENT, IfcThermalLoadSource_VENTILATIONINDOORAIR, IfcThermalLoadSource_VENTILATIONOUTSIDEAIR, IfcThermalLoadSource_RECIRCULATEDAIR, IfcThermalLoadSource_EXHAUSTAIR, IfcThermalLoadSource_AIREXCHANGERATE, IfcThermalLoadSource_DRYBULBTEMPERATURE, IfcThermalLoadSource_RELATIVEHUMIDITY, IfcThermalLoadSource_INFILTRATION, IfcThermalLoadSource_USERDEFINED, IfcThermalLoadSource_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5221,6 +5366,7 @@ public:
     typedef enum {IfcThermalLoadType_SENSIBLE, IfcThermalLoadType_LATENT, IfcThermalLoadType_RADIANT, IfcThermalLoadType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5245,6 +5391,7 @@ public:
     typedef enum {IfcTimeSeriesDataType_CONTINUOUS, IfcTimeSeriesDataType_DISCRETE, IfcTimeSeriesDataType_DISCRETEBINARY, IfcTimeSeriesDataType_PIECEWISEBINARY, IfcTimeSeriesDataType_PIECEWISECONSTANT, IfcTimeSeriesDataType_PIECEWISECONTINUOUS, IfcTimeSeriesDataType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5259,6 +5406,7 @@ public:
     typedef enum {IfcTimeSeriesScheduleType_ANNUAL, IfcTimeSeriesScheduleType_MONTHLY, IfcTimeSeriesScheduleType_WEEKLY, IfcTimeSeriesScheduleType_DAILY, IfcTimeSeriesScheduleType_USERDEFINED, IfcTimeSeriesScheduleType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5283,6 +5431,7 @@ public:
     typedef enum {IfcTransformerType_CURRENT, IfcTransformerType_FREQUENCY, IfcTransformerType_VOLTAGE, IfcTransformerType_USERDEFINED, IfcTransformerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5312,6 +5461,7 @@ public:
     typedef enum {IfcTransitionCode_DISCONTINUOUS, IfcTransitionCode_CONTINUOUS, IfcTransitionCode_CONTSAMEGRADIENT, IfcTransitionCode_CONTSAMEGRADIENTSAMECURVATURE} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5349,6 +5499,7 @@ public:
     typedef enum {IfcTransportElementType_ELEVATOR, IfcTransportElementType_ESCALATOR, IfcTransportElementType_MOVINGWALKWAY, IfcTransportElementType_USERDEFINED, IfcTransportElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5373,6 +5524,7 @@ public:
     typedef enum {IfcTrimmingPreference_CARTESIAN, IfcTrimmingPreference_PARAMETER, IfcTrimmingPreference_UNSPECIFIED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5394,6 +5546,7 @@ public:
     typedef enum {IfcTubeBundleType_FINNED, IfcTubeBundleType_USERDEFINED, IfcTubeBundleType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5443,6 +5596,7 @@ public:
     typedef enum {IfcUnit_ABSORBEDDOSEUNIT, IfcUnit_AMOUNTOFSUBSTANCEUNIT, IfcUnit_AREAUNIT, IfcUnit_DOSEEQUIVALENTUNIT, IfcUnit_ELECTRICCAPACITANCEUNIT, IfcUnit_ELECTRICCHARGEUNIT, IfcUnit_ELECTRICCONDUCTANCEUNIT, IfcUnit_ELECTRICCURRENTUNIT, IfcUnit_ELECTRICRESISTANCEUNIT, IfcUnit_ELECTRICVOLTAGEUNIT, IfcUnit_ENERGYUNIT, IfcUnit_FORCEUNIT, IfcUnit_FREQUENCYUNIT, IfcUnit_ILLUMINANCEUNIT, IfcUnit_INDUCTANCEUNIT, IfcUnit_LENGTHUNIT, IfcUnit_LUMINOUSFLUXUNIT, IfcUnit_LUMINOUSINTENSITYUNIT, IfcUnit_MAGNETICFLUXDENSITYUNIT, IfcUnit_MAGNETICFLUXUNIT, IfcUnit_MASSUNIT, IfcUnit_PLANEANGLEUNIT, IfcUnit_POWERUNIT, IfcUnit_PRESSUREUNIT, IfcUnit_RADIOACTIVITYUNIT, IfcUnit_SOLIDANGLEUNIT, IfcUnit_THERMODYNAMICTEMPERATUREUNIT, IfcUnit_TIMEUNIT, IfcUnit_VOLUMEUNIT, IfcUnit_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5468,6 +5622,7 @@ public:
     typedef enum {IfcUnitaryEquipmentType_AIRHANDLER, IfcUnitaryEquipmentType_AIRCONDITIONINGUNIT, IfcUnitaryEquipmentType_SPLITSYSTEM, IfcUnitaryEquipmentType_ROOFTOPUNIT, IfcUnitaryEquipmentType_USERDEFINED, IfcUnitaryEquipmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5524,6 +5679,7 @@ public:
     typedef enum {IfcValveType_AIRRELEASE, IfcValveType_ANTIVACUUM, IfcValveType_CHANGEOVER, IfcValveType_CHECK, IfcValveType_COMMISSIONING, IfcValveType_DIVERTING, IfcValveType_DRAWOFFCOCK, IfcValveType_DOUBLECHECK, IfcValveType_DOUBLEREGULATING, IfcValveType_FAUCET, IfcValveType_FLUSHING, IfcValveType_GASCOCK, IfcValveType_GASTAP, IfcValveType_ISOLATING, IfcValveType_MIXING, IfcValveType_PRESSUREREDUCING, IfcValveType_PRESSURERELIEF, IfcValveType_REGULATING, IfcValveType_SAFETYCUTOFF, IfcValveType_STEAMTRAP, IfcValveType_STOPCOCK, IfcValveType_USERDEFINED, IfcValveType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5546,6 +5702,7 @@ public:
     typedef enum {IfcVibrationIsolatorType_COMPRESSION, IfcVibrationIsolatorType_SPRING, IfcVibrationIsolatorType_USERDEFINED, IfcVibrationIsolatorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5596,6 +5753,7 @@ public:
     typedef enum {IfcWallType_STANDARD, IfcWallType_POLYGONAL, IfcWallType_SHEAR, IfcWallType_ELEMENTEDWALL, IfcWallType_PLUMBINGWALL, IfcWallType_USERDEFINED, IfcWallType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5623,6 +5781,7 @@ public:
     typedef enum {IfcWasteTerminalType_FLOORTRAP, IfcWasteTerminalType_FLOORWASTE, IfcWasteTerminalType_GULLYSUMP, IfcWasteTerminalType_GULLYTRAP, IfcWasteTerminalType_GREASEINTERCEPTOR, IfcWasteTerminalType_OILINTERCEPTOR, IfcWasteTerminalType_PETROLINTERCEPTOR, IfcWasteTerminalType_ROOFDRAIN, IfcWasteTerminalType_WASTEDISPOSALUNIT, IfcWasteTerminalType_WASTETRAP, IfcWasteTerminalType_USERDEFINED, IfcWasteTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5720,6 +5879,7 @@ public:
     typedef enum {IfcWindowPanelOperation_SIDEHUNGRIGHTHAND, IfcWindowPanelOperation_SIDEHUNGLEFTHAND, IfcWindowPanelOperation_TILTANDTURNRIGHTHAND, IfcWindowPanelOperation_TILTANDTURNLEFTHAND, IfcWindowPanelOperation_TOPHUNG, IfcWindowPanelOperation_BOTTOMHUNG, IfcWindowPanelOperation_PIVOTHORIZONTAL, IfcWindowPanelOperation_PIVOTVERTICAL, IfcWindowPanelOperation_SLIDINGHORIZONTAL, IfcWindowPanelOperation_SLIDINGVERTICAL, IfcWindowPanelOperation_REMOVABLECASEMENT, IfcWindowPanelOperation_FIXEDCASEMENT, IfcWindowPanelOperation_OTHEROPERATION, IfcWindowPanelOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5797,6 +5957,7 @@ public:
     typedef enum {IfcWindowPanelPosition_LEFT, IfcWindowPanelPosition_MIDDLE, IfcWindowPanelPosition_RIGHT, IfcWindowPanelPosition_BOTTOM, IfcWindowPanelPosition_TOP, IfcWindowPanelPosition_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5817,6 +5978,7 @@ public:
     typedef enum {IfcWindowStyleConstruction_ALUMINIUM, IfcWindowStyleConstruction_HIGH_GRADE_STEEL, IfcWindowStyleConstruction_STEEL, IfcWindowStyleConstruction_WOOD, IfcWindowStyleConstruction_ALUMINIUM_WOOD, IfcWindowStyleConstruction_PLASTIC, IfcWindowStyleConstruction_OTHER_CONSTRUCTION, IfcWindowStyleConstruction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5904,6 +6066,7 @@ public:
     typedef enum {IfcWindowStyleOperation_SINGLE_PANEL, IfcWindowStyleOperation_DOUBLE_PANEL_VERTICAL, IfcWindowStyleOperation_DOUBLE_PANEL_HORIZONTAL, IfcWindowStyleOperation_TRIPLE_PANEL_VERTICAL, IfcWindowStyleOperation_TRIPLE_PANEL_BOTTOM, IfcWindowStyleOperation_TRIPLE_PANEL_TOP, IfcWindowStyleOperation_TRIPLE_PANEL_LEFT, IfcWindowStyleOperation_TRIPLE_PANEL_RIGHT, IfcWindowStyleOperation_TRIPLE_PANEL_HORIZONTAL, IfcWindowStyleOperation_USERDEFINED, IfcWindowStyleOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5918,6 +6081,7 @@ public:
     typedef enum {IfcWorkControlType_ACTUAL, IfcWorkControlType_BASELINE, IfcWorkControlType_PLANNED, IfcWorkControlType_USERDEFINED, IfcWorkControlType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2325,6 +2325,125 @@ class IFC4_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4_keyword_displacements[293] = {
+    4, 70, 19, 1, 5, 5, 14, 38, 42, 16, 8, 4, 22, 4, 6, 13,
+    1, 1, 3, 39, 3, 1, 3, 4, 5, 34, 46, 17, 1, 2, 6, 8,
+    2, 3, 1, 7, 1, 16, 14, 8, 6, 4, 3, 8, 8, 4, 6, 16,
+    57, 7, 1, 4, 1, 18, 26, 9, 160, 13, 3, 8, 42, 8, 6, 1,
+    2, 1, 3, 14, 16, 31, 11, 1, 1, 25, 8, 32, 3, 32, 29, 10,
+    4, 8, 9, 3, 3, 19, 7, 2, 24, 2, 17, 2, 4, 15, 42, 22,
+    10, 2, 5, 6, 2, 3, 6, 1, 10, 1, 58, 9, 3, 1, 3, 23,
+    17, 1, 9, 41, 28, 21, 0, 7, 6, 18, 35, 8, 8, 5, 3, 9,
+    23, 4, 12, 14, 7, 12, 23, 17, 1, 0, 20, 2, 23, 47, 1, 19,
+    2, 13, 81, 9, 34, 11, 26, 76, 24, 9, 1, 7, 27, 7, 6, 3,
+    93, 5, 13, 44, 37, 1, 24, 1, 34, 21, 1, 21, 3, 15, 0, 7,
+    2, 11, 1, 30, 18, 1, 5, 10, 27, 11, 43, 23, 9, 15, 12, 21,
+    59, 1, 4, 27, 12, 30, 4, 51, 1, 2, 28, 14, 6, 93, 7, 1,
+    34, 5, 11, 9, 3, 4, 2, 9, 13, 93, 28, 1, 19, 73, 1, 19,
+    33, 6, 2, 4, 4, 49, 6, 11, 5, 37, 1, 40, 13, 3, 9, 11,
+    11, 15, 5, 4, 2, 5, 6, 13, 4, 3, 10, 8, 23, 4, 34, 14,
+    35, 0, 4, 19, 36, 98, 1, 1, 1, 4, 3, 5, 2, 0, 6, 8,
+    9, 5, 5, 6, 24, 24, 2, 14, 1, 32, 24, 3, 3, 29, 8, 1,
+    3, 10, 7, 3, 17
+};
+
+static const int16_t IFC4_keyword_slots[1466] = {
+    538, 1017, 817, 1057, 215, 958, 907, 246, 661, 340, 698, 1092, 671, 234, 858, 768,
+    188, 490, 179, 1084, 650, 642, 1118, 812, 984, -1, 250, 873, 209, 1100, 973, 692,
+    97, 435, 604, 1061, 260, 599, 1048, -1, 88, -1, 239, 482, -1, 1111, 437, 945,
+    -1, 1132, 976, 94, 316, 124, -1, 457, 1107, 302, 301, 961, -1, -1, 485, 675,
+    116, 903, 424, -1, -1, 877, -1, 682, 304, 715, 1142, 934, 240, 137, 461, 589,
+    442, 83, -1, 1085, 373, -1, 855, 462, 605, -1, 664, 521, -1, 571, -1, 499,
+    463, 1027, 868, 819, 444, 602, 266, 1101, 543, 337, 541, -1, 520, 180, 1028, 578,
+    -1, -1, 456, 609, 82, 311, 748, 628, -1, 672, -1, 134, 1119, 272, 13, 1151,
+    100, 760, 1170, -1, 544, 27, -1, 228, 295, 1072, 368, 920, 686, 236, 148, 558,
+    229, 534, -1, -1, -1, -1, 553, 1105, 957, 1136, 481, 235, 42, 648, -1, 615,
+    580, 265, 401, 809, 96, 113, -1, 972, -1, 848, 253, 1039, 940, -1, 39, 874,
+    335, -1, 1042, 76, 72, 111, -1, -1, 522, -1, 69, -1, 1155, -1, -1, -1,
+    9, 326, 703, 129, 820, 999, 668, 2, -1, 395, 315, 221, 52, 398, -1, 687,
+    -1, 842, -1, 631, 479, 592, 802, 1037, -1, 379, 32, -1, 20, 763, -1, 1068,
+    350, 561, 291, 1036, 1167, -1, 769, 471, 994, 1109, 964, 695, 1115, 233, 1076, 273,
+    -1, -1, 1120, 654, 1093, 407, 696, 199, -1, 754, 314, 897, -1, 53, -1, -1,
+    -1, 474, 745, -1, 60, 293, 739, -1, 405, -1, 824, 1054, 652, 1106, -1, 55,
+    603, -1, 470, 119, 539, 330, 781, 73, 726, 1165, 898, 1071, 11, 685, 805, 977,
+    -1, 128, -1, -1, 355, 694, 393, 996, 1164, -1, 369, 1153, -1, 77, 902, 468,
+    220, -1, 1130, 56, -1, 19, 35, 453, 844, 792, 1172, -1, 990, -1, 549, 419,
+    1015, 1020, 742, 815, -1, 177, 780, 1014, -1, 415, 519, -1, 1103, 611, 366, 626,
+    -1, 274, -1, 29, 387, 688, 913, -1, -1, 718, 448, 284, 255, 788, 191, 707,
+    801, -1, 406, 214, 1121, 807, 889, 161, 186, 644, -1, 289, -1, 492, 854, 1157,
+    245, 743, 582, 911, 142, 601, 85, 630, 89, 710, 362, -1, 414, 268, 16, -1,
+    447, 948, 1161, 270, 666, 40, -1, 722, 168, -1, -1, 344, 997, 643, 153, 501,
+    655, 334, 500, 893, 51, 486, 736, -1, 508, -1, 1135, 669, 595, 617, 231, 162,
+    -1, 121, -1, 441, 586, 731, 450, 1150, 823, 445, 537, 793, 806, 779, -1, 198,
+    1065, 624, 207, 354, -1, 1056, 328, 568, 475, -1, 953, 636, -1, 176, 259, 509,
+    829, -1, -1, 370, 33, 585, -1, 776, 493, 915, 1029, 935, 566, 1125, -1, 785,
+    860, 74, 1158, 107, 838, 943, -1, 84, -1, 837, -1, 264, -1, 937, 99, 647,
+    -1, 965, 697, 1078, 279, 404, 732, 753, 1094, -1, 625, 1114, 572, 901, 786, 317,
+    865, 608, 92, -1, 358, 1012, -1, 680, 1088, 154, 528, 1055, 1035, 623, 1049, 37,
+    -1, 1110, -1, 1166, 992, 876, 1013, 349, 227, 495, -1, 3, 217, -1, 427, 1169,
+    713, 747, -1, 639, 579, 332, 126, 1058, 269, -1, 983, 149, 872, 49, 1063, 1008,
+    551, 196, 224, -1, 178, 1062, 216, 588, 431, 184, 674, 514, 67, -1, 633, 7,
+    160, 79, -1, -1, 882, -1, 277, -1, 276, 365, 729, 782, 271, 771, -1, 257,
+    593, -1, 190, 338, 660, 974, 102, 197, 438, 978, 506, -1, -1, 399, 751, -1,
+    610, 372, -1, 938, 676, 708, -1, 557, 339, -1, 502, -1, -1, 417, 728, 959,
+    1149, 1047, 870, 426, 987, 1026, 310, 774, 206, -1, 476, 46, 459, 483, 944, 48,
+    388, 843, 794, 744, 563, 54, -1, 59, 248, 275, 988, 226, 409, 286, 123, -1,
+    1004, 702, 1099, 1163, -1, 211, 1097, 569, 545, -1, 867, 1139, 93, 127, 635, 175,
+    1082, 653, 883, 252, 716, 1059, 318, 145, 171, -1, 385, 320, 531, 288, 1001, 922,
+    195, 375, 821, -1, 721, 1064, 434, 1038, -1, -1, 440, 306, 64, 621, 917, 193,
+    895, 203, 165, 814, 10, 565, 157, 1134, 888, 613, 5, 804, 363, 712, 313, 66,
+    -1, -1, 1066, 1159, 41, 297, 421, 412, 525, 989, 584, 95, 432, 342, 885, 811,
+    -1, 497, 28, 645, -1, -1, -1, -1, 662, -1, 1147, 554, 826, 576, 689, 78,
+    -1, 135, 237, -1, 818, 905, -1, 439, 939, -1, 1102, 327, 70, -1, -1, 591,
+    1154, 891, 966, 1044, 192, 1089, 423, -1, 773, -1, -1, 104, -1, -1, -1, -1,
+    542, 512, 690, 985, -1, 1022, 152, -1, -1, -1, -1, -1, 283, -1, -1, 12,
+    808, 26, 899, 460, 347, -1, 875, 1162, 491, 536, 699, -1, -1, 741, 758, 684,
+    136, -1, 518, 34, 201, -1, 219, 1077, 292, 247, 118, 1090, 1122, -1, 540, 1087,
+    131, 846, -1, 141, 1005, 896, 430, 1046, -1, 833, 200, 469, -1, 1128, 772, 798,
+    45, 1033, -1, -1, 720, -1, -1, 923, 172, 384, 618, 941, 679, 402, -1, 1024,
+    71, -1, 496, 839, -1, 767, 87, 929, 262, 389, 616, 159, 909, 390, -1, 505,
+    -1, 433, 86, 862, -1, 555, 458, 583, 914, 296, 638, -1, 359, 871, 140, 556,
+    859, 1053, 323, 106, 530, 1124, 622, 931, 967, 954, -1, 17, 991, 840, 993, 1006,
+    488, -1, 108, -1, 612, 360, 352, -1, 62, 408, 752, 657, -1, 263, 1009, 208,
+    507, 581, 847, 163, 410, -1, -1, 254, 971, 864, 787, -1, 8, -1, -1, -1,
+    683, 130, 998, 1000, 950, -1, 533, 857, 132, 607, 38, 125, 714, 331, 376, 321,
+    504, 560, 737, 719, -1, 403, 757, 651, -1, 487, 532, 552, 478, 58, 600, 1143,
+    364, -1, 724, 117, 397, 594, 706, 863, -1, -1, 912, 596, -1, 1067, 1137, 411,
+    386, 170, -1, 614, 261, 775, 825, 526, 1133, 466, 173, 949, 282, 22, 416, 446,
+    -1, 1060, 222, 975, 761, 606, 886, 81, 294, 670, 746, 640, -1, 770, -1, 251,
+    357, 573, 413, 849, 637, 783, -1, 933, 243, 392, 0, 574, 756, -1, -1, 467,
+    951, 930, -1, 285, 213, 267, 202, 1052, 138, 740, 890, 634, 1113, 422, -1, 189,
+    167, 156, 789, -1, -1, 597, 942, 700, 962, 1031, 147, 183, 303, 348, 47, 80,
+    451, 869, 194, 14, 329, -1, 649, 477, -1, 155, -1, 351, 185, 523, 139, -1,
+    918, 436, 223, 564, -1, 150, 1021, -1, 960, 346, 101, 61, 879, 230, -1, 816,
+    667, -1, -1, 300, 278, 90, 324, 835, -1, 480, 831, -1, 927, -1, 105, 443,
+    1032, 828, 738, -1, -1, 6, 290, 852, -1, -1, 418, 256, 952, 968, 489, 1095,
+    733, 225, 120, -1, -1, 1016, 164, 678, 904, 766, 673, 371, -1, 1131, 727, 547,
+    803, 212, 629, -1, 15, 169, -1, 30, 174, 382, 1034, 1112, -1, 1086, 18, 755,
+    115, 464, 570, 1168, 845, -1, 299, -1, -1, 1019, 1081, 750, 796, 659, 979, -1,
+    515, 981, 1160, 472, 449, 799, -1, 322, 924, 1007, -1, 932, 473, 1073, 795, 1129,
+    546, 777, 361, 298, -1, -1, 400, 103, 908, 1079, 841, 181, 98, 1040, 1104, 878,
+    -1, 110, -1, -1, 1116, 307, 590, 238, 494, 425, 725, 641, 894, -1, -1, 1108,
+    734, 455, 1117, 91, 305, 1126, 1140, 1148, -1, -1, 420, -1, 31, 367, -1, 1074,
+    1043, 778, 632, 916, 232, 122, 880, 454, 900, 343, 391, 1152, 711, 1, -1, 810,
+    704, 693, 133, -1, 658, 956, -1, 1091, -1, 970, 143, 465, 529, -1, 784, 813,
+    187, 723, 834, 577, -1, 850, 1069, 919, 925, 429, 598, 735, 791, 982, 527, -1,
+    1030, 503, -1, 109, 158, 524, 309, 797, -1, 764, 319, 1123, 947, 1141, 1171, 1145,
+    836, 1156, -1, 1050, 619, 114, 575, 866, 1023, 759, 749, 822, 241, 1144, 4, 341,
+    24, 1080, 44, 23, 63, 800, -1, -1, 921, -1, 394, 166, 681, 1041, -1, 535,
+    548, 946, 353, 281, 182, -1, 517, 452, 1002, 559, 1010, -1, 1127, 21, -1, 567,
+    378, 428, 995, 484, 511, 112, -1, -1, -1, 1045, 75, 258, 244, 1098, 928, 677,
+    -1, -1, 963, 242, 656, 36, -1, 336, 701, 280, 663, 146, 516, 50, 986, 249,
+    312, -1, 980, 856, -1, 562, 287, -1, 513, -1, 851, 381, 827, 926, 356, -1,
+    620, 151, -1, 205, 1096, 144, 790, 853, 25, 665, 709, 705, 1075, -1, 325, 204,
+    396, 955, -1, 65, 333, 43, -1, -1, 691, 498, -1, 861, 380, 308, 765, -1,
+    1138, 830, 887, 1003, 345, 1070, 910, 218, 68, 210, 906, -1, 717, 936, 730, 383,
+    -1, 884, -1, 881, 892, 832, -1, 57, 646, 377, 1018, 1083, 969, -1, 1011, -1,
+    1025, 1146, 374, 510, 762, 587, 550, 1051, 627, -1
+};
+
+static const keyword_table IFC4_keywords = { IFC4_keyword_displacements, 293, IFC4_keyword_slots, 1466 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -15060,7 +15179,7 @@ IfcParse::schema_definition* IFC4_populate_schema() {
     declarations.push_back(IFC4_IfcWorkTime_type);
     declarations.push_back(IFC4_IfcZone_type);
     declarations.push_back(IFC4_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4", declarations, new IFC4_instance_factory());
+    return new schema_definition("IFC4", declarations, new IFC4_instance_factory(), &IFC4_keywords);
 }
 
 
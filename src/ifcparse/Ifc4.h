@@ -893,6 +893,7 @@ public:
     typedef enum {IfcActionRequestType_EMAIL, IfcActionRequestType_FAX, IfcActionRequestType_PHONE, IfcActionRequestType_POST, IfcActionRequestType_VERBAL, IfcActionRequestType_USERDEFINED, IfcActionRequestType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -911,6 +912,7 @@ public:
     typedef enum {IfcActionSourceType_DEAD_LOAD_G, IfcActionSourceType_COMPLETION_G1, IfcActionSourceType_LIVE_LOAD_Q, IfcActionSourceType_SNOW_S, IfcActionSourceType_WIND_W, IfcActionSourceType_PRESTRESSING_P, IfcActionSourceType_SETTLEMENT_U, IfcActionSourceType_TEMPERATURE_T, IfcActionSourceType_EARTHQUAKE_E, IfcActionSourceType_FIRE, IfcActionSourceType_IMPULSE, IfcActionSourceType_IMPACT, IfcActionSourceType_TRANSPORT, IfcActionSourceType_ERECTION, IfcActionSourceType_PROPPING, IfcActionSourceType_SYSTEM_IMPERFECTION, IfcActionSourceType_SHRINKAGE, IfcActionSourceType_CREEP, IfcActionSourceType_LACK_OF_FIT, IfcActionSourceType_BUOYANCY, IfcActionSourceType_ICE, IfcActionSourceType_CURRENT, IfcActionSourceType_WAVE, IfcActionSourceType_RAIN, IfcActionSourceType_BRAKES, IfcActionSourceType_USERDEFINED, IfcActionSourceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -931,6 +933,7 @@ public:
     typedef enum {IfcActionType_PERMANENT_G, IfcActionType_VARIABLE_Q, IfcActionType_EXTRAORDINARY_A, IfcActionType_USERDEFINED, IfcActionType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -960,6 +963,7 @@ public:
     typedef enum {IfcActuatorType_ELECTRICACTUATOR, IfcActuatorType_HANDOPERATEDACTUATOR, IfcActuatorType_HYDRAULICACTUATOR, IfcActuatorType_PNEUMATICACTUATOR, IfcActuatorType_THERMOSTATICACTUATOR, IfcActuatorType_USERDEFINED, IfcActuatorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -984,6 +988,7 @@ public:
     typedef enum {IfcAddressType_OFFICE, IfcAddressType_SITE, IfcAddressType_HOME, IfcAddressType_DISTRIBUTIONPOINT, IfcAddressType_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1008,6 +1013,7 @@ public:
     typedef enum {IfcAirTerminalBoxType_CONSTANTFLOW, IfcAirTerminalBoxType_VARIABLEFLOWPRESSUREDEPENDANT, IfcAirTerminalBoxType_VARIABLEFLOWPRESSUREINDEPENDANT, IfcAirTerminalBoxType_USERDEFINED, IfcAirTerminalBoxType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1034,6 +1040,7 @@ public:
     typedef enum {IfcAirTerminalType_DIFFUSER, IfcAirTerminalType_GRILLE, IfcAirTerminalType_LOUVRE, IfcAirTerminalType_REGISTER, IfcAirTerminalType_USERDEFINED, IfcAirTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1063,6 +1070,7 @@ public:
     typedef enum {IfcAirToAirHeatRecoveryType_FIXEDPLATECOUNTERFLOWEXCHANGER, IfcAirToAirHeatRecoveryType_FIXEDPLATECROSSFLOWEXCHANGER, IfcAirToAirHeatRecoveryType_FIXEDPLATEPARALLELFLOWEXCHANGER, IfcAirToAirHeatRecoveryType_ROTARYWHEEL, IfcAirToAirHeatRecoveryType_RUNAROUNDCOILLOOP, IfcAirToAirHeatRecoveryType_HEATPIPE, IfcAirToAirHeatRecoveryType_TWINTOWERENTHALPYRECOVERYLOOPS, IfcAirToAirHeatRecoveryType_THERMOSIPHONSEALEDTUBEHEATEXCHANGERS, IfcAirToAirHeatRecoveryType_THERMOSIPHONCOILTYPEHEATEXCHANGERS, IfcAirToAirHeatRecoveryType_USERDEFINED, IfcAirToAirHeatRecoveryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1090,6 +1098,7 @@ public:
     typedef enum {IfcAlarmType_BELL, IfcAlarmType_BREAKGLASSBUTTON, IfcAlarmType_LIGHT, IfcAlarmType_MANUALPULLBOX, IfcAlarmType_SIREN, IfcAlarmType_WHISTLE, IfcAlarmType_USERDEFINED, IfcAlarmType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1109,6 +1118,7 @@ public:
     typedef enum {IfcAnalysisModelType_IN_PLANE_LOADING_2D, IfcAnalysisModelType_OUT_PLANE_LOADING_2D, IfcAnalysisModelType_LOADING_3D, IfcAnalysisModelType_USERDEFINED, IfcAnalysisModelType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1129,6 +1139,7 @@ public:
     typedef enum {IfcAnalysisTheoryType_FIRST_ORDER_THEORY, IfcAnalysisTheoryType_SECOND_ORDER_THEORY, IfcAnalysisTheoryType_THIRD_ORDER_THEORY, IfcAnalysisTheoryType_FULL_NONLINEAR_THEORY, IfcAnalysisTheoryType_USERDEFINED, IfcAnalysisTheoryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1154,6 +1165,7 @@ public:
     typedef enum {IfcArithmeticOperator_ADD, IfcArithmeticOperator_DIVIDE, IfcArithmeticOperator_MULTIPLY, IfcArithmeticOperator_SUBTRACT} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1179,6 +1191,7 @@ public:
     typedef enum {IfcAssemblyPlace_SITE, IfcAssemblyPlace_FACTORY, IfcAssemblyPlace_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1206,6 +1219,7 @@ public:
     typedef enum {IfcAudioVisualApplianceType_AMPLIFIER, IfcAudioVisualApplianceType_CAMERA, IfcAudioVisualApplianceType_DISPLAY, IfcAudioVisualApplianceType_MICROPHONE, IfcAudioVisualApplianceType_PLAYER, IfcAudioVisualApplianceType_PROJECTOR, IfcAudioVisualApplianceType_RECEIVER, IfcAudioVisualApplianceType_SPEAKER, IfcAudioVisualApplianceType_SWITCHER, IfcAudioVisualApplianceType_TELEPHONE, IfcAudioVisualApplianceType_TUNER, IfcAudioVisualApplianceType_USERDEFINED, IfcAudioVisualApplianceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1233,6 +1247,7 @@ public:
     typedef enum {IfcBSplineCurveForm_POLYLINE_FORM, IfcBSplineCurveForm_CIRCULAR_ARC, IfcBSplineCurveForm_ELLIPTIC_ARC, IfcBSplineCurveForm_PARABOLIC_ARC, IfcBSplineCurveForm_HYPERBOLIC_ARC, IfcBSplineCurveForm_UNSPECIFIED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1247,6 +1262,7 @@ public:
     typedef enum {IfcBSplineSurfaceForm_PLANE_SURF, IfcBSplineSurfaceForm_CYLINDRICAL_SURF, IfcBSplineSurfaceForm_CONICAL_SURF, IfcBSplineSurfaceForm_SPHERICAL_SURF, IfcBSplineSurfaceForm_TOROIDAL_SURF, IfcBSplineSurfaceForm_SURF_OF_REVOLUTION, IfcBSplineSurfaceForm_RULED_SURF, IfcBSplineSurfaceForm_GENERALISED_CONE, IfcBSplineSurfaceForm_QUADRIC_SURF, IfcBSplineSurfaceForm_SURF_OF_LINEAR_EXTRUSION, IfcBSplineSurfaceForm_UNSPECIFIED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1299,6 +1315,7 @@ public:
     typedef enum {IfcBeamType_BEAM, IfcBeamType_JOIST, IfcBeamType_HOLLOWCORE, IfcBeamType_LINTEL, IfcBeamType_SPANDREL, IfcBeamType_T_BEAM, IfcBeamType_USERDEFINED, IfcBeamType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1352,6 +1369,7 @@ public:
     typedef enum {IfcBenchmark_GREATERTHAN, IfcBenchmark_GREATERTHANOREQUALTO, IfcBenchmark_LESSTHAN, IfcBenchmark_LESSTHANOREQUALTO, IfcBenchmark_EQUALTO, IfcBenchmark_NOTEQUALTO, IfcBenchmark_INCLUDES, IfcBenchmark_NOTINCLUDES, IfcBenchmark_INCLUDEDIN, IfcBenchmark_NOTINCLUDEDIN} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1374,6 +1392,7 @@ public:
     typedef enum {IfcBoilerType_WATER, IfcBoilerType_STEAM, IfcBoilerType_USERDEFINED, IfcBoilerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1396,6 +1415,7 @@ public:
     typedef enum {IfcBooleanOperator_UNION, IfcBooleanOperator_INTERSECTION, IfcBooleanOperator_DIFFERENCE} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1417,6 +1437,7 @@ public:
     typedef enum {IfcBuildingElementPartType_INSULATION, IfcBuildingElementPartType_PRECASTPANEL, IfcBuildingElementPartType_USERDEFINED, IfcBuildingElementPartType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1441,6 +1462,7 @@ public:
     typedef enum {IfcBuildingElementProxyType_COMPLEX, IfcBuildingElementProxyType_ELEMENT, IfcBuildingElementProxyType_PARTIAL, IfcBuildingElementProxyType_PROVISIONFORVOID, IfcBuildingElementProxyType_PROVISIONFORSPACE, IfcBuildingElementProxyType_USERDEFINED, IfcBuildingElementProxyType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1468,6 +1490,7 @@ public:
     typedef enum {IfcBuildingSystemType_FENESTRATION, IfcBuildingSystemType_FOUNDATION, IfcBuildingSystemType_LOADBEARING, IfcBuildingSystemType_OUTERSHELL, IfcBuildingSystemType_SHADING, IfcBuildingSystemType_TRANSPORT, IfcBuildingSystemType_USERDEFINED, IfcBuildingSystemType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1488,6 +1511,7 @@ public:
     typedef enum {IfcBurnerType_USERDEFINED, IfcBurnerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1511,6 +1535,7 @@ public:
     typedef enum {IfcCableCarrierFittingType_BEND, IfcCableCarrierFittingType_CROSS, IfcCableCarrierFittingType_REDUCER, IfcCableCarrierFittingType_TEE, IfcCableCarrierFittingType_USERDEFINED, IfcCableCarrierFittingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1534,6 +1559,7 @@ public:
     typedef enum {IfcCableCarrierSegmentType_CABLELADDERSEGMENT, IfcCableCarrierSegmentType_CABLETRAYSEGMENT, IfcCableCarrierSegmentType_CABLETRUNKINGSEGMENT, IfcCableCarrierSegmentType_CONDUITSEGMENT, IfcCableCarrierSegmentType_USERDEFINED, IfcCableCarrierSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1558,6 +1584,7 @@ public:
     typedef enum {IfcCableFittingType_CONNECTOR, IfcCableFittingType_ENTRY, IfcCableFittingType_EXIT, IfcCableFittingType_JUNCTION, IfcCableFittingType_TRANSITION, IfcCableFittingType_USERDEFINED, IfcCableFittingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1583,6 +1610,7 @@ public:
     typedef enum {IfcCableSegmentType_BUSBARSEGMENT, IfcCableSegmentType_CABLESEGMENT, IfcCableSegmentType_CONDUCTORSEGMENT, IfcCableSegmentType_CORESEGMENT, IfcCableSegmentType_USERDEFINED, IfcCableSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1607,6 +1635,7 @@ public:
     typedef enum {IfcChangeAction_NOCHANGE, IfcChangeAction_MODIFIED, IfcChangeAction_ADDED, IfcChangeAction_DELETED, IfcChangeAction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1630,6 +1659,7 @@ public:
     typedef enum {IfcChillerType_AIRCOOLED, IfcChillerType_WATERCOOLED, IfcChillerType_HEATRECOVERY, IfcChillerType_USERDEFINED, IfcChillerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1653,6 +1683,7 @@ public:
     typedef enum {IfcChimneyType_USERDEFINED, IfcChimneyType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1688,6 +1719,7 @@ public:
     typedef enum {IfcCoilType_DXCOOLINGCOIL, IfcCoilType_ELECTRICHEATINGCOIL, IfcCoilType_GASHEATINGCOIL, IfcCoilType_HYDRONICCOIL, IfcCoilType_STEAMHEATINGCOIL, IfcCoilType_WATERCOOLINGCOIL, IfcCoilType_WATERHEATINGCOIL, IfcCoilType_USERDEFINED, IfcCoilType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1715,6 +1747,7 @@ public:
     typedef enum {IfcColumnType_COLUMN, IfcColumnType_PILASTER, IfcColumnType_USERDEFINED, IfcColumnType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1744,6 +1777,7 @@ public:
     typedef enum {IfcCommunicationsApplianceType_ANTENNA, IfcCommunicationsApplianceType_COMPUTER, IfcCommunicationsApplianceType_FAX, IfcCommunicationsApplianceType_GATEWAY, IfcCommunicationsApplianceType_MODEM, IfcCommunicationsApplianceType_NETWORKAPPLIANCE, IfcCommunicationsApplianceType_NETWORKBRIDGE, IfcCommunicationsApplianceType_NETWORKHUB, IfcCommunicationsApplianceType_PRINTER, IfcCommunicationsApplianceType_REPEATER, IfcCommunicationsApplianceType_ROUTER, IfcCommunicationsApplianceType_SCANNER, IfcCommunicationsApplianceType_USERDEFINED, IfcCommunicationsApplianceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1765,6 +1799,7 @@ public:
     typedef enum {IfcComplexPropertyTemplateType_P_COMPLEX, IfcComplexPropertyTemplateType_Q_COMPLEX} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1800,6 +1835,7 @@ public:
     typedef enum {IfcCompressorType_DYNAMIC, IfcCompressorType_RECIPROCATING, IfcCompressorType_ROTARY, IfcCompressorType_SCROLL, IfcCompressorType_TROCHOIDAL, IfcCompressorType_SINGLESTAGE, IfcCompressorType_BOOSTER, IfcCompressorType_OPENTYPE, IfcCompressorType_HERMETIC, IfcCompressorType_SEMIHERMETIC, IfcCompressorType_WELDEDSHELLHERMETIC, IfcCompressorType_ROLLINGPISTON, IfcCompressorType_ROTARYVANE, IfcCompressorType_SINGLESCREW, IfcCompressorType_TWINSCREW, IfcCompressorType_USERDEFINED, IfcCompressorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1826,6 +1862,7 @@ public:
     typedef enum {IfcCondenserType_AIRCOOLED, IfcCondenserType_EVAPORATIVECOOLED, IfcCondenserType_WATERCOOLED, IfcCondenserType_WATERCOOLEDBRAZEDPLATE, IfcCondenserType_WATERCOOLEDSHELLCOIL, IfcCondenserType_WATERCOOLEDSHELLTUBE, IfcCondenserType_WATERCOOLEDTUBEINTUBE, IfcCondenserType_USERDEFINED, IfcCondenserType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1859,6 +1896,7 @@ public:
     typedef enum {IfcConnectionType_ATPATH, IfcConnectionType_ATSTART, IfcConnectionType_ATEND, IfcConnectionType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1889,6 +1927,7 @@ public:
     typedef enum {IfcConstraint_HARD, IfcConstraint_SOFT, IfcConstraint_ADVISORY, IfcConstraint_USERDEFINED, IfcConstraint_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1916,6 +1955,7 @@ public:
     typedef enum {IfcConstructionEquipmentResourceType_DEMOLISHING, IfcConstructionEquipmentResourceType_EARTHMOVING, IfcConstructionEquipmentResourceType_ERECTING, IfcConstructionEquipmentResourceType_HEATING, IfcConstructionEquipmentResourceType_LIGHTING, IfcConstructionEquipmentResourceType_PAVING, IfcConstructionEquipmentResourceType_PUMPING, IfcConstructionEquipmentResourceType_TRANSPORTING, IfcConstructionEquipmentResourceType_USERDEFINED, IfcConstructionEquipmentResourceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1944,6 +1984,7 @@ public:
     typedef enum {IfcConstructionMaterialResourceType_AGGREGATES, IfcConstructionMaterialResourceType_CONCRETE, IfcConstructionMaterialResourceType_DRYWALL, IfcConstructionMaterialResourceType_FUEL, IfcConstructionMaterialResourceType_GYPSUM, IfcConstructionMaterialResourceType_MASONRY, IfcConstructionMaterialResourceType_METAL, IfcConstructionMaterialResourceType_PLASTIC, IfcConstructionMaterialResourceType_WOOD, IfcConstructionMaterialResourceType_NOTDEFINED, IfcConstructionMaterialResourceType_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1965,6 +2006,7 @@ public:
     typedef enum {IfcConstructionProductResourceType_ASSEMBLY, IfcConstructionProductResourceType_FORMWORK, IfcConstructionProductResourceType_USERDEFINED, IfcConstructionProductResourceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -1992,6 +2034,7 @@ public:
     typedef enum {IfcControllerType_FLOATING, IfcControllerType_PROGRAMMABLE, IfcControllerType_PROPORTIONAL, IfcControllerType_MULTIPOSITION, IfcControllerType_TWOPOSITION, IfcControllerType_USERDEFINED, IfcControllerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2024,6 +2067,7 @@ public:
     typedef enum {IfcCooledBeamType_ACTIVE, IfcCooledBeamType_PASSIVE, IfcCooledBeamType_USERDEFINED, IfcCooledBeamType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2049,6 +2093,7 @@ public:
     typedef enum {IfcCoolingTowerType_NATURALDRAFT, IfcCoolingTowerType_MECHANICALINDUCEDDRAFT, IfcCoolingTowerType_MECHANICALFORCEDDRAFT, IfcCoolingTowerType_USERDEFINED, IfcCoolingTowerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2068,6 +2113,7 @@ public:
     typedef enum {IfcCostItemType_USERDEFINED, IfcCostItemType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2094,6 +2140,7 @@ public:
     typedef enum {IfcCostScheduleType_BUDGET, IfcCostScheduleType_COSTPLAN, IfcCostScheduleType_ESTIMATE, IfcCostScheduleType_TENDER, IfcCostScheduleType_PRICEDBILLOFQUANTITIES, IfcCostScheduleType_UNPRICEDBILLOFQUANTITIES, IfcCostScheduleType_SCHEDULEOFRATES, IfcCostScheduleType_USERDEFINED, IfcCostScheduleType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2150,6 +2197,7 @@ public:
     typedef enum {IfcCoveringType_CEILING, IfcCoveringType_FLOORING, IfcCoveringType_CLADDING, IfcCoveringType_ROOFING, IfcCoveringType_MOLDING, IfcCoveringType_SKIRTINGBOARD, IfcCoveringType_INSULATION, IfcCoveringType_MEMBRANE, IfcCoveringType_SLEEVING, IfcCoveringType_WRAPPING, IfcCoveringType_USERDEFINED, IfcCoveringType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2171,6 +2219,7 @@ public:
     typedef enum {IfcCrewResourceType_OFFICE, IfcCrewResourceType_SITE, IfcCrewResourceType_USERDEFINED, IfcCrewResourceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2193,6 +2242,7 @@ public:
     typedef enum {IfcCurtainWallType_USERDEFINED, IfcCurtainWallType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2223,6 +2273,7 @@ public:
     typedef enum {IfcCurveInterpolation_LINEAR, IfcCurveInterpolation_LOG_LINEAR, IfcCurveInterpolation_LOG_LOG, IfcCurveInterpolation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2253,6 +2304,7 @@ public:
     typedef enum {IfcDamperType_BACKDRAFTDAMPER, IfcDamperType_BALANCINGDAMPER, IfcDamperType_BLASTDAMPER, IfcDamperType_CONTROLDAMPER, IfcDamperType_FIREDAMPER, IfcDamperType_FIRESMOKEDAMPER, IfcDamperType_FUMEHOODEXHAUST, IfcDamperType_GRAVITYDAMPER, IfcDamperType_GRAVITYRELIEFDAMPER, IfcDamperType_RELIEFDAMPER, IfcDamperType_SMOKEDAMPER, IfcDamperType_USERDEFINED, IfcDamperType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2274,6 +2326,7 @@ public:
     typedef enum {IfcDataOrigin_MEASURED, IfcDataOrigin_PREDICTED, IfcDataOrigin_SIMULATED, IfcDataOrigin_USERDEFINED, IfcDataOrigin_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2344,6 +2397,7 @@ public:
     typedef enum {IfcDerivedUnit_ANGULARVELOCITYUNIT, IfcDerivedUnit_AREADENSITYUNIT, IfcDerivedUnit_COMPOUNDPLANEANGLEUNIT, IfcDerivedUnit_DYNAMICVISCOSITYUNIT, IfcDerivedUnit_HEATFLUXDENSITYUNIT, IfcDerivedUnit_INTEGERCOUNTRATEUNIT, IfcDerivedUnit_ISOTHERMALMOISTURECAPACITYUNIT, IfcDerivedUnit_KINEMATICVISCOSITYUNIT, IfcDerivedUnit_LINEARVELOCITYUNIT, IfcDerivedUnit_MASSDENSITYUNIT, IfcDerivedUnit_MASSFLOWRATEUNIT, IfcDerivedUnit_MOISTUREDIFFUSIVITYUNIT, IfcDerivedUnit_MOLECULARWEIGHTUNIT, IfcDerivedUnit_SPECIFICHEATCAPACITYUNIT, IfcDerivedUnit_THERMALADMITTANCEUNIT, IfcDerivedUnit_THERMALCONDUCTANCEUNIT, IfcDerivedUnit_THERMALRESISTANCEUNIT, IfcDerivedUnit_THERMALTRANSMITTANCEUNIT, IfcDerivedUnit_VAPORPERMEABILITYUNIT, IfcDerivedUnit_VOLUMETRICFLOWRATEUNIT, IfcDerivedUnit_ROTATIONALFREQUENCYUNIT, IfcDerivedUnit_TORQUEUNIT, IfcDerivedUnit_MOMENTOFINERTIAUNIT, IfcDerivedUnit_LINEARMOMENTUNIT, IfcDerivedUnit_LINEARFORCEUNIT, IfcDerivedUnit_PLANARFORCEUNIT, IfcDerivedUnit_MODULUSOFELASTICITYUNIT, IfcDerivedUnit_SHEARMODULUSUNIT, IfcDerivedUnit_LINEARSTIFFNESSUNIT, IfcDerivedUnit_ROTATIONALSTIFFNESSUNIT, IfcDerivedUnit_MODULUSOFSUBGRADEREACTIONUNIT, IfcDerivedUnit_ACCELERATIONUNIT, IfcDerivedUnit_CURVATUREUNIT, IfcDerivedUnit_HEATINGVALUEUNIT, IfcDerivedUnit_IONCONCENTRATIONUNIT, IfcDerivedUnit_LUMINOUSINTENSITYDISTRIBUTIONUNIT, IfcDerivedUnit_MASSPERLENGTHUNIT, IfcDerivedUnit_MODULUSOFLINEARSUBGRADEREACTIONUNIT, IfcDerivedUnit_MODULUSOFROTATIONALSUBGRADEREACTIONUNIT, IfcDerivedUnit_PHUNIT, IfcDerivedUnit_ROTATIONALMASSUNIT, IfcDerivedUnit_SECTIONAREAINTEGRALUNIT, IfcDerivedUnit_SECTIONMODULUSUNIT, IfcDerivedUnit_SOUNDPOWERLEVELUNIT, IfcDerivedUnit_SOUNDPOWERUNIT, IfcDerivedUnit_SOUNDPRESSURELEVELUNIT, IfcDerivedUnit_SOUNDPRESSUREUNIT, IfcDerivedUnit_TEMPERATUREGRADIENTUNIT, IfcDerivedUnit_TEMPERATURERATEOFCHANGEUNIT, IfcDerivedUnit_THERMALEXPANSIONCOEFFICIENTUNIT, IfcDerivedUnit_WARPINGCONSTANTUNIT, IfcDerivedUnit_WARPINGMOMENTUNIT, IfcDerivedUnit_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2365,6 +2419,7 @@ public:
     typedef enum {IfcDirectionSense_POSITIVE, IfcDirectionSense_NEGATIVE} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2387,6 +2442,7 @@ public:
     typedef enum {IfcDiscreteAccessoryType_ANCHORPLATE, IfcDiscreteAccessoryType_BRACKET, IfcDiscreteAccessoryType_SHOE, IfcDiscreteAccessoryType_USERDEFINED, IfcDiscreteAccessoryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2416,6 +2472,7 @@ public:
     typedef enum {IfcDistributionChamberElementType_FORMEDDUCT, IfcDistributionChamberElementType_INSPECTIONCHAMBER, IfcDistributionChamberElementType_INSPECTIONPIT, IfcDistributionChamberElementType_MANHOLE, IfcDistributionChamberElementType_METERCHAMBER, IfcDistributionChamberElementType_SUMP, IfcDistributionChamberElementType_TRENCH, IfcDistributionChamberElementType_VALVECHAMBER, IfcDistributionChamberElementType_USERDEFINED, IfcDistributionChamberElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2430,6 +2487,7 @@ public:
     typedef enum {IfcDistributionPortType_CABLE, IfcDistributionPortType_CABLECARRIER, IfcDistributionPortType_DUCT, IfcDistributionPortType_PIPE, IfcDistributionPortType_USERDEFINED, IfcDistributionPortType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2490,6 +2548,7 @@ public:
     typedef enum {IfcDistributionSystem_AIRCONDITIONING, IfcDistributionSystem_AUDIOVISUAL, IfcDistributionSystem_CHEMICAL, IfcDistributionSystem_CHILLEDWATER, IfcDistributionSystem_COMMUNICATION, IfcDistributionSystem_COMPRESSEDAIR, IfcDistributionSystem_CONDENSERWATER, IfcDistributionSystem_CONTROL, IfcDistributionSystem_CONVEYING, IfcDistributionSystem_DATA, IfcDistributionSystem_DISPOSAL, IfcDistributionSystem_DOMESTICCOLDWATER, IfcDistributionSystem_DOMESTICHOTWATER, IfcDistributionSystem_DRAINAGE, IfcDistributionSystem_EARTHING, IfcDistributionSystem_ELECTRICAL, IfcDistributionSystem_ELECTROACOUSTIC, IfcDistributionSystem_EXHAUST, IfcDistributionSystem_FIREPROTECTION, IfcDistributionSystem_FUEL, IfcDistributionSystem_GAS, IfcDistributionSystem_HAZARDOUS, IfcDistributionSystem_HEATING, IfcDistributionSystem_LIGHTING, IfcDistributionSystem_LIGHTNINGPROTECTION, IfcDistributionSystem_MUNICIPALSOLIDWASTE, IfcDistributionSystem_OIL, IfcDistributionSystem_OPERATIONAL, IfcDistributionSystem_POWERGENERATION, IfcDistributionSystem_RAINWATER, IfcDistributionSystem_REFRIGERATION, IfcDistributionSystem_SECURITY, IfcDistributionSystem_SEWAGE, IfcDistributionSystem_SIGNAL, IfcDistributionSystem_STORMWATER, IfcDistributionSystem_TELEPHONE, IfcDistributionSystem_TV, IfcDistributionSystem_VACUUM, IfcDistributionSystem_VENT, IfcDistributionSystem_VENTILATION, IfcDistributionSystem_WASTEWATER, IfcDistributionSystem_WATERSUPPLY, IfcDistributionSystem_USERDEFINED, IfcDistributionSystem_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2515,6 +2574,7 @@ public:
     typedef enum {IfcDocumentConfidentiality_PUBLIC, IfcDocumentConfidentiality_RESTRICTED, IfcDocumentConfidentiality_CONFIDENTIAL, IfcDocumentConfidentiality_PERSONAL, IfcDocumentConfidentiality_USERDEFINED, IfcDocumentConfidentiality_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2531,6 +2591,7 @@ public:
     typedef enum {IfcDocumentStatus_DRAFT, IfcDocumentStatus_FINALDRAFT, IfcDocumentStatus_FINAL, IfcDocumentStatus_REVISION, IfcDocumentStatus_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2577,6 +2638,7 @@ public:
     typedef enum {IfcDoorPanelOperation_SWINGING, IfcDoorPanelOperation_DOUBLE_ACTING, IfcDoorPanelOperation_SLIDING, IfcDoorPanelOperation_FOLDING, IfcDoorPanelOperation_REVOLVING, IfcDoorPanelOperation_ROLLINGUP, IfcDoorPanelOperation_FIXEDPANEL, IfcDoorPanelOperation_USERDEFINED, IfcDoorPanelOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2597,6 +2659,7 @@ public:
     typedef enum {IfcDoorPanelPosition_LEFT, IfcDoorPanelPosition_MIDDLE, IfcDoorPanelPosition_RIGHT, IfcDoorPanelPosition_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2617,6 +2680,7 @@ public:
     typedef enum {IfcDoorStyleConstruction_ALUMINIUM, IfcDoorStyleConstruction_HIGH_GRADE_STEEL, IfcDoorStyleConstruction_STEEL, IfcDoorStyleConstruction_WOOD, IfcDoorStyleConstruction_ALUMINIUM_WOOD, IfcDoorStyleConstruction_ALUMINIUM_PLASTIC, IfcDoorStyleConstruction_PLASTIC, IfcDoorStyleConstruction_USERDEFINED, IfcDoorStyleConstruction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2799,6 +2863,7 @@ public:
     typedef enum {IfcDoorStyleOperation_SINGLE_SWING_LEFT, IfcDoorStyleOperation_SINGLE_SWING_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_SINGLE_SWING, IfcDoorStyleOperation_DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_LEFT, IfcDoorStyleOperation_DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_RIGHT, IfcDoorStyleOperation_DOUBLE_SWING_LEFT, IfcDoorStyleOperation_DOUBLE_SWING_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_DOUBLE_SWING, IfcDoorStyleOperation_SLIDING_TO_LEFT, IfcDoorStyleOperation_SLIDING_TO_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_SLIDING, IfcDoorStyleOperation_FOLDING_TO_LEFT, IfcDoorStyleOperation_FOLDING_TO_RIGHT, IfcDoorStyleOperation_DOUBLE_DOOR_FOLDING, IfcDoorStyleOperation_REVOLVING, IfcDoorStyleOperation_ROLLINGUP, IfcDoorStyleOperation_USERDEFINED, IfcDoorStyleOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2828,6 +2893,7 @@ public:
     typedef enum {IfcDoorType_DOOR, IfcDoorType_GATE, IfcDoorType_TRAPDOOR, IfcDoorType_USERDEFINED, IfcDoorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3021,6 +3087,7 @@ public:
     typedef enum {IfcDoorTypeOperation_SINGLE_SWING_LEFT, IfcDoorTypeOperation_SINGLE_SWING_RIGHT, IfcDoorTypeOperation_DOUBLE_DOOR_SINGLE_SWING, IfcDoorTypeOperation_DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_LEFT, IfcDoorTypeOperation_DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_RIGHT, IfcDoorTypeOperation_DOUBLE_SWING_LEFT, IfcDoorTypeOperation_DOUBLE_SWING_RIGHT, IfcDoorTypeOperation_DOUBLE_DOOR_DOUBLE_SWING, IfcDoorTypeOperation_SLIDING_TO_LEFT, IfcDoorTypeOperation_SLIDING_TO_RIGHT, IfcDoorTypeOperation_DOUBLE_DOOR_SLIDING, IfcDoorTypeOperation_FOLDING_TO_LEFT, IfcDoorTypeOperation_FOLDING_TO_RIGHT, IfcDoorTypeOperation_DOUBLE_DOOR_FOLDING, IfcDoorTypeOperation_REVOLVING, IfcDoorTypeOperation_ROLLINGUP, IfcDoorTypeOperation_SWING_FIXED_LEFT, IfcDoorTypeOperation_SWING_FIXED_RIGHT, IfcDoorTypeOperation_USERDEFINED, IfcDoorTypeOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3067,6 +3134,7 @@ public:
     typedef enum {IfcDuctFittingType_BEND, IfcDuctFittingType_CONNECTOR, IfcDuctFittingType_ENTRY, IfcDuctFittingType_EXIT, IfcDuctFittingType_JUNCTION, IfcDuctFittingType_OBSTRUCTION, IfcDuctFittingType_TRANSITION, IfcDuctFittingType_USERDEFINED, IfcDuctFittingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3095,6 +3163,7 @@ public:
     typedef enum {IfcDuctSegmentType_RIGIDSEGMENT, IfcDuctSegmentType_FLEXIBLESEGMENT, IfcDuctSegmentType_USERDEFINED, IfcDuctSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3118,6 +3187,7 @@ public:
     typedef enum {IfcDuctSilencerType_FLATOVAL, IfcDuctSilencerType_RECTANGULAR, IfcDuctSilencerType_ROUND, IfcDuctSilencerType_USERDEFINED, IfcDuctSilencerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3160,6 +3230,7 @@ public:
     typedef enum {IfcElectricApplianceType_DISHWASHER, IfcElectricApplianceType_ELECTRICCOOKER, IfcElectricApplianceType_FREESTANDINGELECTRICHEATER, IfcElectricApplianceType_FREESTANDINGFAN, IfcElectricApplianceType_FREESTANDINGWATERHEATER, IfcElectricApplianceType_FREESTANDINGWATERCOOLER, IfcElectricApplianceType_FREEZER, IfcElectricApplianceType_FRIDGE_FREEZER, IfcElectricApplianceType_HANDDRYER, IfcElectricApplianceType_KITCHENMACHINE, IfcElectricApplianceType_MICROWAVE, IfcElectricApplianceType_PHOTOCOPIER, IfcElectricApplianceType_REFRIGERATOR, IfcElectricApplianceType_TUMBLEDRYER, IfcElectricApplianceType_VENDINGMACHINE, IfcElectricApplianceType_WASHINGMACHINE, IfcElectricApplianceType_USERDEFINED, IfcElectricApplianceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3183,6 +3254,7 @@ public:
     typedef enum {IfcElectricDistributionBoardType_CONSUMERUNIT, IfcElectricDistributionBoardType_DISTRIBUTIONBOARD, IfcElectricDistributionBoardType_MOTORCONTROLCENTRE, IfcElectricDistributionBoardType_SWITCHBOARD, IfcElectricDistributionBoardType_USERDEFINED, IfcElectricDistributionBoardType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3206,6 +3278,7 @@ public:
     typedef enum {IfcElectricFlowStorageDeviceType_BATTERY, IfcElectricFlowStorageDeviceType_CAPACITORBANK, IfcElectricFlowStorageDeviceType_HARMONICFILTER, IfcElectricFlowStorageDeviceType_INDUCTORBANK, IfcElectricFlowStorageDeviceType_UPS, IfcElectricFlowStorageDeviceType_USERDEFINED, IfcElectricFlowStorageDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3229,6 +3302,7 @@ public:
     typedef enum {IfcElectricGeneratorType_CHP, IfcElectricGeneratorType_ENGINEGENERATOR, IfcElectricGeneratorType_STANDALONE, IfcElectricGeneratorType_USERDEFINED, IfcElectricGeneratorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3253,6 +3327,7 @@ public:
     typedef enum {IfcElectricMotorType_DC, IfcElectricMotorType_INDUCTION, IfcElectricMotorType_POLYPHASE, IfcElectricMotorType_RELUCTANCESYNCHRONOUS, IfcElectricMotorType_SYNCHRONOUS, IfcElectricMotorType_USERDEFINED, IfcElectricMotorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3275,6 +3350,7 @@ public:
     typedef enum {IfcElectricTimeControlType_TIMECLOCK, IfcElectricTimeControlType_TIMEDELAY, IfcElectricTimeControlType_RELAY, IfcElectricTimeControlType_USERDEFINED, IfcElectricTimeControlType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3307,6 +3383,7 @@ public:
     typedef enum {IfcElementAssemblyType_ACCESSORY_ASSEMBLY, IfcElementAssemblyType_ARCH, IfcElementAssemblyType_BEAM_GRID, IfcElementAssemblyType_BRACED_FRAME, IfcElementAssemblyType_GIRDER, IfcElementAssemblyType_REINFORCEMENT_UNIT, IfcElementAssemblyType_RIGID_FRAME, IfcElementAssemblyType_SLAB_FIELD, IfcElementAssemblyType_TRUSS, IfcElementAssemblyType_USERDEFINED, IfcElementAssemblyType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3332,6 +3409,7 @@ public:
     typedef enum {IfcElementComposition_COMPLEX, IfcElementComposition_ELEMENT, IfcElementComposition_PARTIAL} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3353,6 +3431,7 @@ public:
     typedef enum {IfcEngineType_EXTERNALCOMBUSTION, IfcEngineType_INTERNALCOMBUSTION, IfcEngineType_USERDEFINED, IfcEngineType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3382,6 +3461,7 @@ public:
     typedef enum {IfcEvaporativeCoolerType_DIRECTEVAPORATIVERANDOMMEDIAAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVERIGIDMEDIAAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVESLINGERSPACKAGEDAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVEPACKAGEDROTARYAIRCOOLER, IfcEvaporativeCoolerType_DIRECTEVAPORATIVEAIRWASHER, IfcEvaporativeCoolerType_INDIRECTEVAPORATIVEPACKAGEAIRCOOLER, IfcEvaporativeCoolerType_INDIRECTEVAPORATIVEWETCOIL, IfcEvaporativeCoolerType_INDIRECTEVAPORATIVECOOLINGTOWERORCOILCOOLER, IfcEvaporativeCoolerType_INDIRECTDIRECTCOMBINATION, IfcEvaporativeCoolerType_USERDEFINED, IfcEvaporativeCoolerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3408,6 +3488,7 @@ public:
     typedef enum {IfcEvaporatorType_DIRECTEXPANSION, IfcEvaporatorType_DIRECTEXPANSIONSHELLANDTUBE, IfcEvaporatorType_DIRECTEXPANSIONTUBEINTUBE, IfcEvaporatorType_DIRECTEXPANSIONBRAZEDPLATE, IfcEvaporatorType_FLOODEDSHELLANDTUBE, IfcEvaporatorType_SHELLANDCOIL, IfcEvaporatorType_USERDEFINED, IfcEvaporatorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3433,6 +3514,7 @@ public:
     typedef enum {IfcEventTriggerType_EVENTRULE, IfcEventTriggerType_EVENTMESSAGE, IfcEventTriggerType_EVENTTIME, IfcEventTriggerType_EVENTCOMPLEX, IfcEventTriggerType_USERDEFINED, IfcEventTriggerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3457,6 +3539,7 @@ public:
     typedef enum {IfcEventType_STARTEVENT, IfcEventType_ENDEVENT, IfcEventType_INTERMEDIATEEVENT, IfcEventType_USERDEFINED, IfcEventType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3486,6 +3569,7 @@ public:
     typedef enum {IfcExternalSpatialElementType_EXTERNAL, IfcExternalSpatialElementType_EXTERNAL_EARTH, IfcExternalSpatialElementType_EXTERNAL_WATER, IfcExternalSpatialElementType_EXTERNAL_FIRE, IfcExternalSpatialElementType_USERDEFINED, IfcExternalSpatialElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3513,6 +3597,7 @@ public:
     typedef enum {IfcFanType_CENTRIFUGALFORWARDCURVED, IfcFanType_CENTRIFUGALRADIAL, IfcFanType_CENTRIFUGALBACKWARDINCLINEDCURVED, IfcFanType_CENTRIFUGALAIRFOIL, IfcFanType_TUBEAXIAL, IfcFanType_VANEAXIAL, IfcFanType_PROPELLORAXIAL, IfcFanType_USERDEFINED, IfcFanType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3535,6 +3620,7 @@ public:
     typedef enum {IfcFastenerType_GLUE, IfcFastenerType_MORTAR, IfcFastenerType_WELD, IfcFastenerType_USERDEFINED, IfcFastenerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3561,6 +3647,7 @@ public:
     typedef enum {IfcFilterType_AIRPARTICLEFILTER, IfcFilterType_COMPRESSEDAIRFILTER, IfcFilterType_ODORFILTER, IfcFilterType_OILFILTER, IfcFilterType_STRAINER, IfcFilterType_WATERFILTER, IfcFilterType_USERDEFINED, IfcFilterType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3587,6 +3674,7 @@ public:
     typedef enum {IfcFireSuppressionTerminalType_BREECHINGINLET, IfcFireSuppressionTerminalType_FIREHYDRANT, IfcFireSuppressionTerminalType_HOSEREEL, IfcFireSuppressionTerminalType_SPRINKLER, IfcFireSuppressionTerminalType_SPRINKLERDEFLECTOR, IfcFireSuppressionTerminalType_USERDEFINED, IfcFireSuppressionTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3608,6 +3696,7 @@ public:
     typedef enum {IfcFlowDirection_SOURCE, IfcFlowDirection_SINK, IfcFlowDirection_SOURCEANDSINK, IfcFlowDirection_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3637,6 +3726,7 @@ public:
     typedef enum {IfcFlowInstrumentType_PRESSUREGAUGE, IfcFlowInstrumentType_THERMOMETER, IfcFlowInstrumentType_AMMETER, IfcFlowInstrumentType_FREQUENCYMETER, IfcFlowInstrumentType_POWERFACTORMETER, IfcFlowInstrumentType_PHASEANGLEMETER, IfcFlowInstrumentType_VOLTMETER_PEAK, IfcFlowInstrumentType_VOLTMETER_RMS, IfcFlowInstrumentType_USERDEFINED, IfcFlowInstrumentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3665,6 +3755,7 @@ public:
     typedef enum {IfcFlowMeterType_ENERGYMETER, IfcFlowMeterType_GASMETER, IfcFlowMeterType_OILMETER, IfcFlowMeterType_WATERMETER, IfcFlowMeterType_USERDEFINED, IfcFlowMeterType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3692,6 +3783,7 @@ public:
     typedef enum {IfcFootingType_CAISSON_FOUNDATION, IfcFootingType_FOOTING_BEAM, IfcFootingType_PAD_FOOTING, IfcFootingType_PILE_CAP, IfcFootingType_STRIP_FOOTING, IfcFootingType_USERDEFINED, IfcFootingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3718,6 +3810,7 @@ public:
     typedef enum {IfcFurnitureType_CHAIR, IfcFurnitureType_TABLE, IfcFurnitureType_DESK, IfcFurnitureType_BED, IfcFurnitureType_FILECABINET, IfcFurnitureType_SHELF, IfcFurnitureType_SOFA, IfcFurnitureType_USERDEFINED, IfcFurnitureType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3732,6 +3825,7 @@ public:
     typedef enum {IfcGeographicElementType_TERRAIN, IfcGeographicElementType_USERDEFINED, IfcGeographicElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3786,6 +3880,7 @@ public:
     typedef enum {IfcGeometricProjection_GRAPH_VIEW, IfcGeometricProjection_SKETCH_VIEW, IfcGeometricProjection_MODEL_VIEW, IfcGeometricProjection_PLAN_VIEW, IfcGeometricProjection_REFLECTED_PLAN_VIEW, IfcGeometricProjection_SECTION_VIEW, IfcGeometricProjection_ELEVATION_VIEW, IfcGeometricProjection_USERDEFINED, IfcGeometricProjection_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3805,6 +3900,7 @@ public:
     typedef enum {IfcGlobalOrLocal_GLOBAL_COORDS, IfcGlobalOrLocal_LOCAL_COORDS} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3819,6 +3915,7 @@ public:
     typedef enum {IfcGridType_RECTANGULAR, IfcGridType_RADIAL, IfcGridType_TRIANGULAR, IfcGridType_IRREGULAR, IfcGridType_USERDEFINED, IfcGridType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3841,6 +3938,7 @@ public:
     typedef enum {IfcHeatExchangerType_PLATE, IfcHeatExchangerType_SHELLANDTUBE, IfcHeatExchangerType_USERDEFINED, IfcHeatExchangerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3874,6 +3972,7 @@ public:
     typedef enum {IfcHumidifierType_STEAMINJECTION, IfcHumidifierType_ADIABATICAIRWASHER, IfcHumidifierType_ADIABATICPAN, IfcHumidifierType_ADIABATICWETTEDELEMENT, IfcHumidifierType_ADIABATICATOMIZING, IfcHumidifierType_ADIABATICULTRASONIC, IfcHumidifierType_ADIABATICRIGIDMEDIA, IfcHumidifierType_ADIABATICCOMPRESSEDAIRNOZZLE, IfcHumidifierType_ASSISTEDELECTRIC, IfcHumidifierType_ASSISTEDNATURALGAS, IfcHumidifierType_ASSISTEDPROPANE, IfcHumidifierType_ASSISTEDBUTANE, IfcHumidifierType_ASSISTEDSTEAM, IfcHumidifierType_USERDEFINED, IfcHumidifierType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3897,6 +3996,7 @@ public:
     typedef enum {IfcInterceptorType_CYCLONIC, IfcInterceptorType_GREASE, IfcInterceptorType_OIL, IfcInterceptorType_PETROL, IfcInterceptorType_USERDEFINED, IfcInterceptorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3965,6 +4065,7 @@ public:
     typedef enum {IfcInternalOrExternal_INTERNAL, IfcInternalOrExternal_EXTERNAL, IfcInternalOrExternal_EXTERNAL_EARTH, IfcInternalOrExternal_EXTERNAL_WATER, IfcInternalOrExternal_EXTERNAL_FIRE, IfcInternalOrExternal_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -3987,6 +4088,7 @@ public:
     typedef enum {IfcInventoryType_ASSETINVENTORY, IfcInventoryType_SPACEINVENTORY, IfcInventoryType_FURNITUREINVENTORY, IfcInventoryType_USERDEFINED, IfcInventoryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4007,6 +4109,7 @@ public:
     typedef enum {IfcJunctionBoxType_DATA, IfcJunctionBoxType_POWER, IfcJunctionBoxType_USERDEFINED, IfcJunctionBoxType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4021,6 +4124,7 @@ public:
     typedef enum {IfcKnotType_UNIFORM_KNOTS, IfcKnotType_QUASI_UNIFORM_KNOTS, IfcKnotType_PIECEWISE_BEZIER_KNOTS, IfcKnotType_UNSPECIFIED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4058,6 +4162,7 @@ public:
     typedef enum {IfcLaborResourceType_ADMINISTRATION, IfcLaborResourceType_CARPENTRY, IfcLaborResourceType_CLEANING, IfcLaborResourceType_CONCRETE, IfcLaborResourceType_DRYWALL, IfcLaborResourceType_ELECTRIC, IfcLaborResourceType_FINISHING, IfcLaborResourceType_FLOORING, IfcLaborResourceType_GENERAL, IfcLaborResourceType_HVAC, IfcLaborResourceType_LANDSCAPING, IfcLaborResourceType_MASONRY, IfcLaborResourceType_PAINTING, IfcLaborResourceType_PAVING, IfcLaborResourceType_PLUMBING, IfcLaborResourceType_ROOFING, IfcLaborResourceType_SITEGRADING, IfcLaborResourceType_STEELWORK, IfcLaborResourceType_SURVEYING, IfcLaborResourceType_USERDEFINED, IfcLaborResourceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4088,6 +4193,7 @@ public:
     typedef enum {IfcLampType_COMPACTFLUORESCENT, IfcLampType_FLUORESCENT, IfcLampType_HALOGEN, IfcLampType_HIGHPRESSUREMERCURY, IfcLampType_HIGHPRESSURESODIUM, IfcLampType_LED, IfcLampType_METALHALIDE, IfcLampType_OLED, IfcLampType_TUNGSTENFILAMENT, IfcLampType_USERDEFINED, IfcLampType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4110,6 +4216,7 @@ public:
     typedef enum {IfcLayerSetDirection_AXIS1, IfcLayerSetDirection_AXIS2, IfcLayerSetDirection_AXIS3} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4137,6 +4244,7 @@ public:
     typedef enum {IfcLightDistributionCurve_TYPE_A, IfcLightDistributionCurve_TYPE_B, IfcLightDistributionCurve_TYPE_C, IfcLightDistributionCurve_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4167,6 +4275,7 @@ public:
     typedef enum {IfcLightEmissionSource_COMPACTFLUORESCENT, IfcLightEmissionSource_FLUORESCENT, IfcLightEmissionSource_HIGHPRESSUREMERCURY, IfcLightEmissionSource_HIGHPRESSURESODIUM, IfcLightEmissionSource_LIGHTEMITTINGDIODE, IfcLightEmissionSource_LOWPRESSURESODIUM, IfcLightEmissionSource_LOWVOLTAGEHALOGEN, IfcLightEmissionSource_MAINVOLTAGEHALOGEN, IfcLightEmissionSource_METALHALIDE, IfcLightEmissionSource_TUNGSTENFILAMENT, IfcLightEmissionSource_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4191,6 +4300,7 @@ public:
     typedef enum {IfcLightFixtureType_POINTSOURCE, IfcLightFixtureType_DIRECTIONSOURCE, IfcLightFixtureType_SECURITYLIGHTING, IfcLightFixtureType_USERDEFINED, IfcLightFixtureType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4225,6 +4335,7 @@ public:
     typedef enum {IfcLoadGroupType_LOAD_GROUP, IfcLoadGroupType_LOAD_CASE, IfcLoadGroupType_LOAD_COMBINATION, IfcLoadGroupType_USERDEFINED, IfcLoadGroupType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4482,6 +4593,7 @@ public:
     typedef enum {IfcLogicalOperator_LOGICALAND, IfcLogicalOperator_LOGICALOR, IfcLogicalOperator_LOGICALXOR, IfcLogicalOperator_LOGICALNOTAND, IfcLogicalOperator_LOGICALNOTOR} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4512,6 +4624,7 @@ public:
     typedef enum {IfcMechanicalFastenerType_ANCHORBOLT, IfcMechanicalFastenerType_BOLT, IfcMechanicalFastenerType_DOWEL, IfcMechanicalFastenerType_NAIL, IfcMechanicalFastenerType_NAILPLATE, IfcMechanicalFastenerType_RIVET, IfcMechanicalFastenerType_SCREW, IfcMechanicalFastenerType_SHEARCONNECTOR, IfcMechanicalFastenerType_STAPLE, IfcMechanicalFastenerType_STUDSHEARCONNECTOR, IfcMechanicalFastenerType_USERDEFINED, IfcMechanicalFastenerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4538,6 +4651,7 @@ public:
     typedef enum {IfcMedicalDeviceType_AIRSTATION, IfcMedicalDeviceType_FEEDAIRUNIT, IfcMedicalDeviceType_OXYGENGENERATOR, IfcMedicalDeviceType_OXYGENPLANT, IfcMedicalDeviceType_VACUUMSTATION, IfcMedicalDeviceType_USERDEFINED, IfcMedicalDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4594,6 +4708,7 @@ public:
     typedef enum {IfcMemberType_BRACE, IfcMemberType_CHORD, IfcMemberType_COLLAR, IfcMemberType_MEMBER, IfcMemberType_MULLION, IfcMemberType_PLATE, IfcMemberType_POST, IfcMemberType_PURLIN, IfcMemberType_RAFTER, IfcMemberType_STRINGER, IfcMemberType_STRUT, IfcMemberType_STUD, IfcMemberType_USERDEFINED, IfcMemberType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4616,6 +4731,7 @@ public:
     typedef enum {IfcMotorConnectionType_BELTDRIVE, IfcMotorConnectionType_COUPLING, IfcMotorConnectionType_DIRECTDRIVE, IfcMotorConnectionType_USERDEFINED, IfcMotorConnectionType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4637,6 +4753,7 @@ public:
     typedef enum {IfcNullStyle_NULL} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4653,6 +4770,7 @@ public:
     typedef enum {IfcObjectType_PRODUCT, IfcObjectType_PROCESS, IfcObjectType_CONTROL, IfcObjectType_RESOURCE, IfcObjectType_ACTOR, IfcObjectType_GROUP, IfcObjectType_PROJECT, IfcObjectType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4695,6 +4813,7 @@ public:
     typedef enum {IfcObjective_CODECOMPLIANCE, IfcObjective_CODEWAIVER, IfcObjective_DESIGNINTENT, IfcObjective_EXTERNAL, IfcObjective_HEALTHANDSAFETY, IfcObjective_MERGECONFLICT, IfcObjective_MODELVIEW, IfcObjective_PARAMETER, IfcObjective_REQUIREMENT, IfcObjective_SPECIFICATION, IfcObjective_TRIGGERCONDITION, IfcObjective_USERDEFINED, IfcObjective_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4721,6 +4840,7 @@ public:
     typedef enum {IfcOccupantType_ASSIGNEE, IfcOccupantType_ASSIGNOR, IfcOccupantType_LESSEE, IfcOccupantType_LESSOR, IfcOccupantType_LETTINGAGENT, IfcOccupantType_OWNER, IfcOccupantType_TENANT, IfcOccupantType_USERDEFINED, IfcOccupantType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4754,6 +4874,7 @@ public:
     typedef enum {IfcOpeningElementType_OPENING, IfcOpeningElementType_RECESS, IfcOpeningElementType_USERDEFINED, IfcOpeningElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4780,6 +4901,7 @@ public:
     typedef enum {IfcOutletType_AUDIOVISUALOUTLET, IfcOutletType_COMMUNICATIONSOUTLET, IfcOutletType_POWEROUTLET, IfcOutletType_DATAOUTLET, IfcOutletType_TELEPHONEOUTLET, IfcOutletType_USERDEFINED, IfcOutletType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4799,6 +4921,7 @@ public:
     typedef enum {IfcPerformanceHistoryType_USERDEFINED, IfcPerformanceHistoryType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4834,6 +4957,7 @@ public:
     typedef enum {IfcPermeableCoveringOperation_GRILL, IfcPermeableCoveringOperation_LOUVER, IfcPermeableCoveringOperation_SCREEN, IfcPermeableCoveringOperation_USERDEFINED, IfcPermeableCoveringOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4856,6 +4980,7 @@ public:
     typedef enum {IfcPermitType_ACCESS, IfcPermitType_BUILDING, IfcPermitType_WORK, IfcPermitType_USERDEFINED, IfcPermitType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4892,6 +5017,7 @@ public:
     typedef enum {IfcPhysicalOrVirtual_PHYSICAL, IfcPhysicalOrVirtual_VIRTUAL, IfcPhysicalOrVirtual_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4927,6 +5053,7 @@ public:
     typedef enum {IfcPileConstruction_CAST_IN_PLACE, IfcPileConstruction_COMPOSITE, IfcPileConstruction_PRECAST_CONCRETE, IfcPileConstruction_PREFAB_STEEL, IfcPileConstruction_USERDEFINED, IfcPileConstruction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4953,6 +5080,7 @@ public:
     typedef enum {IfcPileType_BORED, IfcPileType_DRIVEN, IfcPileType_JETGROUTING, IfcPileType_COHESION, IfcPileType_FRICTION, IfcPileType_SUPPORT, IfcPileType_USERDEFINED, IfcPileType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -4997,6 +5125,7 @@ public:
     typedef enum {IfcPipeFittingType_BEND, IfcPipeFittingType_CONNECTOR, IfcPipeFittingType_ENTRY, IfcPipeFittingType_EXIT, IfcPipeFittingType_JUNCTION, IfcPipeFittingType_OBSTRUCTION, IfcPipeFittingType_TRANSITION, IfcPipeFittingType_USERDEFINED, IfcPipeFittingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5025,6 +5154,7 @@ public:
     typedef enum {IfcPipeSegmentType_CULVERT, IfcPipeSegmentType_FLEXIBLESEGMENT, IfcPipeSegmentType_RIGIDSEGMENT, IfcPipeSegmentType_GUTTER, IfcPipeSegmentType_SPOOL, IfcPipeSegmentType_USERDEFINED, IfcPipeSegmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5056,6 +5186,7 @@ public:
     typedef enum {IfcPlateType_CURTAIN_PANEL, IfcPlateType_SHEET, IfcPlateType_USERDEFINED, IfcPlateType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5070,6 +5201,7 @@ public:
     typedef enum {IfcPreferredSurfaceCurveRepresentation_CURVE3D, IfcPreferredSurfaceCurveRepresentation_PCURVE_S1, IfcPreferredSurfaceCurveRepresentation_PCURVE_S2} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5097,6 +5229,7 @@ public:
     typedef enum {IfcProcedureType_ADVICE_CAUTION, IfcProcedureType_ADVICE_NOTE, IfcProcedureType_ADVICE_WARNING, IfcProcedureType_CALIBRATION, IfcProcedureType_DIAGNOSTIC, IfcProcedureType_SHUTDOWN, IfcProcedureType_STARTUP, IfcProcedureType_USERDEFINED, IfcProcedureType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5118,6 +5251,7 @@ public:
     typedef enum {IfcProfileType_CURVE, IfcProfileType_AREA} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5142,6 +5276,7 @@ public:
     typedef enum {IfcProjectOrderType_CHANGEORDER, IfcProjectOrderType_MAINTENANCEWORKORDER, IfcProjectOrderType_MOVEORDER, IfcProjectOrderType_PURCHASEORDER, IfcProjectOrderType_WORKORDER, IfcProjectOrderType_USERDEFINED, IfcProjectOrderType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5161,6 +5296,7 @@ public:
     typedef enum {IfcProjectedOrTrueLength_PROJECTED_LENGTH, IfcProjectedOrTrueLength_TRUE_LENGTH} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5186,6 +5322,7 @@ public:
     typedef enum {IfcProjectionElementType_USERDEFINED, IfcProjectionElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5237,6 +5374,7 @@ public:
     typedef enum {IfcPropertySetTemplateType_PSET_TYPEDRIVENONLY, IfcPropertySetTemplateType_PSET_TYPEDRIVENOVERRIDE, IfcPropertySetTemplateType_PSET_OCCURRENCEDRIVEN, IfcPropertySetTemplateType_PSET_PERFORMANCEDRIVEN, IfcPropertySetTemplateType_QTO_TYPEDRIVENONLY, IfcPropertySetTemplateType_QTO_TYPEDRIVENOVERRIDE, IfcPropertySetTemplateType_QTO_OCCURRENCEDRIVEN, IfcPropertySetTemplateType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5257,6 +5395,7 @@ public:
     typedef enum {IfcProtectiveDeviceTrippingUnitType_ELECTRONIC, IfcProtectiveDeviceTrippingUnitType_ELECTROMAGNETIC, IfcProtectiveDeviceTrippingUnitType_RESIDUALCURRENT, IfcProtectiveDeviceTrippingUnitType_THERMAL, IfcProtectiveDeviceTrippingUnitType_USERDEFINED, IfcProtectiveDeviceTrippingUnitType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5285,6 +5424,7 @@ public:
     typedef enum {IfcProtectiveDeviceType_CIRCUITBREAKER, IfcProtectiveDeviceType_EARTHLEAKAGECIRCUITBREAKER, IfcProtectiveDeviceType_EARTHINGSWITCH, IfcProtectiveDeviceType_FUSEDISCONNECTOR, IfcProtectiveDeviceType_RESIDUALCURRENTCIRCUITBREAKER, IfcProtectiveDeviceType_RESIDUALCURRENTSWITCH, IfcProtectiveDeviceType_VARISTOR, IfcProtectiveDeviceType_USERDEFINED, IfcProtectiveDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5326,6 +5466,7 @@ public:
     typedef enum {IfcPumpType_CIRCULATOR, IfcPumpType_ENDSUCTION, IfcPumpType_SPLITCASE, IfcPumpType_SUBMERSIBLEPUMP, IfcPumpType_SUMPPUMP, IfcPumpType_VERTICALINLINE, IfcPumpType_VERTICALTURBINE, IfcPumpType_USERDEFINED, IfcPumpType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5359,6 +5500,7 @@ public:
     typedef enum {IfcRailingType_HANDRAIL, IfcRailingType_GUARDRAIL, IfcRailingType_BALUSTRADE, IfcRailingType_USERDEFINED, IfcRailingType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5383,6 +5525,7 @@ public:
     typedef enum {IfcRampFlightType_STRAIGHT, IfcRampFlightType_SPIRAL, IfcRampFlightType_USERDEFINED, IfcRampFlightType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5444,6 +5587,7 @@ public:
     typedef enum {IfcRampType_STRAIGHT_RUN_RAMP, IfcRampType_TWO_STRAIGHT_RUN_RAMP, IfcRampType_QUARTER_TURN_RAMP, IfcRampType_TWO_QUARTER_TURN_RAMP, IfcRampType_HALF_TURN_RAMP, IfcRampType_SPIRAL_RAMP, IfcRampType_USERDEFINED, IfcRampType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5478,6 +5622,7 @@ public:
     typedef enum {IfcRecurrenceType_DAILY, IfcRecurrenceType_WEEKLY, IfcRecurrenceType_MONTHLY_BY_DAY_OF_MONTH, IfcRecurrenceType_MONTHLY_BY_POSITION, IfcRecurrenceType_BY_DAY_COUNT, IfcRecurrenceType_BY_WEEKDAY_COUNT, IfcRecurrenceType_YEARLY_BY_DAY_OF_MONTH, IfcRecurrenceType_YEARLY_BY_POSITION} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5507,6 +5652,7 @@ public:
     typedef enum {IfcReflectanceMethod_BLINN, IfcReflectanceMethod_FLAT, IfcReflectanceMethod_GLASS, IfcReflectanceMethod_MATT, IfcReflectanceMethod_METAL, IfcReflectanceMethod_MIRROR, IfcReflectanceMethod_PHONG, IfcReflectanceMethod_PLASTIC, IfcReflectanceMethod_STRAUSS, IfcReflectanceMethod_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5539,6 +5685,7 @@ public:
     typedef enum {IfcReinforcingBarRole_MAIN, IfcReinforcingBarRole_SHEAR, IfcReinforcingBarRole_LIGATURE, IfcReinforcingBarRole_STUD, IfcReinforcingBarRole_PUNCHING, IfcReinforcingBarRole_EDGE, IfcReinforcingBarRole_RING, IfcReinforcingBarRole_ANCHORING, IfcReinforcingBarRole_USERDEFINED, IfcReinforcingBarRole_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5561,6 +5708,7 @@ public:
     typedef enum {IfcReinforcingBarSurface_PLAIN, IfcReinforcingBarSurface_TEXTURED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5575,6 +5723,7 @@ public:
     typedef enum {IfcReinforcingBarType_ANCHORING, IfcReinforcingBarType_EDGE, IfcReinforcingBarType_LIGATURE, IfcReinforcingBarType_MAIN, IfcReinforcingBarType_PUNCHING, IfcReinforcingBarType_RING, IfcReinforcingBarType_SHEAR, IfcReinforcingBarType_STUD, IfcReinforcingBarType_USERDEFINED, IfcReinforcingBarType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5589,6 +5738,7 @@ public:
     typedef enum {IfcReinforcingMeshType_USERDEFINED, IfcReinforcingMeshType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5631,6 +5781,7 @@ public:
     typedef enum {IfcRole_SUPPLIER, IfcRole_MANUFACTURER, IfcRole_CONTRACTOR, IfcRole_SUBCONTRACTOR, IfcRole_ARCHITECT, IfcRole_STRUCTURALENGINEER, IfcRole_COSTENGINEER, IfcRole_CLIENT, IfcRole_BUILDINGOWNER, IfcRole_BUILDINGOPERATOR, IfcRole_MECHANICALENGINEER, IfcRole_ELECTRICALENGINEER, IfcRole_PROJECTMANAGER, IfcRole_FACILITIESMANAGER, IfcRole_CIVILENGINEER, IfcRole_COMMISSIONINGENGINEER, IfcRole_ENGINEER, IfcRole_OWNER, IfcRole_CONSULTANT, IfcRole_CONSTRUCTIONMANAGER, IfcRole_FIELDCONSTRUCTIONMANAGER, IfcRole_RESELLER, IfcRole_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5710,6 +5861,7 @@ public:
     typedef enum {IfcRoofType_FLAT_ROOF, IfcRoofType_SHED_ROOF, IfcRoofType_GABLE_ROOF, IfcRoofType_HIP_ROOF, IfcRoofType_HIPPED_GABLE_ROOF, IfcRoofType_GAMBREL_ROOF, IfcRoofType_MANSARD_ROOF, IfcRoofType_BARREL_ROOF, IfcRoofType_RAINBOW_ROOF, IfcRoofType_BUTTERFLY_ROOF, IfcRoofType_PAVILION_ROOF, IfcRoofType_DOME_ROOF, IfcRoofType_FREEFORM, IfcRoofType_USERDEFINED, IfcRoofType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5750,6 +5902,7 @@ public:
     typedef enum {IfcSIPrefix_EXA, IfcSIPrefix_PETA, IfcSIPrefix_TERA, IfcSIPrefix_GIGA, IfcSIPrefix_MEGA, IfcSIPrefix_KILO, IfcSIPrefix_HECTO, IfcSIPrefix_DECA, IfcSIPrefix_DECI, IfcSIPrefix_CENTI, IfcSIPrefix_MILLI, IfcSIPrefix_MICRO, IfcSIPrefix_NANO, IfcSIPrefix_PICO, IfcSIPrefix_FEMTO, IfcSIPrefix_ATTO} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5802,6 +5955,7 @@ public:
     typedef enum {IfcSIUnitName_AMPERE, IfcSIUnitName_BECQUEREL, IfcSIUnitName_CANDELA, IfcSIUnitName_COULOMB, IfcSIUnitName_CUBIC_METRE, IfcSIUnitName_DEGREE_CELSIUS, IfcSIUnitName_FARAD, IfcSIUnitName_GRAM, IfcSIUnitName_GRAY, IfcSIUnitName_HENRY, IfcSIUnitName_HERTZ, IfcSIUnitName_JOULE, IfcSIUnitName_KELVIN, IfcSIUnitName_LUMEN, IfcSIUnitName_LUX, IfcSIUnitName_METRE, IfcSIUnitName_MOLE, IfcSIUnitName_NEWTON, IfcSIUnitName_OHM, IfcSIUnitName_PASCAL, IfcSIUnitName_RADIAN, IfcSIUnitName_SECOND, IfcSIUnitName_SIEMENS, IfcSIUnitName_SIEVERT, IfcSIUnitName_SQUARE_METRE, IfcSIUnitName_STERADIAN, IfcSIUnitName_TESLA, IfcSIUnitName_VOLT, IfcSIUnitName_WATT, IfcSIUnitName_WEBER} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5834,6 +5988,7 @@ public:
     typedef enum {IfcSanitaryTerminalType_BATH, IfcSanitaryTerminalType_BIDET, IfcSanitaryTerminalType_CISTERN, IfcSanitaryTerminalType_SHOWER, IfcSanitaryTerminalType_SINK, IfcSanitaryTerminalType_SANITARYFOUNTAIN, IfcSanitaryTerminalType_TOILETPAN, IfcSanitaryTerminalType_URINAL, IfcSanitaryTerminalType_WASHHANDBASIN, IfcSanitaryTerminalType_WCSEAT, IfcSanitaryTerminalType_USERDEFINED, IfcSanitaryTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5857,6 +6012,7 @@ public:
     typedef enum {IfcSectionType_UNIFORM, IfcSectionType_TAPERED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5898,6 +6054,7 @@ public:
     typedef enum {IfcSensorType_COSENSOR, IfcSensorType_CO2SENSOR, IfcSensorType_CONDUCTANCESENSOR, IfcSensorType_CONTACTSENSOR, IfcSensorType_FIRESENSOR, IfcSensorType_FLOWSENSOR, IfcSensorType_FROSTSENSOR, IfcSensorType_GASSENSOR, IfcSensorType_HEATSENSOR, IfcSensorType_HUMIDITYSENSOR, IfcSensorType_IDENTIFIERSENSOR, IfcSensorType_IONCONCENTRATIONSENSOR, IfcSensorType_LEVELSENSOR, IfcSensorType_LIGHTSENSOR, IfcSensorType_MOISTURESENSOR, IfcSensorType_MOVEMENTSENSOR, IfcSensorType_PHSENSOR, IfcSensorType_PRESSURESENSOR, IfcSensorType_RADIATIONSENSOR, IfcSensorType_RADIOACTIVITYSENSOR, IfcSensorType_SMOKESENSOR, IfcSensorType_SOUNDSENSOR, IfcSensorType_TEMPERATURESENSOR, IfcSensorType_WINDSENSOR, IfcSensorType_USERDEFINED, IfcSensorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5916,6 +6073,7 @@ public:
     typedef enum {IfcSequence_START_START, IfcSequence_START_FINISH, IfcSequence_FINISH_START, IfcSequence_FINISH_FINISH, IfcSequence_USERDEFINED, IfcSequence_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5939,6 +6097,7 @@ public:
     typedef enum {IfcShadingDeviceType_JALOUSIE, IfcShadingDeviceType_SHUTTER, IfcShadingDeviceType_AWNING, IfcShadingDeviceType_USERDEFINED, IfcShadingDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -5970,6 +6129,7 @@ public:
     typedef enum {IfcSimplePropertyTemplateType_P_SINGLEVALUE, IfcSimplePropertyTemplateType_P_ENUMERATEDVALUE, IfcSimplePropertyTemplateType_P_BOUNDEDVALUE, IfcSimplePropertyTemplateType_P_LISTVALUE, IfcSimplePropertyTemplateType_P_TABLEVALUE, IfcSimplePropertyTemplateType_P_REFERENCEVALUE, IfcSimplePropertyTemplateType_Q_LENGTH, IfcSimplePropertyTemplateType_Q_AREA, IfcSimplePropertyTemplateType_Q_VOLUME, IfcSimplePropertyTemplateType_Q_COUNT, IfcSimplePropertyTemplateType_Q_WEIGHT, IfcSimplePropertyTemplateType_Q_TIME} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6015,6 +6175,7 @@ public:
     typedef enum {IfcSlabType_FLOOR, IfcSlabType_ROOF, IfcSlabType_LANDING, IfcSlabType_BASESLAB, IfcSlabType_USERDEFINED, IfcSlabType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6037,6 +6198,7 @@ public:
     typedef enum {IfcSolarDeviceType_SOLARCOLLECTOR, IfcSolarDeviceType_SOLARPANEL, IfcSolarDeviceType_USERDEFINED, IfcSolarDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6062,6 +6224,7 @@ public:
     typedef enum {IfcSpaceHeaterType_CONVECTOR, IfcSpaceHeaterType_RADIATOR, IfcSpaceHeaterType_USERDEFINED, IfcSpaceHeaterType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6110,6 +6273,7 @@ public:
     typedef enum {IfcSpaceType_SPACE, IfcSpaceType_PARKING, IfcSpaceType_GFA, IfcSpaceType_INTERNAL, IfcSpaceType_EXTERNAL, IfcSpaceType_USERDEFINED, IfcSpaceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6148,6 +6312,7 @@ public:
     typedef enum {IfcSpatialZoneType_CONSTRUCTION, IfcSpatialZoneType_FIRESAFETY, IfcSpatialZoneType_LIGHTING, IfcSpatialZoneType_OCCUPANCY, IfcSpatialZoneType_SECURITY, IfcSpatialZoneType_THERMAL, IfcSpatialZoneType_TRANSPORT, IfcSpatialZoneType_VENTILATION, IfcSpatialZoneType_USERDEFINED, IfcSpatialZoneType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6170,6 +6335,7 @@ public:
     typedef enum {IfcStackTerminalType_BIRDCAGE, IfcStackTerminalType_COWL, IfcStackTerminalType_RAINWATERHOPPER, IfcStackTerminalType_USERDEFINED, IfcStackTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6198,6 +6364,7 @@ public:
     typedef enum {IfcStairFlightType_STRAIGHT, IfcStairFlightType_WINDER, IfcStairFlightType_SPIRAL, IfcStairFlightType_CURVED, IfcStairFlightType_FREEFORM, IfcStairFlightType_USERDEFINED, IfcStairFlightType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6304,6 +6471,7 @@ public:
     typedef enum {IfcStairType_STRAIGHT_RUN_STAIR, IfcStairType_TWO_STRAIGHT_RUN_STAIR, IfcStairType_QUARTER_WINDING_STAIR, IfcStairType_QUARTER_TURN_STAIR, IfcStairType_HALF_WINDING_STAIR, IfcStairType_HALF_TURN_STAIR, IfcStairType_TWO_QUARTER_WINDING_STAIR, IfcStairType_TWO_QUARTER_TURN_STAIR, IfcStairType_THREE_QUARTER_WINDING_STAIR, IfcStairType_THREE_QUARTER_TURN_STAIR, IfcStairType_SPIRAL_STAIR, IfcStairType_DOUBLE_RETURN_STAIR, IfcStairType_CURVED_RUN_STAIR, IfcStairType_TWO_CURVED_RUN_STAIR, IfcStairType_USERDEFINED, IfcStairType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6330,6 +6498,7 @@ public:
     typedef enum {IfcState_READWRITE, IfcState_READONLY, IfcState_LOCKED, IfcState_READWRITELOCKED, IfcState_READONLYLOCKED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6358,6 +6527,7 @@ public:
     typedef enum {IfcStructuralCurveActivityType_CONST, IfcStructuralCurveActivityType_LINEAR, IfcStructuralCurveActivityType_POLYGONAL, IfcStructuralCurveActivityType_EQUIDISTANT, IfcStructuralCurveActivityType_SINUS, IfcStructuralCurveActivityType_PARABOLA, IfcStructuralCurveActivityType_DISCRETE, IfcStructuralCurveActivityType_USERDEFINED, IfcStructuralCurveActivityType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6389,6 +6559,7 @@ public:
     typedef enum {IfcStructuralCurveMemberType_RIGID_JOINED_MEMBER, IfcStructuralCurveMemberType_PIN_JOINED_MEMBER, IfcStructuralCurveMemberType_CABLE, IfcStructuralCurveMemberType_TENSION_MEMBER, IfcStructuralCurveMemberType_COMPRESSION_MEMBER, IfcStructuralCurveMemberType_USERDEFINED, IfcStructuralCurveMemberType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6414,6 +6585,7 @@ public:
     typedef enum {IfcStructuralSurfaceActivityType_CONST, IfcStructuralSurfaceActivityType_BILINEAR, IfcStructuralSurfaceActivityType_DISCRETE, IfcStructuralSurfaceActivityType_ISOCONTOUR, IfcStructuralSurfaceActivityType_USERDEFINED, IfcStructuralSurfaceActivityType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6441,6 +6613,7 @@ public:
     typedef enum {IfcStructuralSurfaceMemberType_BENDING_ELEMENT, IfcStructuralSurfaceMemberType_MEMBRANE_ELEMENT, IfcStructuralSurfaceMemberType_SHELL, IfcStructuralSurfaceMemberType_USERDEFINED, IfcStructuralSurfaceMemberType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6462,6 +6635,7 @@ public:
     typedef enum {IfcSubContractResourceType_PURCHASE, IfcSubContractResourceType_WORK, IfcSubContractResourceType_USERDEFINED, IfcSubContractResourceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6486,6 +6660,7 @@ public:
     typedef enum {IfcSurfaceFeatureType_MARK, IfcSurfaceFeatureType_TAG, IfcSurfaceFeatureType_TREATMENT, IfcSurfaceFeatureType_USERDEFINED, IfcSurfaceFeatureType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6510,6 +6685,7 @@ public:
     typedef enum {IfcSurfaceSide_POSITIVE, IfcSurfaceSide_NEGATIVE, IfcSurfaceSide_BOTH} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6539,6 +6715,7 @@ public:
     typedef enum {IfcSwitchingDeviceType_CONTACTOR, IfcSwitchingDeviceType_DIMMERSWITCH, IfcSwitchingDeviceType_EMERGENCYSTOP, IfcSwitchingDeviceType_KEYPAD, IfcSwitchingDeviceType_MOMENTARYSWITCH, IfcSwitchingDeviceType_SELECTORSWITCH, IfcSwitchingDeviceType_STARTER, IfcSwitchingDeviceType_SWITCHDISCONNECTOR, IfcSwitchingDeviceType_TOGGLESWITCH, IfcSwitchingDeviceType_USERDEFINED, IfcSwitchingDeviceType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6560,6 +6737,7 @@ public:
     typedef enum {IfcSystemFurnitureElementType_PANEL, IfcSystemFurnitureElementType_WORKSURFACE, IfcSystemFurnitureElementType_USERDEFINED, IfcSystemFurnitureElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6596,6 +6774,7 @@ public:
     typedef enum {IfcTankType_BASIN, IfcTankType_BREAKPRESSURE, IfcTankType_EXPANSION, IfcTankType_FEEDANDEXPANSION, IfcTankType_PRESSUREVESSEL, IfcTankType_STORAGE, IfcTankType_VESSEL, IfcTankType_USERDEFINED, IfcTankType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6616,6 +6795,7 @@ public:
     typedef enum {IfcTaskDuration_ELAPSEDTIME, IfcTaskDuration_WORKTIME, IfcTaskDuration_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6647,6 +6827,7 @@ public:
     typedef enum {IfcTaskType_ATTENDANCE, IfcTaskType_CONSTRUCTION, IfcTaskType_DEMOLITION, IfcTaskType_DISMANTLE, IfcTaskType_DISPOSAL, IfcTaskType_INSTALLATION, IfcTaskType_LOGISTIC, IfcTaskType_MAINTENANCE, IfcTaskType_MOVE, IfcTaskType_OPERATION, IfcTaskType_REMOVAL, IfcTaskType_RENOVATION, IfcTaskType_USERDEFINED, IfcTaskType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6661,6 +6842,7 @@ public:
     typedef enum {IfcTendonAnchorType_COUPLER, IfcTendonAnchorType_FIXED_END, IfcTendonAnchorType_TENSIONING_END, IfcTendonAnchorType_USERDEFINED, IfcTendonAnchorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6675,6 +6857,7 @@ public:
     typedef enum {IfcTendonType_BAR, IfcTendonType_COATED, IfcTendonType_STRAND, IfcTendonType_WIRE, IfcTendonType_USERDEFINED, IfcTendonType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6695,6 +6878,7 @@ public:
     typedef enum {IfcTextPath_LEFT, IfcTextPath_RIGHT, IfcTextPath_UP, IfcTextPath_DOWN} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6719,6 +6903,7 @@ public:
     typedef enum {IfcTimeSeriesDataType_CONTINUOUS, IfcTimeSeriesDataType_DISCRETE, IfcTimeSeriesDataType_DISCRETEBINARY, IfcTimeSeriesDataType_PIECEWISEBINARY, IfcTimeSeriesDataType_PIECEWISECONSTANT, IfcTimeSeriesDataType_PIECEWISECONTINUOUS, IfcTimeSeriesDataType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6743,6 +6928,7 @@ public:
     typedef enum {IfcTransformerType_CURRENT, IfcTransformerType_FREQUENCY, IfcTransformerType_INVERTER, IfcTransformerType_RECTIFIER, IfcTransformerType_VOLTAGE, IfcTransformerType_USERDEFINED, IfcTransformerType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6772,6 +6958,7 @@ public:
     typedef enum {IfcTransitionCode_DISCONTINUOUS, IfcTransitionCode_CONTINUOUS, IfcTransitionCode_CONTSAMEGRADIENT, IfcTransitionCode_CONTSAMEGRADIENTSAMECURVATURE} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6809,6 +6996,7 @@ public:
     typedef enum {IfcTransportElementType_ELEVATOR, IfcTransportElementType_ESCALATOR, IfcTransportElementType_MOVINGWALKWAY, IfcTransportElementType_CRANEWAY, IfcTransportElementType_LIFTINGGEAR, IfcTransportElementType_USERDEFINED, IfcTransportElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6833,6 +7021,7 @@ public:
     typedef enum {IfcTrimmingPreference_CARTESIAN, IfcTrimmingPreference_PARAMETER, IfcTrimmingPreference_UNSPECIFIED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6854,6 +7043,7 @@ public:
     typedef enum {IfcTubeBundleType_FINNED, IfcTubeBundleType_USERDEFINED, IfcTubeBundleType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6903,6 +7093,7 @@ public:
     typedef enum {IfcUnit_ABSORBEDDOSEUNIT, IfcUnit_AMOUNTOFSUBSTANCEUNIT, IfcUnit_AREAUNIT, IfcUnit_DOSEEQUIVALENTUNIT, IfcUnit_ELECTRICCAPACITANCEUNIT, IfcUnit_ELECTRICCHARGEUNIT, IfcUnit_ELECTRICCONDUCTANCEUNIT, IfcUnit_ELECTRICCURRENTUNIT, IfcUnit_ELECTRICRESISTANCEUNIT, IfcUnit_ELECTRICVOLTAGEUNIT, IfcUnit_ENERGYUNIT, IfcUnit_FORCEUNIT, IfcUnit_FREQUENCYUNIT, IfcUnit_ILLUMINANCEUNIT, IfcUnit_INDUCTANCEUNIT, IfcUnit_LENGTHUNIT, IfcUnit_LUMINOUSFLUXUNIT, IfcUnit_LUMINOUSINTENSITYUNIT, IfcUnit_MAGNETICFLUXDENSITYUNIT, IfcUnit_MAGNETICFLUXUNIT, IfcUnit_MASSUNIT, IfcUnit_PLANEANGLEUNIT, IfcUnit_POWERUNIT, IfcUnit_PRESSUREUNIT, IfcUnit_RADIOACTIVITYUNIT, IfcUnit_SOLIDANGLEUNIT, IfcUnit_THERMODYNAMICTEMPERATUREUNIT, IfcUnit_TIMEUNIT, IfcUnit_VOLUMEUNIT, IfcUnit_USERDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6932,6 +7123,7 @@ public:
     typedef enum {IfcUnitaryControlElementType_ALARMPANEL, IfcUnitaryControlElementType_CONTROLPANEL, IfcUnitaryControlElementType_GASDETECTIONPANEL, IfcUnitaryControlElementType_INDICATORPANEL, IfcUnitaryControlElementType_MIMICPANEL, IfcUnitaryControlElementType_HUMIDISTAT, IfcUnitaryControlElementType_THERMOSTAT, IfcUnitaryControlElementType_WEATHERSTATION, IfcUnitaryControlElementType_USERDEFINED, IfcUnitaryControlElementType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -6957,6 +7149,7 @@ public:
     typedef enum {IfcUnitaryEquipmentType_AIRHANDLER, IfcUnitaryEquipmentType_AIRCONDITIONINGUNIT, IfcUnitaryEquipmentType_DEHUMIDIFIER, IfcUnitaryEquipmentType_SPLITSYSTEM, IfcUnitaryEquipmentType_ROOFTOPUNIT, IfcUnitaryEquipmentType_USERDEFINED, IfcUnitaryEquipmentType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7013,6 +7206,7 @@ public:
     typedef enum {IfcValveType_AIRRELEASE, IfcValveType_ANTIVACUUM, IfcValveType_CHANGEOVER, IfcValveType_CHECK, IfcValveType_COMMISSIONING, IfcValveType_DIVERTING, IfcValveType_DRAWOFFCOCK, IfcValveType_DOUBLECHECK, IfcValveType_DOUBLEREGULATING, IfcValveType_FAUCET, IfcValveType_FLUSHING, IfcValveType_GASCOCK, IfcValveType_GASTAP, IfcValveType_ISOLATING, IfcValveType_MIXING, IfcValveType_PRESSUREREDUCING, IfcValveType_PRESSURERELIEF, IfcValveType_REGULATING, IfcValveType_SAFETYCUTOFF, IfcValveType_STEAMTRAP, IfcValveType_STOPCOCK, IfcValveType_USERDEFINED, IfcValveType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7035,6 +7229,7 @@ public:
     typedef enum {IfcVibrationIsolatorType_COMPRESSION, IfcVibrationIsolatorType_SPRING, IfcVibrationIsolatorType_USERDEFINED, IfcVibrationIsolatorType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7062,6 +7257,7 @@ public:
     typedef enum {IfcVoidingFeatureType_CUTOUT, IfcVoidingFeatureType_NOTCH, IfcVoidingFeatureType_HOLE, IfcVoidingFeatureType_MITER, IfcVoidingFeatureType_CHAMFER, IfcVoidingFeatureType_EDGE, IfcVoidingFeatureType_USERDEFINED, IfcVoidingFeatureType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7112,6 +7308,7 @@ public:
     typedef enum {IfcWallType_MOVABLE, IfcWallType_PARAPET, IfcWallType_PARTITIONING, IfcWallType_PLUMBINGWALL, IfcWallType_SHEAR, IfcWallType_SOLIDWALL, IfcWallType_STANDARD, IfcWallType_POLYGONAL, IfcWallType_ELEMENTEDWALL, IfcWallType_USERDEFINED, IfcWallType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7139,6 +7336,7 @@ public:
     typedef enum {IfcWasteTerminalType_FLOORTRAP, IfcWasteTerminalType_FLOORWASTE, IfcWasteTerminalType_GULLYSUMP, IfcWasteTerminalType_GULLYTRAP, IfcWasteTerminalType_ROOFDRAIN, IfcWasteTerminalType_WASTEDISPOSALUNIT, IfcWasteTerminalType_WASTETRAP, IfcWasteTerminalType_USERDEFINED, IfcWasteTerminalType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7236,6 +7434,7 @@ public:
     typedef enum {IfcWindowPanelOperation_SIDEHUNGRIGHTHAND, IfcWindowPanelOperation_SIDEHUNGLEFTHAND, IfcWindowPanelOperation_TILTANDTURNRIGHTHAND, IfcWindowPanelOperation_TILTANDTURNLEFTHAND, IfcWindowPanelOperation_TOPHUNG, IfcWindowPanelOperation_BOTTOMHUNG, IfcWindowPanelOperation_PIVOTHORIZONTAL, IfcWindowPanelOperation_PIVOTVERTICAL, IfcWindowPanelOperation_SLIDINGHORIZONTAL, IfcWindowPanelOperation_SLIDINGVERTICAL, IfcWindowPanelOperation_REMOVABLECASEMENT, IfcWindowPanelOperation_FIXEDCASEMENT, IfcWindowPanelOperation_OTHEROPERATION, IfcWindowPanelOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7313,6 +7512,7 @@ public:
     typedef enum {IfcWindowPanelPosition_LEFT, IfcWindowPanelPosition_MIDDLE, IfcWindowPanelPosition_RIGHT, IfcWindowPanelPosition_BOTTOM, IfcWindowPanelPosition_TOP, IfcWindowPanelPosition_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7333,6 +7533,7 @@ public:
     typedef enum {IfcWindowStyleConstruction_ALUMINIUM, IfcWindowStyleConstruction_HIGH_GRADE_STEEL, IfcWindowStyleConstruction_STEEL, IfcWindowStyleConstruction_WOOD, IfcWindowStyleConstruction_ALUMINIUM_WOOD, IfcWindowStyleConstruction_PLASTIC, IfcWindowStyleConstruction_OTHER_CONSTRUCTION, IfcWindowStyleConstruction_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7420,6 +7621,7 @@ public:
     typedef enum {IfcWindowStyleOperation_SINGLE_PANEL, IfcWindowStyleOperation_DOUBLE_PANEL_VERTICAL, IfcWindowStyleOperation_DOUBLE_PANEL_HORIZONTAL, IfcWindowStyleOperation_TRIPLE_PANEL_VERTICAL, IfcWindowStyleOperation_TRIPLE_PANEL_BOTTOM, IfcWindowStyleOperation_TRIPLE_PANEL_TOP, IfcWindowStyleOperation_TRIPLE_PANEL_LEFT, IfcWindowStyleOperation_TRIPLE_PANEL_RIGHT, IfcWindowStyleOperation_TRIPLE_PANEL_HORIZONTAL, IfcWindowStyleOperation_USERDEFINED, IfcWindowStyleOperation_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7449,6 +7651,7 @@ public:
     typedef enum {IfcWindowType_WINDOW, IfcWindowType_SKYLIGHT, IfcWindowType_LIGHTDOME, IfcWindowType_USERDEFINED, IfcWindowType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7533,6 +7736,7 @@ public:
     typedef enum {IfcWindowTypePartitioning_SINGLE_PANEL, IfcWindowTypePartitioning_DOUBLE_PANEL_VERTICAL, IfcWindowTypePartitioning_DOUBLE_PANEL_HORIZONTAL, IfcWindowTypePartitioning_TRIPLE_PANEL_VERTICAL, IfcWindowTypePartitioning_TRIPLE_PANEL_BOTTOM, IfcWindowTypePartitioning_TRIPLE_PANEL_TOP, IfcWindowTypePartitioning_TRIPLE_PANEL_LEFT, IfcWindowTypePartitioning_TRIPLE_PANEL_RIGHT, IfcWindowTypePartitioning_TRIPLE_PANEL_HORIZONTAL, IfcWindowTypePartitioning_USERDEFINED, IfcWindowTypePartitioning_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7557,6 +7761,7 @@ public:
     typedef enum {IfcWorkCalendarType_FIRSTSHIFT, IfcWorkCalendarType_SECONDSHIFT, IfcWorkCalendarType_THIRDSHIFT, IfcWorkCalendarType_USERDEFINED, IfcWorkCalendarType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7581,6 +7786,7 @@ public:
     typedef enum {IfcWorkPlanType_ACTUAL, IfcWorkPlanType_BASELINE, IfcWorkPlanType_PLANNED, IfcWorkPlanType_USERDEFINED, IfcWorkPlanType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -7605,6 +7811,7 @@ public:
     typedef enum {IfcWorkScheduleType_ACTUAL, IfcWorkScheduleType_BASELINE, IfcWorkScheduleType_PLANNED, IfcWorkScheduleType_USERDEFINED, IfcWorkScheduleType_NOTDEFINED} Value;
     static const char* ToString(Value v);
     static Value FromString(const std::string& s);
+    static Value FromArgument(const Argument& a);
 
     virtual const IfcParse::enumeration_type& declaration() const;
     static const IfcParse::enumeration_type& Class();
@@ -2381,6 +2381,127 @@ class IFC4X1_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X1_keyword_displacements[300] = {
+    65, 10, 20, 1, 11, 3, 2, 26, 69, 2, 1, 1, 1, 3, 9, 1,
+    24, 2, 16, 31, 10, 9, 33, 87, 10, 7, 23, 29, 1, 20, 136, 6,
+    14, 9, 18, 8, 1, 10, 3, 79, 10, 26, 47, 10, 3, 9, 0, 3,
+    6, 8, 5, 2, 9, 13, 1, 28, 4, 18, 1, 1, 1, 2, 2, 43,
+    1, 4, 21, 0, 6, 41, 12, 0, 12, 15, 2, 2, 6, 33, 0, 16,
+    4, 7, 72, 1, 1, 1, 1, 21, 7, 3, 9, 1, 1, 5, 1, 13,
+    9, 11, 1, 3, 107, 6, 1, 1, 2, 1, 9, 12, 85, 50, 3, 14,
+    2, 9, 38, 14, 1, 1, 2, 6, 31, 47, 9, 27, 15, 11, 1, 1,
+    9, 7, 17, 87, 5, 31, 19, 95, 18, 10, 12, 1, 14, 41, 4, 20,
+    16, 4, 5, 2, 2, 2, 10, 1, 20, 10, 1, 7, 6, 16, 10, 2,
+    8, 18, 6, 4, 1, 28, 10, 5, 1, 22, 6, 28, 5, 6, 5, 1,
+    8, 2, 3, 66, 29, 2, 4, 4, 10, 35, 10, 5, 2, 1, 1, 4,
+    1, 5, 1, 1, 129, 5, 10, 4, 17, 6, 30, 65, 4, 4, 2, 1,
+    1, 10, 26, 2, 48, 11, 4, 141, 64, 38, 7, 9, 6, 4, 13, 16,
+    6, 1, 34, 28, 2, 8, 11, 61, 4, 24, 12, 5, 14, 25, 1, 4,
+    8, 1, 11, 14, 1, 20, 45, 7, 1, 2, 5, 42, 11, 4, 58, 33,
+    11, 4, 11, 2, 13, 22, 31, 15, 47, 5, 4, 3, 57, 1, 17, 13,
+    35, 1, 15, 2, 8, 15, 1, 4, 16, 3, 4, 17, 7, 3, 13, 9,
+    33, 4, 1, 3, 5, 1, 2, 1, 2, 15, 9, 32
+};
+
+static const int16_t IFC4X1_keyword_slots[1501] = {
+    177, 350, 399, 385, 780, 522, 488, 93, -1, 640, -1, 417, 665, 1096, 949, -1,
+    547, 999, 6, 241, 993, 1047, -1, -1, 427, 709, 278, 912, 988, 275, -1, -1,
+    51, 11, 865, -1, -1, 273, 588, 326, 604, 388, 159, 203, 871, 599, 64, -1,
+    -1, 290, 1115, 1094, 771, -1, 69, -1, 1140, 110, 983, 438, 1085, 890, 1171, 735,
+    65, -1, 794, -1, 574, -1, 215, 209, 245, 605, 518, 304, 454, 922, 129, 485,
+    468, 736, 1122, 870, 907, 733, 681, 1078, 663, 20, 1034, 377, 50, 775, 933, 294,
+    866, 387, 469, 1003, 461, -1, 253, -1, 293, 371, 740, 265, 102, 986, 247, 0,
+    -1, 148, 631, 424, 562, 135, -1, 7, 837, 565, 244, -1, 191, -1, 394, -1,
+    137, 1173, 23, -1, 849, 610, 839, 506, 939, -1, 234, -1, 1016, 213, 738, 1152,
+    -1, 364, 832, 19, 106, -1, 1064, -1, -1, 1195, -1, 37, 59, 233, 154, 883,
+    248, -1, 1027, 767, 121, 1146, 309, -1, 530, -1, 373, 1196, 895, 432, 987, 885,
+    1042, 749, 516, 514, -1, 1101, 696, 480, 297, 220, 698, 269, 915, 625, 560, 790,
+    1029, 1097, -1, 401, -1, 578, -1, 1137, -1, 748, 855, 745, 436, 229, 61, 1116,
+    1008, 428, 1055, 673, 122, 546, 71, 1156, 822, -1, 5, 447, 279, -1, -1, 655,
+    441, 500, 1164, 690, 1007, -1, -1, 405, 755, 969, -1, 418, 141, -1, 254, -1,
+    569, 727, 105, -1, 15, -1, 478, -1, 1019, 796, 814, -1, 38, 930, 476, 1081,
+    494, 813, -1, 542, 852, 641, -1, -1, 548, 302, 1087, -1, 704, -1, 613, 311,
+    538, 56, 227, 396, -1, 406, 306, 462, -1, 271, 402, 17, 982, -1, 1071, 1144,
+    633, 976, 171, 712, -1, -1, 763, 624, 747, 872, 390, 893, -1, 112, 622, 981,
+    138, 809, 393, -1, 378, 283, 1103, 195, -1, 136, 857, -1, 1076, 521, 608, -1,
+    1197, 1155, -1, 961, 22, 162, 333, 473, -1, 1046, 723, 225, 498, 842, 1074, 35,
+    -1, 996, -1, 416, 800, 29, 630, 897, 729, 573, 1032, -1, 250, 1181, -1, 366,
+    320, 722, 535, 781, -1, 505, 585, 595, 1018, 571, 337, -1, 1139, 24, -1, 793,
+    -1, 635, 1178, 446, 55, 1175, -1, 1086, 453, 863, 695, 303, -1, 808, 903, 4,
+    894, 554, -1, -1, 691, 1009, -1, 375, 257, 318, -1, -1, 1127, 761, -1, 263,
+    672, 719, 169, 878, 888, -1, 944, 117, 889, -1, 319, 777, 111, 383, 489, 621,
+    659, 812, 321, -1, 46, 458, 710, -1, 1002, 32, 16, 481, 317, 1121, 1021, 932,
+    896, 947, 277, 721, 679, 1062, 212, 509, 1174, -1, 1095, 848, 40, -1, 82, 536,
+    201, 374, 359, 942, 381, 1036, 768, -1, 18, 661, -1, -1, 211, 931, 95, 669,
+    677, -1, 1049, 126, 356, 524, 935, 189, -1, 86, -1, -1, 83, 99, 276, -1,
+    -1, 744, 389, 1142, 1015, 1110, -1, 216, 1161, 902, 77, 715, 504, -1, 687, 467,
+    1125, 688, 486, 1190, 1052, 815, 666, 324, 392, 433, 810, 693, 1163, 382, -1, 819,
+    503, 280, 590, 629, 475, -1, 218, 725, 1133, 259, 553, 58, 914, -1, 48, 649,
+    875, 232, -1, 627, 1058, 699, 346, 833, 14, 537, 773, 400, 422, 450, 348, 281,
+    1194, 1035, 668, -1, 1114, 557, 465, 301, 762, 1004, 439, -1, 52, 510, 731, 313,
+    3, 919, -1, 936, 329, 682, 184, 57, -1, -1, -1, 962, -1, 166, 646, 908,
+    520, 190, 1135, 78, 788, 924, 706, -1, 440, 1184, -1, -1, -1, 1198, 357, -1,
+    -1, 882, 858, 1041, 155, 471, 1033, -1, 549, 892, 616, 797, -1, 1153, 647, -1,
+    1072, 937, 73, -1, 114, -1, 334, 1104, 795, 1154, 1022, 1059, -1, -1, 197, 355,
+    906, 711, 192, 818, 347, 214, 611, 1092, 1057, 1, 160, 149, -1, 492, -1, 224,
+    186, 143, 541, 632, 827, 700, 163, -1, -1, 980, 1112, 1183, 25, 978, 955, 115,
+    -1, 289, 716, 853, 331, 307, 1105, -1, 139, 1089, 825, 606, 1126, -1, -1, -1,
+    701, 742, 456, 54, 856, 572, 97, 354, 252, 844, -1, 552, 1068, -1, -1, 620,
+    151, 222, 251, 267, 770, 561, -1, 316, 802, 145, 104, 146, -1, 310, 593, 964,
+    960, 786, 734, 791, 508, 379, -1, 242, 421, 807, 1030, 951, 805, 464, 534, 583,
+    196, 1012, 1082, 200, 75, -1, 1010, 821, 683, 493, 1177, 1091, 133, -1, 555, 157,
+    952, 567, -1, 119, 435, 675, 470, 44, 449, 911, -1, 1187, -1, 753, 226, 774,
+    231, 264, 344, -1, 737, 72, 365, 1150, 941, 1199, 239, 170, 491, 1166, 597, 384,
+    -1, 98, -1, -1, 30, 284, -1, 8, 607, 175, 581, 879, 946, 134, 21, -1,
+    -1, 860, 816, -1, 592, 300, 843, 587, 676, 466, 994, -1, -1, -1, 9, 1037,
+    967, -1, -1, 210, 410, -1, 642, -1, 580, 150, 1117, 1106, 262, 619, 330, 180,
+    1090, 208, 1151, 255, 891, -1, 10, 881, 367, -1, -1, 708, -1, 274, 667, -1,
+    2, 600, 905, 752, -1, 526, 846, 345, 758, 628, 519, 235, 1134, 594, 173, 558,
+    188, -1, 205, -1, 1053, 880, -1, 153, 96, 80, 671, 131, 840, -1, 958, 397,
+    185, 1102, 656, 88, 156, 1123, 1108, 125, 325, 1129, 305, 487, 998, 295, 142, 1099,
+    -1, 165, 1193, -1, 766, -1, -1, 692, 53, 332, 482, 1023, 707, 1180, -1, 484,
+    68, 563, -1, 314, 972, 1131, 823, -1, 1143, 60, 685, -1, -1, 811, 407, -1,
+    258, 79, 995, 1162, 789, 1025, 178, 910, 1014, 223, 1006, 426, -1, 152, 977, -1,
+    637, 423, 448, 116, 81, -1, 183, 1168, 291, 754, 219, 575, 997, -1, 923, 577,
+    824, 261, -1, 147, 694, 70, 33, -1, 495, -1, 501, 898, 108, 531, 803, -1,
+    869, 236, 368, 288, 41, 1185, 1160, -1, 726, 1079, 90, -1, 360, 525, -1, 207,
+    1039, -1, -1, 876, 415, 887, 836, 528, 970, 511, 901, 792, 626, 315, 826, 1067,
+    340, 206, 782, 483, 408, 62, 167, 358, 507, 984, 328, 686, 174, 26, 559, 193,
+    515, 598, -1, 1011, 113, 477, 603, 299, 662, 434, 256, 199, -1, 338, -1, 732,
+    568, -1, 161, 601, 176, -1, 420, 1051, -1, 249, 391, 362, -1, -1, 270, 118,
+    -1, -1, 920, 862, -1, 831, -1, 918, -1, 948, 84, 940, 322, 27, 128, 1017,
+    -1, -1, -1, 859, -1, 643, 272, -1, 513, 828, -1, 372, 591, 1179, 527, 820,
+    638, 551, 953, 260, 586, -1, 985, 1165, 743, -1, 697, 618, 502, 973, 497, 615,
+    -1, -1, -1, 1084, -1, 1048, 474, -1, 1050, 785, 286, 644, 648, 728, 934, 172,
+    990, 1124, 217, 956, 91, 168, 589, 868, 653, -1, 124, 759, 351, -1, 380, 103,
+    566, 181, -1, -1, 1120, -1, 660, 845, 343, -1, 801, 899, 884, 376, 850, 443,
+    352, 714, 107, -1, -1, 657, 413, 411, 817, 806, 570, -1, 1060, 921, 834, 975,
+    579, 1040, 564, -1, 971, 363, 130, 945, 1147, 460, 237, 404, 582, 776, 204, 499,
+    31, 917, 1159, 636, -1, 327, 1066, 287, 1107, 756, 457, -1, 1149, 639, 308, 198,
+    109, 523, 764, 463, 268, 430, 1065, -1, 414, 680, 369, 543, 282, 916, 830, 750,
+    -1, 717, 1073, 854, 496, 123, 804, 312, -1, -1, 370, -1, 1109, 529, 778, -1,
+    1141, 179, 1098, -1, -1, 230, 943, 1088, 654, 1093, 900, 1020, 398, 1138, -1, 861,
+    979, 1031, 409, 335, 835, 799, 490, -1, -1, 1100, -1, 617, 353, 1128, 765, 36,
+    532, 913, 1075, 1061, -1, 658, -1, 1191, 614, 132, 670, 412, 341, 652, -1, -1,
+    1083, 703, 47, 927, 966, 741, 1000, 938, -1, 92, 221, 959, 164, -1, 1176, 85,
+    929, -1, 323, 403, 963, -1, 1118, 904, 739, 925, 63, 829, 292, -1, 425, 926,
+    445, 867, 238, -1, 66, 674, -1, 1158, 158, -1, 42, -1, -1, 602, 386, 787,
+    909, 101, 576, 1145, 452, 182, 1026, 965, 873, -1, 39, 1186, -1, 1132, 651, 87,
+    1044, 1113, 864, 550, 1001, 472, 584, 1157, 459, -1, 650, 841, 751, -1, 1024, 760,
+    -1, -1, 120, -1, -1, 228, 1188, 724, -1, 718, 45, 479, 702, 886, 1119, 539,
+    838, -1, 266, 1148, 76, -1, 240, 1170, 1077, 928, -1, -1, -1, 144, 1111, 202,
+    -1, 94, 974, 645, 1189, -1, 746, -1, 140, 783, 851, 12, 730, -1, 1169, 187,
+    -1, 1080, 664, 512, -1, 989, 194, 623, 556, 772, 769, 545, 1063, 431, 874, 533,
+    49, 442, 429, -1, 877, 950, 100, -1, 437, 689, 1136, -1, 954, 243, 74, 43,
+    -1, 28, 609, 596, 1172, -1, 713, -1, -1, 339, 361, 342, -1, -1, 1028, 395,
+    1043, 847, 1069, 1130, 1167, 784, 349, 451, 127, 634, -1, 540, -1, 1013, 1070, 991,
+    957, 1200, 13, 89, -1, 1192, 419, 968, 296, 1182, 455, -1, -1, 285, 544, -1,
+    720, 798, 67, 992, 444, 336, 705, 678, 298, 1038, 684, 1005, -1, -1, 612, 1045,
+    -1, 517, 246, -1, 34, -1, -1, 757, 779, -1, 1054, -1, 1056
+};
+
+static const keyword_table IFC4X1_keywords = { IFC4X1_keyword_displacements, 300, IFC4X1_keyword_slots, 1501 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -15461,7 +15582,7 @@ IfcParse::schema_definition* IFC4X1_populate_schema() {
     declarations.push_back(IFC4X1_IfcWorkTime_type);
     declarations.push_back(IFC4X1_IfcZone_type);
     declarations.push_back(IFC4X1_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X1", declarations, new IFC4X1_instance_factory());
+    return new schema_definition("IFC4X1", declarations, new IFC4X1_instance_factory(), &IFC4X1_keywords);
 }
 
 
@@ -2425,6 +2425,130 @@ class IFC4X2_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X2_keyword_displacements[305] = {
+    19, 2, 9, 1, 10, 1, 11, 25, 60, 1, 44, 16, 44, 12, 1, 7,
+    21, 23, 2, 1, 1, 25, 9, 6, 1, 46, 18, 15, 25, 5, 7, 3,
+    3, 10, 11, 3, 3, 3, 59, 43, 6, 1, 5, 23, 7, 1, 3, 1,
+    6, 42, 4, 36, 4, 3, 2, 3, 7, 24, 1, 1, 1, 1, 1, 2,
+    78, 6, 4, 52, 1, 15, 22, 2, 19, 3, 145, 3, 5, 5, 13, 11,
+    13, 3, 8, 67, 2, 7, 68, 17, 7, 6, 78, 8, 55, 4, 1, 4,
+    9, 30, 3, 8, 15, 0, 24, 27, 24, 3, 3, 0, 10, 1, 12, 41,
+    2, 5, 17, 1, 7, 4, 2, 25, 2, 11, 7, 11, 4, 24, 11, 2,
+    13, 2, 2, 13, 26, 1, 3, 1, 1, 5, 50, 37, 2, 4, 29, 32,
+    9, 6, 5, 11, 15, 10, 1, 9, 12, 22, 8, 2, 1, 25, 6, 1,
+    16, 5, 2, 15, 35, 2, 11, 6, 10, 13, 25, 15, 94, 6, 2, 27,
+    40, 7, 1, 15, 57, 1, 20, 13, 10, 7, 45, 16, 7, 1, 14, 10,
+    34, 3, 10, 26, 10, 1, 38, 6, 1, 1, 49, 7, 11, 35, 18, 10,
+    16, 2, 18, 3, 19, 40, 17, 1, 5, 15, 22, 34, 1, 8, 6, 1,
+    29, 15, 26, 0, 1, 7, 3, 1, 2, 8, 4, 1, 85, 2, 64, 21,
+    1, 16, 6, 9, 2, 59, 18, 3, 16, 24, 1, 24, 11, 3, 18, 54,
+    2, 1, 34, 2, 1, 8, 10, 18, 25, 5, 55, 39, 31, 5, 30, 118,
+    6, 13, 2, 97, 6, 6, 5, 1, 0, 1, 2, 8, 5, 5, 7, 3,
+    20, 3, 1, 0, 2, 9, 1, 2, 9, 1, 11, 57, 33, 11, 14, 26,
+    27
+};
+
+static const int16_t IFC4X2_keyword_slots[1528] = {
+    353, -1, 1144, 534, 724, 344, 1119, 1009, 827, 355, 1118, -1, 585, -1, -1, 240,
+    639, 97, 247, 252, -1, 382, -1, -1, 789, -1, 904, 80, 426, 609, 584, 974,
+    767, 1092, 644, 8, -1, 484, -1, 478, 806, 962, 975, 628, 301, -1, -1, -1,
+    917, 577, -1, 163, 775, 984, 349, 731, 653, 888, 473, 55, 172, 284, 539, -1,
+    -1, 615, 812, 1019, 967, 465, 1125, -1, 727, -1, 221, 129, 283, -1, 856, 411,
+    58, 656, 664, 734, 559, 146, -1, 642, 624, -1, 346, 782, 849, 1143, -1, -1,
+    1183, 852, 19, 633, 1169, -1, 1139, -1, 1056, 260, -1, 125, 1132, 1149, 1008, 573,
+    1095, 230, 90, 1168, 601, 599, 612, 623, 515, 16, 387, 216, 805, 517, 1041, 496,
+    620, 1030, 591, 667, 337, 1186, 340, 102, -1, -1, 787, 698, 116, 86, 258, 640,
+    1128, 466, 607, -1, 954, -1, 531, 739, -1, -1, 747, 1025, -1, 497, 964, 661,
+    835, 663, 463, 231, 91, 881, -1, -1, 960, 155, 662, 760, 1182, 510, -1, 270,
+    235, 819, 1052, 959, 9, 1170, -1, 949, 179, -1, 514, 1027, 532, 308, 84, 1151,
+    547, 1160, 776, 188, -1, 586, 82, 304, 936, 621, 1102, 1178, 1222, 1131, 1126, 1200,
+    729, 613, 893, 706, 757, 970, 587, 291, 1068, 811, 199, 461, -1, 1211, 71, 1001,
+    88, 1175, 752, 899, -1, 928, 1201, 29, 803, 907, 870, 287, 544, 843, 174, 716,
+    412, -1, 347, 407, 924, 111, -1, 994, 150, 456, 684, 638, 21, 825, 317, 778,
+    408, 1050, 1192, -1, 1172, 1029, 850, 943, 338, 24, 923, -1, 198, 1116, -1, -1,
+    1129, 167, 905, 250, 239, -1, 511, -1, 154, 386, 903, 352, -1, 50, 95, 26,
+    72, 1202, 519, -1, 332, 1065, -1, 1113, 720, 158, 596, -1, 419, 844, 358, 701,
+    1130, 762, 41, 546, 350, 660, -1, 1164, 920, 1188, -1, 858, 735, 1159, 1094, 394,
+    -1, 118, 774, 312, 625, 491, -1, 627, 124, 424, 290, -1, -1, 309, 937, 264,
+    1137, 1180, 106, -1, 227, 442, 432, -1, 1032, 909, 867, 1031, 761, 530, 1070, 857,
+    548, -1, 569, 631, 28, 7, 618, 128, 51, 610, -1, 665, 210, 379, 538, 362,
+    12, -1, 798, 786, -1, 187, -1, -1, 142, 224, -1, 582, -1, 939, 503, -1,
+    1021, -1, 683, 1142, 1028, 551, 772, 1158, 953, 908, -1, 2, 647, 1154, 339, 422,
+    677, 282, 110, 263, 279, 53, 23, 276, -1, 780, 600, -1, 1203, 630, -1, 160,
+    -1, -1, 195, 611, 336, 217, 56, 1059, 914, 1111, 170, 979, 861, 359, 999, 721,
+    1206, 57, 414, 873, 453, 244, 119, 1122, 842, 298, 629, 1106, 458, 389, 335, 822,
+    1174, -1, 368, -1, 826, 649, 830, 1076, 545, -1, 754, 481, 435, 883, 438, 572,
+    -1, 678, 915, 486, 828, 784, 925, -1, 1191, 472, 161, -1, 575, 1184, 66, 556,
+    524, 558, 98, 578, -1, 431, 646, -1, 321, 223, -1, -1, -1, -1, 327, 457,
+    1115, 868, 513, 719, 413, -1, 1003, 303, 99, 679, 906, 626, 567, 859, -1, 485,
+    741, 214, -1, -1, -1, 75, 885, 1135, 266, 226, -1, 972, -1, 402, 807, 32,
+    105, -1, -1, 853, 1107, 1014, 1002, 480, -1, 555, 792, -1, 602, 697, 323, -1,
+    718, -1, -1, 246, 987, -1, -1, 942, -1, 1040, 1147, 357, 781, 1127, 1195, 159,
+    1079, 207, 940, 108, 331, 658, 553, 922, 1055, 851, 1176, 177, -1, 1199, 809, 52,
+    -1, -1, -1, 388, 749, -1, -1, -1, 608, 689, 114, 449, 744, 891, 674, 30,
+    113, 143, 306, 186, 96, 288, -1, 205, 722, 981, -1, 109, -1, 897, 654, 326,
+    133, -1, 135, -1, 525, 455, -1, 641, -1, -1, 139, 634, 1036, 40, 137, 467,
+    -1, 1006, 1082, -1, 314, 971, 197, 416, -1, 604, -1, 708, 1121, 273, 529, -1,
+    1177, 672, 549, 854, -1, 440, 686, 500, 1042, -1, 10, 498, 138, 0, 932, 363,
+    931, 145, 489, -1, 173, 693, 955, 248, 89, 1207, 829, -1, -1, 180, 875, -1,
+    228, 743, 501, 468, 289, -1, 846, 117, 46, -1, 229, 574, 550, 864, 395, 777,
+    562, -1, -1, 823, -1, 329, 793, 6, 469, 48, 1134, 132, 1060, -1, -1, 794,
+    -1, 816, 1185, 817, 540, 399, 504, 1083, 44, 648, 406, 232, 446, 365, 941, 475,
+    369, -1, -1, 62, 302, 1155, 832, 165, 385, 709, 181, 373, 563, 738, -1, 580,
+    783, 371, 354, 265, 831, 1064, 436, -1, 1034, -1, 1053, -1, -1, 209, -1, 1010,
+    -1, -1, 506, 1011, 31, 141, -1, 130, 910, -1, 1145, 1071, 286, 151, 879, 657,
+    275, 834, 1089, 1058, -1, -1, -1, 1078, 958, 328, 581, 921, 882, 393, 790, 912,
+    753, 361, -1, 11, 1194, 509, -1, 182, -1, 316, 123, 1004, 713, -1, 417, 183,
+    225, 880, -1, 691, -1, 564, 164, 571, 295, 1140, -1, -1, 1108, 203, -1, 690,
+    -1, 1163, 281, 1037, 847, 730, 704, -1, 989, 750, 702, 1080, 536, 175, 614, -1,
+    1166, 391, 795, 107, 383, 682, -1, 810, 692, 73, 201, 319, -1, 650, 238, 1124,
+    -1, 122, 483, 799, 946, 1198, 14, -1, 966, 377, 22, 87, 598, -1, 502, -1,
+    20, 462, 838, 872, 115, 324, 211, 1063, 1044, 126, 926, 768, 294, 255, 930, 945,
+    542, 269, 963, 837, 728, 70, 5, 495, 499, 576, -1, 202, 876, 1024, 714, 896,
+    -1, -1, -1, -1, 334, 740, -1, 635, 156, 717, 136, 459, 245, 523, 447, 951,
+    434, 1146, 1197, 140, 1096, 1218, 375, -1, -1, -1, -1, 990, 603, 77, -1, 262,
+    1033, 948, 1150, 737, -1, 976, -1, -1, -1, 376, 696, 818, 403, 522, -1, 103,
+    -1, -1, 1062, 755, -1, 237, 568, 271, 147, 554, 998, 973, 992, 34, 969, -1,
+    521, 272, 1212, -1, 191, 79, 127, -1, 1153, -1, 685, 220, 1161, -1, -1, 490,
+    366, 330, 886, 1061, 1112, 616, 285, 763, -1, 1091, -1, 965, 267, -1, 78, -1,
+    769, -1, 1087, 535, 94, 307, 855, 392, 3, 637, -1, 927, 725, 671, 894, 18,
+    60, -1, 527, 643, 1105, 986, 460, 320, -1, 120, 1173, 421, 938, 1048, 427, 342,
+    -1, -1, 222, 900, 889, 81, 869, 189, 733, 1196, 400, 1018, -1, 892, 236, -1,
+    695, 1007, -1, 687, -1, 378, 1097, -1, 121, 25, -1, 1217, -1, 957, 863, 1017,
+    -1, 148, 759, 428, -1, 820, 916, 212, -1, 487, -1, 257, 770, -1, 1069, 997,
+    184, 131, 1208, 588, 410, -1, 605, 13, -1, 153, 401, 673, 441, 516, 980, 1051,
+    241, 1074, 1026, 43, -1, 865, 176, 1103, 791, -1, 1216, 1104, 1057, 680, 991, -1,
+    -1, 901, 952, -1, 669, 249, 732, 61, 208, 557, 1219, 681, 1213, 785, 800, 144,
+    372, 351, -1, 64, 67, 318, 39, 200, 918, 561, 676, 619, 345, 579, 860, -1,
+    -1, 38, 190, 297, -1, 688, 433, 1049, 833, -1, -1, 771, 796, 1165, -1, 595,
+    310, 169, -1, 675, 1189, 479, 69, 104, -1, 348, 36, -1, 215, 518, 1156, -1,
+    -1, 801, 171, 666, 1012, 982, 1090, 622, 333, 1141, 178, 313, 933, 398, 149, -1,
+    1148, 935, 1110, 1072, 947, 606, 1038, 1193, 1101, 343, 804, 367, 234, 815, 919, 268,
+    507, 862, 541, 293, 715, 985, 1210, 206, 902, -1, 505, 261, 492, 1221, 961, 192,
+    -1, 1187, 37, -1, 565, 1, 520, 451, 305, 808, -1, 1215, -1, 1162, -1, 415,
+    443, -1, -1, -1, 85, 27, 895, 652, 636, 839, 470, -1, 450, 533, 583, 797,
+    913, 1152, -1, 840, 390, 877, 1088, -1, 1077, -1, 256, -1, 322, 526, 381, -1,
+    929, 593, 703, 950, 841, 1035, -1, 756, 1138, 745, 405, 887, 592, 1000, 168, 494,
+    488, 655, 1109, -1, 274, 566, -1, 993, 668, 694, 444, 152, 47, 560, 845, -1,
+    944, 166, 651, 1073, 380, 1190, 802, 409, 33, 1075, 836, 590, 404, 700, 63, 645,
+    -1, 597, 508, 420, 766, 594, 374, 311, -1, 278, 1023, 49, 280, 1123, -1, 824,
+    112, 68, 1020, 429, -1, -1, 59, -1, 1005, 1043, 370, 1179, -1, 552, 243, 83,
+    898, 617, 1120, 213, -1, 512, 1039, 364, 1205, 54, 779, 788, 874, 988, 325, -1,
+    -1, 315, 1045, 356, 1013, 977, -1, 430, 748, 773, 1099, -1, 193, -1, -1, 233,
+    1117, 74, 884, 670, 445, 1209, -1, 1098, 1066, -1, 464, -1, 723, 476, 1181, 1214,
+    742, 1171, -1, 259, 543, 705, 396, 277, -1, -1, 474, 1085, 423, 360, 471, 418,
+    1157, -1, 1081, 1084, 890, 162, 528, 589, -1, -1, 659, 65, 439, 1167, -1, 866,
+    -1, 765, 726, 699, -1, 995, 477, 15, -1, 764, -1, 185, -1, -1, 251, -1,
+    956, -1, -1, 911, 751, -1, 746, -1, 632, -1, 300, 384, 1220, 437, -1, 452,
+    1204, 814, 42, 821, 299, 1100, 983, 1114, 711, 570, -1, 537, 707, -1, 134, 1067,
+    -1, 1093, 1136, 978, 1047, 482, 204, 397, 425, -1, 17, 710, 1086, 253, 1022, 35,
+    101, 242, 218, 712, 1054, -1, -1, 45, 813, 1133, 758, 100, 996, 254, 196, 848,
+    76, 4, 493, 1015, 871, 878, -1, 736, 1016, 448, 292, 934, 454, 157, -1, 296,
+    -1, 1046, 194, 219, 93, 341, 92, 968
+};
+
+static const keyword_table IFC4X2_keywords = { IFC4X2_keyword_displacements, 305, IFC4X2_keyword_slots, 1528 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -15797,7 +15921,7 @@ IfcParse::schema_definition* IFC4X2_populate_schema() {
     declarations.push_back(IFC4X2_IfcWorkTime_type);
     declarations.push_back(IFC4X2_IfcZone_type);
     declarations.push_back(IFC4X2_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X2", declarations, new IFC4X2_instance_factory());
+    return new schema_definition("IFC4X2", declarations, new IFC4X2_instance_factory(), &IFC4X2_keywords);
 }
 
 
@@ -2600,6 +2600,138 @@ class IFC4X3_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X3_keyword_displacements[327] = {
+    13, 5, 1, 2, 5, 1, 2, 1, 1, 8, 26, 10, 7, 4, 2, 10,
+    12, 3, 3, 91, 12, 8, 38, 3, 10, 5, 2, 25, 3, 28, 2, 1,
+    5, 34, 2, 8, 1, 17, 48, 6, 1, 14, 3, 19, 1, 1, 10, 1,
+    1, 2, 1, 10, 59, 6, 42, 14, 41, 8, 14, 2, 5, 16, 26, 2,
+    1, 17, 1, 15, 3, 3, 12, 14, 40, 6, 34, 6, 3, 4, 0, 19,
+    5, 1, 35, 44, 1, 16, 0, 9, 1, 1, 8, 13, 16, 2, 12, 29,
+    15, 17, 25, 2, 11, 14, 22, 8, 26, 2, 27, 6, 1, 2, 15, 17,
+    1, 1, 3, 4, 12, 15, 13, 8, 3, 17, 5, 11, 49, 11, 3, 15,
+    2, 5, 17, 57, 1, 3, 1, 10, 4, 2, 8, 3, 2, 6, 12, 4,
+    16, 2, 47, 15, 11, 2, 15, 64, 32, 8, 4, 21, 12, 11, 39, 19,
+    8, 22, 6, 32, 0, 5, 4, 7, 1, 5, 10, 3, 4, 35, 40, 17,
+    6, 1, 13, 0, 5, 3, 3, 1, 2, 8, 35, 10, 5, 23, 14, 1,
+    2, 1, 4, 2, 20, 3, 1, 6, 1, 21, 21, 14, 23, 3, 12, 10,
+    2, 10, 1, 9, 3, 1, 32, 2, 28, 1, 3, 11, 8, 118, 2, 5,
+    1, 1, 37, 8, 68, 9, 25, 10, 40, 1, 7, 123, 6, 2, 22, 7,
+    31, 4, 2, 9, 11, 1, 10, 19, 10, 13, 4, 7, 9, 9, 1, 32,
+    0, 2, 19, 1, 17, 1, 1, 21, 32, 3, 24, 10, 2, 21, 7, 4,
+    1, 3, 3, 10, 1, 22, 1, 21, 5, 9, 62, 10, 5, 1, 101, 1,
+    9, 36, 2, 87, 47, 1, 7, 2, 5, 4, 1, 36, 9, 4, 2, 4,
+    14, 2, 7, 4, 4, 27, 13, 1, 25, 4, 4, 23, 7, 23, 61, 6,
+    61, 6, 1, 14, 47, 24, 29
+};
+
+static const int16_t IFC4X3_keyword_slots[1638] = {
+    1227, -1, 1170, 714, 1106, 917, 1237, -1, 1259, -1, 563, 781, 949, 884, -1, 1234,
+    910, 382, -1, 1012, 20, 1261, 728, 694, 1269, 335, 1300, 1292, 864, 229, -1, -1,
+    860, 1020, 764, 400, 205, 969, 433, -1, 1279, 1205, -1, -1, 547, 1187, 1127, 17,
+    943, -1, 1162, 713, 1245, 1225, 1137, 42, 957, 1173, 904, 474, 1212, 1290, 1039, 931,
+    -1, 445, 971, 1049, 748, 839, 309, 273, 1258, 1129, -1, 711, -1, 623, 383, 499,
+    1301, 942, 809, -1, 103, 1283, 588, -1, 825, 1142, 785, 975, 174, 1151, 1058, -1,
+    878, -1, -1, 881, 668, 857, 902, 677, 146, 877, 423, 1047, 751, 911, -1, 206,
+    575, 399, 56, -1, 213, 41, 221, 188, 349, -1, 139, 1094, 44, 330, 181, -1,
+    223, 678, 164, 572, 1031, 912, 641, 247, -1, 312, -1, 799, 566, 821, 424, 637,
+    264, 932, -1, -1, 1156, 871, -1, 1291, 1119, 939, -1, 246, 1216, 1145, 418, -1,
+    1183, -1, -1, 1146, -1, 631, 180, 594, 763, 1100, 215, 13, -1, 311, -1, 417,
+    798, 1284, 536, 454, 23, 1214, 322, -1, 608, -1, 861, -1, 1075, 118, 1057, 695,
+    791, 1123, 1193, -1, 1045, 1029, -1, -1, 83, 967, 95, -1, 277, 167, 1252, -1,
+    230, 1002, 1278, 977, 512, 830, 465, 887, 1044, 993, 505, -1, 656, 154, -1, 836,
+    889, 1267, 1307, 208, 842, -1, 1000, 998, 191, 384, 211, 425, 153, 663, 983, 1141,
+    -1, 808, 606, 500, -1, 1015, 862, 438, -1, 367, 462, -1, 240, 968, 486, -1,
+    491, 157, -1, 171, 901, 242, 837, 5, 681, 1178, 81, 948, -1, -1, 1158, 854,
+    8, 333, -1, 85, -1, 1303, 1105, -1, 1098, 136, 542, 596, 1163, 611, 284, 131,
+    986, 1275, 1198, 71, 635, 1128, 1084, 997, 98, 1063, 672, 1230, 660, 1009, 806, 591,
+    390, 175, 989, -1, 567, 1161, 449, 1305, 886, 1096, 253, -1, 777, 218, 1061, 1079,
+    -1, -1, 440, 1302, 401, 137, 170, 290, -1, 336, 443, -1, 1150, 810, 933, -1,
+    982, 354, 203, -1, -1, 973, 355, 58, 1048, 1091, 853, 116, 984, 235, -1, 503,
+    255, 508, 755, -1, 778, -1, 119, 439, 935, 343, 469, 125, 1203, 394, -1, 573,
+    923, -1, 617, 77, 669, 317, 216, 1304, 990, 329, -1, -1, -1, 1295, 687, 29,
+    406, 1241, 412, 407, -1, 278, 395, 459, 592, 314, -1, 227, -1, 955, 589, 626,
+    38, -1, 1005, 646, 1037, 53, 55, 214, -1, 352, 866, -1, 1004, 475, -1, 409,
+    -1, 308, 467, 727, 562, -1, -1, 516, 582, 501, 262, 158, 586, 890, -1, -1,
+    765, 351, 60, 1110, -1, -1, -1, 33, 165, 91, 1206, 141, 463, 1217, -1, 1043,
+    1065, 245, 1210, -1, -1, 818, 1117, 21, -1, 299, 1228, -1, 452, 789, 9, 925,
+    883, 295, 112, 455, 228, 1085, 324, 772, 307, 648, 476, 6, 74, 1171, 48, 838,
+    -1, -1, 430, 750, 502, 736, -1, 824, -1, 364, 1097, 1166, -1, 453, 583, 1160,
+    232, 852, 1066, 690, 280, 745, 578, 769, 1054, 78, 811, 1175, 788, 688, 602, 517,
+    -1, 1035, 130, 493, 1116, 1008, 386, -1, 1055, 323, 1109, 1213, 342, -1, 829, 1064,
+    -1, 507, 553, 794, 835, 369, 365, 1280, 224, 318, 347, -1, 374, -1, 768, -1,
+    1028, 415, 538, 22, 150, 729, 252, -1, 689, 12, 622, 1152, 1104, 350, 1236, 238,
+    541, 258, 529, 1060, 1069, 712, -1, 484, 697, -1, 892, 894, 10, 873, -1, 604,
+    1121, -1, -1, 767, 102, -1, 59, -1, 426, -1, 200, 1224, -1, 51, -1, 1014,
+    226, 520, 1308, 627, 101, 1053, -1, 142, -1, 595, 279, 665, 392, 960, 991, 288,
+    730, 859, 1131, -1, 140, 705, 304, 1032, -1, 256, 472, 675, 1244, 759, 143, 1233,
+    922, -1, 495, 550, 319, 488, 601, 1050, 737, 531, -1, -1, -1, 716, 585, 893,
+    377, 671, 271, -1, -1, -1, 1199, 434, 1219, 833, 979, 725, 926, 1179, 89, 679,
+    298, 1154, 976, 574, 1135, 1185, 560, 94, -1, -1, 532, 16, -1, 121, 1139, 569,
+    771, 1263, -1, -1, 1074, 169, 959, -1, 981, 537, 826, -1, 1143, 1223, 970, 68,
+    67, 632, 792, 315, -1, 388, 1197, 1023, 126, 832, 69, 629, 640, 1112, 634, 366,
+    479, 999, 709, 855, 1030, 1231, 79, 896, 950, 848, 123, 807, 559, -1, 321, -1,
+    86, 554, 639, 564, 1087, -1, 1164, -1, 30, 1052, 15, 822, 259, 111, 790, 1118,
+    -1, 1114, 283, 52, 340, 1051, 625, 457, 237, 891, 257, 682, 155, 39, 473, 372,
+    -1, 1078, 1026, 1276, 642, -1, -1, -1, -1, 1272, 1027, 636, 327, 1120, 534, 540,
+    1201, 1196, 647, 1181, 107, -1, -1, -1, -1, 1246, 812, -1, 844, 1034, 587, -1,
+    482, 869, -1, 432, 726, 192, 179, 845, 752, 749, 603, -1, -1, 779, 620, 963,
+    -1, 1260, 49, -1, 733, 1016, -1, 856, -1, 1149, -1, 1068, -1, 1003, 952, 704,
+    849, -1, 817, 1076, 707, 1115, 341, 816, 515, 944, -1, 951, 1136, -1, 972, 934,
+    413, 185, 87, -1, -1, 404, 614, 19, 1, 524, 965, 875, 114, 936, -1, 548,
+    754, 1221, 1271, 961, 61, -1, -1, 316, -1, -1, 581, 249, 953, 945, 468, 1289,
+    339, 489, -1, 1077, 1080, 375, -1, 1092, 535, 1240, 1022, 193, -1, 980, 1253, 7,
+    -1, -1, 1167, 1101, 600, -1, -1, 803, 1208, 831, 815, 1072, 1038, 2, 54, -1,
+    599, -1, 579, -1, -1, 605, 120, 793, 202, 260, -1, -1, 921, 1172, 718, -1,
+    1273, 117, 263, 100, 362, 292, 248, 168, 1286, 40, 1006, 1239, -1, 1235, 328, 152,
+    419, -1, 1125, 1288, 756, 1134, -1, -1, 847, 1059, 212, 1021, 783, 992, 234, 692,
+    -1, 368, 720, 270, 391, -1, 498, 654, 176, 80, 693, -1, 11, 92, 590, 275,
+    1108, 717, 274, 719, -1, 698, 920, 994, -1, -1, 1309, 1138, 775, 802, 813, -1,
+    132, 1242, 1287, 735, 610, -1, 222, 450, 753, 46, 680, 996, 379, -1, 1249, 612,
+    667, 1155, -1, -1, 129, 964, 584, 1040, 24, 1204, 561, 1124, 685, 236, 846, 282,
+    1070, 261, -1, 834, 162, 867, 598, -1, 378, 127, 1159, 483, 251, 387, 36, 743,
+    444, 300, 570, 909, -1, 172, 28, 134, 546, 913, 929, 209, 217, 402, 441, 518,
+    -1, 269, 1282, -1, -1, 481, 823, -1, 198, -1, 334, 403, -1, 113, -1, 397,
+    -1, 1192, -1, 320, 148, 761, 903, 597, 1010, 850, 701, 882, 410, 1191, 1095, 225,
+    649, 658, 492, 70, 356, 448, 1007, 268, 927, 460, 919, 638, 1274, 466, 159, 906,
+    436, -1, 1209, 613, 545, 527, 851, -1, 609, 615, 522, 655, 272, 93, 115, -1,
+    -1, 827, 1024, 204, 741, -1, -1, 90, 1130, 385, -1, -1, -1, -1, 1041, 650,
+    985, 1281, 1189, 673, 914, 1148, 190, 800, 110, 1086, 746, 1266, 928, -1, -1, -1,
+    1188, 57, 879, 958, 1256, -1, -1, 478, 461, 173, 151, 1277, 286, 233, -1, 796,
+    497, -1, -1, 187, -1, 358, -1, 84, 371, 978, 565, 683, 1211, 1033, 1180, 138,
+    742, 1089, 722, -1, -1, 539, -1, 513, 361, 160, 653, 65, -1, -1, -1, 31,
+    128, 568, 721, 1018, 593, 700, -1, 431, 916, 1153, 147, -1, 446, 987, 494, -1,
+    437, 1147, 177, 201, 624, -1, 580, 1083, 43, 643, 88, -1, 27, 956, 907, 122,
+    708, 664, 552, 795, 244, 47, 616, 186, 34, 182, -1, -1, -1, 519, 995, 14,
+    183, 703, -1, 411, 149, 178, 1306, 1042, 841, 526, -1, 784, 1062, 738, 1177, 4,
+    1093, 760, 96, 496, -1, 360, 1071, 35, 696, 1144, 621, 774, 1103, 370, 359, 1019,
+    416, 1296, -1, 797, 731, -1, 124, 651, -1, 62, -1, 659, -1, 373, -1, 241,
+    -1, -1, -1, -1, 1229, 619, 786, 1232, 530, 398, 556, -1, -1, 25, 1251, 966,
+    898, 801, 396, 937, 1195, 699, 267, 163, 576, 332, 509, -1, 723, -1, 938, 184,
+    344, 428, 555, 75, -1, -1, -1, -1, 363, -1, 758, 1222, -1, 840, 1099, 195,
+    -1, 1157, 511, 485, 1257, -1, 250, 734, 266, 1013, 1090, -1, 297, 357, 874, 287,
+    674, 666, 549, 346, 946, 109, 577, 66, 762, 3, 1082, -1, 422, 918, 477, 135,
+    254, 662, 337, 1293, 487, 1194, 376, 1218, 1248, 145, 104, 1285, 348, 133, 1140, 189,
+    947, -1, -1, -1, 782, 776, 1243, -1, -1, 1270, 770, 99, 644, 197, 1122, -1,
+    533, 514, -1, -1, 447, 265, 900, 974, 0, -1, -1, 988, 1168, 607, 1111, 421,
+    289, -1, 456, 557, 64, -1, 291, 471, -1, 715, 1067, 1025, 72, 219, 940, 1081,
+    105, 868, 313, 1247, 1190, 571, 276, -1, 521, -1, 405, -1, 301, 1107, 506, -1,
+    -1, -1, 528, 1036, 880, 1133, 628, 414, 1174, 239, 231, -1, 523, 420, 1226, 1220,
+    908, 724, -1, 618, 220, -1, 843, 706, 865, 1186, 338, 380, 302, 196, -1, -1,
+    207, 1001, 930, 670, -1, 144, 1046, -1, 543, 1294, 876, 293, 747, 1310, 442, 18,
+    510, 296, 161, 739, 1176, 76, -1, -1, -1, 787, -1, -1, 1182, -1, 37, 684,
+    1298, 858, 915, 1265, 1017, -1, 710, 1262, 780, 899, -1, 1165, 1088, 393, 676, 1200,
+    870, 814, 888, 156, 732, 905, 285, 630, -1, 1169, 464, 740, 303, 97, 657, 897,
+    -1, 294, 389, 45, -1, 757, 470, -1, 895, 32, 633, 243, 1132, 544, 1073, 805,
+    -1, -1, 458, 435, 525, -1, 26, 828, -1, 1264, 1113, -1, 686, 504, 427, 924,
+    451, 381, 353, 1011, 872, 326, 82, 199, 1102, 645, 819, 281, -1, 1250, 691, 490,
+    954, -1, 1297, 305, 50, 325, 408, 331, 1255, 1056, 108, 1207, 166, 766, 652, -1,
+    804, 558, 1254, 773, 194, -1, 1126, 106, 73, 863, 1202, -1, 941, 480, -1, -1,
+    551, 744, 210, 962, 1215, -1, 345, 429, -1, 1184, 306, 310, 702, -1, 1268, 885,
+    -1, 1299, 63, 661, 820, 1238
+};
+
+static const keyword_table IFC4X3_keywords = { IFC4X3_keyword_displacements, 327, IFC4X3_keyword_slots, 1638 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -17082,7 +17214,7 @@ IfcParse::schema_definition* IFC4X3_populate_schema() {
     declarations.push_back(IFC4X3_IfcWorkTime_type);
     declarations.push_back(IFC4X3_IfcZone_type);
     declarations.push_back(IFC4X3_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X3", declarations, new IFC4X3_instance_factory());
+    return new schema_definition("IFC4X3", declarations, new IFC4X3_instance_factory(), &IFC4X3_keywords);
 }
 
 
@@ -2602,6 +2602,138 @@ class IFC4X3_ADD2_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X3_ADD2_keyword_displacements[328] = {
+    44, 52, 2, 4, 9, 9, 4, 27, 36, 1, 9, 4, 5, 34, 1, 1,
+    14, 33, 15, 6, 16, 3, 24, 18, 33, 3, 6, 6, 17, 13, 2, 2,
+    11, 10, 3, 25, 12, 20, 7, 117, 21, 4, 1, 37, 5, 1, 7, 4,
+    4, 21, 47, 14, 20, 16, 15, 7, 26, 4, 2, 16, 16, 2, 17, 24,
+    1, 4, 34, 3, 8, 16, 4, 61, 4, 7, 0, 2, 1, 1, 23, 14,
+    8, 2, 5, 33, 15, 5, 7, 8, 86, 10, 5, 6, 4, 118, 29, 5,
+    15, 5, 16, 18, 13, 29, 62, 1, 0, 7, 10, 3, 12, 49, 4, 3,
+    14, 5, 3, 3, 5, 21, 5, 13, 1, 43, 4, 24, 9, 46, 2, 1,
+    3, 37, 2, 15, 13, 6, 1, 5, 3, 2, 14, 1, 6, 1, 19, 3,
+    10, 3, 7, 5, 35, 19, 18, 3, 15, 22, 8, 52, 2, 74, 1, 1,
+    43, 19, 9, 31, 1, 8, 9, 2, 3, 72, 3, 2, 8, 27, 1, 7,
+    31, 6, 31, 3, 1, 7, 2, 1, 13, 50, 6, 3, 7, 46, 28, 22,
+    14, 5, 13, 6, 4, 10, 1, 6, 8, 1, 9, 10, 1, 14, 20, 22,
+    28, 7, 2, 5, 32, 72, 9, 23, 1, 21, 1, 22, 6, 15, 61, 4,
+    7, 16, 2, 5, 2, 48, 7, 13, 4, 0, 3, 35, 2, 11, 2, 1,
+    4, 11, 1, 30, 23, 4, 47, 1, 1, 8, 9, 5, 1, 6, 2, 0,
+    2, 0, 5, 32, 8, 16, 1, 4, 5, 9, 5, 14, 1, 11, 12, 4,
+    7, 11, 10, 1, 1, 16, 2, 1, 8, 1, 17, 12, 3, 1, 23, 12,
+    1, 3, 36, 1, 12, 4, 1, 55, 10, 8, 23, 17, 10, 4, 10, 4,
+    7, 2, 1, 6, 4, 9, 4, 1, 2, 13, 2, 7, 4, 15, 24, 3,
+    4, 98, 1, 9, 10, 0, 16, 5
+};
+
+static const int16_t IFC4X3_ADD2_keyword_slots[1640] = {
+    924, 42, 1253, 1235, 514, 258, 899, 587, 1137, 1247, 722, 1140, 206, 791, -1, 875,
+    1088, 881, -1, 146, -1, 448, -1, 994, 1040, -1, -1, 1250, 499, 1200, 461, 152,
+    -1, 188, 76, 246, 653, 1274, -1, 266, 588, 456, 627, 420, 242, 838, 851, 83,
+    677, 268, 909, 311, 232, 965, 202, -1, 535, 650, 1239, 618, 934, 728, 529, 683,
+    580, 148, 1144, 656, 125, 671, -1, 1009, 135, 59, 86, 1148, -1, 1043, -1, 253,
+    -1, 237, 137, 1310, 1178, 1001, -1, 1161, 450, 1064, 810, -1, -1, -1, -1, 254,
+    895, 575, -1, 398, 821, -1, 708, 1300, 639, 571, 277, 795, -1, -1, 257, 128,
+    602, 691, 316, 1133, 1151, -1, -1, -1, 1049, 759, 436, -1, 884, 476, -1, 106,
+    404, -1, 544, 1123, 1120, -1, 869, 44, 18, 908, 226, -1, 831, -1, -1, 487,
+    446, 444, 498, 1115, -1, -1, 534, 1257, 796, 43, 1019, 31, 1187, 304, 667, 870,
+    993, 269, -1, 1217, 454, 720, 362, -1, 1262, 866, 475, 623, 197, 578, 887, 840,
+    1147, 1172, 873, 369, 405, 496, -1, 583, 2, -1, -1, 472, 1296, 704, 904, 550,
+    470, 473, 158, 488, -1, -1, 501, 134, -1, 1248, 290, 491, 260, 914, 805, 429,
+    757, 799, 53, 1087, -1, -1, 995, 1190, -1, 931, 67, 1290, 33, 1146, 672, 384,
+    407, -1, -1, 173, -1, 218, 21, 13, 1097, 80, -1, 1111, 1136, 711, 963, 403,
+    1045, 303, 1201, 1109, 1260, 399, 463, 536, 787, 193, 155, 283, 657, 972, 982, 1029,
+    -1, 882, 749, 482, 7, 308, 734, 849, 1238, 1214, -1, 1026, 714, 1213, 903, 99,
+    1303, 1279, 328, -1, 894, 979, 692, 619, 275, 409, 543, 1165, 883, 116, 1075, 65,
+    1102, 192, 1252, -1, 1095, 970, 1016, 1039, 823, 597, -1, -1, 1277, 777, 438, 809,
+    1301, 1204, 923, 936, 1076, 513, -1, 519, 986, -1, 647, 640, 816, 504, 216, 203,
+    -1, 1286, -1, 1138, 971, 209, 939, 576, -1, 510, 1276, 181, 896, 354, -1, 680,
+    256, 929, 783, 549, 585, 352, 888, 338, 1135, 129, 921, 341, 1233, 141, 533, 75,
+    864, 541, 933, -1, -1, 272, -1, 736, -1, 709, 133, 457, 154, 1265, 336, -1,
+    334, 772, 458, 751, -1, 88, 754, 1171, 163, 274, -1, 577, -1, 1113, -1, 426,
+    997, 1141, 1216, 335, -1, 1117, 847, -1, 786, 854, 175, 634, -1, 1244, 375, 1015,
+    26, 95, 305, 1219, 1112, 434, 82, 813, 1229, 120, 940, -1, 1211, 1122, 212, -1,
+    687, 1124, 165, 1074, 1283, 370, 868, 877, 168, 184, 855, 1062, 561, 1145, -1, 616,
+    1047, 171, 1243, 1035, 773, 620, 371, 379, 700, 60, -1, 85, 69, 466, 537, -1,
+    825, 30, 249, 905, 169, 957, -1, 79, 803, 465, 419, 151, -1, 1294, 94, 1241,
+    1264, 804, 1153, 987, 508, 530, 39, 788, 22, -1, -1, 244, 741, 781, 178, -1,
+    -1, 376, 273, 195, 15, 1002, 778, -1, -1, -1, 516, 1044, -1, 852, 1169, 301,
+    279, 1189, -1, 919, 102, 1173, -1, 58, 1061, -1, 1100, 1267, 288, 563, 122, 278,
+    -1, 705, 259, 110, 1270, 68, 991, 423, -1, 913, 1081, 1167, 745, 988, 1053, 1197,
+    842, 492, -1, 1128, -1, 477, 980, 289, 785, -1, 227, 1306, 1281, 906, 539, 726,
+    104, 1162, 558, -1, 589, 1183, 738, 614, 740, -1, 502, -1, 1245, 780, 950, 591,
+    -1, 636, -1, 177, -1, -1, 263, 812, 1149, 271, 124, 366, -1, 613, -1, 932,
+    167, 835, 52, -1, -1, 609, -1, -1, -1, 592, 917, 610, 701, 494, 992, 1207,
+    659, 669, 460, 690, 144, 845, -1, 24, -1, 1159, 351, -1, 282, -1, 843, 743,
+    71, 12, -1, 912, 962, -1, 323, 6, 789, -1, 1036, 790, -1, 1011, 761, 793,
+    243, 239, -1, 1038, 1285, 729, 794, -1, -1, 1259, 565, 865, 386, 1195, 297, -1,
+    -1, 784, 779, 240, 89, 1143, 724, 552, 315, 330, 815, 87, 130, -1, 862, 229,
+    -1, 648, 631, 747, 935, 143, 150, 1055, 1228, -1, 599, 1182, 28, 374, -1, 528,
+    459, 1094, -1, 765, -1, 769, 1032, 1231, 774, -1, 1168, 830, 92, 1305, 822, 187,
+    449, 760, 1096, 186, 400, 309, 1118, -1, 525, 180, -1, 573, 511, -1, 1210, 1156,
+    676, 57, -1, 1037, 37, 191, 637, -1, 217, 453, 339, 1084, 493, 313, 467, 1299,
+    132, 1166, 800, 721, -1, 40, -1, 142, 674, -1, 481, 182, 829, -1, 1114, 1192,
+    318, -1, 383, -1, 574, -1, -1, 1205, -1, 321, -1, 123, 733, -1, 1077, -1,
+    -1, 622, 646, 342, 1218, 332, 941, -1, 91, 1017, 185, 984, 107, 121, -1, 381,
+    570, -1, -1, 157, 615, 633, -1, 996, 681, 727, 355, 1060, 918, -1, -1, 331,
+    -1, 586, 764, 818, 464, 1121, -1, 432, 770, 11, 756, 742, -1, 27, -1, 1258,
+    937, 230, 964, -1, 415, 696, 897, 675, -1, 600, -1, 248, 697, 698, 113, 431,
+    36, 644, 969, 922, 621, 413, 874, 238, 617, 1086, 119, 373, 1065, 1129, 505, -1,
+    1289, 768, 392, 224, 1070, 1058, 1073, 447, 928, 892, 1054, 1078, 706, -1, 78, -1,
+    -1, 811, -1, 219, -1, 1083, 841, 990, -1, -1, 802, 673, 211, 97, 566, 210,
+    38, -1, 1131, 1272, 949, -1, 1302, -1, -1, 1225, -1, 172, 1057, 973, 967, -1,
+    946, 1056, 145, 998, 1242, 54, 1297, 872, 538, 5, 625, 1202, 712, 264, -1, 112,
+    649, 517, -1, 1028, 389, -1, 876, -1, 382, 1092, 507, 1155, 824, 81, -1, -1,
+    138, 1025, 926, 1157, 414, 832, 607, 953, -1, 1014, 302, 762, 606, 641, 1191, 497,
+    -1, 679, 252, 643, 312, 480, 159, 367, -1, -1, 45, 1004, 1142, 1175, 348, 959,
+    162, 1041, 408, -1, 8, 388, 1255, 236, 131, 518, 1220, 719, 848, -1, -1, -1,
+    1005, 213, -1, 1023, 730, 349, 685, 55, 1263, -1, 1188, 952, 1012, 1050, 594, 1093,
+    1199, 819, -1, 551, 1090, 920, -1, 1021, 1234, -1, 1280, 911, 247, 603, 915, -1,
+    333, 1022, 140, 412, -1, 422, 62, -1, 1108, 638, 90, 660, 1101, 285, 1079, -1,
+    978, 827, 455, -1, 707, 898, 930, 902, -1, 300, 635, 520, 1268, 296, -1, 891,
+    837, 670, -1, 1072, 771, 889, 951, 569, 954, 47, -1, 1067, 139, 325, 547, 61,
+    292, -1, 329, 340, 174, 46, 753, 347, 73, 1309, -1, 149, -1, 893, 64, 878,
+    251, 17, 938, -1, 471, 1287, 807, -1, 629, 117, 593, 114, 430, 396, 556, 100,
+    -1, 1185, -1, 863, -1, 418, 103, 343, 337, 630, 1046, 63, 776, 469, -1, 190,
+    718, 717, -1, 1230, 136, 590, 1030, -1, 968, 1223, -1, -1, 74, 1158, 503, -1,
+    985, 560, 885, 96, -1, -1, 545, 451, 1024, 1116, 93, 562, 523, 378, 948, 890,
+    320, 1186, 16, 579, 880, 385, 605, -1, 748, 694, 51, 548, 468, 1269, -1, 1107,
+    -1, 72, 1284, 1033, 836, 1098, 1288, 1069, 215, 205, -1, 198, 1282, 1020, -1, 611,
+    976, -1, 1010, -1, 557, -1, 435, 595, 160, 200, -1, 433, 546, 294, 1222, 291,
+    572, 801, 1127, -1, 1177, -1, 1080, 183, 326, 1251, 445, 1091, 568, -1, -1, 428,
+    1292, 357, 658, 1261, 652, -1, 1198, 358, 755, 478, -1, 981, 958, 1293, 642, 506,
+    319, 306, 427, -1, 221, -1, -1, 500, 84, 1240, 417, 284, -1, 108, 255, 910,
+    1003, 1082, 1184, 3, 1068, 710, 612, 164, 49, 608, -1, 1000, -1, 945, -1, 1048,
+    655, -1, -1, 654, 424, 688, 581, -1, 360, -1, 1104, 703, 359, 1208, 540, 245,
+    814, -1, 758, 737, 327, 101, 977, 439, -1, 1059, -1, 363, 32, 559, 555, 391,
+    766, 663, 713, 262, -1, -1, 798, -1, -1, 390, -1, 276, 1179, 225, -1, 41,
+    109, -1, 856, -1, 317, 782, -1, 725, 668, 886, -1, 846, 411, 584, 1139, 527,
+    147, 56, 731, -1, 735, 942, -1, 127, -1, 1181, 421, 752, 1256, 1027, 1042, 567,
+    542, 265, 1103, 879, 270, 955, 161, 820, 9, 1105, 716, 999, -1, 678, -1, 1150,
+    176, 695, 515, -1, 344, 1052, 490, 380, 486, 324, 956, 1236, 346, 598, 365, 1311,
+    601, 425, 368, 554, -1, 744, 394, 484, 1006, 947, 628, 440, 682, 281, 907, 553,
+    -1, 228, 1110, -1, 1051, 307, -1, 1031, 750, -1, 189, 665, 702, 286, -1, 322,
+    -1, 664, 1298, -1, -1, 522, 105, -1, 1163, -1, 261, 797, -1, -1, 437, 1034,
+    298, 406, 0, 767, -1, 350, 975, 1174, 746, 153, 495, 235, 900, 1224, 364, 1203,
+    361, -1, 1106, 1119, 564, 1130, 808, 1215, 1291, 156, 860, -1, 393, 489, 1271, -1,
+    857, -1, -1, 974, 14, 126, 1254, -1, 1152, 817, 1164, 479, -1, -1, -1, 1196,
+    -1, 1013, 118, -1, 50, -1, 345, 943, 295, 853, -1, 861, 901, 1221, 416, 442,
+    1132, 310, 23, 582, -1, 651, 632, 1193, 1089, 25, 443, -1, 732, 867, -1, 512,
+    19, 111, 401, 1085, 1246, 287, 645, 66, -1, 983, 1008, -1, 531, 1154, 521, 684,
+    -1, 596, 1071, 166, -1, 532, 626, 474, 29, -1, -1, 207, 1170, 1307, -1, 916,
+    223, 397, 826, 1227, 387, -1, 1237, 1275, 1134, 199, 850, 833, 402, 839, -1, 98,
+    208, 220, 666, 834, 395, -1, 693, 483, 1226, 792, -1, 1278, 194, 871, -1, 214,
+    715, 1066, 1266, 1209, 441, -1, 699, 1212, -1, 1295, 462, -1, 353, 1273, 201, 372,
+    4, -1, -1, 1304, -1, 1194, -1, 661, 1176, 689, 1, 989, -1, -1, 806, 1126,
+    35, 763, 775, 196, 204, 524, 250, 1099, 858, 604, 77, 115, 1206, 526, 222, 662,
+    293, 859, -1, 944, 377, 299, 10, 961, -1, 356, 624, 739, -1, 20, 234, -1,
+    -1, 686, -1, 280, -1, 233, 267, 1063, 509, 966, 410, 1018, -1, 925, 452, 241,
+    231, 170, 70, 34, 1125, 1308, 828, 1180, 960, 485, 48, 1007, 723, -1, 1232, 927,
+    844, -1, 1160, -1, 179, 1249, -1, 314
+};
+
+static const keyword_table IFC4X3_ADD2_keywords = { IFC4X3_ADD2_keyword_displacements, 328, IFC4X3_ADD2_keyword_slots, 1640 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -17059,7 +17191,7 @@ IfcParse::schema_definition* IFC4X3_ADD2_populate_schema() {
     declarations.push_back(IFC4X3_ADD2_IfcWorkTime_type);
     declarations.push_back(IFC4X3_ADD2_IfcZone_type);
     declarations.push_back(IFC4X3_ADD2_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X3_ADD2", declarations, new IFC4X3_ADD2_instance_factory());
+    return new schema_definition("IFC4X3_ADD2", declarations, new IFC4X3_ADD2_instance_factory(), &IFC4X3_ADD2_keywords);
 }
 
 
@@ -2607,6 +2607,138 @@ class IFC4X3_RC1_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X3_RC1_keyword_displacements[329] = {
+    10, 9, 3, 8, 22, 7, 4, 23, 68, 12, 29, 11, 20, 5, 6, 30,
+    1, 15, 1, 136, 24, 43, 0, 4, 79, 3, 6, 13, 37, 24, 8, 1,
+    9, 6, 11, 33, 0, 31, 2, 4, 37, 50, 78, 3, 4, 3, 10, 5,
+    71, 2, 1, 15, 2, 17, 7, 2, 54, 4, 16, 1, 4, 14, 7, 2,
+    3, 2, 4, 8, 8, 32, 42, 1, 19, 3, 15, 33, 42, 27, 10, 1,
+    92, 18, 3, 4, 10, 2, 1, 1, 10, 42, 2, 5, 4, 10, 100, 1,
+    5, 1, 53, 4, 4, 1, 1, 2, 8, 21, 22, 29, 26, 29, 5, 9,
+    4, 1, 10, 9, 10, 3, 3, 6, 3, 35, 5, 2, 2, 4, 41, 1,
+    73, 3, 6, 9, 1, 41, 8, 6, 55, 27, 6, 2, 2, 1, 5, 34,
+    1, 11, 3, 1, 10, 8, 6, 5, 4, 7, 2, 15, 41, 0, 38, 23,
+    3, 3, 4, 20, 2, 13, 8, 5, 1, 8, 11, 10, 6, 47, 17, 11,
+    29, 16, 6, 1, 51, 9, 3, 21, 9, 24, 40, 10, 1, 28, 1, 62,
+    1, 22, 3, 2, 13, 1, 1, 16, 1, 28, 20, 5, 11, 9, 2, 1,
+    1, 2, 16, 25, 1, 12, 12, 1, 2, 7, 1, 4, 1, 3, 7, 201,
+    4, 1, 3, 12, 1, 3, 11, 1, 6, 3, 2, 11, 10, 2, 3, 7,
+    6, 1, 1, 1, 4, 1, 9, 30, 10, 32, 4, 4, 63, 1, 4, 60,
+    1, 20, 4, 56, 40, 5, 2, 5, 20, 11, 2, 85, 22, 24, 12, 1,
+    26, 2, 6, 41, 5, 5, 1, 10, 16, 41, 41, 30, 20, 15, 61, 3,
+    50, 3, 23, 22, 1, 78, 13, 1, 1, 2, 8, 20, 2, 8, 16, 1,
+    7, 15, 2, 9, 8, 28, 35, 30, 21, 1, 44, 20, 3, 9, 8, 42,
+    11, 4, 19, 3, 7, 79, 4, 60, 1
+};
+
+static const int16_t IFC4X3_RC1_keyword_slots[1646] = {
+    1110, 907, 343, 973, 1254, -1, 781, 211, 1040, 1185, -1, 1302, 917, -1, 979, 589,
+    572, 1222, 285, -1, 577, 867, 302, -1, 112, 677, -1, 1290, 779, 151, 43, 654,
+    946, -1, -1, 1165, 444, 148, 673, 1092, 1245, 18, -1, 1079, 807, 1047, 1061, 185,
+    452, 855, 435, 81, 908, 520, 168, 153, 225, -1, 80, 523, -1, 392, 508, 415,
+    1223, 616, 1097, 216, 420, 680, 116, -1, 1256, 900, -1, -1, -1, 853, 714, 548,
+    -1, -1, 947, 1236, 183, 582, 824, 510, 948, 1059, 1029, -1, 283, 515, 769, 1211,
+    1285, 459, -1, 569, -1, 294, 1129, 554, -1, 693, -1, 679, 1182, 965, 368, 544,
+    292, 854, 879, 1085, -1, -1, 24, 141, 724, 494, 1010, 219, 157, 407, 429, 233,
+    547, 223, 482, 277, 671, 702, 518, 669, 1287, -1, 492, 142, 525, 865, 1156, -1,
+    977, -1, -1, 1004, -1, -1, 1003, 773, 902, 1263, 462, 1056, 985, 124, 703, 195,
+    -1, 1228, 210, 762, 905, 840, -1, 1111, 1025, 541, 193, 858, 512, -1, 307, 740,
+    344, -1, 706, 921, 455, 234, 8, 846, 92, 154, 1137, 896, -1, 1154, 1164, -1,
+    -1, -1, 1052, 1149, 179, 804, 825, 593, 242, -1, 476, 413, -1, 472, 1168, 574,
+    1038, 1094, 255, 16, 1220, -1, 815, 1231, 608, 371, 899, 102, 478, 555, -1, 1088,
+    215, -1, 155, 625, 837, 95, 774, 1268, 780, 1170, 1180, 290, -1, -1, 658, -1,
+    408, -1, 622, 969, 656, -1, -1, -1, 496, -1, 310, 805, 872, 909, 1315, 1191,
+    752, -1, 406, 662, 230, -1, 1265, -1, 11, 607, 627, 499, 733, 1284, 493, 22,
+    560, 4, 140, -1, 52, 1186, 750, 887, 689, 1192, 631, 1082, 25, 261, -1, 813,
+    -1, -1, 941, 1131, 1306, -1, 646, 647, 64, 549, 836, 1242, 381, 1189, -1, 250,
+    473, 832, 475, 934, -1, 1117, -1, -1, 723, 552, -1, 1024, 834, 701, 509, 751,
+    789, 110, 237, 1283, 808, -1, 984, 316, 419, 841, 71, -1, 937, -1, 312, 1057,
+    667, 106, 458, 592, 169, 411, 801, -1, 1291, 699, -1, -1, 721, 353, 878, -1,
+    -1, 890, 136, -1, 1184, 690, 324, -1, 766, 880, -1, -1, -1, 1270, 1214, 120,
+    1310, 1274, 630, 820, -1, 1083, 433, 97, 1206, 744, 412, 26, 111, 410, 1235, 919,
+    -1, -1, 745, 1203, 1207, 224, 506, 1021, 1106, 1212, -1, 675, 175, 787, 1304, 1073,
+    565, 226, -1, 660, 1277, 362, 152, 620, -1, 993, 743, 906, 562, -1, 983, -1,
+    149, 299, 138, 256, 1123, 732, 995, 852, 578, 624, 997, 389, 611, 659, -1, -1,
+    -1, 821, 828, 704, 159, 355, 802, -1, -1, 329, -1, 628, 849, 688, 192, -1,
+    540, 319, -1, 98, 469, 1243, 848, 591, -1, 1101, 342, 403, 857, 54, 333, 421,
+    127, 1070, 244, 1147, 1146, 978, 994, 615, -1, 374, 1171, 613, -1, 318, 1301, 326,
+    1238, -1, 96, 295, 401, 461, 457, 728, 68, 129, -1, 1295, 1167, 1041, -1, 393,
+    3, 1260, -1, 15, -1, 546, 447, 932, -1, 180, -1, -1, -1, 1078, 20, 910,
+    468, 122, 1197, 243, 1144, 79, -1, 914, 926, 90, 650, 1105, 328, -1, -1, 816,
+    1099, 1298, 311, 1193, 10, 1043, -1, 486, 972, 347, 1176, -1, 1141, 1261, 601, -1,
+    940, 1280, 453, 819, -1, -1, 500, 449, 208, 844, 532, 959, 1119, -1, -1, -1,
+    430, 1015, 913, 417, 30, 935, 528, 576, 404, 1150, 1229, 722, 300, -1, 1233, 989,
+    1196, 1026, 395, 73, 1081, 36, 1017, 128, 451, 207, 357, 1062, -1, 1288, 529, 182,
+    28, 253, 1045, 1051, -1, 694, -1, 66, 460, 213, 454, 1068, 38, 968, 1013, 958,
+    -1, 636, 870, 1031, 866, 274, 585, -1, 1155, 1276, 517, 553, 335, 1016, 563, -1,
+    -1, 37, 77, 860, 1163, 1086, -1, 1066, -1, 859, -1, 558, -1, 6, -1, -1,
+    361, -1, 352, 1113, -1, 416, 763, 1022, 45, 1160, -1, 1063, 146, 831, 181, 364,
+    251, 504, 89, 438, 32, 332, 786, 485, 998, -1, 583, 742, 782, 1300, 861, 463,
+    198, -1, 479, 971, 218, 507, -1, -1, 7, -1, 1126, 736, 282, 1124, 765, 497,
+    -1, 862, 222, 448, -1, 1120, -1, 931, 144, 707, 336, 587, 904, 1151, 1198, 923,
+    323, -1, -1, 385, -1, 657, 903, 439, 864, 76, 753, 166, -1, -1, 1076, -1,
+    -1, 535, 488, 955, 939, 402, 996, 634, -1, -1, -1, -1, 564, -1, 1177, 114,
+    725, 266, 1032, 927, -1, -1, 173, 450, 749, 976, 570, 287, 150, 641, 1107, 783,
+    260, -1, -1, 1159, 522, 377, 176, 543, 970, 1039, 19, 203, 466, 1239, 268, 1065,
+    -1, 531, 293, 698, 289, 1103, 165, 1162, 308, 1248, 338, 58, 56, -1, 1158, -1,
+    118, 227, 317, 1034, 220, 649, 1, -1, 1173, 895, -1, 202, 91, 489, 306, 891,
+    247, 1132, 206, 1008, 990, 987, 1216, -1, 803, 298, 432, 747, 561, 605, 716, 291,
+    -1, 117, 1258, 280, -1, 356, 9, 334, -1, -1, 814, 358, 101, 363, 686, 930,
+    663, 521, 1077, 982, 757, 929, 446, 1205, 784, 426, 487, 685, 1279, -1, 924, 1035,
+    -1, -1, 1108, 1199, 771, 121, -1, 1072, 163, 1125, -1, 164, 398, 322, 827, 427,
+    405, -1, -1, 278, 596, -1, 337, 708, 1262, 967, 391, 23, -1, 53, 425, -1,
+    938, 557, 1172, 626, 373, 55, 980, 559, 838, -1, 871, 709, 502, 567, 952, -1,
+    759, 229, 594, 584, 1312, 1005, 843, 712, 812, 47, 612, -1, 1307, 2, 581, 156,
+    1115, -1, 1241, -1, 599, 484, 1054, 963, 1133, 794, 586, 345, 1250, 456, 12, 1152,
+    534, -1, 545, 629, -1, 1267, 597, 132, 911, 644, 1204, -1, -1, 39, 275, 257,
+    892, -1, 876, 27, 379, 1273, 975, -1, 536, 196, 729, -1, -1, 304, 498, 670,
+    798, 1139, 856, 632, 513, 1272, 477, 991, 467, -1, 1297, 107, -1, -1, 951, 125,
+    442, 1135, 100, 1037, -1, 82, 683, 1067, 5, 573, 1046, -1, -1, 1234, 481, 86,
+    -1, 1292, 793, 645, 160, 1175, 788, 348, 652, 1009, -1, 705, 755, 33, 232, -1,
+    681, 46, 267, -1, 949, 443, -1, -1, 258, 1102, -1, 598, 665, 143, 1048, 1127,
+    -1, 1253, 635, 305, 912, 1166, 471, 1209, 850, -1, -1, 217, 1011, -1, 130, -1,
+    776, 248, 346, 1100, 734, -1, 1240, 943, -1, -1, 676, 954, -1, 188, 1289, 731,
+    1282, 933, 796, -1, 1257, -1, 184, 174, 69, -1, 34, 1044, 1259, 711, -1, 321,
+    -1, 42, 1255, 1071, 623, 1112, 375, 606, 957, 1305, 638, 422, 830, -1, 877, -1,
+    -1, 882, 62, -1, 262, 264, 331, -1, 284, 1060, 1080, 386, 1169, -1, 550, 313,
+    945, -1, 1074, 235, 962, 1179, 795, 78, -1, 885, 1314, 1275, 692, -1, 48, 396,
+    197, 684, 239, 240, -1, 1020, 1019, 254, 14, 533, 191, -1, 418, 1023, 1313, -1,
+    167, 105, 214, 1286, 133, 474, -1, 806, 238, 271, 145, -1, 1140, -1, -1, 873,
+    1033, 800, 1210, -1, 527, 966, 171, -1, 1311, 382, 359, 893, 602, -1, 1000, 41,
+    874, 390, 204, -1, 200, 1134, 551, 600, 809, 668, 84, 378, 397, -1, 383, -1,
+    633, 72, 839, -1, 314, 767, 399, -1, 376, 1224, 1157, 279, 1293, 1104, 715, 1114,
+    137, -1, 286, 571, 1014, 436, 682, 483, -1, -1, -1, 1148, 833, 1225, 1096, 29,
+    640, -1, 735, 1252, 0, 437, 51, -1, 1201, 288, 1294, 1226, 158, 1007, -1, 847,
+    236, 269, 575, 610, -1, 953, 568, 922, 761, 1237, 409, 366, 1218, -1, 470, 131,
+    1089, 1308, 503, -1, 1271, 57, 514, 135, 123, 1138, 556, 758, 697, 764, 691, -1,
+    31, -1, -1, 884, 760, 875, 1244, 108, -1, -1, 595, 687, 61, -1, 186, 1098,
+    915, 981, -1, 790, 1028, 918, 617, 99, -1, 241, 1251, -1, 754, -1, 845, 400,
+    -1, 272, 1042, 490, 1084, -1, -1, 501, 778, 194, 730, 387, 505, 986, 115, 537,
+    -1, 103, -1, -1, 739, 350, 201, 651, 325, -1, 1188, 916, 950, 301, 678, 886,
+    956, 898, 1012, 1247, 297, 726, 511, 428, 818, 696, 172, 524, 737, 1181, 339, -1,
+    464, 59, 566, 245, -1, 320, 424, -1, 1069, -1, 1122, 1221, 367, 113, 44, 161,
+    901, 139, 661, 1269, 526, 768, 1136, 655, 888, 104, 797, 746, 1093, 942, -1, 445,
+    -1, 1187, -1, 1145, 614, 1143, 603, 13, 920, -1, 842, 273, -1, 327, 434, 1090,
+    -1, 178, 791, 1217, 60, 1087, 1178, 265, 74, 87, -1, 775, 925, -1, 718, 263,
+    1246, 648, -1, 126, 431, 637, 777, 465, 1299, 360, 1183, 1264, 372, 889, -1, -1,
+    -1, 772, 1208, 199, -1, 756, 259, 21, -1, 1064, 246, 209, -1, 315, 799, 394,
+    -1, 491, 928, 664, 281, 50, 1050, 94, 580, 666, 309, 134, 249, 296, 1215, -1,
+    618, 674, 205, -1, -1, 365, 810, 609, 717, 414, 1091, 960, 1194, 354, 1195, 869,
+    276, 1303, 67, 1058, -1, -1, -1, -1, -1, -1, -1, 642, 231, 881, 252, 770,
+    351, 70, 961, -1, 653, 1232, 738, 147, 119, 542, -1, 177, -1, 883, 330, 1075,
+    -1, 1190, 93, 944, 639, 270, 1121, 1018, -1, 792, 1142, 1118, -1, -1, 590, 388,
+    719, 1266, -1, 109, 1001, -1, 992, 40, 710, 1249, 823, 1006, 588, -1, 936, -1,
+    440, -1, 897, 619, -1, -1, 894, -1, 538, 1036, -1, 748, 1316, -1, -1, 1296,
+    1227, 441, 999, 228, -1, 964, 1174, 727, 1095, 1116, 817, 974, 579, 1027, 835, 349,
+    85, 785, 341, 1219, 1200, 423, 190, 1281, -1, 988, 826, 495, 519, -1, 369, 170,
+    1213, 604, 1161, 88, 480, -1, 35, 822, 380, 1278, 1053, 17, 1230, -1, 539, 187,
+    1202, 49, -1, 672, 65, 75, 221, 1128, 384, 516, -1, 1109, 1153, -1, 713, 370,
+    811, -1, 212, 530, 1049, 868, 1030, 829, 340, 643, 162, 621, 720, -1, 700, 303,
+    -1, 1309, 741, 695, 1055, 1130, 189, 1002, 863, -1, 63, 83, -1, 851
+};
+
+static const keyword_table IFC4X3_RC1_keywords = { IFC4X3_RC1_keyword_displacements, 329, IFC4X3_RC1_keyword_slots, 1646 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -17132,7 +17264,7 @@ IfcParse::schema_definition* IFC4X3_RC1_populate_schema() {
     declarations.push_back(IFC4X3_RC1_IfcWorkTime_type);
     declarations.push_back(IFC4X3_RC1_IfcZone_type);
     declarations.push_back(IFC4X3_RC1_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X3_RC1", declarations, new IFC4X3_RC1_instance_factory());
+    return new schema_definition("IFC4X3_RC1", declarations, new IFC4X3_RC1_instance_factory(), &IFC4X3_RC1_keywords);
 }
 
 
@@ -2626,6 +2626,139 @@ class IFC4X3_RC2_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X3_RC2_keyword_displacements[331] = {
+    20, 32, 2, 62, 45, 56, 14, 7, 7, 0, 1, 38, 20, 34, 5, 8,
+    1, 1, 24, 89, 6, 10, 2, 4, 16, 24, 7, 10, 3, 7, 37, 15,
+    2, 55, 35, 6, 9, 31, 2, 1, 43, 15, 4, 17, 20, 1, 27, 6,
+    10, 9, 10, 31, 13, 30, 10, 3, 2, 6, 1, 10, 7, 3, 93, 40,
+    4, 1, 49, 3, 4, 1, 4, 3, 20, 73, 3, 27, 13, 52, 1, 6,
+    3, 6, 21, 8, 33, 19, 27, 2, 2, 32, 2, 5, 9, 19, 5, 3,
+    14, 21, 10, 10, 26, 15, 1, 71, 1, 5, 1, 5, 2, 14, 8, 9,
+    9, 35, 4, 3, 1, 11, 1, 3, 5, 13, 40, 7, 4, 49, 1, 35,
+    7, 2, 25, 8, 3, 38, 6, 9, 17, 21, 10, 7, 1, 26, 6, 1,
+    10, 7, 25, 19, 47, 50, 4, 2, 10, 10, 18, 6, 27, 16, 17, 31,
+    2, 6, 2, 3, 8, 12, 1, 10, 25, 24, 5, 1, 26, 2, 53, 1,
+    21, 30, 98, 10, 12, 5, 66, 8, 53, 8, 30, 1, 48, 2, 1, 48,
+    2, 40, 3, 1, 17, 2, 2, 53, 48, 3, 2, 9, 1, 1, 2, 1,
+    5, 3, 2, 1, 1, 7, 5, 11, 2, 12, 1, 1, 2, 9, 16, 1,
+    72, 4, 10, 3, 7, 17, 2, 27, 14, 2, 3, 8, 10, 7, 17, 17,
+    8, 4, 30, 12, 124, 1, 46, 57, 10, 2, 1, 11, 4, 1, 31, 3,
+    7, 12, 19, 10, 3, 26, 19, 30, 2, 47, 18, 2, 5, 17, 3, 10,
+    12, 5, 7, 4, 6, 13, 1, 20, 5, 39, 9, 27, 28, 6, 73, 20,
+    7, 19, 25, 16, 13, 89, 1, 3, 9, 15, 1, 16, 0, 15, 9, 9,
+    72, 6, 41, 6, 24, 1, 2, 1, 9, 1, 3, 6, 19, 7, 3, 11,
+    8, 7, 48, 2, 8, 1, 14, 2, 31, 7, 18
+};
+
+static const int16_t IFC4X3_RC2_keyword_slots[1658] = {
+    -1, 724, 416, -1, 932, 814, 759, 1142, 910, 1097, 699, 1245, 1109, -1, 1266, -1,
+    1086, 1233, -1, 1290, 266, 306, 322, 45, -1, 1072, 604, 1240, 432, 1000, 927, 174,
+    1001, 11, 320, 998, 980, 637, 645, 407, 1148, 1175, 24, 771, 879, 372, 1055, -1,
+    28, 578, -1, 1090, 139, 892, 9, 280, 1312, 0, 915, 844, 1289, 1321, -1, 690,
+    1195, 972, 1085, 279, 953, 783, 1117, 600, 977, 1123, 86, 464, -1, 228, 229, 608,
+    80, 969, 861, 917, 329, 856, 705, 1324, 564, -1, -1, 986, -1, 669, 179, 309,
+    293, 1304, 384, 778, 7, -1, 351, 300, 465, 722, 267, 245, 489, 601, 164, 545,
+    162, -1, 215, 1192, 43, 1176, -1, 273, 1002, 492, 875, 1067, 446, 426, 558, 924,
+    808, -1, 1126, 158, 666, 1129, 501, 282, 1004, 527, 907, 725, 308, 1282, 613, 40,
+    1251, 658, -1, 222, 1198, 1160, -1, 763, 1073, 116, -1, -1, 1081, 514, 508, 485,
+    644, 1078, 680, 412, 1326, 730, 244, 575, 1242, -1, -1, -1, 1239, 1322, 520, 143,
+    691, 161, 708, 662, 1026, -1, 458, 694, 584, -1, 1131, -1, 378, -1, 424, 1206,
+    757, 538, 958, -1, 683, 534, 619, -1, 91, 31, 217, 314, 740, 1037, 687, -1,
+    -1, 175, 792, 761, 939, 193, 845, 719, 920, -1, 743, 68, 703, -1, 270, 804,
+    871, -1, -1, 73, 236, 1082, 60, 681, 1181, 1264, 1268, 1217, 52, 328, 684, 123,
+    572, 1074, 157, 1305, 254, -1, 154, 1202, 1094, -1, 541, 904, 1310, 721, 1064, 971,
+    1146, 82, 532, 350, -1, 1246, -1, 955, -1, 477, -1, 542, 1039, 1229, -1, 776,
+    867, 198, -1, 413, 661, -1, 863, 121, 310, 1269, 260, -1, -1, 825, 524, 1224,
+    1234, 291, 185, 196, 10, 1279, 981, 62, -1, 990, -1, 1054, 714, 1135, 53, 766,
+    1267, -1, 1005, 1008, 345, 1079, 371, 824, -1, 78, 881, 271, -1, 726, 356, 942,
+    55, 692, 61, 19, 406, 627, 1029, -1, 946, 1087, -1, 402, 1308, -1, 233, 582,
+    605, 285, 467, 361, 913, 559, -1, 259, -1, 1006, 642, -1, 745, 249, 1317, 802,
+    1252, 517, 71, 935, -1, 1183, 1262, 805, 96, 908, 758, 728, -1, 135, 188, 429,
+    1092, 1243, -1, 1258, 425, 1210, 1112, 1221, -1, 843, 835, 1114, 419, 530, 916, 415,
+    -1, 787, 1257, 749, 1236, 1130, -1, -1, 37, 633, 968, -1, 1260, 454, -1, 14,
+    1043, -1, -1, -1, 253, 199, 903, 985, -1, 1254, 243, 906, 618, 1170, 679, 1053,
+    819, 612, 833, 297, 167, -1, 1023, 862, -1, 617, -1, 810, 994, 1102, 126, -1,
+    323, 212, 1278, 128, -1, -1, -1, 1227, 1159, -1, -1, 568, 325, 706, 340, -1,
+    503, 1249, 1300, 197, 76, 506, 192, -1, 487, 554, 409, 1044, -1, 775, 803, 1273,
+    -1, -1, 750, 339, -1, 294, 311, 265, -1, 451, -1, 70, -1, -1, -1, 710,
+    653, 224, -1, 110, -1, 899, 973, 596, 218, 268, -1, 1241, 493, 770, 235, 1320,
+    360, 1325, 433, 342, 873, 535, 1215, 455, 1201, 1283, 660, 1164, 39, 1220, 878, 354,
+    377, 57, 94, -1, -1, 846, 767, 813, 295, 97, 741, 1134, 1041, -1, -1, 1098,
+    974, -1, -1, 1013, 1104, 131, 576, 537, 401, 723, 257, 466, 1196, 1139, 877, 204,
+    655, 47, 482, 1232, 292, 850, 393, 1309, 1145, 226, -1, 574, -1, 674, 1230, 536,
+    1209, -1, -1, 414, 1315, 341, 463, 362, 142, 383, 579, 1077, 1187, 1265, 976, 735,
+    646, 363, 296, -1, -1, 756, 115, -1, -1, -1, -1, 737, 1280, 1162, 1012, 1007,
+    232, 129, 1103, 676, 1110, -1, 1216, -1, 602, 860, 88, 366, -1, -1, 815, -1,
+    -1, -1, 528, 1186, 312, 1084, 1166, -1, 438, 106, 569, 1051, -1, 594, 405, 539,
+    112, 1038, 276, 1277, 457, 369, 72, 156, 1127, 956, -1, 635, 902, 1319, 370, 177,
+    -1, 114, -1, 1152, 20, -1, -1, -1, 440, 359, 298, 1299, 144, 688, 439, -1,
+    832, 657, -1, -1, 623, 1302, 1140, -1, -1, -1, 853, 1003, 667, 59, 897, 764,
+    -1, 768, 936, 868, -1, 38, 1292, 839, -1, 84, -1, 760, 476, 872, 989, 303,
+    988, 277, -1, -1, 1017, 937, 1293, 685, -1, -1, 595, 880, 551, 746, -1, 1151,
+    961, -1, 1071, 109, 1294, 1261, 509, 240, 149, 278, 286, 8, 1247, 959, 357, 794,
+    100, 995, 970, -1, 700, -1, 336, 29, 786, 170, 1231, 590, 141, -1, -1, 702,
+    -1, 1237, 1235, 641, 63, 1050, -1, 262, 1150, 348, -1, -1, 583, 399, 513, 335,
+    -1, 689, 256, 830, 848, 220, 403, -1, 447, 812, 772, 864, 263, 823, -1, 120,
+    -1, 809, 461, 797, 364, 1124, 304, 854, 1107, 404, 552, 870, -1, -1, 991, 1108,
+    227, 169, 264, 450, -1, 1285, -1, 523, -1, 996, 1088, -1, 459, 571, 1049, 626,
+    496, -1, 470, 221, 965, 171, 1141, -1, 1143, -1, 918, 518, 951, 529, 1019, 888,
+    140, 201, 673, 1100, -1, 427, 739, 448, -1, 857, 1248, 194, 765, 344, 56, 1263,
+    909, -1, 499, 206, 180, 886, 887, 99, 90, 1015, 624, 17, 269, 580, 967, -1,
+    148, 1288, -1, 230, 26, 365, -1, -1, 315, -1, 213, 838, 225, 431, -1, 32,
+    488, 1018, -1, 947, 975, 205, 711, 701, 25, -1, 475, 281, -1, -1, 704, 1205,
+    1178, 926, 176, -1, 828, 358, 713, 817, 656, 333, 1121, -1, 23, -1, -1, 400,
+    -1, 219, 483, 1197, 581, 104, 290, 1323, 349, 1208, 592, 1125, 92, -1, 744, 1033,
+    195, -1, -1, 798, 1244, 242, -1, -1, -1, 931, 484, -1, 1189, -1, 391, -1,
+    698, -1, 153, 747, 113, 842, 117, 1035, -1, 1173, 145, 1213, 119, 392, 1295, -1,
+    -1, 1014, 1184, 74, -1, 203, 283, -1, 332, 95, -1, 1116, 395, 610, 566, -1,
+    241, 172, 715, 210, 811, -1, 481, 234, -1, 522, -1, 248, 445, 647, 442, -1,
+    -1, 173, 1250, 191, 987, 1024, 396, -1, 152, 5, 1179, -1, 430, -1, 186, 1119,
+    1185, -1, 648, 398, 93, 940, 1158, 622, 573, -1, 561, 1093, 928, 353, -1, 984,
+    1156, 894, 966, 651, 373, -1, 650, 1048, 1313, 54, 15, 387, 614, -1, 421, 841,
+    516, 1034, 160, 736, 780, 437, -1, 326, 549, 784, 216, 318, 1270, -1, -1, 1284,
+    -1, 754, 417, -1, 35, 1099, 1211, 1226, 105, 670, 858, 777, 48, 548, 675, 755,
+    313, -1, 599, 1036, 6, 66, 1306, 18, 591, 982, 124, 717, 388, 44, 1165, 643,
+    41, -1, 302, 238, -1, 85, 992, -1, 1120, 1219, 274, 151, 207, 1191, 1167, 27,
+    441, -1, 1076, 444, 829, -1, 1274, 394, 893, 686, 469, -1, 598, 1137, 184, 696,
+    847, 709, 389, 782, 1301, 239, -1, 631, 1111, 1066, 563, -1, 1228, -1, 762, 851,
+    422, 250, 343, 252, 943, 1065, 178, 822, 818, 1303, 165, 774, 682, 779, -1, -1,
+    -1, -1, 1155, -1, -1, 330, 587, 101, -1, 1060, 456, -1, 1297, -1, 1020, 597,
+    231, 352, 547, 1057, 609, 555, 781, 876, 1200, 190, 949, 589, 533, 983, 1316, 504,
+    525, 1030, 963, 327, 1207, 1214, 209, 885, 511, 652, 1106, 1296, 498, 816, 1069, 408,
+    734, 1122, -1, -1, 1174, 630, 1089, 659, 889, 1025, 317, 632, 800, -1, -1, 1080,
+    731, 376, 69, 954, -1, -1, -1, 284, 944, -1, 1042, 34, -1, 255, 1063, 202,
+    -1, 397, -1, 502, 1149, 1075, 560, 621, -1, 159, 316, 137, 380, 1058, 46, 258,
+    -1, -1, 289, 166, 1059, -1, 507, 3, -1, 4, 801, -1, 543, 882, 999, 654,
+    -1, 562, 1128, -1, 795, 1011, 616, 1070, 997, 1027, 586, 505, -1, 859, 945, -1,
+    374, 827, 1095, 98, 826, 1286, 707, 453, 790, 512, 796, 182, 435, 663, 468, 133,
+    1194, 1147, 1199, 443, -1, 132, 799, 922, 553, 83, 1161, 102, 1132, 855, 930, 334,
+    -1, 1223, 895, 150, 1133, 716, 1177, 418, 693, 905, -1, 849, 896, 678, 272, 738,
+    1314, 346, 950, 486, 1113, 125, 386, 1068, 1083, 51, 1204, 331, 837, 625, 883, -1,
+    -1, 200, 1028, 1172, 531, 607, -1, -1, -1, 65, 993, -1, 490, 544, 1096, 697,
+    -1, 1144, 1190, 452, 751, -1, -1, 471, 556, 1154, 168, -1, 30, 1138, 211, 948,
+    1212, 305, 540, -1, 1101, -1, 769, 411, 497, 410, 1276, -1, -1, 960, 118, 919,
+    -1, -1, 785, 933, 664, 1188, 515, 1222, -1, 111, 107, 1031, 791, 319, 77, 321,
+    978, 852, -1, 495, 275, 567, 1253, 941, 301, 526, -1, 866, -1, 890, 1203, -1,
+    -1, 979, -1, 550, 1040, 247, 718, 1091, 639, -1, 146, 820, 381, 789, 1238, 299,
+    962, -1, -1, 81, 806, 1062, 1115, 155, 127, 712, 347, -1, 108, 671, -1, 934,
+    1032, 375, -1, 1056, -1, 58, 22, 1182, 337, 67, 807, -1, 629, -1, 557, 603,
+    521, 379, 460, 261, 964, 668, 1256, -1, 1272, 1255, 214, 13, 831, 288, 42, 1275,
+    -1, 307, 64, -1, 836, 89, -1, 21, 1045, 130, 611, 773, 921, 1046, 79, 628,
+    869, 474, 479, 122, 1169, 1, 385, -1, 912, 720, 181, 519, 620, -1, -1, 1157,
+    50, 251, 189, -1, 729, 428, 1271, 788, 434, 390, -1, 355, 449, 138, 677, -1,
+    208, 606, 615, 1291, 382, 33, 491, 1136, 1118, -1, 898, 733, 368, -1, 16, -1,
+    -1, 1047, 1009, 187, 821, 634, 1052, 473, 570, 748, 1010, 891, 87, -1, 183, -1,
+    577, 324, 494, -1, 287, -1, 840, 636, 672, 75, 638, 901, 423, -1, 957, 1180,
+    588, 510, 1163, -1, 923, 929, 12, 593, 665, -1, 695, 565, -1, 1218, 1311, -1,
+    900, 472, 163, 865, 793, -1, 136, 753, 834, 1105, -1, 420, 752, 500, 925, 103,
+    911, 640, 237, 1061, 1307, 732, 246, 367, -1, -1, 952, 727, -1, 884, 585, 914,
+    -1, 462, 223, -1, 1259, 1168, -1, 1153, 1281, -1, 480, 134, 478, -1, 938, 1016,
+    436, 1022, 1225, 338, 147, 1298, -1, 874, 546, 2, 1193, 1171, 36, 49, 742, -1,
+    -1, 1318, -1, 649, 1287, -1, -1, -1, 1021, -1
+};
+
+static const keyword_table IFC4X3_RC2_keywords = { IFC4X3_RC2_keyword_displacements, 331, IFC4X3_RC2_keyword_slots, 1658 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -17234,7 +17367,7 @@ IfcParse::schema_definition* IFC4X3_RC2_populate_schema() {
     declarations.push_back(IFC4X3_RC2_IfcWorkTime_type);
     declarations.push_back(IFC4X3_RC2_IfcZone_type);
     declarations.push_back(IFC4X3_RC2_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X3_RC2", declarations, new IFC4X3_RC2_instance_factory());
+    return new schema_definition("IFC4X3_RC2", declarations, new IFC4X3_RC2_instance_factory(), &IFC4X3_RC2_keywords);
 }
 
 
@@ -2609,6 +2609,138 @@ class IFC4X3_RC3_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X3_RC3_keyword_displacements[329] = {
+    11, 32, 2, 2, 1, 5, 4, 1, 29, 10, 15, 2, 3, 1, 154, 5,
+    1, 39, 6, 34, 33, 35, 0, 7, 3, 3, 6, 13, 7, 5, 5, 1,
+    21, 5, 50, 2, 0, 32, 2, 6, 2, 75, 41, 1, 32, 3, 51, 4,
+    41, 6, 1, 11, 8, 45, 5, 2, 15, 4, 29, 1, 4, 20, 1, 3,
+    8, 2, 7, 7, 8, 2, 5, 2, 8, 8, 17, 20, 85, 2, 4, 6,
+    11, 3, 43, 4, 10, 11, 1, 1, 24, 19, 2, 1, 5, 11, 16, 12,
+    2, 1, 4, 10, 25, 1, 1, 3, 9, 15, 13, 22, 20, 2, 0, 103,
+    29, 3, 5, 29, 23, 3, 1, 3, 3, 13, 19, 32, 23, 13, 139, 3,
+    16, 3, 13, 6, 1, 16, 14, 5, 5, 9, 3, 12, 4, 1, 5, 55,
+    16, 2, 2, 1, 8, 2, 13, 130, 2, 1, 2, 30, 3, 2, 1, 7,
+    2, 1, 4, 3, 2, 7, 8, 5, 1, 4, 53, 20, 15, 15, 3, 49,
+    3, 51, 12, 3, 43, 6, 15, 21, 14, 6, 77, 7, 1, 8, 8, 41,
+    2, 78, 57, 7, 76, 1, 3, 16, 2, 20, 7, 3, 30, 1, 2, 1,
+    1, 2, 19, 49, 3, 34, 7, 1, 2, 13, 5, 4, 1, 2, 15, 12,
+    11, 1, 7, 12, 23, 9, 15, 1, 12, 27, 20, 13, 1, 2, 31, 27,
+    17, 1, 58, 5, 6, 11, 26, 14, 19, 2, 22, 36, 2, 40, 7, 16,
+    1, 5, 4, 8, 14, 9, 2, 3, 3, 3, 1, 86, 1, 39, 39, 4,
+    26, 5, 5, 57, 3, 20, 1, 2, 72, 9, 5, 8, 112, 3, 57, 3,
+    1, 1, 2, 22, 52, 3, 19, 1, 32, 3, 1, 7, 1, 71, 45, 33,
+    3, 18, 2, 66, 42, 38, 20, 13, 18, 1, 21, 3, 4, 5, 8, 4,
+    11, 10, 23, 17, 7, 18, 3, 78, 1
+};
+
+static const int16_t IFC4X3_RC3_keyword_slots[1646] = {
+    1111, 1224, 181, 41, 1253, 623, -1, 1282, 777, 112, -1, 1302, 657, 498, 1, -1,
+    1296, 1223, 655, 1185, 576, 917, 5, 1187, 387, 364, -1, -1, -1, 1035, 647, 649,
+    618, 628, -1, 1239, 1313, 175, 668, 1093, 1244, 18, 370, 1080, 304, 365, 1183, -1,
+    702, 447, 433, 78, 903, 559, -1, 149, 942, 621, 1117, 1014, -1, 390, -1, 413,
+    500, -1, 1098, 212, 241, 978, 977, -1, 80, -1, -1, -1, 292, 90, -1, 674,
+    391, 956, 409, 256, 179, 581, 720, 508, -1, 1059, 1212, 1232, 529, 1041, 763, -1,
+    -1, 718, 793, 439, 1096, -1, 1129, 986, -1, 688, 1199, 634, 875, 960, -1, 543,
+    10, 1149, -1, -1, 95, -1, 24, 519, 1249, 492, 696, -1, 741, -1, -1, 229,
+    546, -1, 1145, 274, 905, 766, -1, 831, 269, 489, 196, 138, 523, 638, 1156, -1,
+    972, -1, 1011, 1003, -1, 847, -1, 150, -1, 1262, 217, -1, 981, 1015, 1220, 743,
+    840, 707, 206, 760, 751, 834, 976, 1112, 1270, 540, 189, 386, 510, -1, 795, 257,
+    -1, 877, 358, 1235, 453, -1, 8, -1, -1, 1277, 448, -1, 25, 21, 233, 12,
+    -1, 742, 1052, 118, 1139, 360, 819, 1204, 732, 131, 474, 113, -1, -1, 415, 383,
+    1038, 1095, 930, 16, 830, 869, 454, -1, -1, 369, -1, 105, 476, 929, -1, 1089,
+    211, 40, 106, 620, 37, 605, 768, 1267, 434, -1, 1180, 1236, 898, -1, 1292, 640,
+    1138, -1, 617, 964, -1, 470, -1, 123, -1, -1, 54, 1085, 866, 1002, 801, -1,
+    424, 356, 310, 359, 226, 666, 1264, -1, 384, -1, 622, 1077, 803, 927, -1, 22,
+    268, 4, 136, 1160, 76, 403, 446, 882, 684, 1192, -1, 465, -1, -1, 94, 807,
+    291, -1, -1, 1131, -1, 767, 331, 878, 61, -1, -1, 1073, 865, 1189, 1279, 432,
+    471, 996, 473, 552, -1, 1118, 812, 392, 1222, 864, -1, 1023, 837, 985, 1064, 494,
+    786, 135, 98, 1283, 457, 937, 263, 654, 341, -1, 427, 950, 932, 754, 632, 1057,
+    515, 103, 456, 1245, 855, 771, -1, -1, 501, 694, 469, 884, 715, 1086, 873, -1,
+    997, 885, -1, -1, 1184, -1, 480, 691, 173, -1, -1, 542, 281, 1269, -1, 116,
+    101, 1103, 625, 1227, 148, 1084, 1179, 954, 361, 967, -1, 271, 303, 979, 739, 1175,
+    706, 753, 1290, 202, 1207, 888, 249, 1020, 526, -1, 790, 670, 170, 344, 1304, 1090,
+    564, 990, 648, -1, -1, 785, 1287, 1251, 727, 608, -1, 901, 561, -1, 755, -1,
+    -1, 100, -1, -1, 30, 1233, 1169, -1, 452, 619, 81, 904, 1022, 484, -1, -1,
+    -1, 93, 630, 222, 155, 353, 798, 248, 1214, 327, 246, 951, 1257, 683, 868, -1,
+    553, 87, 1043, 328, 908, 520, 345, -1, -1, 1102, -1, 401, 593, -1, 987, 147,
+    842, 1071, 240, 641, 475, -1, 32, 482, 639, 936, 650, 611, 802, 316, 1301, 264,
+    -1, 531, 551, 293, 399, 612, 455, 192, 134, 1188, -1, 398, 1275, 916, 108, 1008,
+    340, 372, -1, 15, 722, -1, 445, 762, 1191, 176, -1, -1, 144, 1126, 733, -1,
+    1061, 388, 1121, 533, -1, -1, 1230, 735, 729, -1, 84, 313, -1, 352, 1137, 810,
+    1100, 334, -1, 1213, -1, 46, 354, -1, 765, 1198, 1176, -1, 752, 1211, 288, 512,
+    555, 1280, 451, -1, -1, 1083, 697, -1, 547, 838, 300, 726, 1091, -1, 52, 881,
+    1151, -1, -1, 880, 1094, 490, 1031, -1, 778, 1150, 1228, 1203, 298, -1, 408, 250,
+    1196, 945, 1299, -1, 36, 854, -1, 124, -1, 1101, 355, 1062, -1, 261, 1141, 1265,
+    467, -1, 1045, 544, -1, -1, 111, 63, 458, -1, -1, -1, 934, 928, 1012, -1,
+    -1, 185, -1, -1, -1, 606, -1, 404, 1030, 35, 110, -1, 140, 794, 450, -1,
+    1140, -1, 1068, 491, -1, 1087, 756, -1, 184, 853, 235, -1, -1, 6, -1, 947,
+    940, 912, 461, 1114, 580, 862, 757, -1, 871, 504, 70, 1063, -1, 11, 177, 362,
+    658, 502, 86, 436, 965, 330, 782, -1, -1, 1013, 1097, 736, 503, 1300, 1297, -1,
+    272, 974, 379, 307, 393, 933, 1167, 1049, 1123, 627, 1172, 48, 280, 438, -1, 541,
+    -1, 712, 1056, -1, 1164, 633, -1, 713, 663, 788, 509, 586, 687, -1, 816, 1295,
+    1106, 737, 60, 744, 89, 406, 145, 437, 516, 891, 747, 162, 963, 151, 444, 852,
+    104, 568, 486, -1, 1259, 463, 121, -1, -1, 44, -1, 1130, 913, 82, 1177, 975,
+    1298, 867, 746, 1250, 573, 642, 673, 719, -1, 562, 569, 843, -1, -1, 1108, 635,
+    1306, 1273, 225, 1159, -1, 375, 171, 776, 603, -1, 19, -1, -1, -1, 265, 1065,
+    906, 530, -1, 1082, -1, 102, 1173, -1, 1255, 74, 714, 55, 53, -1, 1000, 481,
+    114, 528, -1, 680, 17, 644, 301, -1, 1206, 890, 1237, 198, 88, 487, 521, -1,
+    698, 1132, 460, 1007, -1, 332, 1217, 1288, -1, 296, 991, 69, 560, 604, -1, 289,
+    804, -1, -1, 685, 1268, 679, 9, 472, 995, -1, -1, 646, -1, 876, -1, 1307,
+    770, 1170, -1, 97, -1, 924, -1, 342, 306, 1153, 886, -1, 731, -1, 919, 887,
+    -1, 31, 483, 1166, -1, 117, 848, 1092, 740, 651, 1034, 678, 396, 199, 821, -1,
+    682, 994, 1134, 275, 595, -1, 870, 827, 1261, 425, 1136, 153, 64, 50, 587, -1,
+    214, 243, 578, 1246, 371, 66, 721, 558, 49, 889, 572, -1, -1, 874, 166, 91,
+    -1, 1205, -1, -1, 1312, 574, 197, 1315, 806, 554, 610, 186, -1, 478, 223, 152,
+    -1, 262, 1240, 823, 598, 167, 194, 42, 497, 285, 239, -1, -1, 191, 925, 1152,
+    338, 219, 279, 773, 615, 1040, -1, 128, 973, 20, -1, 745, -1, 899, 909, 961,
+    589, 1182, 1009, 159, -1, 1272, -1, 1284, 535, 941, 824, 895, 75, 302, 496, 665,
+    624, 787, 273, 939, 643, 1271, -1, 923, 421, 230, 1019, 282, 34, 294, 7, 914,
+    440, -1, 1024, -1, -1, 79, 626, 1278, -1, 329, 1046, -1, 689, 828, 224, 596,
+    377, -1, 195, -1, 926, -1, 1165, 346, 592, 267, 841, 1276, 749, -1, 228, -1,
+    506, 971, 39, 659, 944, 441, 1029, 1142, 255, 247, 252, 597, 781, 26, -1, 1127,
+    -1, 1252, 710, 536, 1104, -1, 653, 1210, 844, -1, 204, 213, 1010, 1308, 607, 772,
+    -1, 244, 594, 107, -1, 549, 1005, 1133, -1, 1120, 1248, 949, -1, 525, 534, 724,
+    1241, 132, 1032, -1, 779, 1200, 468, 169, 962, 65, 299, 809, 1258, 705, 700, 319,
+    160, 599, 1254, 1072, 518, 1113, 373, 326, 681, 563, 14, 420, -1, 238, -1, 675,
+    857, 394, 58, 1042, 259, 1171, 1048, 575, -1, 59, 1054, 850, 1116, -1, 382, -1,
+    1186, 1025, 357, 231, 431, 1163, 791, -1, 662, 163, -1, 832, 57, 178, -1, 156,
+    1293, 1067, 524, 236, -1, -1, 1018, 1158, -1, 532, 187, 669, 416, 305, 953, 704,
+    548, 813, 210, 1286, 129, 845, -1, 761, 234, -1, -1, 1274, 1026, -1, 1066, 1294,
+    545, 577, -1, 320, -1, -1, 1218, -1, 1311, 380, 464, 989, -1, 1060, 397, 83,
+    -1, 142, 200, 716, 849, 583, 146, 792, 1281, -1, 822, 28, 395, 314, 590, 998,
+    158, -1, 980, -1, 479, 814, 278, 493, 374, 389, 120, 276, 402, 1105, 709, 1115,
+    897, 126, 284, 570, 851, 922, 677, 1242, 717, 955, 92, 1021, 286, 99, 309, 1016,
+    943, 220, -1, 45, 759, 435, 1055, 1006, 1201, 629, -1, 2, 154, 38, 728, 1291,
+    232, 368, 988, -1, 695, 948, 567, 172, 921, 918, 407, -1, 1109, 708, 71, 127,
+    775, 1219, 125, -1, 1079, 77, 566, -1, 119, 0, 860, 664, 692, 758, 686, 1157,
+    982, -1, -1, 879, 1037, 1238, 1243, 571, 863, 485, 322, 351, 1119, -1, 182, 1099,
+    952, 835, 442, -1, 1225, 495, 613, 96, 318, 237, -1, 418, 609, 412, 839, 1168,
+    565, 414, 915, 488, 324, 894, 789, 505, 43, 190, 209, 385, -1, 29, 499, 297,
+    253, 920, 311, 27, 1162, 348, -1, 829, 323, -1, -1, 911, -1, 287, 902, 970,
+    983, 893, 892, 1107, 295, -1, 366, 539, 872, 1033, -1, 522, 730, 1181, 337, 1143,
+    462, 703, 1193, -1, 1309, 343, 422, -1, 188, 938, 1122, 582, 336, 1208, 1305, 426,
+    896, 266, 1051, 1076, -1, -1, 935, 734, 883, 513, 133, -1, -1, 1197, 1075, 443,
+    1216, 449, 33, -1, 910, 376, 602, 13, 1215, -1, -1, 270, 1289, 325, -1, -1,
+    429, 614, 1221, 1047, -1, 1088, 1178, -1, 1039, 410, 1004, 672, -1, -1, -1, 260,
+    1124, 968, -1, 122, 517, 183, 168, 826, 1256, -1, 411, 797, 992, 1247, 701, 836,
+    645, -1, 1209, 251, 783, 750, 405, 254, 818, 676, -1, 205, -1, -1, 221, 321,
+    -1, 201, 784, 317, 143, 47, -1, 1110, 579, 661, 958, 130, 723, 799, 858, 1154,
+    -1, 174, -1, 957, 907, 363, 585, 419, 711, -1, 556, 3, 51, 861, 1195, 333,
+    -1, 1303, 966, 1058, 774, 859, -1, 428, 652, 73, 109, 1144, 227, 1314, 161, 764,
+    349, 67, 856, -1, 312, 1231, 218, 601, 115, 207, 203, 1081, 636, 216, 1161, 999,
+    693, 1190, 23, 417, -1, 1044, 430, 1017, -1, -1, 315, 796, 459, -1, 671, 157,
+    584, 725, 846, -1, 931, 900, 1194, 141, 1260, 165, 817, 769, 1285, 616, -1, 283,
+    1125, 137, -1, -1, -1, -1, 290, 335, 993, 1036, 808, 164, 1316, 242, 507, 591,
+    477, 600, 193, 1078, 423, 959, 1174, 1074, 56, 825, 811, 969, 1028, 1027, 537, 347,
+    527, 780, 339, 215, 400, 1069, 1263, 833, -1, 984, 820, 557, 1266, -1, -1, 68,
+    367, 1135, -1, 85, 258, -1, -1, -1, 378, -1, 1053, 1146, 1229, -1, 538, 748,
+    1202, 1310, 1155, 1147, 62, 72, 245, 1128, 1050, 514, 381, 637, -1, 815, -1, 738,
+    805, 588, 1070, 800, -1, -1, 550, 1226, -1, -1, 667, 511, -1, 1148, 946, 1234,
+    660, 180, 350, 690, 139, 631, 277, 1001, -1, 308, 656, 466, 208, 699
+};
+
+static const keyword_table IFC4X3_RC3_keywords = { IFC4X3_RC3_keyword_displacements, 329, IFC4X3_RC3_keyword_slots, 1646 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -17111,7 +17243,7 @@ IfcParse::schema_definition* IFC4X3_RC3_populate_schema() {
     declarations.push_back(IFC4X3_RC3_IfcWorkTime_type);
     declarations.push_back(IFC4X3_RC3_IfcZone_type);
     declarations.push_back(IFC4X3_RC3_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X3_RC3", declarations, new IFC4X3_RC3_instance_factory());
+    return new schema_definition("IFC4X3_RC3", declarations, new IFC4X3_RC3_instance_factory(), &IFC4X3_RC3_keywords);
 }
 
 
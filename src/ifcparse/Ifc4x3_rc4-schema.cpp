@@ -2607,6 +2607,138 @@ class IFC4X3_RC4_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X3_RC4_keyword_displacements[329] = {
+    5, 10, 32, 53, 4, 1, 5, 12, 1, 13, 55, 1, 19, 9, 1, 9,
+    46, 21, 4, 26, 3, 28, 0, 12, 29, 30, 5, 21, 34, 19, 17, 1,
+    14, 23, 10, 3, 0, 1, 1, 11, 21, 7, 71, 2, 12, 22, 27, 4,
+    14, 7, 1, 2, 1, 8, 3, 4, 16, 4, 22, 1, 5, 9, 35, 11,
+    10, 2, 19, 3, 8, 20, 17, 2, 5, 11, 2, 12, 14, 13, 6, 2,
+    10, 21, 2, 10, 1, 1, 1, 2, 9, 98, 1, 19, 2, 27, 10, 10,
+    2, 2, 14, 4, 1, 2, 1, 3, 12, 13, 34, 4, 23, 10, 0, 22,
+    45, 2, 4, 32, 13, 5, 1, 12, 4, 45, 7, 28, 11, 10, 9, 1,
+    4, 2, 3, 64, 1, 23, 9, 1, 15, 29, 7, 5, 5, 1, 19, 32,
+    6, 37, 0, 1, 12, 1, 17, 12, 3, 3, 3, 9, 11, 1, 39, 30,
+    1, 8, 4, 6, 2, 1, 5, 2, 1, 13, 20, 25, 3, 70, 21, 35,
+    59, 47, 27, 6, 63, 8, 2, 3, 29, 16, 13, 26, 4, 10, 2, 58,
+    8, 72, 13, 128, 25, 1, 1, 3, 1, 19, 10, 10, 7, 18, 1, 1,
+    1, 1, 17, 29, 1, 1, 39, 2, 4, 4, 17, 8, 1, 3, 8, 8,
+    16, 1, 2, 69, 4, 10, 3, 2, 1, 59, 30, 19, 46, 3, 18, 21,
+    10, 4, 2, 1, 1, 2, 6, 42, 3, 7, 1, 27, 22, 3, 18, 10,
+    1, 6, 5, 95, 23, 7, 1, 1, 7, 7, 13, 2, 10, 8, 137, 10,
+    24, 10, 97, 1, 6, 9, 1, 88, 2, 7, 31, 21, 10, 2, 42, 1,
+    9, 6, 24, 6, 18, 27, 7, 5, 13, 2, 3, 5, 1, 5, 31, 10,
+    1, 14, 8, 2, 1, 1, 1, 55, 31, 1, 11, 2, 3, 2, 8, 31,
+    1, 9, 5, 9, 45, 34, 9, 27, 2
+};
+
+static const int16_t IFC4X3_RC4_keyword_slots[1645] = {
+    -1, 89, 479, 674, -1, 381, 557, -1, 1292, 1127, 1251, 619, -1, 1227, 95, 279,
+    87, -1, 1056, 1154, 204, -1, 887, 574, 21, 304, 412, 433, -1, 310, 970, 1008,
+    902, 915, 182, 105, 1205, 213, 1296, 1094, 624, 1268, 457, -1, -1, 855, -1, 1120,
+    132, 823, 655, 767, 357, 303, 1123, 196, -1, 783, 1216, -1, 590, 1297, 714, 167,
+    1057, 1207, 787, 1234, 490, 583, 443, 84, -1, 948, 1250, 172, 757, 491, 346, -1,
+    765, 1277, 273, 444, -1, 246, 1233, -1, 620, 441, 636, 669, 1282, -1, -1, -1,
+    1100, 1305, -1, 1134, 849, 563, 1106, -1, 672, 1016, 1192, 442, -1, -1, -1, 280,
+    1273, 718, 709, 962, -1, 301, 129, 1177, 886, 160, 588, -1, 161, 1132, 1208, 1034,
+    423, 1021, 216, 337, 1223, 396, 1165, 894, -1, -1, 187, -1, 755, 1076, 1281, 1203,
+    1189, 17, 1103, 623, -1, 991, 929, 309, 731, 805, 844, 64, 670, 942, 34, 833,
+    -1, 56, 802, 1244, 156, 175, -1, 254, 239, 538, 82, 208, 242, 1197, 392, 946,
+    953, 485, 924, 758, 868, 403, 25, 83, 865, 111, 467, 1062, 407, 265, 975, 1074,
+    49, 1084, 1280, 51, -1, -1, 923, 209, 1109, 550, 1126, -1, 223, 180, -1, -1,
+    774, 26, 152, 174, 315, 194, 633, -1, 33, 1214, -1, 933, 643, -1, 605, 142,
+    741, 793, -1, 537, 1252, 68, 358, 473, -1, -1, 498, 893, -1, 759, 1236, 561,
+    543, 463, 881, 299, 369, 188, 486, 375, 1198, 982, 153, 804, -1, 228, 568, 215,
+    1241, -1, 815, 103, 803, -1, 519, 340, 522, 571, 580, 544, 1017, 762, -1, -1,
+    1101, 941, 837, 516, 456, -1, 671, -1, 32, 278, 898, 192, 54, 618, 1040, 760,
+    890, 901, 131, 1275, 1027, 1058, 980, 685, -1, 938, 1237, 178, 592, 523, 559, 377,
+    176, 1279, 143, 416, -1, 656, 608, 676, 106, 384, 1286, -1, 508, 405, -1, 661,
+    1119, 1186, 399, 373, 554, 390, -1, -1, 1148, 1020, 1139, -1, -1, 595, 292, 657,
+    1124, 455, 646, -1, 226, 1033, 255, 1160, -1, 57, -1, 725, 197, 1108, -1, 1090,
+    134, 492, 1019, -1, 53, 203, 483, 271, 586, 797, -1, 977, 320, 149, 642, 18,
+    673, 1260, -1, -1, 1125, 243, 1159, 205, 1081, 191, 527, -1, 1266, 690, 875, 22,
+    -1, 943, 201, 710, 564, -1, -1, 351, 52, 922, -1, -1, 166, 852, 428, -1,
+    43, 99, -1, 6, -1, 312, 722, -1, 813, 593, 352, 1315, 533, 1095, 1230, 293,
+    1092, 1115, 905, 1011, 276, -1, 1193, -1, 966, 27, 118, 5, 694, 876, 509, 162,
+    789, 480, -1, 869, 232, 414, 1068, 135, -1, 258, 863, 1117, 48, 1221, 1075, 1176,
+    993, 214, 86, 822, 652, -1, -1, 421, 1153, 733, 1253, 157, -1, 1144, -1, -1,
+    1293, 1155, 753, -1, 1228, 330, 1088, 940, 1184, 591, 1097, -1, 809, 59, 283, 1066,
+    696, 904, 222, 505, 494, -1, 130, 666, -1, 1128, 122, 708, 101, 355, 114, 94,
+    14, 820, 1114, 79, 806, 777, -1, -1, 1161, -1, 715, 984, 313, -1, 841, -1,
+    -1, -1, 393, 889, 1178, 807, 1182, -1, 319, 1012, 548, 735, 331, 566, -1, 502,
+    -1, 1107, 883, 689, 1023, 1180, 521, 190, 506, 308, 1026, 24, 1308, 693, 1254, -1,
+    687, -1, 914, -1, -1, 700, 1226, 7, 951, 394, 828, 211, 147, 159, 786, 763,
+    -1, 1025, 432, -1, 572, 862, 874, 379, 974, -1, 1270, 1174, 1083, 677, -1, 639,
+    879, 1006, 224, 577, 596, 565, 1035, 1278, 438, 1246, 936, -1, -1, 11, -1, 1215,
+    371, 1313, 150, 518, -1, 1213, 275, 256, 1045, 712, 119, 603, 411, 662, 378, 644,
+    736, 1072, 417, 861, 376, 1029, 478, 847, -1, -1, 918, 61, 402, -1, 1196, 90,
+    -1, 1014, 842, 189, 615, 860, 364, 234, 703, 699, 818, 186, 770, 230, 761, 424,
+    503, 839, 291, 602, 996, 1078, 697, 716, 515, 816, 560, 536, 667, 481, 749, 1121,
+    819, 88, 38, 747, 1265, -1, -1, 4, 528, 764, -1, 799, 237, -1, -1, 1283,
+    -1, 477, 954, -1, 245, 348, 1256, 1212, 827, 931, -1, 170, 972, 464, 738, 609,
+    -1, 1299, 928, 446, -1, 1204, -1, 229, -1, -1, 711, 236, 704, 1061, 354, 724,
+    98, 165, 963, 1091, 74, 244, 361, 576, 737, 1003, 200, -1, -1, 937, 1287, 272,
+    848, 988, 248, 420, 177, 302, 19, 1013, 1222, 91, 1102, 688, 249, 400, -1, 235,
+    1290, 363, 754, 260, -1, 334, 1009, -1, 686, 1195, 880, 1031, -1, 752, 1219, 695,
+    -1, 63, -1, 829, 968, 600, 285, 335, 240, 440, 185, 288, -1, -1, 649, 173,
+    -1, 311, 629, 542, -1, -1, 1085, 532, -1, 944, 772, 858, 328, 431, -1, 648,
+    1005, -1, -1, 859, 1105, 110, 743, 1141, 846, 950, 10, 36, 1248, 344, 999, 233,
+    680, 541, 77, 112, 877, 795, -1, -1, 76, 221, 961, 326, 634, 385, 788, -1,
+    989, 20, -1, 1259, 632, 910, 684, 1243, 495, 1050, -1, 514, 1225, 1164, 778, 985,
+    614, 824, -1, 780, 306, 1052, 830, 986, -1, 1274, 751, 562, 31, 470, 1079, 471,
+    1300, 1309, 626, -1, -1, 388, 1001, 1098, -1, 739, 217, 771, 994, 1060, 179, 35,
+    -1, 1149, 42, 453, 287, 683, 812, 768, 911, 811, 1288, 513, 987, 945, 706, 534,
+    610, -1, 921, 817, 769, 2, 96, 1077, 665, 1239, 124, 323, 850, 1071, 891, 831,
+    840, -1, -1, -1, 117, 612, 969, 422, 307, 692, -1, 65, -1, 990, 482, 163,
+    744, 912, 12, 360, 949, 397, 264, -1, 906, 606, 547, 628, 776, -1, 58, -1,
+    115, 107, 745, 459, 1043, 332, 8, 955, 183, 426, -1, 199, 339, -1, 1065, 1042,
+    907, 611, 701, 353, -1, -1, 238, -1, 801, -1, 1152, 935, 247, 920, 1030, 682,
+    654, 1054, -1, 675, 814, -1, 719, 625, 775, 853, 1087, 294, 854, 721, 1202, 452,
+    1269, 1064, -1, 60, 971, 269, 343, -1, 908, 530, 1302, 742, 1211, 798, 1004, 171,
+    -1, 210, 356, 864, 630, -1, 794, -1, 41, 1037, 1000, -1, 75, 1162, 1, 913,
+    601, 866, 1163, -1, 45, 218, 998, 1218, 1024, 845, 468, 1129, -1, -1, 137, 750,
+    321, 219, -1, 499, 872, 154, 1112, 834, 67, 261, 362, 1055, 100, 790, 871, 139,
+    627, 726, 821, 164, 919, 436, 437, -1, 383, 270, 252, 585, 1018, 1113, 504, 316,
+    539, 681, 1311, 884, 1171, 435, 1140, 1146, 1185, 168, 267, 493, 635, 451, -1, 69,
+    702, 333, 1138, -1, -1, 746, 445, 259, 169, 535, 965, 1099, 72, 723, 784, 885,
+    -1, 398, 80, 558, 1166, 1232, -1, 108, 195, 779, -1, 30, 1172, 104, 930, 113,
+    500, 290, -1, 1137, 785, 359, 552, 578, 707, 1111, 474, 1258, 927, 873, 579, -1,
+    23, 617, 268, 125, 1069, -1, 925, -1, 1187, -1, 350, 1032, 1158, 184, 365, 1167,
+    -1, 401, 732, 386, 410, 1295, 1036, -1, 1263, 404, 1173, 909, 1224, 126, 637, 281,
+    -1, 663, 419, 484, -1, 589, 212, -1, -1, 1059, 660, 525, -1, 1247, -1, -1,
+    -1, 55, 1044, 97, -1, 342, 979, -1, -1, 1264, 900, 430, 826, 140, 1133, 263,
+    1047, -1, -1, 1002, 0, 1201, 415, -1, 1143, 406, 370, -1, 1231, 322, 1306, 50,
+    -1, 297, -1, 250, 545, -1, -1, -1, 641, 740, 584, 1199, 1039, -1, 225, 1289,
+    800, -1, 1130, 475, 553, 976, 748, -1, -1, 40, -1, 1276, 897, 705, 796, 13,
+    -1, 257, 1046, 997, -1, 549, 241, 1271, 109, -1, 1168, 1150, 1188, 136, -1, 959,
+    29, 284, -1, 791, 1200, -1, -1, 133, 895, 1007, 374, 277, 1284, 851, 73, -1,
+    -1, 1240, 93, 843, 1067, 1086, 647, -1, 413, 380, 729, 792, 439, 488, 116, 551,
+    -1, 781, 756, 631, 349, 1110, 838, 145, 1063, 1028, 734, -1, 622, 28, 1291, -1,
+    409, 720, -1, 597, 1294, 202, 958, 296, 462, 978, 939, 138, 497, -1, -1, -1,
+    728, 766, 449, 1145, 469, -1, -1, 144, 476, 193, -1, 1070, 305, 599, -1, 1285,
+    882, -1, 1272, 327, 727, -1, -1, 9, 668, -1, 581, 345, 1142, 512, -1, 616,
+    638, -1, -1, 836, 524, 1136, 1181, 1073, -1, 832, 640, -1, 487, 1242, 434, 604,
+    659, -1, 1122, 146, 231, -1, 507, 1191, -1, 621, 981, 338, 461, -1, 207, 123,
+    960, 587, 465, 1255, 1238, -1, -1, 39, -1, 892, 1298, 679, -1, -1, 382, 151,
+    -1, 607, 1261, 1301, -1, -1, 992, 418, 141, -1, 253, 1190, 582, -1, 496, 1080,
+    1135, 324, -1, 917, 286, -1, -1, -1, -1, 389, 489, 526, 1249, 395, 1220, 458,
+    1206, -1, -1, 650, 429, -1, 1179, 698, 1267, 1314, 1217, 447, 1118, 934, 329, 266,
+    1235, 472, -1, -1, 1038, 531, 520, 888, 427, -1, 1194, -1, -1, 947, 808, -1,
+    367, 1089, 575, 37, 466, 1041, 903, -1, 529, 1157, 856, -1, -1, 995, 1053, -1,
+    916, -1, 448, 121, 1116, 1257, 658, -1, 645, -1, 810, 44, 1229, 569, 573, -1,
+    713, 158, 1183, -1, 664, 1304, -1, 289, 1022, 1147, 318, -1, 1151, 1048, -1, 967,
+    540, 691, 1245, 46, 198, 1209, -1, -1, 181, -1, 317, 613, 730, 391, 1169, -1,
+    251, 653, 964, 510, 598, 501, 325, 1093, 1262, 717, -1, 127, -1, 454, 1131, 16,
+    1307, 274, 957, 368, 1015, 15, -1, 336, 899, 408, 62, 425, 973, 1051, 1210, -1,
+    298, 1104, -1, 835, -1, 952, 511, 867, -1, 78, 1175, -1, -1, 71, 556, 878,
+    387, -1, 782, 1156, 3, 546, 825, -1, 896, -1, 47, -1, 128, -1, 206, 1310,
+    70, -1, 870, -1, 282, -1, 227, 651, 66, -1, -1, 1303, 1312, 773, 300, 1082,
+    460, 120, 678, 567, 262, -1, 341, 366, 81, 92, 85, 1170, 555, -1, 932, 1096,
+    -1, 1010, -1, 857, 295, 347, 570, 155, -1, 314, 372, 148, 102, -1, 983, -1,
+    220, 926, -1, 1049, -1, -1, -1, 594, 517, -1, 956, 450, -1
+};
+
+static const keyword_table IFC4X3_RC4_keywords = { IFC4X3_RC4_keyword_displacements, 329, IFC4X3_RC4_keyword_slots, 1645 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -17125,7 +17257,7 @@ IfcParse::schema_definition* IFC4X3_RC4_populate_schema() {
     declarations.push_back(IFC4X3_RC4_IfcWorkTime_type);
     declarations.push_back(IFC4X3_RC4_IfcZone_type);
     declarations.push_back(IFC4X3_RC4_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X3_RC4", declarations, new IFC4X3_RC4_instance_factory());
+    return new schema_definition("IFC4X3_RC4", declarations, new IFC4X3_RC4_instance_factory(), &IFC4X3_RC4_keywords);
 }
 
 
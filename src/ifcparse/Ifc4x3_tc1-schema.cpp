@@ -2592,6 +2592,138 @@ class IFC4X3_TC1_instance_factory : public IfcParse::instance_factory {
     }
 };
 
+static const uint16_t IFC4X3_TC1_keyword_displacements[326] = {
+    2, 3, 13, 1, 3, 1, 22, 20, 2, 1, 1, 16, 1, 43, 6, 32,
+    8, 9, 1, 1, 13, 3, 30, 30, 0, 17, 24, 1, 2, 9, 27, 1,
+    14, 12, 129, 12, 14, 10, 4, 1, 20, 1, 6, 11, 7, 12, 30, 6,
+    16, 36, 11, 1, 1, 10, 9, 7, 119, 5, 6, 8, 9, 12, 2, 7,
+    5, 11, 9, 1, 26, 43, 14, 4, 1, 22, 11, 8, 5, 96, 59, 22,
+    3, 28, 5, 65, 1, 1, 2, 23, 3, 104, 6, 11, 2, 103, 10, 1,
+    2, 30, 6, 2, 8, 69, 8, 23, 0, 8, 11, 7, 1, 5, 2, 5,
+    9, 30, 1, 0, 3, 5, 81, 5, 1, 21, 41, 6, 6, 7, 48, 9,
+    6, 0, 31, 16, 3, 31, 34, 16, 15, 3, 9, 2, 9, 5, 2, 26,
+    2, 14, 8, 29, 34, 86, 1, 43, 3, 7, 7, 3, 54, 4, 17, 5,
+    8, 65, 30, 5, 12, 4, 3, 28, 4, 3, 4, 7, 11, 9, 12, 1,
+    1, 5, 17, 4, 1, 1, 7, 12, 1, 10, 1, 8, 70, 8, 0, 1,
+    6, 46, 4, 3, 13, 6, 12, 2, 107, 32, 4, 5, 6, 11, 21, 11,
+    28, 14, 2, 1, 4, 1, 5, 19, 1, 72, 20, 34, 1, 12, 3, 29,
+    68, 1, 17, 1, 1, 67, 21, 28, 1, 4, 3, 80, 3, 4, 8, 2,
+    6, 4, 6, 11, 5, 33, 4, 1, 6, 9, 0, 6, 68, 3, 1, 26,
+    68, 112, 33, 3, 28, 18, 7, 0, 2, 2, 6, 2, 2, 10, 30, 26,
+    9, 10, 1, 37, 1, 61, 5, 16, 1, 1, 12, 1, 9, 5, 46, 48,
+    1, 22, 32, 1, 1, 4, 10, 20, 3, 37, 13, 10, 13, 6, 5, 15,
+    4, 3, 7, 6, 1, 1, 6, 4, 7, 1, 20, 85, 90, 3, 11, 45,
+    10, 16, 30, 32, 1, 1
+};
+
+static const int16_t IFC4X3_TC1_keyword_slots[1633] = {
+    58, 911, -1, -1, 887, -1, 782, 93, 1047, 970, 366, 67, 921, 1305, -1, 512,
+    -1, -1, -1, -1, 889, -1, 568, 39, -1, -1, -1, 1131, 119, 719, 811, 189,
+    -1, -1, -1, 36, 1011, 246, 210, 673, 190, -1, 779, 617, -1, 1228, 352, 230,
+    952, 690, 464, -1, 1100, -1, 938, 249, -1, 538, -1, 547, -1, 1173, 982, 754,
+    843, -1, -1, -1, 1141, -1, 757, 648, 767, -1, 311, 925, -1, 877, 509, 545,
+    138, 1210, 9, 1081, 94, 1089, 845, 379, 1138, 573, 934, 633, 500, 31, 166, 268,
+    266, -1, 157, -1, 1284, 581, -1, 1219, 131, 661, 1193, 1051, 732, 816, 439, 878,
+    1196, 479, -1, -1, -1, 578, -1, -1, 32, -1, 950, -1, -1, 177, 1240, 937,
+    596, 336, -1, 684, -1, 557, 764, -1, 836, 918, 102, 480, 16, 1251, 848, 172,
+    1122, -1, -1, 642, -1, -1, 3, 1076, 814, -1, 742, 247, 109, -1, 318, -1,
+    1038, 390, 516, 936, -1, 864, 346, 1222, 686, 577, 1078, -1, -1, 369, 828, 425,
+    -1, 838, -1, 608, -1, 1163, -1, -1, 1102, 478, 876, 741, 961, 28, 76, 892,
+    1266, -1, 544, -1, 574, 462, -1, -1, 70, -1, -1, 91, 1005, 112, 1191, 1277,
+    461, -1, 203, 941, 242, 916, -1, 1139, 262, -1, -1, 385, 234, 1156, 694, 746,
+    939, 1175, 201, 434, 908, 1279, -1, 1111, 842, 752, 922, 52, 194, -1, 942, 536,
+    295, 871, 1114, 872, 1045, 181, 261, 504, 1094, 1093, 83, 503, 1087, 1006, -1, 428,
+    794, -1, 380, 359, 594, 413, 1248, 128, 49, 1009, -1, 989, 572, -1, 787, 82,
+    1208, 542, 550, 901, 571, 701, -1, 251, -1, 196, -1, 106, 796, 156, 612, -1,
+    1003, 641, 783, -1, 1230, 1032, 1174, -1, 1292, 776, 74, 1137, 984, -1, 1098, 1096,
+    773, 923, -1, -1, 323, 1066, 451, 422, 386, 95, 990, 964, 991, -1, 1283, 826,
+    195, 881, 1027, 257, 1243, 624, 651, 438, 1146, -1, -1, -1, 393, 436, 377, 1223,
+    710, 847, 384, 306, -1, 12, 907, 25, 812, 1026, 880, 977, 267, -1, 679, 772,
+    299, -1, 998, -1, 121, -1, 1167, 993, 79, 406, 362, 675, -1, 347, 160, 381,
+    1250, 854, 145, 1128, 1107, 221, 250, 1028, 637, 807, 469, -1, 896, 1017, 549, 1280,
+    -1, 19, 361, -1, 996, 440, 198, 408, 1129, 740, 761, 884, 598, 582, 317, 770,
+    1197, 1070, 1234, 745, -1, 698, 784, 1181, 1148, 202, 427, 270, 288, 442, -1, 1263,
+    488, 768, 799, 607, 616, -1, 1264, -1, 354, 521, -1, 1069, 855, -1, 678, 627,
+    307, 579, 60, 293, -1, 1232, 1290, 1282, -1, 717, 956, 276, 142, 136, 853, 885,
+    -1, 534, -1, 733, 38, 1268, 1293, 420, -1, 526, 229, 1260, 200, 331, -1, 489,
+    1201, 149, 29, 1143, 913, 1121, 5, 327, 310, 1151, 1160, 206, 1231, 687, 14, 1261,
+    -1, 45, 1192, 351, 219, 632, 51, 231, 419, 821, 6, 103, 1299, 254, 43, -1,
+    508, 405, 424, 730, -1, 1054, 960, 659, 320, 123, 1036, 514, 441, 358, 117, 182,
+    13, 978, 1018, 334, 543, 737, 110, 1161, 580, 1169, 769, 645, -1, 556, 27, 279,
+    151, 1247, 459, 519, 180, 1002, 398, 211, 1062, 1215, 1113, 314, 401, -1, 486, 357,
+    1108, 588, -1, -1, 235, 120, 1058, 374, 863, 1187, 753, -1, 319, 108, 917, 281,
+    -1, -1, 709, 363, 517, 551, -1, 1244, 1041, 40, 999, -1, 395, 852, -1, 168,
+    1097, 472, 1190, 1020, -1, 507, 21, 567, 736, 17, 292, 940, 564, 88, 163, 640,
+    1237, 1042, 973, 533, 621, 576, 473, 1150, 1106, 763, 85, 343, 824, 1159, 372, -1,
+    -1, -1, -1, -1, 1269, 948, 1090, -1, 506, 706, -1, 227, 715, 371, -1, 725,
+    593, -1, 790, 193, 321, 232, 1180, 609, -1, 337, 237, 483, 705, 443, 207, -1,
+    1000, 851, 1162, 780, 1238, -1, -1, 1217, 525, -1, 613, 1285, 183, -1, 127, 236,
+    84, 743, 1099, -1, 947, 150, 1204, 527, 1254, 554, 169, 280, 329, 1265, 101, 72,
+    -1, 353, 618, -1, -1, -1, -1, 1295, 792, 1037, 1183, 1008, 143, 1203, 619, 115,
+    962, 41, 857, 839, 1016, -1, 601, -1, 35, -1, -1, 1272, 898, 1004, 600, 220,
+    225, 830, 1185, 531, 1147, 874, -1, 33, 805, 1119, 56, -1, 303, 689, -1, 1172,
+    1153, 945, 963, 454, 446, -1, 1117, 248, -1, 817, 523, 920, 1239, 285, 1178, -1,
+    -1, 1010, 1130, 325, -1, 204, 1105, 682, -1, 539, -1, 905, 1019, 1029, 416, 591,
+    1273, -1, 392, -1, 980, 662, 1021, 738, 635, 704, 655, 914, 833, 146, 130, 277,
+    -1, 691, 1209, 1294, 700, 498, 1288, 802, 466, -1, 669, 1073, -1, 356, 154, 34,
+    1158, 367, 1298, 975, -1, 1112, 979, 1281, -1, 476, 532, 981, 1202, -1, 161, 1142,
+    -1, 186, -1, 491, 895, 389, 152, 1095, -1, 360, 300, 862, 883, -1, 1065, 957,
+    447, 296, 735, 1275, 99, 1012, 226, 560, 309, 1053, 755, -1, 535, 256, 926, 868,
+    46, 468, 653, 233, 1289, 1033, 1152, 570, 1195, 238, 1060, -1, 1030, -1, 402, -1,
+    666, 834, 92, 677, 1278, 997, -1, 861, 747, 1291, 65, 1140, 540, 505, -1, 804,
+    1233, 515, 417, 141, 294, -1, 639, 731, -1, 893, 90, 355, 212, 173, 1214, -1,
+    -1, -1, 1306, 681, 1216, 789, -1, 680, -1, -1, 1079, 501, 692, -1, -1, 192,
+    282, 605, 1039, 756, 30, 785, 167, 64, 966, 340, 495, 697, 273, 720, -1, 583,
+    951, 849, 1091, 846, -1, -1, 448, 158, 803, 1301, 813, 153, 638, 604, 387, -1,
+    904, 832, 650, -1, 205, 1252, 411, 1135, -1, 116, 455, 840, 1085, 87, 59, 105,
+    587, 174, 118, -1, 928, 339, 909, 647, 810, 133, 330, -1, 674, 967, 345, 1229,
+    1046, 882, -1, 1075, -1, 382, 342, 1194, 629, 781, -1, 933, 1236, 409, 788, 68,
+    73, 886, 1101, 66, 1067, 946, 433, 315, -1, -1, 289, 414, 835, -1, 819, -1,
+    324, 1255, 241, -1, 721, 758, 159, 1225, 57, -1, 209, -1, 513, 722, 712, 18,
+    -1, 1177, 1296, 1082, 264, -1, 958, 494, 1001, -1, -1, 252, 20, 1072, -1, 869,
+    530, 137, 734, 1200, -1, 976, 541, -1, 497, 322, 407, 185, -1, 1064, -1, 1056,
+    1182, 985, 253, 988, 615, 992, 481, -1, 1297, 271, -1, -1, 502, 610, 510, 304,
+    -1, 1176, 370, 1303, 841, 749, 844, 191, 171, 1186, -1, 470, 412, 974, -1, 636,
+    -1, 660, 1120, 1088, 1184, -1, 1086, -1, 437, -1, 24, 301, 897, -1, 954, 688,
+    1256, 348, 672, -1, -1, 968, 524, 240, 801, 175, 1212, -1, -1, 1104, 1034, 875,
+    995, 287, 858, 671, -1, -1, 487, 26, 162, 870, 643, -1, 122, 1274, 903, 61,
+    297, 702, 0, 667, 751, 649, -1, -1, 775, 474, -1, -1, 178, 364, 179, 104,
+    1050, 208, -1, 1043, 71, -1, 727, 1224, -1, 338, 258, 1242, 750, 595, 724, 676,
+    943, 471, 283, 590, 1115, 1133, 930, 429, 831, 1015, 490, 900, 1253, 969, 1132, 1246,
+    8, 1109, -1, 1155, 453, 140, 124, 1127, 566, -1, 400, 766, 463, -1, 548, -1,
+    1144, 611, 1123, 298, 518, 748, -1, 332, 1220, 599, 1049, 328, 634, 699, 972, 302,
+    -1, 1245, 96, 1276, 493, -1, 415, 1125, 1136, 1040, 867, -1, 552, 822, 421, 1103,
+    716, 457, 214, 132, 53, 482, 696, 396, -1, 818, 431, 971, 129, 344, 931, 983,
+    113, -1, 47, -1, 1221, 48, 404, -1, 965, -1, -1, 823, 1165, 22, 899, 286,
+    777, 1084, -1, 477, 316, 665, 430, 664, -1, 910, 394, 902, 1080, 383, 1077, 703,
+    265, 467, 873, 949, 11, -1, 1257, 313, 865, -1, 1241, 1014, 144, 927, 1074, 693,
+    125, 1286, 499, 275, 445, -1, 654, 771, 888, 695, -1, 7, 658, 291, -1, 1207,
+    825, 955, 485, -1, 1227, 4, -1, 714, 69, 522, 218, 856, 135, -1, 217, 511,
+    728, 269, 80, 312, 589, 134, 373, 465, 1063, 592, 164, -1, -1, 1206, -1, -1,
+    795, 620, 1271, 111, 100, 450, -1, 216, 1126, 475, -1, -1, -1, 786, 365, 994,
+    879, 274, 1259, -1, 444, -1, 850, 333, 78, 628, 244, 484, -1, -1, 1068, 685,
+    1048, 243, -1, 107, -1, 827, 657, 1198, 148, 245, 565, 397, 308, 924, 561, 953,
+    368, 537, 1023, 1157, 820, 272, 388, 798, 932, 935, 1300, 456, 630, 944, -1, 646,
+    184, 1025, 63, 188, 707, 520, -1, 1205, 778, 774, -1, 1270, 1092, 603, -1, 584,
+    97, 1235, 496, 546, -1, -1, 187, 222, 263, 739, 1179, 1218, 1168, -1, 418, 1287,
+    -1, -1, 912, -1, 553, 708, -1, 906, -1, 1044, -1, 575, -1, 54, 1302, 1149,
+    165, 597, -1, -1, 1145, 42, 555, 1124, 239, 114, -1, 399, -1, 1304, 228, -1,
+    -1, 1154, 86, -1, 837, 929, 668, -1, 1211, -1, 1, 1024, 626, 797, 1134, -1,
+    278, 606, 586, 866, 452, -1, 558, 1057, 894, 77, 305, 449, 1061, 215, -1, 529,
+    -1, 711, 1071, 423, 1031, 1022, 670, 170, 259, 585, 260, 1226, 759, -1, 1166, 403,
+    623, -1, -1, -1, -1, 622, 744, 426, 37, 435, -1, 563, 62, 1199, 919, -1,
+    458, 569, 762, 55, 81, 562, -1, 199, 350, 1110, 602, 829, 891, 432, 1258, 224,
+    718, 683, 986, 326, 614, 1164, 410, 1055, 765, 1083, 341, 815, 652, 126, 460, 375,
+    760, 2, 987, 15, 1170, 1267, 376, 859, 793, 656, 1052, 1262, 723, -1, 391, -1,
+    -1, 213, 1171, 290, 631, 663, 255, 75, 1118, -1, 959, 197, 1249, 98, 378, 1013,
+    1035, -1, 23, -1, 1189, 1213, 492, -1, -1, 625, 155, 335, -1, 1059, -1, 1116,
+    -1, 44, 809, 139, 89, 1007, -1, 223, 860, 1188, 50, 528, -1, 176, 791, 349,
+    726, 890, 915, 644, -1, 808, 559, -1, 729, -1, 147, 806, -1, 713, 284, 800,
+    10
+};
+
+static const keyword_table IFC4X3_TC1_keywords = { IFC4X3_TC1_keyword_displacements, 326, IFC4X3_TC1_keyword_slots, 1633 };
+
 
 #if defined(__clang__)
 __attribute__((optnone))
@@ -16995,7 +17127,7 @@ IfcParse::schema_definition* IFC4X3_TC1_populate_schema() {
     declarations.push_back(IFC4X3_TC1_IfcWorkTime_type);
     declarations.push_back(IFC4X3_TC1_IfcZone_type);
     declarations.push_back(IFC4X3_TC1_IfcZShapeProfileDef_type);
-    return new schema_definition("IFC4X3_TC1", declarations, new IFC4X3_TC1_instance_factory());
+    return new schema_definition("IFC4X3_TC1", declarations, new IFC4X3_TC1_instance_factory(), &IFC4X3_TC1_keywords);
 }
 
 
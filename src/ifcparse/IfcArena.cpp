@@ -0,0 +1,76 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace IfcParse;
+
+const size_t arena::min_block_size;
+const size_t arena::max_block_size;
+
+void* arena::cursor::allocate(size_t size, size_t alignment) {
+	uintptr_t p = (reinterpret_cast<uintptr_t>(ptr_) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	if (ptr_ == nullptr || p + size > reinterpret_cast<uintptr_t>(end_)) {
+		// Blocks grow geometrically so that small files do not reserve a lot
+		// of memory, while large files only need relatively few blocks.
+		size_t block_size = (std::max)(next_block_size_, size + alignment);
+		ptr_ = arena_->allocate_block(block_size);
+		end_ = ptr_ + block_size;
+		next_block_size_ = (std::min)(next_block_size_ * 2, max_block_size);
+		p = (reinterpret_cast<uintptr_t>(ptr_) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	}
+	ptr_ = reinterpret_cast<char*>(p + size);
+	return reinterpret_cast<void*>(p);
+}
+
+arena::~arena() {
+	for (auto& p : blocks_) {
+		::operator delete(const_cast<char*>(p.first));
+	}
+}
+
+char* arena::allocate_block(size_t size) {
+	char* block = static_cast<char*>(::operator new(size));
+	std::lock_guard<std::mutex> lk(mutex_);
+	blocks_.insert({ block, block + size });
+	return block;
+}
+
+bool arena::owns(const void* p) const {
+	const char* c = static_cast<const char*>(p);
+	std::lock_guard<std::mutex> lk(mutex_);
+	auto it = blocks_.upper_bound(c);
+	if (it == blocks_.begin()) {
+		return false;
+	}
+	--it;
+	return c < it->second;
+}
+
+size_t arena::capacity() const {
+	size_t n = 0;
+	std::lock_guard<std::mutex> lk(mutex_);
+	for (auto& p : blocks_) {
+		n += p.second - p.first;
+	}
+	return n;
+}
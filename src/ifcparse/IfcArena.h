@@ -0,0 +1,103 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Monotonic allocator for the attributes parsed from an IFC-SPF file. Memory   *
+* is handed out from large blocks and only released when the arena is         *
+* destroyed, objects allocated from it are never destructed individually.     *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCARENA_H
+#define IFCARENA_H
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "ifc_parse_api.h"
+
+namespace IfcParse {
+
+	class IFC_PARSE_API arena {
+	public:
+		/// Allocates from a block of the arena. Every thread allocates using
+		/// its own cursor, only obtaining a new block is synchronized.
+		class IFC_PARSE_API cursor {
+		private:
+			arena* arena_;
+			char* ptr_;
+			char* end_;
+			size_t next_block_size_;
+
+		public:
+			explicit cursor(arena* a)
+				: arena_(a)
+				, ptr_(nullptr)
+				, end_(nullptr)
+				, next_block_size_(min_block_size)
+			{}
+
+			void* allocate(size_t size, size_t alignment);
+
+			/// Constructs an object of type T in the arena. The destructor of
+			/// T is never called, so T should not own memory outside of it.
+			template <typename T, typename... Args>
+			T* create(Args&&... args) {
+				return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+			}
+
+			/// Allocates a value-initialized array of n elements of type T
+			template <typename T>
+			T* create_array(size_t n) {
+				return new (allocate(sizeof(T) * n, alignof(T))) T[n]();
+			}
+		};
+
+		static const size_t min_block_size = 64 * 1024;
+		static const size_t max_block_size = 4 * 1024 * 1024;
+
+	private:
+		// Blocks by their start address, mapped to their end address
+		std::map<const char*, const char*> blocks_;
+		mutable std::mutex mutex_;
+
+		arena(const arena&) = delete;
+		arena& operator=(const arena&) = delete;
+
+	public:
+		arena() {}
+		~arena();
+
+		/// Returns a new block of at least size bytes
+		char* allocate_block(size_t size);
+
+		/// Returns whether p points into one of the blocks of this arena
+		bool owns(const void* p) const;
+
+		/// Returns the total number of bytes in the blocks of this arena
+		size_t capacity() const;
+	};
+
+}
+
+#endif
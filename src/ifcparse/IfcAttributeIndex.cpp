@@ -0,0 +1,177 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcAttributeIndex.h"
+#include "../ifcparse/Argument.h"
+#include "../ifcparse/IfcEntityInstanceData.h"
+#include "../ifcparse/IfcException.h"
+#include "../ifcparse/IfcLogger.h"
+#include "../ifcparse/IfcSchema.h"
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace IfcParse;
+
+namespace {
+	// Tags for the kind of value, which precede the text of a key
+	const char string_tag = 'S';
+	const char number_tag = 'N';
+	const char logical_tag = 'L';
+	const char instance_tag = 'I';
+}
+
+attribute_value::attribute_value(const std::string& v) {
+	key_.reserve(v.size() + 1);
+	key_.push_back(string_tag);
+	key_ += v;
+}
+
+attribute_value::attribute_value(const char* v)
+	: attribute_value(std::string(v))
+{}
+
+attribute_value::attribute_value(int v)
+	: attribute_value(static_cast<double>(v))
+{}
+
+attribute_value::attribute_value(double v) {
+	// Negative zero is formatted as "-0", but compares equal to zero
+	if (v == 0.) {
+		v = 0.;
+	}
+	// Integers are represented exactly, so that they match equal reals
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%.17g", v);
+	key_.push_back(number_tag);
+	key_ += buffer;
+}
+
+attribute_value::attribute_value(bool v) {
+	key_.push_back(logical_tag);
+	key_.push_back(v ? 'T' : 'F');
+}
+
+attribute_value::attribute_value(IfcUtil::IfcBaseClass* v) {
+	if (v == nullptr) {
+		return;
+	}
+	if (v->declaration().as_entity()) {
+		key_.push_back(instance_tag);
+		key_ += std::to_string(v->data().id());
+	} else {
+		// A typed value matches the value it wraps, an empty key matches nothing
+		attribute_value wrapped;
+		if (from_argument(v->data().getArgument(0), wrapped)) {
+			key_.swap(wrapped.key_);
+		}
+	}
+}
+
+attribute_value attribute_value::logical(boost::logic::tribool v) {
+	attribute_value value;
+	value.key_.push_back(logical_tag);
+	value.key_.push_back(boost::logic::indeterminate(v) ? 'U' : v ? 'T' : 'F');
+	return value;
+}
+
+bool attribute_value::from_argument(const Argument* argument, attribute_value& value) {
+	if (argument == nullptr) {
+		return false;
+	}
+	switch (argument->type()) {
+	case IfcUtil::Argument_STRING:
+	case IfcUtil::Argument_ENUMERATION:
+		value = attribute_value((std::string) *argument);
+		return true;
+	case IfcUtil::Argument_INT:
+		value = attribute_value((int) *argument);
+		return true;
+	case IfcUtil::Argument_DOUBLE:
+		value = attribute_value((double) *argument);
+		return true;
+	case IfcUtil::Argument_BOOL:
+		value = attribute_value((bool) *argument);
+		return true;
+	case IfcUtil::Argument_LOGICAL: {
+		const boost::logic::tribool v = *argument;
+		value = logical(v);
+		return true;
+	}
+	case IfcUtil::Argument_ENTITY_INSTANCE:
+		value = attribute_value((IfcUtil::IfcBaseClass*) *argument);
+		return !value.key_.empty();
+	default:
+		return false;
+	}
+}
+
+attribute_value_index::attribute_value_index(const aggregate_of_instance::ptr& instances, size_t attribute_index) {
+	if (!instances) {
+		return;
+	}
+	entries_.reserve(instances->size());
+	size_t position = 0;
+	attribute_value value;
+	for (auto it = instances->begin(); it != instances->end(); ++it, ++position) {
+		try {
+			const IfcEntityInstanceData& data = (*it)->data();
+			if (attribute_index < data.getArgumentCount() && attribute_value::from_argument(data.getArgument(attribute_index), value)) {
+				entries_.push_back({ std::move(value.key_), *it, position });
+			}
+		} catch (IfcException& e) {
+			Logger::Error(e);
+		}
+	}
+	std::sort(entries_.begin(), entries_.end(), [](const entry& a, const entry& b) {
+		const int c = a.key.compare(b.key);
+		return c < 0 || (c == 0 && a.position < b.position);
+	});
+}
+
+aggregate_of_instance::ptr attribute_value_index::find(const attribute_value& value) const {
+	aggregate_of_instance::ptr instances(new aggregate_of_instance);
+	auto it = std::lower_bound(entries_.begin(), entries_.end(), value.key(), [](const entry& e, const std::string& k) {
+		return e.key < k;
+	});
+	for (; it != entries_.end() && it->key == value.key(); ++it) {
+		instances->push(it->instance);
+	}
+	return instances;
+}
+
+aggregate_of_instance::ptr attribute_value_index::find_prefix(const std::string& prefix) const {
+	const std::string key = attribute_value(prefix).key();
+	auto it = std::lower_bound(entries_.begin(), entries_.end(), key, [](const entry& e, const std::string& k) {
+		return e.key < k;
+	});
+	std::vector<const entry*> matches;
+	for (; it != entries_.end() && it->key.compare(0, key.size(), key) == 0; ++it) {
+		matches.push_back(&*it);
+	}
+	std::sort(matches.begin(), matches.end(), [](const entry* a, const entry* b) {
+		return a->position < b->position;
+	});
+	aggregate_of_instance::ptr instances(new aggregate_of_instance);
+	instances->reserve((unsigned) matches.size());
+	for (auto& e : matches) {
+		instances->push(e->instance);
+	}
+	return instances;
+}
@@ -0,0 +1,102 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Indexes the instances of an entity type by the value of one of their         *
+* attributes. Values are encoded as a key that starts with a tag for the kind  *
+* of value, followed by its text, so that instances can be looked up by value  *
+* or by the start of a string value in a single sorted vector.                 *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCATTRIBUTEINDEX_H
+#define IFCATTRIBUTEINDEX_H
+
+#include <string>
+#include <vector>
+
+#include <boost/logic/tribool.hpp>
+
+#include "ifc_parse_api.h"
+#include "../ifcparse/aggregate_of_instance.h"
+
+class Argument;
+
+namespace IfcParse {
+
+	/// A value to look up in an attribute_value_index. Strings also match
+	/// enumeration values, numbers match integer and real values alike and
+	/// typed values, e.g. IFCLABEL('...'), match the value they wrap.
+	/// Entity instances match references to them.
+	class IFC_PARSE_API attribute_value {
+	private:
+		std::string key_;
+
+		attribute_value() {}
+
+		friend class attribute_value_index;
+
+	public:
+		attribute_value(const std::string& v);
+		attribute_value(const char* v);
+		attribute_value(int v);
+		attribute_value(double v);
+		attribute_value(bool v);
+		attribute_value(IfcUtil::IfcBaseClass* v);
+
+		static attribute_value logical(boost::logic::tribool v);
+
+		/// Returns the value of an attribute, or false when it is not
+		/// indexed, i.e. when it is null, derived or an aggregate
+		static bool from_argument(const Argument* argument, attribute_value& value);
+
+		const std::string& key() const { return key_; }
+	};
+
+	class IFC_PARSE_API attribute_value_index {
+	private:
+		struct entry {
+			std::string key;
+			IfcUtil::IfcBaseClass* instance;
+			// Position of the instance in the list the index is built from
+			size_t position;
+		};
+
+		std::vector<entry> entries_;
+
+	public:
+		/// Indexes the instances by the value of the attribute at attribute_index
+		attribute_value_index(const aggregate_of_instance::ptr& instances, size_t attribute_index);
+
+		/// Returns the instances of which the attribute equals value, in the
+		/// order of the list the index is built from
+		aggregate_of_instance::ptr find(const attribute_value& value) const;
+
+		/// Returns the instances of which the attribute is a string, or
+		/// enumeration, that starts with prefix, in the order of the list
+		/// the index is built from
+		aggregate_of_instance::ptr find_prefix(const std::string& prefix) const;
+
+		size_t size() const { return entries_.size(); }
+	};
+
+}
+
+#endif
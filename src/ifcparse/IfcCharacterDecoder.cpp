@@ -80,13 +80,13 @@ IfcCharacterDecoder::~IfcCharacterDecoder() {
 }
 
 namespace {
-	static unsigned int reference_helper = 0;
+	static size_t reference_helper = 0;
 
 	class pure_impure_helper {
 	private:
 		bool pure_;
 		IfcParse::IfcSpfStream* stream_;
-		unsigned int& pointer_;
+		size_t& pointer_;
 		std::wstring builder_;
 
 		char peek() {
@@ -97,7 +97,7 @@ namespace {
 			}
 		}
 
-		unsigned int tell() {
+		size_t tell() {
 			if (pure_) {
 				return pointer_;
 			} else {
@@ -118,7 +118,7 @@ namespace {
 			: pure_(false), stream_(stream), pointer_(reference_helper)
 		{}
 
-		pure_impure_helper(IfcParse::IfcSpfStream* stream, unsigned int& pointer)
+		pure_impure_helper(IfcParse::IfcSpfStream* stream, size_t& pointer)
 			: pure_(true), stream_(stream), pointer_(pointer)
 		{}
 
@@ -241,15 +241,25 @@ IfcCharacterDecoder::operator std::string() {
 	return pure_impure_helper(file).get(mode, substitution_character);
 }
 
-std::string IfcCharacterDecoder::get(unsigned int& ptr) {
+std::string IfcCharacterDecoder::get(size_t& ptr) {
 	return pure_impure_helper(file, ptr).get(mode, substitution_character);
 }
 
+namespace {
+	// Characters that change the parse state of a string literal starting from the initial state
+	const IfcParse::character_set string_special_characters("'\\\0", 3);
+}
+
 void IfcCharacterDecoder::skip() {
 	unsigned int parse_state = 0;
 	char current_char;
 	unsigned int hex_count = 0;
-	while ((current_char = file->Peek()) != 0) {
+	for (;;) {
+		if (!parse_state) {
+			// Ordinary characters do not affect the parse state, skip over them in blocks
+			file->SeekFirstOf(string_special_characters);
+		}
+		if (file->eof || (current_char = file->Peek()) == 0) break;
 		if ( EXPECTS_CHARACTER(parse_state) ) {
 			parse_state = 0;
 		} else if ( current_char == '\'' && ! parse_state ) {
@@ -59,7 +59,7 @@ namespace IfcParse {
 		operator std::string();
 		// Gets a decoded string representation at the offset provided,
 		// does not mutate the underlying token stream read pointer.
-		std::string get(unsigned int&);
+		std::string get(size_t&);
 	};
 
 }
@@ -0,0 +1,225 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcCharacterScan.h"
+
+#include <atomic>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || ((defined(__i386__) || defined(_M_IX86)) && (defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define IFC_CHARACTER_SCAN_X86
+#endif
+
+#ifdef IFC_CHARACTER_SCAN_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define IFC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define IFC_TARGET_AVX2
+#endif
+#endif
+
+IfcParse::character_set::character_set(const char* chars, size_t n)
+	: size_(n)
+{
+	if (n == 0 || n > max_size) {
+		throw std::invalid_argument("Invalid character set size");
+	}
+	std::memset(table_, 0, sizeof(table_));
+	for (size_t i = 0; i < max_size; ++i) {
+		// Unused slots repeat the first character, so that they never
+		// introduce additional matches.
+		chars_[i] = chars[i < n ? i : 0];
+		table_[(unsigned char) chars_[i]] = true;
+	}
+}
+
+namespace {
+
+	typedef size_t(*find_first_of_fn)(const char*, size_t, size_t, const IfcParse::character_set&);
+
+	size_t find_first_of_scalar(const char* buffer, size_t begin, size_t end, const IfcParse::character_set& set) {
+		while (begin < end && !set.contains(buffer[begin])) {
+			++begin;
+		}
+		return begin;
+	}
+
+#ifdef IFC_CHARACTER_SCAN_X86
+
+	inline unsigned int count_trailing_zeros(unsigned int v) {
+#ifdef _MSC_VER
+		unsigned long i;
+		_BitScanForward(&i, v);
+		return (unsigned int) i;
+#else
+		return (unsigned int) __builtin_ctz(v);
+#endif
+	}
+
+	// Matches are often found within the first characters, e.g. the end of a
+	// number, for which setting up the vector comparisons costs more than
+	// inspecting the characters one by one.
+	const size_t scalar_prefix_size = 16;
+
+	size_t find_first_of_sse2(const char* buffer, size_t begin, size_t end, const IfcParse::character_set& set) {
+		size_t i = find_first_of_scalar(buffer, begin, (std::min)(end, begin + scalar_prefix_size), set);
+		if (i < end && set.contains(buffer[i])) {
+			return i;
+		}
+
+		__m128i needles[IfcParse::character_set::max_size];
+		const size_t n = set.size();
+		for (size_t j = 0; j < n; ++j) {
+			needles[j] = _mm_set1_epi8(set.chars()[j]);
+		}
+
+		for (; i + 16 <= end; i += 16) {
+			const __m128i block = _mm_loadu_si128((const __m128i*) (buffer + i));
+			__m128i matches = _mm_cmpeq_epi8(block, needles[0]);
+			for (size_t j = 1; j < n; ++j) {
+				matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, needles[j]));
+			}
+			const unsigned int mask = (unsigned int) _mm_movemask_epi8(matches);
+			if (mask) {
+				return i + count_trailing_zeros(mask);
+			}
+		}
+
+		return find_first_of_scalar(buffer, i, end, set);
+	}
+
+	IFC_TARGET_AVX2 size_t find_first_of_avx2(const char* buffer, size_t begin, size_t end, const IfcParse::character_set& set) {
+		size_t i = find_first_of_scalar(buffer, begin, (std::min)(end, begin + scalar_prefix_size), set);
+		if (i < end && set.contains(buffer[i])) {
+			return i;
+		}
+
+		__m256i needles[IfcParse::character_set::max_size];
+		const size_t n = set.size();
+		for (size_t j = 0; j < n; ++j) {
+			needles[j] = _mm256_set1_epi8(set.chars()[j]);
+		}
+
+		for (; i + 32 <= end; i += 32) {
+			const __m256i block = _mm256_loadu_si256((const __m256i*) (buffer + i));
+			__m256i matches = _mm256_cmpeq_epi8(block, needles[0]);
+			for (size_t j = 1; j < n; ++j) {
+				matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, needles[j]));
+			}
+			const unsigned int mask = (unsigned int) _mm256_movemask_epi8(matches);
+			if (mask) {
+				return i + count_trailing_zeros(mask);
+			}
+		}
+
+		return find_first_of_sse2(buffer, i, end, set);
+	}
+
+	bool cpu_supports_avx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) {
+			return false;
+		}
+		__cpuid(info, 1);
+		// Both OSXSAVE and AVX are required, and the operating system needs
+		// to preserve the YMM registers on context switches.
+		if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) {
+			return false;
+		}
+		if ((_xgetbv(0) & 6) != 6) {
+			return false;
+		}
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+
+#endif
+
+	bool always_supported() {
+		return true;
+	}
+
+	struct implementation {
+		find_first_of_fn fn;
+		const char* name;
+		bool(*supported)();
+	};
+
+	// Ordered from fastest to slowest
+	const implementation implementations[] = {
+#ifdef IFC_CHARACTER_SCAN_X86
+		{ find_first_of_avx2, "avx2", cpu_supports_avx2 },
+		{ find_first_of_sse2, "sse2", always_supported },
+#endif
+		{ find_first_of_scalar, "scalar", always_supported }
+	};
+
+	std::atomic<const implementation*>& selected_implementation() {
+		static std::atomic<const implementation*> selected(&*std::find_if(std::begin(implementations), std::end(implementations), [](const implementation& impl) {
+			return impl.supported();
+		}));
+		return selected;
+	}
+
+}
+
+size_t IfcParse::find_first_of(const char* buffer, size_t begin, size_t end, const character_set& set) {
+	return selected_implementation().load(std::memory_order_relaxed)->fn(buffer, begin, end, set);
+}
+
+const char* IfcParse::find_first_of_implementation() {
+	return selected_implementation().load(std::memory_order_relaxed)->name;
+}
+
+void IfcParse::find_first_of_implementation(const std::string& name) {
+	for (const implementation& impl : implementations) {
+		if (name == impl.name) {
+			if (!impl.supported()) {
+				throw std::invalid_argument("The " + name + " implementation is not supported by this processor");
+			}
+			selected_implementation().store(&impl, std::memory_order_relaxed);
+			return;
+		}
+	}
+	throw std::invalid_argument("Unknown implementation " + name);
+}
+
+std::vector<std::string> IfcParse::find_first_of_implementations() {
+	std::vector<std::string> names;
+	for (const implementation& impl : implementations) {
+		if (impl.supported()) {
+			names.push_back(impl.name);
+		}
+	}
+	return names;
+}
@@ -0,0 +1,79 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Vectorized search for characters in the contiguous buffer of an SPF file.    *
+* An SSE2 or AVX2 implementation is selected at runtime when available, with   *
+* a scalar fallback for other platforms.                                       *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCCHARACTERSCAN_H
+#define IFCCHARACTERSCAN_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ifc_parse_api.h"
+
+namespace IfcParse {
+
+	/// A small set of characters to search for using find_first_of()
+	class IFC_PARSE_API character_set {
+	public:
+		static const size_t max_size = 8;
+
+	private:
+		char chars_[max_size];
+		size_t size_;
+		bool table_[256];
+
+	public:
+		/// Creates a set from the first n characters pointed to by chars,
+		/// n can be at most max_size. Note that chars can contain '\0'.
+		character_set(const char* chars, size_t n);
+
+		const char* chars() const { return chars_; }
+		size_t size() const { return size_; }
+		bool contains(char c) const { return table_[(unsigned char) c]; }
+	};
+
+	/// Returns the offset of the first character in buffer[begin, end) that is
+	/// part of set, or end when no such character is found.
+	IFC_PARSE_API size_t find_first_of(const char* buffer, size_t begin, size_t end, const character_set& set);
+
+	/// Returns the name of the implementation used by find_first_of(), one of
+	/// "avx2", "sse2" or "scalar".
+	IFC_PARSE_API const char* find_first_of_implementation();
+
+	/// Selects the implementation used by find_first_of() by name, e.g. to
+	/// compare them in a benchmark. By default the fastest implementation
+	/// supported by the processor is used. Throws std::invalid_argument when
+	/// the implementation is unknown or not supported by the processor.
+	IFC_PARSE_API void find_first_of_implementation(const std::string& name);
+
+	/// Returns the names of the implementations of find_first_of() that are
+	/// supported by the processor, the fastest first.
+	IFC_PARSE_API std::vector<std::string> find_first_of_implementations();
+
+}
+
+#endif
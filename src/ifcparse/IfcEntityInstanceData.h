@@ -25,6 +25,8 @@
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 class Argument;
@@ -35,29 +37,54 @@ namespace IfcParse {
 
 class IFC_PARSE_API IfcEntityInstanceData {
 public:
+	/// Outcome of release_attributes()
+	enum release_status { released, recently_used, in_use, not_releasable };
+
 	// Public for backwards compatibility
 	IfcParse::IfcFile* file;
 protected:
 	unsigned id_;
+	// Set once attributes_ is populated, so that instances can be lazily
+	// loaded from multiple threads. attributes_ is only owned by the
+	// instance while set, released attributes are freed by the file.
+	mutable std::atomic<bool> loaded_;
+	// Set when attributes_ is allocated from the arena of the file. Arguments
+	// are then arena allocated as well, except those assigned afterwards.
+	mutable bool in_arena_;
+	bool modified_;
+	// Whether the attributes can be released and read again from file, and
+	// whether they have been accessed since the file last considered them
+	// for release, see IfcFile::memory_budget()
+	enum residency : uint8_t { not_evictable, evictable, evictable_referenced };
+	mutable std::atomic<uint8_t> residency_;
 	const IfcParse::declaration* type_;
 	mutable Argument** attributes_;
-	unsigned offset_in_file_;
+	size_t offset_in_file_;
 
 public:
-	IfcEntityInstanceData(const IfcParse::declaration* type, IfcParse::IfcFile* file_, unsigned id = 0, unsigned offset_in_file = 0)
-		: file(file_), id_(id), type_(type), attributes_(0), offset_in_file_(offset_in_file)
+	IfcEntityInstanceData(const IfcParse::declaration* type, IfcParse::IfcFile* file_, unsigned id = 0, size_t offset_in_file = 0)
+		: file(file_), id_(id), loaded_(false), in_arena_(false), modified_(false), residency_(not_evictable), type_(type), attributes_(0), offset_in_file_(offset_in_file)
 	{}
 
    IfcEntityInstanceData(IfcParse::IfcFile* file_, size_t size)
-      : file(file_), id_(0), type_(0), attributes_(new Argument*[size] {0}), offset_in_file_(0)
+      : file(file_), id_(0), loaded_(true), in_arena_(false), modified_(false), residency_(not_evictable), type_(0), attributes_(new Argument*[size] {0}), offset_in_file_(0)
 	{}
 
    IfcEntityInstanceData(const IfcParse::declaration* type)
-      : file(0), id_(0), type_(type), attributes_(new Argument*[getArgumentCount()]{ 0 }), offset_in_file_(0)
+      : file(0), id_(0), loaded_(true), in_arena_(false), modified_(false), residency_(not_evictable), type_(type), attributes_(new Argument*[getArgumentCount()]{ 0 }), offset_in_file_(0)
    {}
 
+	/// Reads the attributes from file, this is safe to call from multiple
+	/// threads once the file has been parsed.
 	void load() const;
 
+	/// Releases the attributes read from file, unless they have been accessed
+	/// since the previous attempt. They are read again on the next access.
+	/// Only applies to instances loaded while the file has a memory budget.
+	/// The released attributes are not freed, but handed over in attributes,
+	/// as threads that hold an IfcFile::attribute_lease may still read them.
+	release_status release_attributes(Argument**& attributes) const;
+
 	IfcEntityInstanceData(const IfcEntityInstanceData& e);
 
 	virtual ~IfcEntityInstanceData();
@@ -89,9 +116,21 @@ public:
 	std::string toString(bool upper = false) const;
 
 	unsigned int id() const { return id_; }
-	unsigned int offset_in_file() const { return offset_in_file_; }
+	size_t offset_in_file() const { return offset_in_file_; }
+
+	/// Returns whether attributes have been assigned since the instance was
+	/// read from file, including to the typed values nested in its attributes.
+	/// Nested values are only inspected when the attributes are loaded, which
+	/// is sufficient because values can only be assigned to loaded
+	/// attributes and modified instances are not evicted.
+	bool modified() const;
 
 	// NB: const ommitted for lazy loading
+	/// Other than by the parsers, attributes are to be assigned through
+	/// setArgument() only, never by writing to this array directly. Besides
+	/// maintaining the inverse references, setArgument() marks the instance
+	/// as modified, which IfcFile::write() relies on to decide whether the
+	/// text of the instance can be copied from the original file.
 	Argument**& attributes() const { return attributes_; }
 
 	unsigned set_id(boost::optional<unsigned> i = boost::none);
@@ -20,9 +20,13 @@
 #ifndef IFCFILE_H
 #define IFCFILE_H
 
+#include <deque>
 #include <map>
+#include <tuple>
 #include <set>
 #include <iterator>
+#include <memory>
+#include <mutex>
 
 #include <boost/unordered_map.hpp>
 #include <boost/multi_index_container.hpp>
@@ -33,6 +37,11 @@
 #include "ifc_parse_api.h"
 
 #include "../ifcparse/IfcParse.h"
+#include "../ifcparse/IfcArena.h"
+#include "../ifcparse/IfcAttributeIndex.h"
+#include "../ifcparse/IfcInstanceMap.h"
+#include "../ifcparse/IfcInverseIndex.h"
+#include "../ifcparse/IfcGuidMap.h"
 #include "../ifcparse/IfcSpfHeader.h"
 #include "../ifcparse/IfcSchema.h"
 
@@ -68,17 +77,47 @@ public:
 	}
 };
 
+/// Summary of an IFC-SPF file obtained by IfcFile::probe() without
+/// creating entity instances
+struct IFC_PARSE_API file_probe {
+	file_open_status status = file_open_status::READ_ERROR;
+	/// The size of the (decompressed) file contents in bytes. For compressed
+	/// files 0, unless stored in the zip archive or with statistics.
+	size_t size = 0;
+
+	std::vector<std::string> description;
+	std::string implementation_level;
+	std::string name;
+	std::string time_stamp;
+	std::vector<std::string> author;
+	std::vector<std::string> organization;
+	std::string preprocessor_version;
+	std::string originating_system;
+	std::string authorization;
+	std::vector<std::string> schema_identifiers;
+
+	/// Whether the statistics below have been gathered. These are
+	/// approximate, as the instances are not validated.
+	bool has_statistics = false;
+	size_t instance_count = 0;
+	unsigned int max_id = 0;
+	/// The number of instances by upper case entity keyword
+	std::map<std::string, size_t> entity_counts;
+};
+
 /// This class provides several static convenience functions and variables
 /// and provide access to the entities in an IFC file
 class IFC_PARSE_API IfcFile {
 public:
 	typedef std::map<const IfcParse::declaration*, aggregate_of_instance::ptr> entities_by_type_t;
-	typedef boost::unordered_map<unsigned int, IfcUtil::IfcBaseClass*> entity_by_id_t;
+	typedef IfcParse::instance_by_id_map entity_by_id_t;
 	typedef boost::unordered_map<uint32_t, IfcUtil::IfcBaseClass*> entity_by_iden_t;
-	typedef std::map<std::string, IfcUtil::IfcBaseClass*> entity_by_guid_t;
+	typedef IfcParse::instance_by_guid_map entity_by_guid_t;
+	typedef IfcParse::inverse_index entities_by_ref_t;
+	// No longer used by IfcFile, inverses are stored in entities_by_ref_t.
+	// Retained for source compatibility of code that refers to them.
 	typedef std::tuple<int, int, int> inverse_attr_record;
 	enum INVERSE_ATTR { INSTANCE_ID, INSTANCE_TYPE, ATTRIBUTE_INDEX };
-	typedef std::map<inverse_attr_record, std::vector<int> > entities_by_ref_t;
 	typedef std::map<int, std::vector<int> > entities_by_ref_excl_t;
 	typedef std::map<unsigned int, aggregate_of_instance::ptr> ref_map_t;
 	typedef entity_by_id_t::const_iterator const_iterator;
@@ -122,6 +161,41 @@ public:
 	static bool guid_map() { return guid_map_; }
 	static void guid_map(bool b) { guid_map_ = b; }
 
+	/// When enabled, files opened by filename use an index stored next to the
+	/// file (with an .idx suffix) to skip scanning the file when it has not
+	/// changed since the index was written. The index is (re)written otherwise.
+	/// Changes are detected by the size and modification time of the file and
+	/// a hash of samples of its contents, not by reading the file as a whole.
+	static bool persistent_index_;
+	static bool persistent_index() { return persistent_index_; }
+	static void persistent_index(bool b) { persistent_index_ = b; }
+
+	/// A lexer with its own cursor into the file contents, used by a thread
+	/// to load instances once parsing is complete.
+	struct instance_reader {
+		IfcParse::IfcSpfStream stream;
+		IfcParse::IfcSpfLexer lexer;
+		std::vector<Argument*> attribute_vector, attribute_vector_simple_type;
+		IfcParse::arena::cursor allocator;
+		explicit instance_reader(IfcFile* file);
+	};
+
+	/// Keeps the arguments of the instances of a file valid while it exists.
+	/// Attributes released to meet the memory budget of the file are only
+	/// freed once every lease that existed at the time has ended, so that
+	/// threads holding a lease can keep reading arguments while other
+	/// threads load instances. Leases can be nested. Constructing one for a
+	/// null file has no effect.
+	class IFC_PARSE_API attribute_lease {
+		const IfcFile* file_;
+		size_t epoch_;
+	public:
+		explicit attribute_lease(const IfcFile* file);
+		~attribute_lease();
+		attribute_lease(const attribute_lease&) = delete;
+		attribute_lease& operator=(const attribute_lease&) = delete;
+	};
+
 private:
 	typedef std::map<uint32_t, IfcUtil::IfcBaseClass*> entity_entity_map_t;
 
@@ -133,13 +207,16 @@ private:
 
 	std::vector<Argument*> internal_attribute_vector_, internal_attribute_vector_simple_type_;
 
+	// Holds the attributes parsed from file, needs to outlive the instances
+	IfcParse::arena arena_;
+	IfcParse::arena::cursor arena_cursor_{ &arena_ };
+
 	entity_by_id_t byid;
 	// this is for simple types
 	entity_by_iden_t byidentity;
 	entities_by_type_t bytype;
 	entities_by_type_t bytype_excl;
 	entities_by_ref_t byref;
-	entities_by_ref_excl_t byref_excl;
 	entity_by_guid_t byguid;
 	entity_entity_map_t entity_file_map;
 
@@ -147,12 +224,88 @@ private:
 
 	IfcSpfHeader _header;
 
+	// The name of the file this instance was read from, if any
+	std::string filename_;
+
+	// When not empty, only the instances of these types and the instances
+	// they refer to are loaded
+	std::vector<std::string> root_types_;
+
+	// Readers for lazily loading instances, created on demand when threads
+	// load concurrently. Not freed before the file is, as tokens refer to them.
+	std::vector<std::unique_ptr<instance_reader>> readers_;
+	std::vector<instance_reader*> idle_readers_;
+	std::mutex readers_mutex_;
+	// Serializes modifications of the file made while loading instances
+	std::mutex load_mutex_;
+
+	// Instances loaded while a memory budget is set, which have their
+	// attributes allocated individually so that they can be released
+	struct resident_instance {
+		unsigned id;
+		const IfcEntityInstanceData* data;
+		size_t bytes;
+	};
+	std::vector<resident_instance> resident_;
+	size_t resident_hand_ = 0;
+	size_t resident_bytes_ = 0;
+	size_t memory_budget_ = 0;
+	mutable std::mutex resident_mutex_;
+
+	// Released attributes that are freed once the leases that existed when
+	// they were released have ended. Every release that is deferred starts
+	// a new epoch, leases record the epoch in which they were acquired.
+	struct retired_attributes {
+		Argument** attributes;
+		size_t count;
+		size_t bytes;
+		size_t epoch;
+	};
+	std::deque<retired_attributes> retired_;
+	size_t retired_bytes_ = 0;
+	mutable size_t attribute_epoch_ = 0;
+	mutable std::multiset<size_t> lease_epochs_;
+
+	/// Releases attributes of resident instances other than keep until the
+	/// memory budget is met, using a second chance approximation of least
+	/// recently used
+	void release_resident_(const IfcEntityInstanceData* keep = nullptr);
+	/// Frees the retired attributes no longer reachable by any lease
+	void free_retired_();
+
 	void setDefaultHeaderValues();
 
-	void initialize_(IfcParse::IfcSpfStream* f);
+	// When set, initialize_() only reads the header
+	bool header_only_ = false;
+	struct header_only_t {};
+	IfcFile(const std::string& fn, header_only_t);
+
+	void initialize_(IfcParse::IfcSpfStream* f, unsigned int threads);
+
+	/// Scans the DATA section using multiple threads, each operating on a
+	/// separate section of the stream buffer. Results are merged in file order.
+	/// Returns false when the file is too small to be split.
+	bool scan_parallel_(unsigned int threads);
+
+	/// Scans the DATA section and only adds the instances of root_types_ and
+	/// their forward-reference closure to the file
+	void scan_partial_(unsigned int threads);
+
+	/// Loads the attributes of all instances, used when lazy loading is disabled
+	void load_scanned_instances_();
+
+	/// Adds an instance encountered while scanning the file to the maps by id and type
+	void add_scanned_instance_(IfcUtil::IfcBaseClass* instance);
+
+	/// Populates the file from the persistent index, returns false when the
+	/// index is not present or does not match the file contents.
+	bool read_index_();
+	void write_index_();
 
 	void build_inverses_(IfcUtil::IfcBaseClass*);
 
+	size_t load_(unsigned entity_instance_name, const IfcParse::entity* entity, Argument**& attributes, size_t num_attributes, int attribute_index, IfcParse::arena::cursor* allocator);
+
 	typedef boost::multi_index_container<
 		int,
 		boost::multi_index::indexed_by<
@@ -166,24 +319,59 @@ private:
 	bool batch_mode_ = false;
 	void process_deletion_();
 
+	// Indices of the values of an attribute of the instances of an entity
+	// type (including subtypes), built on first use. The generation is
+	// incremented on every invalidation, so that an index that was being
+	// built concurrently with a modification is not retained.
+	typedef std::map<std::pair<const IfcParse::entity*, size_t>, std::shared_ptr<const attribute_value_index>> attribute_indices_t;
+	attribute_indices_t attribute_indices_;
+	size_t attribute_indices_generation_ = 0;
+	std::mutex attribute_indices_mutex_;
+	std::shared_ptr<const attribute_value_index> attribute_index_(const IfcParse::entity* type, size_t attribute_index);
+	std::shared_ptr<const attribute_value_index> attribute_index_(const std::string& type, const std::string& attribute);
+
 public:
 	IfcParse::IfcSpfLexer* tokens;
 	IfcParse::IfcSpfStream* stream;
 	
+	/// The threads argument specifies the number of threads used to scan the
+	/// DATA section of the file for entity instances and references. Small
+	/// files are always scanned by a single thread.
 #ifdef USE_MMAP
-	IfcFile(const std::string& fn, bool mmap = false);
+	IfcFile(const std::string& fn, bool mmap = false, unsigned int threads = 1);
 #else
-	IfcFile(const std::string& fn);
+	IfcFile(const std::string& fn, unsigned int threads = 1);
 #endif
-	IfcFile(std::istream& fn, int len);
-	IfcFile(void* data, int len);
-	IfcFile(IfcParse::IfcSpfStream* f);
+	/// Only loads the instances of the entity types in root_types (including
+	/// subtypes) and the instances they refer to, directly or indirectly.
+	/// Other instances are skipped and are not available from the file, also
+	/// not as inverses of the instances loaded. Only the offsets, ids and
+	/// types of the instances and their references are kept while scanning,
+	/// the ones outside of the closure are released before the instances
+	/// are created. Use mmap to avoid reading the file into memory.
+#ifdef USE_MMAP
+	IfcFile(const std::string& fn, const std::vector<std::string>& root_types, bool mmap = false, unsigned int threads = 1);
+#else
+	IfcFile(const std::string& fn, const std::vector<std::string>& root_types, unsigned int threads = 1);
+#endif
+	IfcFile(std::istream& fn, size_t len, unsigned int threads = 1);
+	IfcFile(void* data, size_t len, unsigned int threads = 1);
+	IfcFile(IfcParse::IfcSpfStream* f, unsigned int threads = 1);
+	IfcFile(IfcParse::IfcSpfStream* f, const std::vector<std::string>& root_types, unsigned int threads = 1);
 	IfcFile(const IfcParse::schema_definition* schema = IfcParse::schema_by_name("IFC4"));
 
 	/// Deleting the file will also delete all new instances that were added to the file (via memory allocation)
 	virtual ~IfcFile();
 
-	file_open_status good() const { return good_; }
+	/// Reads the header of the file at fn, and when statistics is set also
+	/// counts the entity instances by keyword in a single pass over the
+	/// file contents. No instances are created, so this is considerably
+	/// faster than opening the file, also for unsupported schemas.
+	static file_probe probe(const std::string& fn, bool statistics = false);
+
+	/// Returns READ_ERROR as well when reading the file contents failed
+	/// while they were parsed, e.g. when the file was truncated
+	file_open_status good() const;
 	
 	/// Returns the first entity in the file, this probably is the entity
 	/// with the lowest id (EXPRESS ENTITY_INSTANCE_NAME)
@@ -221,6 +409,20 @@ public:
 		}
 	}
 
+	/// Same as instances_by_type<T>() but returns a view of the list
+	/// maintained by the file instead of a copy, see typed_range.
+	template <class T>
+	typed_range<T> instances_by_type_range() {
+		return typed_range<T>(instances_by_type(&T::Class()));
+	}
+
+	/// Same as instances_by_type_excl_subtypes<T>() but returns a view of
+	/// the list maintained by the file instead of a copy, see typed_range.
+	template <class T>
+	typed_range<T> instances_by_type_excl_subtypes_range() {
+		return typed_range<T>(instances_by_type_excl_subtypes(&T::Class()));
+	}
+
 	/// Returns all entities in the file that match the positional argument.
 	/// NOTE: This also returns subtypes of the requested type, for example:
 	/// IfcWall will also return IfcWallStandardCase entities
@@ -240,6 +442,24 @@ public:
 	/// Returns all entities in the file that reference the id
 	aggregate_of_instance::ptr instances_by_reference(int id);
 
+	/// Returns the instances of type, including subtypes, of which the
+	/// attribute at attribute_index equals value. The first lookup builds an
+	/// index of the values of the attribute, which is used for subsequent
+	/// lookups until instances of the type are modified, added or removed.
+	aggregate_of_instance::ptr instances_by_attribute_value(const IfcParse::entity* type, size_t attribute_index, const attribute_value& value);
+	aggregate_of_instance::ptr instances_by_attribute_value(const std::string& type, const std::string& attribute, const attribute_value& value);
+
+	/// Same as instances_by_attribute_value(), for the instances of which the
+	/// attribute is a string or enumeration value that starts with prefix
+	aggregate_of_instance::ptr instances_by_attribute_prefix(const IfcParse::entity* type, size_t attribute_index, const std::string& prefix);
+	aggregate_of_instance::ptr instances_by_attribute_prefix(const std::string& type, const std::string& attribute, const std::string& prefix);
+
+	/// Discards the attribute value indices that can contain instances of
+	/// type, only those of attribute_index unless it is -1. Called when
+	/// instances are modified, added or removed. Typed values discard all
+	/// indices, as they can be the value of any attribute.
+	void invalidate_attribute_indices(const IfcParse::declaration* type, int attribute_index = -1);
+
 	/// Returns the entity with the specified id
 	IfcUtil::IfcBaseClass* instance_by_id(int id);
 
@@ -255,10 +475,23 @@ public:
 	/// breadth-first search
 	aggregate_of_instance::ptr traverse_breadth_first(IfcUtil::IfcBaseClass* instance, int max_level=-1);
 
+	/// Same as traverse() for multiple instances, returning the union of
+	/// their closures without duplicates
+	aggregate_of_instance::ptr traverse_many(const aggregate_of_instance::ptr& roots, int max_level=-1);
+
 	/// Get the attribute indices corresponding to the list of entity instances
 	/// returned by getInverse().
 	std::vector<int> get_inverse_indices(int instance_id);
 
+	/// Returns the instances of type, including subtypes, that refer to
+	/// instance_id through the attribute at attribute_index, or through any
+	/// attribute when attribute_index is -1. Without an attribute index the
+	/// instances are ordered by the index of the attribute through which
+	/// they refer, and otherwise in the order in which the references were
+	/// read or assigned. Instances referring more than once are repeated.
+	/// Without a type and attribute index, the instances referring to
+	/// instance_id are returned in the order in which the references were
+	/// read or assigned, as by instances_by_reference().
 	aggregate_of_instance::ptr getInverse(int instance_id, const IfcParse::declaration* type, int attribute_index);
 	
 	int getTotalInverses(int instance_id);
@@ -272,6 +505,9 @@ public:
 
 	unsigned int getMaxId() const { return MaxId; }
 
+	/// Returns the number of entity instances in the file
+	size_t instance_count() const { return byid.size(); }
+
 	const IfcParse::declaration* ifcroot_type() const { return ifcroot_type_; }
 
 	void recalculate_id_counter();
@@ -298,12 +534,50 @@ public:
 
 	std::string createTimestamp() const;
 
+	/// Writes the file as IFC-SPF. Instances are formatted by the given
+	/// number of threads in blocks of consecutive names, which are written
+	/// in order.
+	void write(std::ostream& os, unsigned int threads = 1) const;
+	/// Writes the file as IFC-SPF to the file at path, throws an IfcException
+	/// when it cannot be written.
+	void write(const std::string& path, unsigned int threads = 1) const;
+
+	instance_reader* acquire_reader();
+	void release_reader(instance_reader*);
+
+	/// Reads attributes from the current token onwards. When attributes is
+	/// not preallocated, the arguments and array are allocated from the arena
+	/// of the file, or from the heap when a memory budget is set.
 	size_t load(unsigned entity_instance_name, const IfcParse::entity* entity, Argument**& attributes, size_t num_attributes, int attribute_index=-1);
+	/// Returns whether p is allocated from the arena for parsed attributes
+	bool in_arena(const void* p) const { return arena_.owns(p); }
+	/// Returns a block of size bytes that is released together with the
+	/// arena for parsed attributes. Can be called from any thread.
+	char* allocate_arena_block(size_t size) { return arena_.allocate_block(size); }
+
+	/// Limits the memory used by the attributes of lazily loaded instances to
+	/// approximately bytes, 0 (the default) for no limit. When exceeded, the
+	/// attributes of unmodified instances that have not been accessed
+	/// recently are released and read again from file on their next access.
+	/// This does not apply to instances loaded before the budget is set or
+	/// to instances with nested typed values, e.g. IFCLABEL('...'). With a
+	/// budget set, arguments obtained from an instance are only guaranteed
+	/// to remain valid while loading other instances when an attribute_lease
+	/// is held, and threads that access instances concurrently need to
+	/// hold one. write() takes leases of its own.
+	void memory_budget(size_t bytes);
+	size_t memory_budget() const { return memory_budget_; }
+	/// Returns the number of bytes of attributes that can be released,
+	/// including released attributes not yet freed because of leases
+	size_t memory_usage() const;
+	/// Registers an instance loaded while a memory budget is set
+	void add_resident(const IfcEntityInstanceData& data, size_t bytes);
 	void seek_to(const IfcEntityInstanceData& data);
 	void try_read_semicolon();
 
 	void register_inverse(unsigned, const IfcParse::entity* from_entity, Token, int attribute_index);
 	void register_inverse(unsigned, const IfcParse::entity* from_entity, IfcUtil::IfcBaseClass*, int attribute_index);
+	void register_inverse(unsigned, const IfcParse::entity* from_entity, int id_to, int attribute_index);
 	void unregister_inverse(unsigned, const IfcParse::entity* from_entity, IfcUtil::IfcBaseClass*, int attribute_index);
     
 	const IfcParse::schema_definition* schema() const { return schema_; }
@@ -82,6 +82,24 @@ void expand(const std::string& s, std::vector<unsigned char>& v) {
 	}
 }
 
+namespace {
+	// Maps characters to their value in the base64 alphabet above, or -1
+	struct base64_table {
+		signed char values[256];
+		base64_table() {
+			std::fill(values, values + 256, (signed char) -1);
+			for (int i = 0; i < 64; ++i) {
+				values[(unsigned char) chars[i]] = (signed char) i;
+			}
+		}
+	};
+
+	const base64_table& decoding_table() {
+		static const base64_table table;
+		return table;
+	}
+}
+
 // A random number generator for the UUID
 static boost::uuids::basic_random_generator<boost::mt19937> gen;
 
@@ -138,3 +156,38 @@ IfcParse::IfcGlobalId::operator const boost::uuids::uuid&() const {
 const std::string& IfcParse::IfcGlobalId::formatted() const {
 	return formatted_string;
 }
+
+bool IfcParse::IfcGlobalId::decode(const char* s, size_t n, boost::uuids::uuid& uuid) {
+	if (n != length) {
+		return false;
+	}
+	const signed char* values = decoding_table().values;
+	unsigned v[length];
+	for (unsigned i = 0; i < length; ++i) {
+		const signed char c = values[(unsigned char) s[i]];
+		if (c < 0) {
+			return false;
+		}
+		v[i] = (unsigned) c;
+	}
+	// The first two characters encode a single byte, larger values would not
+	// survive a round trip through the binary form.
+	if (v[0] > 3) {
+		return false;
+	}
+	uuid.data[0] = (unsigned char) ((v[0] << 6) | v[1]);
+	for (unsigned i = 0; i < 5; ++i) {
+		const unsigned* w = v + 2 + 4 * i;
+		const unsigned d = (w[0] << 18) | (w[1] << 12) | (w[2] << 6) | w[3];
+		uuid.data[1 + 3 * i] = (unsigned char) (d >> 16);
+		uuid.data[2 + 3 * i] = (unsigned char) (d >> 8);
+		uuid.data[3 + 3 * i] = (unsigned char) d;
+	}
+	return true;
+}
+
+std::string IfcParse::IfcGlobalId::encode(const boost::uuids::uuid& uuid) {
+	unsigned char v[16];
+	std::copy(uuid.begin(), uuid.end(), v);
+	return compress(v);
+}
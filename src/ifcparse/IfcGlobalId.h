@@ -39,6 +39,12 @@ namespace IfcParse {
 		operator const std::string&() const;
 		operator const boost::uuids::uuid&() const;
 		const std::string& formatted() const;
+
+		/// Decodes the compressed GlobalId of n characters at s into its binary
+		/// form. Returns false if s is not a valid compressed GlobalId.
+		static bool decode(const char* s, size_t n, boost::uuids::uuid& uuid);
+		/// Returns the compressed GlobalId for its binary form
+		static std::string encode(const boost::uuids::uuid& uuid);
 	};
 
 }
@@ -0,0 +1,147 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcGuidMap.h"
+#include "../ifcparse/IfcGlobalId.h"
+
+#include <cstdint>
+#include <cstring>
+
+using namespace IfcParse;
+
+const size_t instance_by_guid_map::min_slots;
+
+size_t instance_by_guid_map::home_(const boost::uuids::uuid& guid) const {
+	// GlobalIds are not necessarily random, some applications number them
+	// sequentially, so mix all bytes into the slot index.
+	uint64_t lo, hi;
+	std::memcpy(&lo, guid.data, 8);
+	std::memcpy(&hi, guid.data + 8, 8);
+	uint64_t h = (lo ^ (hi * 0x9E3779B97F4A7C15ULL)) * 0xC2B2AE3D27D4EB4FULL;
+	h ^= h >> 32;
+	return (size_t) h & (slots_.size() - 1);
+}
+
+size_t instance_by_guid_map::find_(const boost::uuids::uuid& guid) const {
+	if (slots_.empty()) {
+		return slots_.size();
+	}
+	const size_t mask = slots_.size() - 1;
+	for (size_t i = home_(guid);; i = (i + 1) & mask) {
+		const slot& s = slots_[i];
+		if (s.instance == nullptr) {
+			return slots_.size();
+		}
+		if (s.guid == guid) {
+			return i;
+		}
+	}
+}
+
+void instance_by_guid_map::rehash_(size_t num_slots) {
+	std::vector<slot> old;
+	old.swap(slots_);
+	slots_.resize(num_slots, slot{ boost::uuids::uuid(), nullptr });
+	const size_t mask = num_slots - 1;
+	for (auto& s : old) {
+		if (s.instance) {
+			size_t i = home_(s.guid);
+			while (slots_[i].instance) {
+				i = (i + 1) & mask;
+			}
+			slots_[i] = s;
+		}
+	}
+}
+
+instance_by_guid_map::mapped_type instance_by_guid_map::get(const boost::uuids::uuid& guid) const {
+	const size_t i = find_(guid);
+	return i == slots_.size() ? nullptr : slots_[i].instance;
+}
+
+instance_by_guid_map::mapped_type instance_by_guid_map::get(const std::string& guid) const {
+	boost::uuids::uuid binary;
+	if (IfcGlobalId::decode(guid.data(), guid.size(), binary)) {
+		return get(binary);
+	}
+	auto it = text_.find(guid);
+	return it == text_.end() ? nullptr : it->second;
+}
+
+void instance_by_guid_map::insert_or_assign(const boost::uuids::uuid& guid, mapped_type instance) {
+	// Keep the load factor below three quarters
+	if ((size_ + 1) * 4 > slots_.size() * 3) {
+		rehash_(slots_.empty() ? min_slots : slots_.size() * 2);
+	}
+	const size_t mask = slots_.size() - 1;
+	size_t i = home_(guid);
+	for (; slots_[i].instance; i = (i + 1) & mask) {
+		if (slots_[i].guid == guid) {
+			slots_[i].instance = instance;
+			return;
+		}
+	}
+	slots_[i].guid = guid;
+	slots_[i].instance = instance;
+	++size_;
+}
+
+void instance_by_guid_map::insert_or_assign(const std::string& guid, mapped_type instance) {
+	boost::uuids::uuid binary;
+	if (IfcGlobalId::decode(guid.data(), guid.size(), binary)) {
+		insert_or_assign(binary, instance);
+	} else {
+		text_[guid] = instance;
+	}
+}
+
+size_t instance_by_guid_map::erase(const boost::uuids::uuid& guid) {
+	size_t i = find_(guid);
+	if (i == slots_.size()) {
+		return 0;
+	}
+	// Shift subsequent slots of the probe sequence back, so that lookups do
+	// not need to step over removed slots.
+	const size_t mask = slots_.size() - 1;
+	for (size_t j = (i + 1) & mask; slots_[j].instance; j = (j + 1) & mask) {
+		const size_t k = home_(slots_[j].guid);
+		const bool movable = (i <= j) ? (k <= i || k > j) : (k <= i && k > j);
+		if (movable) {
+			slots_[i] = slots_[j];
+			i = j;
+		}
+	}
+	slots_[i].instance = nullptr;
+	--size_;
+	return 1;
+}
+
+size_t instance_by_guid_map::erase(const std::string& guid) {
+	boost::uuids::uuid binary;
+	if (IfcGlobalId::decode(guid.data(), guid.size(), binary)) {
+		return erase(binary);
+	}
+	return text_.erase(guid);
+}
+
+void instance_by_guid_map::clear() {
+	std::vector<slot>().swap(slots_);
+	size_ = 0;
+	text_.clear();
+}
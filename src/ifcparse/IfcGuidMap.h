@@ -0,0 +1,108 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Maps GlobalIds to instances. GlobalIds are stored in their 16 byte binary    *
+* form in an open addressing hash table. GlobalIds that are not valid          *
+* compressed GUIDs are rare and kept by their text in an ordered map instead.  *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCGUIDMAP_H
+#define IFCGUIDMAP_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/uuid/uuid.hpp>
+
+#include "ifc_parse_api.h"
+
+namespace IfcUtil {
+	class IfcBaseClass;
+}
+
+namespace IfcParse {
+
+	class IFC_PARSE_API instance_by_guid_map {
+	public:
+		typedef IfcUtil::IfcBaseClass* mapped_type;
+		typedef std::map<std::string, mapped_type> text_map_t;
+
+	private:
+		struct slot {
+			boost::uuids::uuid guid;
+			// nullptr for slots that are not in use
+			mapped_type instance;
+		};
+
+		// Linear probing in a power of two number of slots
+		std::vector<slot> slots_;
+		size_t size_;
+
+		// GlobalIds that have no binary form
+		text_map_t text_;
+
+		static const size_t min_slots = 64;
+
+		size_t home_(const boost::uuids::uuid& guid) const;
+		size_t find_(const boost::uuids::uuid& guid) const;
+		void rehash_(size_t num_slots);
+
+	public:
+		instance_by_guid_map()
+			: size_(0)
+		{}
+
+		/// Returns the instance with GlobalId guid, or nullptr
+		mapped_type get(const boost::uuids::uuid& guid) const;
+		mapped_type get(const std::string& guid) const;
+
+		/// Sets the instance with GlobalId guid, instance should not be nullptr
+		void insert_or_assign(const boost::uuids::uuid& guid, mapped_type instance);
+		void insert_or_assign(const std::string& guid, mapped_type instance);
+
+		size_t erase(const boost::uuids::uuid& guid);
+		size_t erase(const std::string& guid);
+
+		size_t size() const { return size_ + text_.size(); }
+		bool empty() const { return size() == 0; }
+		void clear();
+
+		/// Calls fn(guid, instance) for the GlobalIds stored in binary form,
+		/// in no particular order
+		template <typename Fn>
+		void for_each(Fn fn) const {
+			for (auto& s : slots_) {
+				if (s.instance) {
+					fn(s.guid, s.instance);
+				}
+			}
+		}
+
+		/// Returns the GlobalIds that are stored by their text
+		const text_map_t& text_entries() const { return text_; }
+	};
+
+}
+
+#endif
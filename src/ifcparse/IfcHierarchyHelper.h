@@ -382,9 +382,9 @@ public:
 
 	template <class T>
 	T* getSingle() {
-		typename T::list::ptr ts = instances_by_type<T>();
-		if (ts->size() != 1) return 0;
-		return *ts->begin();
+		typed_range<T> ts = instances_by_type_range<T>();
+		if (ts.size() != 1) return 0;
+		return *ts.begin();
 	}
 	
 	typename Schema::IfcAxis2Placement3D* addPlacement3d(double ox=0.0, double oy=0.0, double oz=0.0,
@@ -403,10 +403,8 @@ public:
 	void addRelatedObject(typename Schema::IfcObjectDefinition* relating_object, 
 		typename Schema::IfcObjectDefinition* related_object, typename Schema::IfcOwnerHistory* owner_hist = 0)
 	{
-		typename T::list::ptr li = instances_by_type<T>();
 		bool found = false;
-		for (typename T::list::it i = li->begin(); i != li->end(); ++i) {
-			T* rel = *i;
+		for (T* rel : instances_by_type_range<T>()) {
             try {
                 if (get_parent_of_relation(rel) == relating_object) {
                     aggregate_of_instance::ptr products = get_children_of_relation(rel);
@@ -601,10 +599,8 @@ template <>
 inline void IfcHierarchyHelper::addRelatedObject <typename Schema::IfcRelContainedInSpatialStructure> (typename Schema::IfcObjectDefinition* relating_structure, 
 	typename Schema::IfcObjectDefinition* related_object, typename Schema::IfcOwnerHistory* owner_hist)
 {
-	typename Schema::IfcRelContainedInSpatialStructure::list::ptr li = instances_by_type<typename Schema::IfcRelContainedInSpatialStructure>();
 	bool found = false;
-	for (typename Schema::IfcRelContainedInSpatialStructure::list::it i = li->begin(); i != li->end(); ++i) {
-		typename Schema::IfcRelContainedInSpatialStructure* rel = *i;
+	for (typename Schema::IfcRelContainedInSpatialStructure* rel : instances_by_type_range<typename Schema::IfcRelContainedInSpatialStructure>()) {
 		if (rel->RelatingStructure() == relating_structure) {
 			typename Schema::IfcProduct::list::ptr products = rel->RelatedElements();
 			products->push((typename Schema::IfcProduct*)related_object);
@@ -633,10 +629,8 @@ template <>
 inline void IfcHierarchyHelper::addRelatedObject <typename Schema::IfcRelDefinesByType> (typename Schema::IfcObjectDefinition* relating_type, 
 	typename Schema::IfcObjectDefinition* related_object, typename Schema::IfcOwnerHistory* owner_hist)
 {
-	typename Schema::IfcRelDefinesByType::list::ptr li = instances_by_type<typename Schema::IfcRelDefinesByType>();
 	bool found = false;
-	for (typename Schema::IfcRelDefinesByType::list::it i = li->begin(); i != li->end(); ++i) {
-		typename Schema::IfcRelDefinesByType* rel = *i;
+	for (typename Schema::IfcRelDefinesByType* rel : instances_by_type_range<typename Schema::IfcRelDefinesByType>()) {
 		if (rel->RelatingType() == relating_type) {
 			typename Schema::IfcObject::list::ptr objects = rel->RelatedObjects();
 			objects->push((typename Schema::IfcObject*)related_object);
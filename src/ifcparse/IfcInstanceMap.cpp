@@ -0,0 +1,125 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcInstanceMap.h"
+
+#include <algorithm>
+
+using namespace IfcParse;
+
+const size_t instance_by_id_map::min_dense_size;
+const size_t instance_by_id_map::max_dense_ratio;
+
+void instance_by_id_map::const_iterator::settle_() {
+	const auto& dense = map_->dense_;
+	while (index_ < dense.size() && dense[index_] == nullptr) {
+		++index_;
+	}
+	if (index_ < dense.size()) {
+		current_ = value_type((key_type) index_, dense[index_]);
+	} else if (sparse_it_ != map_->sparse_.end()) {
+		current_ = *sparse_it_;
+	}
+}
+
+instance_by_id_map::const_iterator& instance_by_id_map::const_iterator::operator++() {
+	if (index_ < map_->dense_.size()) {
+		++index_;
+	} else {
+		++sparse_it_;
+	}
+	settle_();
+	return *this;
+}
+
+instance_by_id_map::const_iterator instance_by_id_map::begin() const {
+	return const_iterator(this, 0, sparse_.begin());
+}
+
+instance_by_id_map::const_iterator instance_by_id_map::end() const {
+	return const_iterator(this, dense_.size(), sparse_.end());
+}
+
+instance_by_id_map::const_iterator instance_by_id_map::find(key_type id) const {
+	if (id < dense_.size()) {
+		if (dense_[id]) {
+			return const_iterator(this, id, sparse_.begin());
+		}
+		return end();
+	}
+	return const_iterator(this, dense_.size(), sparse_.find(id));
+}
+
+void instance_by_id_map::grow_(key_type id) {
+	// Grow geometrically, but never beyond what the number of instances
+	// justifies, names beyond that are stored in the sparse map.
+	const size_t limit = (std::max)(min_dense_size, max_dense_ratio * (size_ + 1));
+	if ((size_t) id >= limit) {
+		return;
+	}
+	const size_t new_size = (std::min)(limit, (std::max)((size_t) id + 1, dense_.size() * 2));
+	dense_.resize(new_size, nullptr);
+
+	// Move the names now covered by the table out of the sparse map
+	auto end = sparse_.lower_bound((key_type) (std::min)(new_size, (size_t) ~key_type(0)));
+	for (auto it = sparse_.begin(); it != end; ++it) {
+		dense_[it->first] = it->second;
+	}
+	sparse_.erase(sparse_.begin(), end);
+}
+
+void instance_by_id_map::insert_or_assign(key_type id, mapped_type instance) {
+	if (id >= dense_.size()) {
+		grow_(id);
+	}
+	if (id < dense_.size()) {
+		if (dense_[id] == nullptr) {
+			++size_;
+		}
+		dense_[id] = instance;
+	} else {
+		auto p = sparse_.insert({ id, instance });
+		if (p.second) {
+			++size_;
+		} else {
+			p.first->second = instance;
+		}
+	}
+}
+
+size_t instance_by_id_map::erase(key_type id) {
+	if (id < dense_.size()) {
+		if (dense_[id]) {
+			dense_[id] = nullptr;
+			--size_;
+			return 1;
+		}
+		return 0;
+	}
+	const size_t n = sparse_.erase(id);
+	size_ -= n;
+	return n;
+}
+
+void instance_by_id_map::clear() {
+	dense_.clear();
+	dense_.shrink_to_fit();
+	sparse_.clear();
+	size_ = 0;
+}
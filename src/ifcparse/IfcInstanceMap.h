@@ -0,0 +1,157 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Maps entity instance names to instances. Instance names in files are mostly  *
+* dense, so they are stored in a table indexed by name, with an ordered map    *
+* as a fallback for names that are far beyond the number of instances.        *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCINSTANCEMAP_H
+#define IFCINSTANCEMAP_H
+
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "ifc_parse_api.h"
+
+namespace IfcUtil {
+	class IfcBaseClass;
+}
+
+namespace IfcParse {
+
+	class IFC_PARSE_API instance_by_id_map {
+	public:
+		typedef unsigned int key_type;
+		typedef IfcUtil::IfcBaseClass* mapped_type;
+		typedef std::pair<key_type, mapped_type> value_type;
+
+	private:
+		typedef std::map<key_type, mapped_type> sparse_t;
+
+		// Instances by name, nullptr for names that are not in use
+		std::vector<mapped_type> dense_;
+		// Instances with a name beyond the end of dense_
+		sparse_t sparse_;
+		size_t size_;
+
+		// The minimal number of names covered by the table before its size is
+		// limited relative to the number of instances
+		static const size_t min_dense_size = 1 << 16;
+		// The table covers at most this many names per instance
+		static const size_t max_dense_ratio = 4;
+
+		void grow_(key_type id);
+
+	public:
+		/// Iterates over the instances in order of their name. Note that the
+		/// pair dereferenced is stored in the iterator itself.
+		class IFC_PARSE_API const_iterator {
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef instance_by_id_map::value_type value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const value_type* pointer;
+			typedef const value_type& reference;
+
+		private:
+			const instance_by_id_map* map_;
+			size_t index_;
+			sparse_t::const_iterator sparse_it_;
+			value_type current_;
+
+			friend class instance_by_id_map;
+
+			const_iterator(const instance_by_id_map* map, size_t index, sparse_t::const_iterator sparse_it)
+				: map_(map)
+				, index_(index)
+				, sparse_it_(sparse_it)
+				, current_(0, nullptr)
+			{
+				settle_();
+			}
+
+			// Skips unused names in the table and updates the current pair
+			void settle_();
+
+		public:
+			const_iterator()
+				: map_(nullptr)
+				, index_(0)
+				, current_(0, nullptr)
+			{}
+
+			reference operator*() const { return current_; }
+			pointer operator->() const { return &current_; }
+
+			const_iterator& operator++();
+			const_iterator operator++(int) {
+				const_iterator it = *this;
+				++(*this);
+				return it;
+			}
+
+			bool operator==(const const_iterator& other) const {
+				return index_ == other.index_ && sparse_it_ == other.sparse_it_;
+			}
+			bool operator!=(const const_iterator& other) const {
+				return !(*this == other);
+			}
+		};
+
+		typedef const_iterator iterator;
+
+		instance_by_id_map()
+			: size_(0)
+		{}
+
+		const_iterator begin() const;
+		const_iterator end() const;
+		const_iterator find(key_type id) const;
+
+		/// Returns the instance with the name id, or nullptr
+		mapped_type get(key_type id) const {
+			if (id < dense_.size()) {
+				return dense_[id];
+			}
+			auto it = sparse_.find(id);
+			return it == sparse_.end() ? nullptr : it->second;
+		}
+
+		size_t count(key_type id) const { return get(id) ? 1 : 0; }
+		size_t size() const { return size_; }
+		bool empty() const { return size_ == 0; }
+
+		/// Sets the instance with the name id, instance should not be nullptr
+		void insert_or_assign(key_type id, mapped_type instance);
+
+		size_t erase(key_type id);
+		void erase(const_iterator it) { erase(it->first); }
+		void clear();
+	};
+
+}
+
+#endif
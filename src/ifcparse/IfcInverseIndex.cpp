@@ -0,0 +1,246 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcInverseIndex.h"
+#include "../ifcparse/IfcException.h"
+
+#include <algorithm>
+
+using namespace IfcParse;
+
+const int32_t inverse_index::removed_attribute_index;
+const size_t inverse_index::min_direct_size;
+const size_t inverse_index::min_compact_size;
+
+bool inverse_index::range_(int32_t to, const reference*& begin, const reference*& end) const {
+	size_t i;
+	if (keys_.empty()) {
+		if (to < 0 || (size_t) to + 1 >= offsets_.size()) {
+			return false;
+		}
+		i = (size_t) to;
+	} else {
+		auto it = std::lower_bound(keys_.begin(), keys_.end(), to);
+		if (it == keys_.end() || *it != to) {
+			return false;
+		}
+		i = std::distance(keys_.begin(), it);
+	}
+	begin = references_.data() + offsets_[i];
+	end = references_.data() + offsets_[i + 1];
+	return begin != end;
+}
+
+bool inverse_index::range_(int32_t to, reference*& begin, reference*& end) {
+	const reference *cbegin, *cend;
+	if (!static_cast<const inverse_index*>(this)->range_(to, cbegin, cend)) {
+		return false;
+	}
+	begin = const_cast<reference*>(cbegin);
+	end = const_cast<reference*>(cend);
+	return true;
+}
+
+void inverse_index::add(int to, int from, int attribute_index) {
+	if (built_) {
+		overflow_[(int32_t) to].push_back({ (int32_t) from, (int32_t) attribute_index });
+	} else {
+		pending_.push_back({ (int32_t) to, { (int32_t) from, (int32_t) attribute_index } });
+	}
+}
+
+void inverse_index::build() {
+	if (built_ && overflow_.empty() && removed_ == 0) {
+		return;
+	}
+
+	std::vector<pending_reference> refs;
+	if (built_) {
+		// Repack the references added since the previous build, this also
+		// drops the references that have been removed in the meantime.
+		for_each([&refs](int to, const reference& r) {
+			refs.push_back({ (int32_t) to, r });
+		});
+	} else {
+		refs.swap(pending_);
+	}
+
+	if (refs.size() >= (size_t) std::numeric_limits<uint32_t>::max()) {
+		throw IfcException("Too many instance references");
+	}
+
+	int32_t min_to = 0, max_to = -1;
+	for (auto& r : refs) {
+		min_to = (std::min)(min_to, r.to);
+		max_to = (std::max)(max_to, r.to);
+	}
+
+	keys_.clear();
+	offsets_.clear();
+	references_.clear();
+	overflow_.clear();
+	removed_ = 0;
+	references_.resize(refs.size());
+
+	if (min_to >= 0 && (size_t) max_to < (std::max)(min_direct_size, 2 * refs.size())) {
+		// Offsets are indexed by name directly. This is a counting sort, which
+		// retains the order in which references to the same name were added.
+		offsets_.assign((size_t) max_to + 2, 0);
+		for (auto& r : refs) {
+			++offsets_[(size_t) r.to + 1];
+		}
+		for (size_t i = 1; i < offsets_.size(); ++i) {
+			offsets_[i] += offsets_[i - 1];
+		}
+		// Use the offsets as insertion cursors, afterwards every offset has
+		// moved to the start of the next name.
+		for (auto& r : refs) {
+			references_[offsets_[(size_t) r.to]++] = r.ref;
+		}
+		for (size_t i = offsets_.size() - 1; i > 0; --i) {
+			offsets_[i] = offsets_[i - 1];
+		}
+		offsets_[0] = 0;
+	} else {
+		// Names are too sparse for a table, offsets are stored along with a
+		// sorted array of names.
+		std::stable_sort(refs.begin(), refs.end(), [](const pending_reference& a, const pending_reference& b) {
+			return a.to < b.to;
+		});
+		for (size_t i = 0; i < refs.size(); ++i) {
+			if (i == 0 || refs[i].to != refs[i - 1].to) {
+				keys_.push_back(refs[i].to);
+				offsets_.push_back((uint32_t) i);
+			}
+			references_[i] = refs[i].ref;
+		}
+		offsets_.push_back((uint32_t) refs.size());
+		keys_.shrink_to_fit();
+		offsets_.shrink_to_fit();
+	}
+
+	built_ = true;
+}
+
+bool inverse_index::remove(int to, int from, int attribute_index) {
+	if (!built_) {
+		build();
+	}
+
+	reference *begin, *end;
+	if (range_((int32_t) to, begin, end)) {
+		for (auto it = begin; it != end; ++it) {
+			if (it->instance == from && it->attribute_index == attribute_index) {
+				it->attribute_index = removed_attribute_index;
+				++removed_;
+				compact_if_needed_();
+				return true;
+			}
+		}
+	}
+
+	auto it = overflow_.find((int32_t) to);
+	if (it != overflow_.end()) {
+		auto& refs = it->second;
+		for (auto jt = refs.begin(); jt != refs.end(); ++jt) {
+			if (jt->instance == from && jt->attribute_index == attribute_index) {
+				refs.erase(jt);
+				if (refs.empty()) {
+					overflow_.erase(it);
+				}
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void inverse_index::remove_referrer(int to, int from) {
+	if (!built_) {
+		build();
+	}
+
+	reference *begin, *end;
+	if (range_((int32_t) to, begin, end)) {
+		for (auto it = begin; it != end; ++it) {
+			if (it->instance == from && it->attribute_index != removed_attribute_index) {
+				it->attribute_index = removed_attribute_index;
+				++removed_;
+			}
+		}
+	}
+
+	auto it = overflow_.find((int32_t) to);
+	if (it != overflow_.end()) {
+		auto& refs = it->second;
+		refs.erase(std::remove_if(refs.begin(), refs.end(), [from](const reference& r) {
+			return r.instance == from;
+		}), refs.end());
+		if (refs.empty()) {
+			overflow_.erase(it);
+		}
+	}
+
+	compact_if_needed_();
+}
+
+void inverse_index::remove_instance(int to) {
+	if (!built_) {
+		build();
+	}
+
+	reference *begin, *end;
+	if (range_((int32_t) to, begin, end)) {
+		for (auto it = begin; it != end; ++it) {
+			if (it->attribute_index != removed_attribute_index) {
+				it->attribute_index = removed_attribute_index;
+				++removed_;
+			}
+		}
+	}
+
+	overflow_.erase((int32_t) to);
+
+	compact_if_needed_();
+}
+
+void inverse_index::compact_if_needed_() {
+	if (removed_ >= min_compact_size && removed_ * 4 >= references_.size()) {
+		build();
+	}
+}
+
+size_t inverse_index::count(int to) const {
+	size_t n = 0;
+	for_each(to, [&n](const reference&) {
+		++n;
+	});
+	return n;
+}
+
+void inverse_index::clear() {
+	std::vector<pending_reference>().swap(pending_);
+	std::vector<int32_t>().swap(keys_);
+	std::vector<uint32_t>().swap(offsets_);
+	std::vector<reference>().swap(references_);
+	overflow_.clear();
+	removed_ = 0;
+	built_ = false;
+}
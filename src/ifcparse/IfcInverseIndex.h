@@ -0,0 +1,205 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Stores for every entity instance name the instances that refer to it, along  *
+* with the attribute index through which they refer. References encountered   *
+* while scanning a file are packed into a compressed sparse row layout once    *
+* scanning is complete, references added afterwards are kept separately.      *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCINVERSEINDEX_H
+#define IFCINVERSEINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "ifc_parse_api.h"
+
+namespace IfcParse {
+
+	class IFC_PARSE_API inverse_index {
+	public:
+		/// A reference by the instance named `instance` through its attribute
+		/// at `attribute_index` (or the index within an aggregate for
+		/// references nested in aggregates of aggregates)
+		struct reference {
+			int32_t instance;
+			int32_t attribute_index;
+		};
+
+	private:
+		struct pending_reference {
+			int32_t to;
+			reference ref;
+		};
+
+		// Marks references in the packed array that have been removed
+		static const int32_t removed_attribute_index = std::numeric_limits<int32_t>::min();
+
+		// The minimal number of names covered by the offset table before its
+		// size is limited relative to the number of references
+		static const size_t min_direct_size = 1 << 16;
+
+		// The minimal number of removed references in the packed array
+		// before it is compacted, see compact_if_needed_()
+		static const size_t min_compact_size = 1 << 12;
+
+		// References added before build(), in order of addition
+		std::vector<pending_reference> pending_;
+
+		// References to the name keys_[i] (or i when keys_ is empty) are
+		// stored at references_[offsets_[i]] until references_[offsets_[i + 1]]
+		std::vector<int32_t> keys_;
+		std::vector<uint32_t> offsets_;
+		std::vector<reference> references_;
+
+		// References added after build(), by name referred to
+		std::map<int32_t, std::vector<reference> > overflow_;
+
+		bool built_;
+
+		// The number of removed references in the packed array
+		size_t removed_;
+
+		// Returns the packed references to name to, which may contain removed
+		// references, or an empty range
+		bool range_(int32_t to, const reference*& begin, const reference*& end) const;
+		bool range_(int32_t to, reference*& begin, reference*& end);
+
+		// Repacks the references when at least a quarter of the packed array
+		// consists of removed references, so that lookups and iteration do
+		// not keep skipping them after many deletions.
+		void compact_if_needed_();
+
+	public:
+		inverse_index()
+			: built_(false)
+			, removed_(0)
+		{}
+
+		/// Registers a reference from instance `from` to instance `to`
+		void add(int to, int from, int attribute_index);
+
+		/// Packs the references added so far, subsequent references are
+		/// stored in a separate area that is cheaper to update. Calling this
+		/// again repacks the references added and removed since.
+		void build();
+
+		/// Removes a single reference from `from` to `to` through attribute_index
+		bool remove(int to, int from, int attribute_index);
+		/// Removes all references from `from` to `to`
+		void remove_referrer(int to, int from);
+		/// Removes all references to `to`
+		void remove_instance(int to);
+
+		/// Removes all references for which fn(to, reference) returns true
+		template <typename Fn>
+		void remove_if(Fn fn) {
+			if (!built_) {
+				build();
+			}
+			for (size_t i = 0; i + 1 < offsets_.size(); ++i) {
+				const int32_t to = keys_.empty() ? (int32_t) i : keys_[i];
+				for (uint32_t j = offsets_[i]; j < offsets_[i + 1]; ++j) {
+					reference& r = references_[j];
+					if (r.attribute_index != removed_attribute_index && fn((int) to, r)) {
+						r.attribute_index = removed_attribute_index;
+						++removed_;
+					}
+				}
+			}
+			for (auto it = overflow_.begin(); it != overflow_.end();) {
+				auto& refs = it->second;
+				for (auto jt = refs.begin(); jt != refs.end();) {
+					if (fn((int) it->first, *jt)) {
+						jt = refs.erase(jt);
+					} else {
+						++jt;
+					}
+				}
+				if (refs.empty()) {
+					it = overflow_.erase(it);
+				} else {
+					++it;
+				}
+			}
+			compact_if_needed_();
+		}
+
+		/// Calls fn(reference) for the references to `to`, in order of addition
+		template <typename Fn>
+		void for_each(int to, Fn fn) const {
+			// Only while scanning, not expected to be queried frequently
+			for (auto& p : pending_) {
+				if (p.to == (int32_t) to) {
+					fn(p.ref);
+				}
+			}
+			const reference *begin, *end;
+			if (range_((int32_t) to, begin, end)) {
+				for (auto it = begin; it != end; ++it) {
+					if (it->attribute_index != removed_attribute_index) {
+						fn(*it);
+					}
+				}
+			}
+			auto it = overflow_.find((int32_t) to);
+			if (it != overflow_.end()) {
+				for (auto& r : it->second) {
+					fn(r);
+				}
+			}
+		}
+
+		/// Calls fn(to, reference) for all references
+		template <typename Fn>
+		void for_each(Fn fn) const {
+			for (auto& p : pending_) {
+				fn((int) p.to, p.ref);
+			}
+			for (size_t i = 0; i + 1 < offsets_.size(); ++i) {
+				const int32_t to = keys_.empty() ? (int32_t) i : keys_[i];
+				for (uint32_t j = offsets_[i]; j < offsets_[i + 1]; ++j) {
+					if (references_[j].attribute_index != removed_attribute_index) {
+						fn((int) to, references_[j]);
+					}
+				}
+			}
+			for (auto& p : overflow_) {
+				for (auto& r : p.second) {
+					fn((int) p.first, r);
+				}
+			}
+		}
+
+		/// Returns the number of references to `to`
+		size_t count(int to) const;
+
+		void clear();
+	};
+
+}
+
+#endif
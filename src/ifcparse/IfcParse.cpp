@@ -22,9 +22,11 @@
 #include "../ifcparse/IfcException.h"
 #include "../ifcparse/IfcBaseClass.h"
 #include "../ifcparse/IfcSpfStream.h"
+#include "../ifcparse/IfcSpfCompression.h"
 #include "../ifcparse/IfcFile.h"
 #include "../ifcparse/IfcSIPrefix.h"
 #include "../ifcparse/IfcSchema.h"
+#include "../ifcparse/IfcGlobalId.h"
 #include "../ifcparse/utils.h"
 
 #ifdef USE_MMAP
@@ -34,12 +36,22 @@
 #include <set>
 #include <ctime>
 #include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <limits>
 #include <string>
+#include <thread>
+#include <cfloat>
+#include <cctype>
+#include <cstring>
 #include <stdio.h>
 #include <stdlib.h>
 #include <algorithm>
 
 #include <boost/circular_buffer.hpp>
+#include <boost/unordered_set.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 
@@ -51,14 +63,14 @@ using namespace IfcParse;
 // in locales that have ',' as a decimal separator. Therefore the non standard _strtod_l() / 
 // strtod_l() is used and a reference to the "C" locale is obtained here. The alternative is 
 // to use std::istringstream::imbue(std::locale::classic()), but there are subtleties in 
-// parsing in MSVC2010 and it appears to be much slower. 
+// parsing in MSVC2010 and it appears to be much slower. Note that strtod_l() is only used
+// as a fallback for numbers that cannot be parsed exactly by ParseFloat() itself. The locale
+// is created once on first use.
 #if defined(_MSC_VER)
 
-static _locale_t locale = (_locale_t) 0;
-void init_locale() {
-	if (locale == (_locale_t) 0) {
-		locale = _create_locale(LC_NUMERIC, "C");
-	}
+static _locale_t get_locale() {
+	static _locale_t locale = _create_locale(LC_NUMERIC, "C");
+	return locale;
 }
 
 #else
@@ -68,9 +80,10 @@ void init_locale() {
 #include <sstream>
 
 typedef void* locale_t;
-static locale_t locale = (locale_t)0;
 
-void init_locale() {}
+static locale_t get_locale() {
+	return (locale_t)0;
+}
 
 double strtod_l(const char* start, char** end, locale_t loc) {
 	double d;
@@ -90,17 +103,103 @@ double strtod_l(const char* start, char** end, locale_t loc) {
 #endif
 #include <locale.h>
 
-static locale_t locale = (locale_t)0;
-void init_locale() {
-	if (locale == (locale_t)0) {
-		locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
-	}
+static locale_t get_locale() {
+	static locale_t locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+	return locale;
 }
 
 #endif
 
 #endif
 
+namespace {
+	// Files smaller than this are read synchronously
+	const size_t read_ahead_min_size = 8 << 20;
+	// Amount of data read at once by the read-ahead thread
+	const size_t read_ahead_block_size = 1 << 20;
+}
+
+class IfcSpfStream::read_ahead {
+private:
+	FILE* stream_;
+	char* buffer_;
+	const size_t len_;
+	std::atomic<size_t> read_;
+	std::atomic<bool> stop_;
+	std::atomic<bool> failed_;
+	std::mutex mutex_;
+	std::condition_variable cv_;
+	std::thread thread_;
+
+	void run() {
+		size_t read = 0;
+		while (read < len_ && !stop_.load(std::memory_order_relaxed)) {
+			const size_t n = fread(buffer_ + read, 1, (std::min)(read_ahead_block_size, len_ - read), stream_);
+			if (n == 0) {
+				// The file has been truncated or cannot be read. The failure is
+				// reported by IfcFile::good(), the remainder is only blanked so
+				// that the lexer does not read uninitialized memory and the
+				// threads waiting for the contents are released.
+				Logger::Error("Unable to read file contents at offset " + std::to_string(read));
+				failed_.store(true, std::memory_order_release);
+				memset(buffer_ + read, ' ', len_ - read);
+				read = len_;
+			} else {
+				read += n;
+			}
+			{
+				std::lock_guard<std::mutex> lk(mutex_);
+				read_.store(read, std::memory_order_release);
+			}
+			cv_.notify_all();
+		}
+		fclose(stream_);
+	}
+
+public:
+	read_ahead(FILE* stream, char* buffer, size_t len)
+		: stream_(stream)
+		, buffer_(buffer)
+		, len_(len)
+		, read_(0)
+		, stop_(false)
+		, failed_(false)
+		, thread_(&read_ahead::run, this)
+	{}
+
+	~read_ahead() {
+		stop_ = true;
+		thread_.join();
+	}
+
+	// Blocks until at least the first end bytes have been read, returns the
+	// number of bytes read
+	size_t wait(size_t end) {
+		size_t read = read_.load(std::memory_order_acquire);
+		if (read < end) {
+			std::unique_lock<std::mutex> lk(mutex_);
+			cv_.wait(lk, [this, end, &read]() {
+				return (read = read_.load(std::memory_order_acquire)) >= end;
+			});
+		}
+		return read;
+	}
+
+	bool failed() const {
+		return failed_.load(std::memory_order_acquire);
+	}
+};
+
+bool IfcSpfStream::read_error() const {
+	return read_error_ || (read_ahead_ && read_ahead_->failed()) || (compressed_ && compressed_->failed());
+}
+
+void IfcSpfStream::wait_(size_t end) const {
+	if (read_ahead_) {
+		available_.store(read_ahead_->wait((std::min)(end, len)), std::memory_order_release);
+	}
+}
+
 // 
 // Opens the file and gets the filesize
 //
@@ -111,6 +210,11 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 #endif
 	: stream(0)
 	, buffer(0)
+	, owns_buffer_(true)
+	, read_ahead_(nullptr)
+	, available_(0)
+	, block_begin_(0)
+	, block_end_(0)
 	, valid(false)
 	, eof(false)
 {
@@ -143,6 +247,17 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 #endif
 
 #ifdef USE_MMAP
+	if (mmap && mfs.is_open() && compression::detect((const unsigned char*) mfs.data(), mfs.size()) != compression::uncompressed) {
+		// Compressed files are decompressed in blocks instead
+		mfs.close();
+		mmap = false;
+#ifdef _MSC_VER
+		stream = _wfopen(fn_wide, L"rb");
+#else
+		stream = fopen(fn.c_str(), "rb");
+#endif
+	}
+
 	if (mmap) {
 		if (!mfs.is_open()) {
 			return;
@@ -151,46 +266,117 @@ IfcSpfStream::IfcSpfStream(const std::string& fn)
 		valid = true;
 		buffer = mfs.data();
 		ptr = 0;
-		len = mfs.size();
+		size = len = available_ = mfs.size();
 	} else {
 #endif
 		if (stream == NULL) {
 			return;
 		}
 
+		const compression::format format = compression::detect(stream);
+		if (format != compression::uncompressed) {
+			open_blocks_(stream, format);
+			stream = nullptr;
+			return;
+		}
+
 		valid = true;
-		fseek(stream, 0, SEEK_END);
-		size = (unsigned int)ftell(stream);
+#ifdef _MSC_VER
+		_fseeki64(stream, 0, SEEK_END);
+		size = (size_t)_ftelli64(stream);
+#else
+		fseeko(stream, 0, SEEK_END);
+		size = (size_t)ftello(stream);
+#endif
 		rewind(stream);
 		char* buffer_rw = new char[size];
-		len = (unsigned int)fread(buffer_rw, 1, size, stream);
 		buffer = buffer_rw;
-		eof = len == 0;
 		ptr = 0;
-		fclose(stream);
+		if (size >= read_ahead_min_size) {
+			// The stream is closed by the read-ahead thread
+			len = size;
+			eof = false;
+			read_ahead_ = new read_ahead(stream, buffer_rw, size);
+		} else {
+			len = available_ = fread(buffer_rw, 1, size, stream);
+			eof = len == 0;
+			if (len != size) {
+				Logger::Error("Unable to read file contents at offset " + std::to_string(len));
+				read_error_ = true;
+			}
+			fclose(stream);
+		}
 		stream = nullptr;
 #ifdef USE_MMAP	
 	}
 #endif
 }
 
-IfcSpfStream::IfcSpfStream(std::istream& f, int l)
+IfcSpfStream::IfcSpfStream(const std::string& fn, in_blocks_t)
 	: stream(0)
 	, buffer(0)
+	, owns_buffer_(true)
+	, read_ahead_(nullptr)
+	, available_(0)
+	, block_begin_(0)
+	, block_end_(0)
+	, valid(false)
+	, eof(true)
+	, size(0)
+{
+#ifdef _MSC_VER
+	FILE* f = _wfopen(IfcUtil::path::from_utf8(fn).c_str(), L"rb");
+#else
+	FILE* f = fopen(fn.c_str(), "rb");
+#endif
+	if (f != NULL) {
+		open_blocks_(f, compression::detect(f));
+	}
+}
+
+void IfcSpfStream::open_blocks_(FILE* f, compression::format format) {
+	// Neither the compressed nor the decompressed contents are held in
+	// memory as a whole. The length is only known upfront for uncompressed
+	// files and zip archives. The file is closed by the block reader.
+	compressed_.reset(compression::block_reader::open(f, format));
+	ptr = 0;
+	valid = !!compressed_;
+	if (valid && compressed_->length_known()) {
+		size = len = compressed_->length();
+	} else {
+		size = 0;
+		len = (std::numeric_limits<size_t>::max)();
+	}
+	eof = !valid || !in_block_(0);
+}
+
+IfcSpfStream::IfcSpfStream(std::istream& f, size_t l)
+	: stream(0)
+	, buffer(0)
+	, owns_buffer_(true)
+	, read_ahead_(nullptr)
+	, available_(l)
+	, block_begin_(0)
+	, block_end_(0)
 {
 	eof = false;
 	size = l;
 	char* buffer_rw = new char[size];
-	f.read(buffer_rw,size);
+	f.read(buffer_rw, (std::streamsize) size);
 	buffer = buffer_rw;
-	valid = f.gcount() == size;
+	valid = (size_t) f.gcount() == size;
 	ptr = 0;
 	len = l;	
 }
 
-IfcSpfStream::IfcSpfStream(void* data, int l)
+IfcSpfStream::IfcSpfStream(void* data, size_t l)
 	: stream(0)
 	, buffer(0)
+	, owns_buffer_(true)
+	, read_ahead_(nullptr)
+	, available_(l)
+	, block_begin_(0)
+	, block_end_(0)
 {
 	eof = false;
 	size = l;
@@ -200,12 +386,36 @@ IfcSpfStream::IfcSpfStream(void* data, int l)
 	len = l;
 }
 
+IfcSpfStream::IfcSpfStream(const IfcSpfStream& other, size_t offset)
+	: stream(0)
+	, buffer(other.buffer)
+	, ptr(offset)
+	, len(other.len)
+	, owns_buffer_(false)
+	, read_ahead_(other.read_ahead_)
+	, available_(other.available_.load(std::memory_order_acquire))
+	, compressed_(other.compressed_)
+	, block_begin_(0)
+	, block_end_(0)
+	, valid(other.valid)
+	, eof(offset >= other.len)
+	, size(other.size)
+{}
+
 IfcSpfStream::~IfcSpfStream()
 {
 	Close();
 }
 
 void IfcSpfStream::Close() {
+	if (!owns_buffer_) {
+		return;
+	}
+	// Joins the read-ahead thread before the buffer is released
+	delete read_ahead_;
+	read_ahead_ = nullptr;
+	block_.reset();
+	compressed_.reset();
 #ifdef USE_MMAP
 	if (mfs.is_open()) {
 		mfs.close();
@@ -221,38 +431,112 @@ void IfcSpfStream::Close() {
 //
 // Seeks an arbitrary position in the file
 //
-void IfcSpfStream::Seek(unsigned int o) {
+void IfcSpfStream::Seek(size_t o) {
 	ptr = o;
-	if (ptr >= len) throw IfcException("Reading outside of file limits");
+	if (compressed_ ? !in_block_(ptr) : ptr >= len) throw IfcException("Reading outside of file limits");
 	eof = false;
 }
 
+bool IfcSpfStream::load_block_(size_t o) {
+	size_t begin;
+	std::shared_ptr<const std::vector<char> > block = compressed_->block_at(o, begin);
+	if (!block) {
+		return false;
+	}
+	block_ = block;
+	block_begin_ = begin;
+	block_end_ = begin + block->size();
+	return true;
+}
+
+char IfcSpfStream::compressed_at_(size_t o) {
+	if (!in_block_(o)) throw IfcException("Reading outside of file limits");
+	return (*block_)[o - block_begin_];
+}
+
+const char* IfcSpfStream::Chunk(size_t o, size_t& begin, size_t& end) {
+	if (compressed_) {
+		if (!in_block_(o)) {
+			return nullptr;
+		}
+		begin = block_begin_;
+		end = block_end_;
+		return block_->data();
+	}
+	if (o >= len) {
+		return nullptr;
+	}
+	begin = 0;
+	end = len;
+	return Buffer();
+}
+
+size_t IfcSpfStream::Length() const {
+	return compressed_ ? compressed_->length() : len;
+}
+
 //
 // Returns the character at the cursor
 //
 char IfcSpfStream::Peek() {
+	if (compressed_) return compressed_at_(ptr);
+	require_(ptr + 1);
 	return buffer[ptr];
 }
 
 //
 // Returns the character at specified offset
 //
-char IfcSpfStream::Read(unsigned int o) {
+char IfcSpfStream::Read(size_t o) {
+	if (compressed_) return compressed_at_(o);
+	require_(o + 1);
 	return buffer[o];
 }
 
 //
 // Returns the cursor position
 //
-unsigned int IfcSpfStream::Tell() {
+size_t IfcSpfStream::Tell() {
 	return ptr;
 }
 
+//
+// Moves the cursor to the first occurrence of one of chars
+//
+void IfcSpfStream::SeekFirstOf(const character_set& chars) {
+	if (compressed_) {
+		// Continue searching in the next block until found
+		while (in_block_(ptr)) {
+			const size_t i = find_first_of(block_->data(), ptr - block_begin_, block_->size(), chars);
+			ptr = block_begin_ + i;
+			if (i != block_->size()) {
+				return;
+			}
+		}
+		eof = true;
+		return;
+	}
+	for (;;) {
+		const size_t available = available_.load(std::memory_order_acquire);
+		if (ptr < available || available == len) {
+			ptr = find_first_of(buffer, ptr, available, chars);
+			if (ptr != available || available == len) {
+				break;
+			}
+		}
+		// Continue searching in the contents read in the meantime
+		wait_(ptr + 1);
+	}
+	if (ptr == len) {
+		eof = true;
+	}
+}
+
 //
 // Increments cursor and reads new chunk if necessary
 //
 void IfcSpfStream::Inc() {
-	if ( ++ptr == len ) { 
+	if (compressed_ ? !in_block_(++ptr) : ++ptr == len) {
 		eof = true;
 		return;
 	}
@@ -263,7 +547,33 @@ void IfcSpfStream::Inc() {
 	}
 }
 
+namespace {
+	// Lexers by the index stored in the tokens they read, index 0 is reserved
+	// for the none token. Indices are reused after a lexer is destroyed.
+	const size_t max_lexers = size_t(1) << 16;
+	IfcSpfLexer* lexers_by_index[max_lexers];
+	std::vector<unsigned> free_lexer_indices;
+	unsigned next_lexer_index = 1;
+	std::mutex lexer_index_mutex;
+}
+
+IfcSpfLexer* IfcSpfLexer::by_index(unsigned i) {
+	return lexers_by_index[i];
+}
+
 IfcSpfLexer::IfcSpfLexer(IfcParse::IfcSpfStream *s, IfcParse::IfcFile* f) {
+	{
+		std::lock_guard<std::mutex> lk(lexer_index_mutex);
+		if (!free_lexer_indices.empty()) {
+			index_ = free_lexer_indices.back();
+			free_lexer_indices.pop_back();
+		} else if (next_lexer_index < max_lexers) {
+			index_ = next_lexer_index++;
+		} else {
+			throw IfcException("Maximum number of simultaneously opened files exceeded");
+		}
+		lexers_by_index[index_] = this;
+	}
 	file = f;
 	stream = s;
 	decoder = new IfcCharacterDecoder(s);
@@ -271,6 +581,9 @@ IfcSpfLexer::IfcSpfLexer(IfcParse::IfcSpfStream *s, IfcParse::IfcFile* f) {
 
 IfcSpfLexer::~IfcSpfLexer() {
 	delete decoder;
+	std::lock_guard<std::mutex> lk(lexer_index_mutex);
+	lexers_by_index[index_] = nullptr;
+	free_lexer_indices.push_back(index_);
 }
 
 unsigned int IfcSpfLexer::skipWhitespace() {
@@ -286,25 +599,33 @@ unsigned int IfcSpfLexer::skipWhitespace() {
 	return n;
 }
 
+namespace {
+	// Characters that terminate a general token, or start a string literal within it
+	const character_set token_delimiters("()=,;/'", 7);
+	const character_set comment_end("*", 1);
+}
+
 unsigned int IfcSpfLexer::skipComment() {
 	char c = stream->Peek();
 	if (c != '/') return 0;
+	const size_t start = stream->Tell();
 	stream->Inc();
 	c = stream->Peek();
 	if (c != '*') {
 		stream->Seek(stream->Tell() - 1);
 		return 0;
 	}
-	unsigned int n = 2;
-	char p = 0;
+	stream->Inc();
 	while ( !stream->eof ) {
-		c = stream->Peek();
+		stream->SeekFirstOf(comment_end);
+		if (stream->eof) break;
 		stream->Inc();
-		++ n;
-		if (c == '/' && p == '*') break;
-		p = c;
+		if (!stream->eof && stream->Peek() == '/') {
+			stream->Inc();
+			break;
+		}
 	}
-	return n;
+	return (unsigned int) (std::min)(stream->Tell() - start, (size_t) std::numeric_limits<unsigned int>::max());
 }
 
 //
@@ -317,7 +638,7 @@ Token IfcSpfLexer::Next() {
 	while (skipWhitespace() || skipComment()) {}
 	
 	if ( stream->eof ) return NoneTokenPtr();
-	unsigned int pos = stream->Tell();
+	size_t pos = stream->Tell();
 
 	char c = stream->Peek();
 	
@@ -339,24 +660,29 @@ Token IfcSpfLexer::Next() {
 
 		// If a string is encountered defer processing to the IfcCharacterDecoder
 		if ( c == '\'' ) decoder->skip();
+
+		// Skip over the remaining characters of the token in blocks
+		if ( ! stream->eof ) stream->SeekFirstOf(token_delimiters);
 	}
 	if ( len ) return GeneralTokenPtr(this, pos, stream->Tell());
 	else return NoneTokenPtr();
 }
 
-bool IfcSpfStream::is_eof_at(unsigned int local_ptr) {
-	return local_ptr >= len;
+bool IfcSpfStream::is_eof_at(size_t local_ptr) {
+	return compressed_ ? !in_block_(local_ptr) : local_ptr >= len;
 }
 
-void IfcSpfStream::increment_at(unsigned int& local_ptr) {
-	if (++local_ptr == len) {
+void IfcSpfStream::increment_at(size_t& local_ptr) {
+	if (is_eof_at(++local_ptr)) {
 		return;
 	}
 	const char current = IfcSpfStream::peek_at(local_ptr);
 	if (current == '\n' || current == '\r') IfcSpfStream::increment_at(local_ptr);
 }
 
-char IfcSpfStream::peek_at(unsigned int local_ptr) {
+char IfcSpfStream::peek_at(size_t local_ptr) {
+	if (compressed_) return compressed_at_(local_ptr);
+	require_(local_ptr + 1);
 	return buffer[local_ptr];
 }
 
@@ -364,7 +690,7 @@ char IfcSpfStream::peek_at(unsigned int local_ptr) {
 // Reads a std::string from the file at specified offset
 // Omits whitespace and comments
 //
-void IfcSpfLexer::TokenString(unsigned int offset, std::string &buffer) {
+void IfcSpfLexer::TokenString(size_t offset, std::string &buffer) {
 	buffer.clear();
 	while (!stream->is_eof_at(offset)) {
 		char c = stream->peek_at(offset);
@@ -381,9 +707,9 @@ void IfcSpfLexer::TokenString(unsigned int offset, std::string &buffer) {
 }
 
 //Note: according to STEP standard, there may be newlines in tokens
-inline void RemoveTokenSeparators(IfcSpfStream* stream, unsigned start, unsigned end, std::string &oDestination) {
+inline void RemoveTokenSeparators(IfcSpfStream* stream, size_t start, size_t end, std::string &oDestination) {
 	oDestination.clear();
-	for (unsigned i = start; i < end; i++) {
+	for (size_t i = start; i < end; i++) {
 		char c = stream->Read(i);
 		if (c == ' ' || c == '\r' || c == '\n' || c == '\t')
 			continue;
@@ -391,7 +717,170 @@ inline void RemoveTokenSeparators(IfcSpfStream* stream, unsigned start, unsigned
 	}
 }
 
-bool ParseInt(const char *pStart, int &val) {
+namespace {
+	inline bool is_digit(char c) {
+		return c >= '0' && c <= '9';
+	}
+
+	const uint64_t integer_powers_of_ten[] = {
+		1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+		100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+		10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+		100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+	};
+
+	// Powers of ten that are exactly representable as a double
+	const double exact_powers_of_ten[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	const uint64_t max_exact_mantissa = 1ULL << 53;
+
+	// Parses a decimal number [+-]digits[.digits][E[+-]digits] into a double without
+	// depending on the current locale. The result is only computed when it can be
+	// obtained exactly, i.e. when both the decimal significand and the power of ten
+	// are representable as a double, so that a single correctly rounded multiplication
+	// or division yields the nearest double (Clinger's fast path). Returns false
+	// otherwise, in which case the caller needs to fall back to strtod().
+	bool parse_decimal_exact(const char* p, double& val) {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+		bool negative = false;
+		if (*p == '-') {
+			negative = true;
+			++p;
+		} else if (*p == '+') {
+			++p;
+		}
+
+		uint64_t significand = 0;
+		int num_digits = 0;
+		// Zeros that have not been multiplied into the significand yet
+		int pending_zeros = 0;
+		int exponent = 0;
+		bool has_digits = false;
+		bool fraction = false;
+
+		for (;; ++p) {
+			if (*p == '.' && !fraction) {
+				fraction = true;
+				continue;
+			}
+			if (!is_digit(*p)) {
+				break;
+			}
+			has_digits = true;
+			if (fraction) {
+				--exponent;
+			}
+			if (*p == '0') {
+				if (significand != 0) {
+					++pending_zeros;
+				}
+			} else {
+				if (num_digits + pending_zeros + 1 > 19) {
+					return false;
+				}
+				significand = significand * integer_powers_of_ten[pending_zeros + 1] + (uint64_t) (*p - '0');
+				num_digits += pending_zeros + 1;
+				pending_zeros = 0;
+			}
+		}
+
+		if (!has_digits) {
+			return false;
+		}
+
+		// Trailing zeros are accounted for in the exponent
+		exponent += pending_zeros;
+
+		if (*p == 'E' || *p == 'e') {
+			++p;
+			bool negative_exponent = false;
+			if (*p == '-') {
+				negative_exponent = true;
+				++p;
+			} else if (*p == '+') {
+				++p;
+			}
+			if (!is_digit(*p)) {
+				return false;
+			}
+			int e = 0;
+			for (; is_digit(*p); ++p) {
+				if (e < 100000) {
+					e = e * 10 + (*p - '0');
+				}
+			}
+			exponent += negative_exponent ? -e : e;
+		}
+
+		if (*p != 0) {
+			return false;
+		}
+
+		double v;
+		if (significand == 0) {
+			v = 0.;
+		} else if (significand > max_exact_mantissa) {
+			return false;
+		} else if (exponent < 0) {
+			if (exponent < -22) {
+				return false;
+			}
+			v = (double) significand / exact_powers_of_ten[-exponent];
+		} else if (exponent <= 22) {
+			v = (double) significand * exact_powers_of_ten[exponent];
+		} else if (exponent <= 22 + 19) {
+			// Some of the exponent can be moved into the significand
+			// when it is small enough, e.g. 1e25 = 1000 * 1e22
+			const uint64_t factor = integer_powers_of_ten[exponent - 22];
+			if (significand > max_exact_mantissa / factor) {
+				return false;
+			}
+			v = (double) (significand * factor) * exact_powers_of_ten[22];
+		} else {
+			return false;
+		}
+
+		val = negative ? -v : v;
+		return true;
+#else
+		// Intermediate results with excess precision would lead to double rounding
+		(void) p;
+		(void) val;
+		return false;
+#endif
+	}
+}
+
+bool IfcParse::ParseInt(const char *pStart, int &val) {
+	const char* p = pStart;
+	bool negative = false;
+	if (*p == '-') {
+		negative = true;
+		++p;
+	} else if (*p == '+') {
+		++p;
+	}
+	// Up to 9 digits always fit in an int, longer sequences use strtol() below
+	if (is_digit(*p)) {
+		int result = 0;
+		int n = 0;
+		for (; is_digit(*p) && n < 9; ++p, ++n) {
+			result = result * 10 + (*p - '0');
+		}
+		if (*p == 0) {
+			val = negative ? -result : result;
+			return true;
+		} else if (!is_digit(*p)) {
+			return false;
+		}
+	} else if (*pStart != 0) {
+		// Not a number, e.g. a keyword
+		return false;
+	}
+
 	char* pEnd;
 	long result = strtol(pStart, &pEnd, 10);
 	if (*pEnd != 0)
@@ -400,12 +889,22 @@ bool ParseInt(const char *pStart, int &val) {
 	return true;
 }
 
-bool ParseFloat(const char *pStart, double &val) {
+bool IfcParse::ParseFloat(const char *pStart, double &val) {
+	if (parse_decimal_exact(pStart, val)) {
+		return true;
+	}
+
+	// Besides decimal numbers, strtod() also accepts infinity, nan and hexadecimal notation
+	const char first = (*pStart == '-' || *pStart == '+') ? pStart[1] : pStart[0];
+	if (first != 0 && !is_digit(first) && first != '.' && first != 'I' && first != 'i' && first != 'N' && first != 'n') {
+		return false;
+	}
+
 	char* pEnd;
 #ifdef _MSC_VER
-	double result = _strtod_l(pStart, &pEnd, locale);
+	double result = _strtod_l(pStart, &pEnd, get_locale());
 #else
-	double result = strtod_l(pStart, &pEnd, locale);
+	double result = strtod_l(pStart, &pEnd, get_locale());
 #endif
 	if (*pEnd != 0)
 		return false;
@@ -431,14 +930,14 @@ bool ParseBool(const char *pStart, int &val) {
 	return true;
 }
 
-Token IfcParse::OperatorTokenPtr(IfcSpfLexer* lexer, unsigned start, unsigned end) {
+Token IfcParse::OperatorTokenPtr(IfcSpfLexer* lexer, size_t start, size_t end) {
 	char first = lexer->stream->Read(start);
 	Token token(lexer, start, end, Token_OPERATOR);
 	token.value_char = first;
 	return token;
 }
 
-Token IfcParse::GeneralTokenPtr(IfcSpfLexer* lexer, unsigned start, unsigned end) {
+Token IfcParse::GeneralTokenPtr(IfcSpfLexer* lexer, size_t start, size_t end) {
 	Token token(lexer, start, end, Token_NONE);
 
 	//extract token into temp buffer (remove eol-s, no encoding changes)
@@ -458,6 +957,8 @@ Token IfcParse::GeneralTokenPtr(IfcSpfLexer* lexer, unsigned start, unsigned end
 		token.type = Token_ENUMERATION;
 		if (ParseBool(tokenStr.c_str(), token.value_int)) //bool is also enumeration
 			token.type = Token_BOOL;
+		else
+			token.value_int = -1; //resolved when the attribute type is known
 	}
 	else if (first == '"')
 		token.type = Token_BINARY;
@@ -572,12 +1073,49 @@ double TokenFunc::asFloat(const Token& t) {
 	}
 }
 
+namespace {
+	// Reads a string token directly from the file contents when it consists
+	// of printable characters without escape sequences or apostrophes, which
+	// decode to themselves in every conversion mode. Returns false otherwise,
+	// in which case the string needs to be decoded by the lexer.
+	bool read_plain_string(IfcSpfStream* stream, size_t offset, std::string& str) {
+		const char* data;
+		size_t begin = 0, end;
+		if (stream->compressed()) {
+			data = stream->Chunk(offset, begin, end);
+		} else {
+			// The characters of the token, and the one following it, have
+			// been read by the lexer.
+			data = stream->PartialBuffer();
+			end = stream->Length();
+		}
+		if (data == nullptr || offset >= end || data[offset - begin] != '\'') {
+			return false;
+		}
+		const char* first = data + (offset - begin) + 1;
+		const char* last = data + (end - begin);
+		const char* it = first;
+		while (it != last && *it >= 0x20 && *it <= 0x7e && *it != '\'' && *it != '\\') {
+			++it;
+		}
+		// An apostrophe followed by another one is an escaped apostrophe
+		if (it == last || *it != '\'' || it + 1 == last || it[1] == '\'') {
+			return false;
+		}
+		str.assign(first, it);
+		return true;
+	}
+}
+
 const std::string &TokenFunc::asStringRef(const Token& t) {
     if (t.type == Token_NONE) {
         throw IfcParse::IfcException("Null token encountered, premature end of file?");
     }
-	std::string &str = t.lexer->GetTempString();
-	t.lexer->TokenString(t.startPos, str);
+	std::string &str = t.lexer()->GetTempString();
+	if (t.type == Token_STRING && read_plain_string(t.lexer()->stream, t.startPos, str)) {
+		return str;
+	}
+	t.lexer()->TokenString(t.startPos, str);
 	if ((isString(t) || isEnumeration(t) || isBinary(t)) && !str.empty()) {
 		//remove start+end characters in-place
 		str.erase(str.end()-1);
@@ -626,7 +1164,7 @@ boost::dynamic_bitset<> TokenFunc::asBinary(const Token& t) {
 
 std::string TokenFunc::toString(const Token& t) {
 	std::string result;
-	t.lexer->TokenString(t.startPos, result);
+	t.lexer()->TokenString(t.startPos, result);
 	return result;
 }
 
@@ -636,7 +1174,7 @@ TokenArgument::TokenArgument(const Token& t) {
 }
 
 EntityArgument::EntityArgument(const Token& t) {
-	IfcParse::IfcFile* file = t.lexer->file;
+	IfcParse::IfcFile* file = t.lexer()->file;
 	IfcEntityInstanceData* data = read(0, file, t.startPos);
 	// Data needs to be loaded, for the tokens
 	// to be consumed and parsing to continue.
@@ -645,6 +1183,135 @@ EntityArgument::EntityArgument(const Token& t) {
 }
 
 namespace {
+	// Returns the offset of an enumeration token in the items of the
+	// enumeration type of attribute `index` of entity, or -1.
+	int enumeration_index_of(const IfcParse::entity* entity, size_t index, const Token& t) {
+		if (index >= entity->attribute_count()) {
+			return -1;
+		}
+		const IfcParse::named_type* nt = entity->attribute_by_index(index)->type_of_attribute()->as_named_type();
+		const IfcParse::enumeration_type* et = nt ? nt->declared_type()->as_enumeration_type() : nullptr;
+		if (et == nullptr) {
+			return -1;
+		}
+		const IfcSpfStream* stream = t.lexer()->stream;
+		const char* buffer = stream->PartialBuffer();
+		if (buffer) {
+			// Read the value between the dots directly from the file contents
+			const char* begin = buffer + t.startPos + 1;
+			const char* end = buffer + stream->Length();
+			const char* it = begin;
+			while (it != end && ((*it >= 'A' && *it <= 'Z') || (*it >= '0' && *it <= '9') || *it == '_')) {
+				++it;
+			}
+			if (it != end && *it == '.') {
+				return et->lookup_enum_offset(begin, it - begin);
+			}
+		}
+		const std::string& value = TokenFunc::asStringRef(t);
+		return et->lookup_enum_offset(value.data(), value.size());
+	}
+
+	// Looks up the declaration for a keyword token. The keyword is read
+	// directly from the file contents, unless it is interrupted by whitespace
+	// or comments, in which case it is decoded by the lexer.
+	const IfcParse::declaration* declaration_by_keyword(const IfcParse::schema_definition* schema, const Token& t) {
+		const IfcSpfStream* stream = t.lexer()->stream;
+		const char* buffer = stream->PartialBuffer();
+		if (buffer) {
+			const char* begin = buffer + t.startPos;
+			const char* end = buffer + stream->Length();
+			const char* it = begin;
+			for (; it != end; ++it) {
+				const char c = *it;
+				if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_')) {
+					break;
+				}
+			}
+			if (it == end || *it == '(') {
+				return schema->declaration_by_name(begin, it - begin);
+			}
+		}
+		return schema->declaration_by_name(TokenFunc::asStringRef(t));
+	}
+
+	// The reader the calling thread currently loads instances with, if any
+	my_thread_local IfcParse::IfcFile::instance_reader* current_reader = nullptr;
+
+	IfcParse::IfcFile::instance_reader* reader_of(const IfcParse::IfcFile* file) {
+		if (current_reader && current_reader->lexer.file == file) {
+			return current_reader;
+		}
+		return nullptr;
+	}
+
+	// Returns the lexer to read instance attributes with on the calling thread
+	IfcSpfLexer* lexer_of(IfcParse::IfcFile* file) {
+		auto reader = reader_of(file);
+		return reader ? &reader->lexer : file->tokens;
+	}
+
+	// Assigns a reader of the file to the calling thread for the duration of
+	// loading an instance. Instances nested in the instance being loaded reuse
+	// the reader of the enclosing load, as parsing continues where they end.
+	class reader_lease {
+		IfcParse::IfcFile* file_;
+		IfcParse::IfcFile::instance_reader* previous_;
+		IfcParse::IfcFile::instance_reader* reader_;
+	public:
+		reader_lease()
+			: file_(nullptr)
+			, previous_(nullptr)
+			, reader_(nullptr)
+		{}
+
+		// Returns false when the thread is already loading from file
+		bool acquire(IfcParse::IfcFile* file) {
+			if (reader_of(file)) {
+				return false;
+			}
+			file_ = file;
+			previous_ = current_reader;
+			current_reader = reader_ = file->acquire_reader();
+			return true;
+		}
+
+		~reader_lease() {
+			if (reader_) {
+				current_reader = previous_;
+				file_->release_reader(reader_);
+			}
+		}
+	};
+
+	// Bytes allocated on the heap for parsed arguments and the number of
+	// nested typed values read by the current thread, used to account for
+	// the instances loaded while a memory budget is set on the file.
+	thread_local size_t heap_argument_bytes = 0;
+	thread_local size_t nested_values_read = 0;
+
+	// Approximate bookkeeping overhead of a heap allocation
+	const size_t heap_allocation_overhead = 2 * sizeof(void*);
+
+	// Parsed arguments are allocated from the arena of the file, unless they
+	// are part of an instance that owns its attributes
+	template <typename T, typename... Args>
+	T* create_argument(arena::cursor* allocator, Args&&... args) {
+		if (allocator) {
+			return allocator->create<T>(std::forward<Args>(args)...);
+		} else {
+			heap_argument_bytes += sizeof(T) + heap_allocation_overhead;
+			return new T(std::forward<Args>(args)...);
+		}
+	}
+
+	// Instances are loaded under one of a fixed set of mutexes, selected by
+	// the address of the instance data.
+	std::mutex& instance_mutex(const void* p) {
+		static std::mutex mutexes[64];
+		return mutexes[(reinterpret_cast<uintptr_t>(p) >> 4) % 64];
+	}
+
 	template <typename T>
 	class vector_or_array {
 		std::vector<T>* vector_;
@@ -683,6 +1350,125 @@ namespace {
 			}
 		}
 	};
+
+	// Returns the simple type of the elements of attribute `index` of entity
+	// when it is a list of lists of numbers, e.g. IfcCartesianPointList3D.CoordList,
+	// or datatype_COUNT otherwise.
+	IfcParse::simple_type::data_type numeric_aggregate_of_aggregate_type(const IfcParse::entity* entity, size_t index) {
+		const IfcParse::simple_type::data_type none = IfcParse::simple_type::datatype_COUNT;
+		if (index >= entity->attribute_count()) {
+			return none;
+		}
+		const IfcParse::parameter_type* pt = entity->attribute_by_index(index)->type_of_attribute();
+		for (int depth = 0; depth < 3; ++depth) {
+			// Resolve defined types, such as IfcLengthMeasure, to their underlying type
+			while (pt->as_named_type()) {
+				const IfcParse::type_declaration* td = pt->as_named_type()->declared_type()->as_type_declaration();
+				if (td == nullptr) {
+					return none;
+				}
+				pt = td->declared_type();
+			}
+			if (depth == 2) {
+				break;
+			}
+			const IfcParse::aggregation_type* at = pt->as_aggregation_type();
+			if (at == nullptr) {
+				return none;
+			}
+			pt = at->type_of_element();
+		}
+		const IfcParse::simple_type* st = pt->as_simple_type();
+		if (st == nullptr) {
+			return none;
+		}
+		switch (st->declared_type()) {
+		case IfcParse::simple_type::integer_type:
+		case IfcParse::simple_type::real_type:
+		case IfcParse::simple_type::number_type:
+			return st->declared_type();
+		default:
+			return none;
+		}
+	}
+
+	inline bool read_numeric_value(const Token& t, double& v) {
+		if (TokenFunc::isFloat(t)) {
+			v = TokenFunc::asFloat(t);
+			return true;
+		}
+		return false;
+	}
+
+	inline bool read_numeric_value(const Token& t, int& v) {
+		if (t.type == Token_INT) {
+			v = t.value_int;
+			return true;
+		}
+		return false;
+	}
+
+	// Reads a list of lists of numbers of equal length, of which the opening
+	// parenthesis has just been read, into a single contiguous array. Returns
+	// nullptr and restores the position of the lexer when the list is of any
+	// other form, so that it can be read as a generic ArgumentList instead.
+	template <typename T>
+	Argument* read_numeric_aggregate(IfcSpfLexer* lexer, const Token& open, arena::cursor* allocator) {
+		thread_local std::vector<T> values;
+		values.clear();
+
+		const size_t start = lexer->stream->Tell();
+		size_t rows = 0, columns = 0, row_begin = 0;
+		bool in_row = false, complete = false;
+
+		Token next = lexer->Next();
+		while (next.startPos || next.lexer_index) {
+			if (in_row) {
+				T v;
+				if (read_numeric_value(next, v)) {
+					values.push_back(v);
+				} else if (TokenFunc::isOperator(next, ')')) {
+					const size_t n = values.size() - row_begin;
+					if (n == 0 || (rows && n != columns)) {
+						break;
+					}
+					columns = n;
+					++rows;
+					in_row = false;
+				} else if (!TokenFunc::isOperator(next, ',')) {
+					break;
+				}
+			} else {
+				if (TokenFunc::isOperator(next, '(')) {
+					row_begin = values.size();
+					in_row = true;
+				} else if (TokenFunc::isOperator(next, ')')) {
+					complete = rows != 0;
+					break;
+				} else if (!TokenFunc::isOperator(next, ',')) {
+					break;
+				}
+			}
+			next = lexer->Next();
+		}
+
+		if (!complete) {
+			if (!lexer->stream->is_eof_at(start)) {
+				lexer->stream->Seek(start);
+			}
+			return nullptr;
+		}
+
+		T* data;
+		if (allocator) {
+			data = static_cast<T*>(allocator->allocate(values.size() * sizeof(T), alignof(T)));
+		} else {
+			heap_argument_bytes += values.size() * sizeof(T) + heap_allocation_overhead;
+			data = new T[values.size()];
+		}
+		std::copy(values.begin(), values.end(), data);
+		return create_argument<NumericAggregateArgument>(allocator, open, rows, columns, data);
+	}
 }
 
 // 
@@ -690,19 +1476,34 @@ namespace {
 // Aditionally, registers the ids (i.e. #[\d]+) in the inverse map
 //
 size_t IfcParse::IfcFile::load(unsigned entity_instance_name, const IfcParse::entity* entity, Argument**& attributes, size_t num_attributes, int attribute_index) {
-	Token next = tokens->Next();
+	// Preallocated attributes (of header entities) are owned by the instance,
+	// otherwise everything read is allocated from the arena, unless it needs
+	// to be released individually to stay within the memory budget.
+	arena::cursor* allocator = nullptr;
+	if (attributes == 0 && !(memory_budget_ && parsing_complete_)) {
+		instance_reader* reader = reader_of(this);
+		allocator = reader ? &reader->allocator : &arena_cursor_;
+	}
+	return load_(entity_instance_name, entity, attributes, num_attributes, attribute_index, allocator);
+}
 
-	std::vector<Argument*>* vector = 0;
+size_t IfcParse::IfcFile::load_(unsigned entity_instance_name, const IfcParse::entity* entity, Argument**& attributes, size_t num_attributes, int attribute_index, arena::cursor* allocator) {
+	instance_reader* reader = reader_of(this);
+	IfcSpfLexer* lexer = reader ? &reader->lexer : tokens;
+
+	Token next = lexer->Next();
+
+	std::vector<Argument*>* vector = 0;
 	vector_or_array<Argument*> filler(attributes, num_attributes);
 	if (attributes == 0) {
 		if (num_attributes != 0) {
 			// If num_attributes is zero we know this is a top-level entity instance (or header entity) being parsed.
-			// There can only be parsed one of these at a time, so we can reuse the vector we have defined at the file
-			// scope.
+			// There can only be parsed one of these at a time per reader, so we can reuse the vector we have defined
+			// at the file or reader scope.
 			if (entity) {
-				vector = &internal_attribute_vector_;
+				vector = reader ? &reader->attribute_vector : &internal_attribute_vector_;
 			} else {
-				vector = &internal_attribute_vector_simple_type_;
+				vector = reader ? &reader->attribute_vector_simple_type : &internal_attribute_vector_simple_type_;
 			}
 			vector->clear();
 		} else {
@@ -713,17 +1514,38 @@ size_t IfcParse::IfcFile::load(unsigned entity_instance_name, const IfcParse::en
 
 	size_t return_value = 0;
 
-	while( next.startPos || next.lexer ) {
+	while( next.startPos || next.lexer_index ) {
 		if ( TokenFunc::isOperator(next,',') ) {
 			// do nothing
 		} else if ( TokenFunc::isOperator(next,')') ) {
 			break;
 		} else if ( TokenFunc::isOperator(next,'(') ) {
 			return_value++;
-			ArgumentList* alist = new ArgumentList();
+			if (num_attributes && entity) {
+				// Lists of lists of numbers of the instance itself, such as
+				// coordinate lists, are stored contiguously when possible.
+				Argument* numeric = nullptr;
+				switch (numeric_aggregate_of_aggregate_type(entity, filler.index())) {
+				case IfcParse::simple_type::integer_type:
+					numeric = read_numeric_aggregate<int>(lexer, next, allocator);
+					break;
+				case IfcParse::simple_type::real_type:
+				case IfcParse::simple_type::number_type:
+					numeric = read_numeric_aggregate<double>(lexer, next, allocator);
+					break;
+				default:
+					break;
+				}
+				if (numeric) {
+					filler.push_back(numeric);
+					next = lexer->Next();
+					continue;
+				}
+			}
+			ArgumentList* alist = create_argument<ArgumentList>(allocator);
 			// entity is passed along here, after all the it is the type of the instance
 			// that owns the list that is significant for inverse attributes
-			alist->size() = load(entity_instance_name, entity, alist->arguments(), 0, attribute_index == -1 ? (int)filler.index() : attribute_index);
+			alist->size() = load_(entity_instance_name, entity, alist->arguments(), 0, attribute_index == -1 ? (int)filler.index() : attribute_index, allocator);
 			filler.push_back(alist);
 		} else {
 			return_value++;
@@ -735,20 +1557,36 @@ size_t IfcParse::IfcFile::load(unsigned entity_instance_name, const IfcParse::en
 			
 			if (TokenFunc::isKeyword(next)) {
 				try {
-					auto ea = new EntityArgument(next);
-					addEntity(((IfcUtil::IfcBaseClass*) *ea));
+					auto ea = create_argument<EntityArgument>(allocator, next);
+					++nested_values_read;
+					if (reader) {
+						std::lock_guard<std::mutex> lk(load_mutex_);
+						addEntity(((IfcUtil::IfcBaseClass*) *ea));
+					} else {
+						addEntity(((IfcUtil::IfcBaseClass*) *ea));
+					}
 					filler.push_back(ea);
 				} catch (IfcException& e) {
 					Logger::Message(Logger::LOG_ERROR, e.what());
 					// #4070 We didn't actually capture an aggregate entry, undo length increment.
 					return_value--;
 				}
+			} else if (num_attributes && TokenFunc::isOperator(next, '$')) {
+				// Null attributes of the instance itself are not stored as an
+				// argument, getArgument() returns a shared null argument for them.
+				filler.push_back(nullptr);
+			} else if (num_attributes && entity && next.type == Token_ENUMERATION) {
+				// Enumeration values of the instance itself are resolved once here,
+				// so that the generated accessors do not need to compare strings.
+				Token resolved = next;
+				resolved.value_int = enumeration_index_of(entity, filler.index(), next);
+				filler.push_back(create_argument<TokenArgument>(allocator, resolved));
 			} else {
-				filler.push_back(new TokenArgument(next));
+				filler.push_back(create_argument<TokenArgument>(allocator, next));
 			}
 
 		}
-		next = tokens->Next();
+		next = lexer->Next();
 	}
 
 	if (vector) {
@@ -757,7 +1595,13 @@ size_t IfcParse::IfcFile::load(unsigned entity_instance_name, const IfcParse::en
 			// @todo figure out whether all this logic is still necessary, since we know the
 			// expected amount of attributes and shouldn't be able to access more than allowed
 			// by the schema.
-			attributes = new Argument*[(std::max)(num_attributes, vector->size())]{ nullptr };
+			const size_t n = (std::max)(num_attributes, vector->size());
+			if (allocator) {
+				attributes = allocator->create_array<Argument*>(n);
+			} else {
+				heap_argument_bytes += n * sizeof(Argument*) + heap_allocation_overhead;
+				attributes = new Argument*[n]{ nullptr };
+			}
 
 			// @todo this appears unnecessary, we increment this in the loop already,
 			// which is more accurate as the filler can't go above it's size in case
@@ -769,7 +1613,7 @@ size_t IfcParse::IfcFile::load(unsigned entity_instance_name, const IfcParse::en
 			}
 		}
 
-		if ((vector != &internal_attribute_vector_) && (vector != &internal_attribute_vector_simple_type_)) {
+		if (num_attributes == 0) {
 			delete vector;
 		}
 	}	
@@ -857,7 +1701,7 @@ ArgumentList::operator aggregate_of_aggregate_of_instance::ptr() const {
 			l->push(e);
 		} else {
 			auto token = dynamic_cast<const TokenArgument*>(arg);
-			int startpos = token ? token->token.startPos : 0;
+			size_t startpos = token ? (size_t) token->token.startPos : 0;
 			std::string string_rep = this->toString();
 			throw IfcInvalidTokenException(startpos, string_rep, "nested aggregate");
 		}
@@ -889,16 +1733,15 @@ void ArgumentList::set(unsigned int i, Argument* argument) {
 */
 
 std::string ArgumentList::toString(bool upper) const {
-	std::stringstream ss;
-	ss << "(";
+	std::string str = "(";
 	for (size_t i = 0; i < size_; ++i) {
 		if (i != 0) {
-			ss << ",";
+			str += ",";
 		}
-		ss << list_[i]->toString(upper);
+		str += list_[i]->toString(upper);
 	}
-	ss << ")";
-	return ss.str();
+	str += ")";
+	return str;
 }
 
 bool ArgumentList::isNull() const { return false; }
@@ -911,28 +1754,235 @@ ArgumentList::~ArgumentList() {
 }
 
 
+NumericAggregateArgument::~NumericAggregateArgument() {
+	if (integral_) {
+		delete[] integers_;
+	} else {
+		delete[] doubles_;
+	}
+	// Only reached for arguments on the heap, of which the rows are on the
+	// heap as well. The rows are not destructed, like in the arena.
+	::operator delete(row_arguments_.load(std::memory_order_relaxed));
+}
+
+IfcUtil::ArgumentType NumericAggregateArgument::type() const {
+	return integral_ ? IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_INT : IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_DOUBLE;
+}
+
+namespace {
+	template <typename T, typename U>
+	std::vector< std::vector<T> > numeric_aggregate_as_vector2(const std::vector< numeric_span<U> >& spans) {
+		std::vector< std::vector<T> > return_value;
+		return_value.reserve(spans.size());
+		for (auto& span : spans) {
+			return_value.emplace_back(span.begin(), span.end());
+		}
+		return return_value;
+	}
+}
+
+NumericAggregateArgument::operator std::vector< std::vector<int> >() const {
+	if (!integral_) {
+		throw IfcInvalidTokenException(token_.startPos, toString(), "integer");
+	}
+	return numeric_aggregate_as_vector2<int>(row_spans<int>());
+}
+
+NumericAggregateArgument::operator std::vector< std::vector<double> >() const {
+	if (integral_) {
+#ifdef PERMISSIVE_FLOAT
+		/// NB: We are being more permissive here then allowed by the standard
+		return numeric_aggregate_as_vector2<double>(row_spans<int>());
+#else
+		throw IfcInvalidTokenException(token_.startPos, toString(), "real");
+#endif
+	}
+	return numeric_aggregate_as_vector2<double>(row_spans<double>());
+}
+
+namespace {
+	// The rows of numeric aggregates are created under one of a fixed set of
+	// mutexes, selected by the address of the aggregate.
+	std::mutex& numeric_aggregate_mutex(const void* p) {
+		static std::mutex mutexes[16];
+		return mutexes[(reinterpret_cast<uintptr_t>(p) >> 4) % 16];
+	}
+
+	bool is_numeric_aggregate_separator(char c) {
+		return c == ' ' || c == '\r' || c == '\n' || c == '\t' || c == ',';
+	}
+}
+
+ArgumentList* NumericAggregateArgument::create_row_arguments_() const {
+	std::lock_guard<std::mutex> lock(numeric_aggregate_mutex(this));
+	ArgumentList* rows = row_arguments_.load(std::memory_order_acquire);
+	if (rows) {
+		return rows;
+	}
+
+	// The offsets of the values are found by scanning the text like
+	// toString() does, so that the values can be read as tokens.
+	IfcSpfLexer* lexer = token_.lexer();
+	IfcSpfStream* stream = lexer->stream;
+	const size_t count = rows_ * columns_;
+	std::vector<size_t> offsets;
+	offsets.reserve(count);
+	size_t offset = token_.startPos;
+	int depth = 0;
+	while (!stream->is_eof_at(offset)) {
+		const char c = stream->peek_at(offset);
+		if (is_numeric_aggregate_separator(c)) {
+			++offset;
+		} else if (c == '/' && !stream->is_eof_at(offset + 1) && stream->peek_at(offset + 1) == '*') {
+			offset += 2;
+			while (!stream->is_eof_at(offset + 1) && !(stream->peek_at(offset) == '*' && stream->peek_at(offset + 1) == '/')) {
+				++offset;
+			}
+			offset += 2;
+		} else if (c == '(') {
+			++depth;
+			++offset;
+		} else if (c == ')') {
+			++offset;
+			if (--depth == 0) {
+				break;
+			}
+		} else {
+			offsets.push_back(offset);
+			while (!stream->is_eof_at(offset)) {
+				const char d = stream->peek_at(offset);
+				if (is_numeric_aggregate_separator(d) || d == '(' || d == ')' || d == '/') {
+					break;
+				}
+				++offset;
+			}
+		}
+	}
+	if (offsets.size() != count) {
+		throw IfcInvalidTokenException(token_.startPos, toString(), "list of lists of numbers");
+	}
+
+	// The lists, the arrays of their elements and the elements themselves
+	// are allocated as a single block, from the arena when this argument is.
+	const size_t size = rows_ * sizeof(ArgumentList) + count * (sizeof(Argument*) + sizeof(TokenArgument));
+	IfcParse::IfcFile* file = lexer->file;
+	char* block = file && file->in_arena(this)
+		? file->allocate_arena_block(size)
+		: static_cast<char*>(::operator new(size));
+
+	rows = reinterpret_cast<ArgumentList*>(block);
+	Argument** elements = reinterpret_cast<Argument**>(block + rows_ * sizeof(ArgumentList));
+	TokenArgument* values = reinterpret_cast<TokenArgument*>(elements + count);
+	for (size_t i = 0; i < count; ++i) {
+		Token t(lexer, offsets[i], 0, integral_ ? Token_INT : Token_FLOAT);
+		if (integral_) {
+			t.value_int = integers_[i];
+		} else {
+			t.value_double = doubles_[i];
+		}
+		elements[i] = new (values + i) TokenArgument(t);
+	}
+	for (size_t i = 0; i < rows_; ++i) {
+		ArgumentList* row = new (rows + i) ArgumentList();
+		row->arguments() = elements + i * columns_;
+		row->size() = columns_;
+	}
+
+	row_arguments_.store(rows, std::memory_order_release);
+	return rows;
+}
+
+Argument* NumericAggregateArgument::operator [] (unsigned int i) const {
+	if (i >= rows_) {
+		throw IfcAttributeOutOfRangeException("Argument index out of range");
+	}
+	ArgumentList* rows = row_arguments_.load(std::memory_order_acquire);
+	if (rows == nullptr) {
+		rows = create_row_arguments_();
+	}
+	return rows + i;
+}
+
+std::string NumericAggregateArgument::toString(bool /*upper*/) const {
+	// The values are written as they occur in the file, like TokenArgument
+	// does, but without whitespace and comments and with the separators of
+	// a generic ArgumentList.
+	IfcSpfStream* stream = token_.lexer()->stream;
+	std::string str;
+	size_t offset = token_.startPos;
+	int depth = 0;
+	bool separate = false;
+	while (!stream->is_eof_at(offset)) {
+		const char c = stream->peek_at(offset);
+		if (c == ' ' || c == '\r' || c == '\n' || c == '\t' || c == ',') {
+			++offset;
+		} else if (c == '/' && !stream->is_eof_at(offset + 1) && stream->peek_at(offset + 1) == '*') {
+			offset += 2;
+			while (!stream->is_eof_at(offset + 1) && !(stream->peek_at(offset) == '*' && stream->peek_at(offset + 1) == '/')) {
+				++offset;
+			}
+			offset += 2;
+		} else if (c == ')') {
+			str.push_back(c);
+			++offset;
+			separate = true;
+			if (--depth == 0) {
+				break;
+			}
+		} else {
+			if (separate) {
+				str.push_back(',');
+			}
+			if (c == '(') {
+				str.push_back(c);
+				++offset;
+				++depth;
+				separate = false;
+			} else {
+				std::string value;
+				token_.lexer()->TokenString(offset, value);
+				str += value;
+				// Continue at the delimiter that ended the value
+				while (!stream->is_eof_at(offset)) {
+					const char d = stream->peek_at(offset);
+					if (d == '(' || d == ')' || d == ',' || d == '/') {
+						break;
+					}
+					++offset;
+				}
+				separate = true;
+			}
+		}
+	}
+	return str;
+}
+
 IfcUtil::ArgumentType TokenArgument::type() const {
-	if (TokenFunc::isInt(token)) {
+	// The token type is a tag that is determined when the token is read
+	switch (token.type) {
+	case Token_INT:
 		return IfcUtil::Argument_INT;
-	} else if (TokenFunc::isBool(token)) {
-		return IfcUtil::Argument_BOOL;
-	} else if (TokenFunc::isLogical(token)) {
-		return IfcUtil::Argument_LOGICAL;
-	} else if (TokenFunc::isFloat(token)) {
+	case Token_BOOL:
+		// Bool and logical share the same storage type, just logical unknown is stored as 2.
+		return token.value_int == 2 ? IfcUtil::Argument_LOGICAL : IfcUtil::Argument_BOOL;
+	case Token_FLOAT:
 		return IfcUtil::Argument_DOUBLE;
-	} else if (TokenFunc::isString(token)) {
+	case Token_STRING:
 		return IfcUtil::Argument_STRING;
-	} else if (TokenFunc::isEnumeration(token)) {
+	case Token_ENUMERATION:
 		return IfcUtil::Argument_ENUMERATION;
-	} else if (TokenFunc::isIdentifier(token)) {
+	case Token_IDENTIFIER:
 		return IfcUtil::Argument_ENTITY_INSTANCE;
-	} else if (TokenFunc::isBinary(token)) {
+	case Token_BINARY:
 		return IfcUtil::Argument_BINARY;
-	} else if (TokenFunc::isOperator(token, '$')) {
-		return IfcUtil::Argument_NULL;
-	} else if (TokenFunc::isOperator(token, '*')) {
-		return IfcUtil::Argument_DERIVED;
-	} else {
+	case Token_OPERATOR:
+		if (token.value_char == '$') {
+			return IfcUtil::Argument_NULL;
+		} else if (token.value_char == '*') {
+			return IfcUtil::Argument_DERIVED;
+		}
+		return IfcUtil::Argument_UNKNOWN;
+	default:
 		return IfcUtil::Argument_UNKNOWN;
 	}
 }
@@ -946,7 +1996,8 @@ TokenArgument::operator boost::logic::tribool() const { return TokenFunc::asLogi
 TokenArgument::operator double() const { return TokenFunc::asFloat(token); }
 TokenArgument::operator std::string() const { return TokenFunc::asString(token); }
 TokenArgument::operator boost::dynamic_bitset<>() const { return TokenFunc::asBinary(token); }
-TokenArgument::operator IfcUtil::IfcBaseClass*() const { return token.lexer->file->instance_by_id(TokenFunc::asIdentifier(token)); }
+TokenArgument::operator IfcUtil::IfcBaseClass*() const { return token.lexer()->file->instance_by_id(TokenFunc::asIdentifier(token)); }
+int TokenArgument::enumeration_index() const { return token.type == Token_ENUMERATION ? token.value_int : -1; }
 unsigned int TokenArgument::size() const { return 1; }
 Argument* TokenArgument::operator [] (unsigned int /*i*/) const { throw IfcException("Argument is not a list of attributes"); }
 std::string TokenArgument::toString(bool upper) const { 
@@ -994,88 +2045,183 @@ EntityArgument::~EntityArgument() {
 //
 // Reads an Entity from the list of Tokens at the specified offset in the file
 //
-IfcEntityInstanceData* IfcParse::read(unsigned int i, IfcFile* f, boost::optional<unsigned> offset) {
+IfcEntityInstanceData* IfcParse::read(unsigned int i, IfcFile* f, boost::optional<size_t> offset) {
+	IfcSpfLexer* lexer = lexer_of(f);
 	if (offset) {
-		f->tokens->stream->Seek(*offset);
+		lexer->stream->Seek(*offset);
 	}
-	Token datatype = f->tokens->Next();
+	Token datatype = lexer->Next();
 	if (!TokenFunc::isKeyword(datatype)) throw IfcException("Unexpected token while parsing entity");
-	const IfcParse::declaration* ty = f->schema()->declaration_by_name(TokenFunc::asStringRef(datatype));
+	const IfcParse::declaration* ty = declaration_by_keyword(f->schema(), datatype);
 	IfcEntityInstanceData* e = new IfcEntityInstanceData(ty, f, i, offset.get_value_or(0));
 	return e;
 }
 
 void IfcParse::IfcFile::seek_to(const IfcEntityInstanceData& data) {
-	if (tokens->stream->Tell() != data.offset_in_file()) {
-		tokens->stream->Seek(data.offset_in_file());
-		Token datatype = tokens->Next();
+	IfcSpfLexer* lexer = lexer_of(this);
+	if (lexer->stream->Tell() != data.offset_in_file()) {
+		lexer->stream->Seek(data.offset_in_file());
+		Token datatype = lexer->Next();
 		if (!TokenFunc::isKeyword(datatype)) throw IfcException("Unexpected token while parsing entity instance");
 	}
-	tokens->Next();
+	lexer->Next();
 }
 
 void IfcParse::IfcFile::try_read_semicolon() {
-	unsigned int old_offset = tokens->stream->Tell();
-	Token semilocon = tokens->Next();
+	IfcSpfLexer* lexer = lexer_of(this);
+	size_t old_offset = lexer->stream->Tell();
+	Token semilocon = lexer->Next();
 	if (!TokenFunc::isOperator(semilocon, ';')) {
-		tokens->stream->Seek(old_offset);
+		lexer->stream->Seek(old_offset);
 	}
 }
 
-void IfcParse::IfcFile::register_inverse(unsigned id_from, const IfcParse::entity* from_entity, Token t, int attribute_index) {
-	// Assume a check on token type has already been performed
-	auto e = from_entity;
-	byref_excl[t.value_int].push_back(id_from);
-	while (e) {
-		byref[{t.value_int, e->index_in_schema(), attribute_index}].push_back(id_from);
-		e = e->supertype();
+IfcParse::IfcFile::instance_reader::instance_reader(IfcFile* file)
+	: stream(*file->stream, 0)
+	, lexer(&stream, file)
+	, allocator(&file->arena_)
+{
+	attribute_vector.reserve(64);
+	attribute_vector_simple_type.reserve(16);
+}
+
+IfcParse::IfcFile::instance_reader* IfcParse::IfcFile::acquire_reader() {
+	std::lock_guard<std::mutex> lk(readers_mutex_);
+	if (idle_readers_.empty()) {
+		readers_.emplace_back(new instance_reader(this));
+		return readers_.back().get();
 	}
+	instance_reader* reader = idle_readers_.back();
+	idle_readers_.pop_back();
+	return reader;
 }
 
-void IfcParse::IfcFile::register_inverse(unsigned id_from, const IfcParse::entity* from_entity, IfcUtil::IfcBaseClass* inst, int attribute_index) {
-	auto e = from_entity;
-	byref_excl[inst->data().id()].push_back(id_from);
-	while (e) {
-		byref[{inst->data().id(), e->index_in_schema(), attribute_index}].push_back(id_from);
-		e = e->supertype();
-	}
-}
-
-void IfcParse::IfcFile::unregister_inverse(unsigned id_from, const IfcParse::entity* from_entity, IfcUtil::IfcBaseClass* inst, int attribute_index) {
-	auto e = from_entity;
-	while (e) {
-		std::vector<int>& ids = byref[{inst->data().id(), e->index_in_schema(), attribute_index}];
-		std::vector<int>::iterator it = std::find(ids.begin(), ids.end(), id_from);
-		if (it == ids.end()) {
-			// @todo inverses also need to be populated when multiple instances are added to a new file.
-			// throw IfcParse::IfcException("Instance not found among inverses");
-		} else {
-			ids.erase(it);
+void IfcParse::IfcFile::release_reader(instance_reader* reader) {
+	std::lock_guard<std::mutex> lk(readers_mutex_);
+	idle_readers_.push_back(reader);
+}
+
+void IfcParse::IfcFile::memory_budget(size_t bytes) {
+	std::lock_guard<std::mutex> lk(resident_mutex_);
+	memory_budget_ = bytes;
+	release_resident_();
+}
+
+size_t IfcParse::IfcFile::memory_usage() const {
+	std::lock_guard<std::mutex> lk(resident_mutex_);
+	return resident_bytes_ + retired_bytes_;
+}
+
+IfcParse::IfcFile::attribute_lease::attribute_lease(const IfcFile* file)
+	: file_(file)
+	, epoch_(0)
+{
+	if (file_) {
+		std::lock_guard<std::mutex> lk(file_->resident_mutex_);
+		epoch_ = file_->attribute_epoch_;
+		file_->lease_epochs_.insert(epoch_);
+	}
+}
+
+IfcParse::IfcFile::attribute_lease::~attribute_lease() {
+	if (file_) {
+		std::lock_guard<std::mutex> lk(file_->resident_mutex_);
+		file_->lease_epochs_.erase(file_->lease_epochs_.find(epoch_));
+		const_cast<IfcFile*>(file_)->free_retired_();
+	}
+}
+
+void IfcParse::IfcFile::free_retired_() {
+	// Attributes retired in an epoch can only have been read by leases
+	// acquired in the same or an earlier epoch
+	while (!retired_.empty() && (lease_epochs_.empty() || *lease_epochs_.begin() > retired_.front().epoch)) {
+		const retired_attributes& r = retired_.front();
+		for (size_t i = 0; i < r.count; ++i) {
+			delete r.attributes[i];
 		}
-		e = e->supertype();
+		delete[] r.attributes;
+		retired_bytes_ -= r.bytes;
+		retired_.pop_front();
 	}
+}
 
-	std::vector<int>& ids = byref_excl[inst->data().id()];
-	std::vector<int>::iterator it = std::find(ids.begin(), ids.end(), id_from);
-	if (it == ids.end()) {
-		// @todo inverses also need to be populated when multiple instances are added to a new file.
-		// throw IfcParse::IfcException("Instance not found among inverses");
-	} else {
-		ids.erase(it);
+void IfcParse::IfcFile::add_resident(const IfcEntityInstanceData& data, size_t bytes) {
+	std::lock_guard<std::mutex> lk(resident_mutex_);
+	resident_.push_back({ data.id(), &data, bytes });
+	resident_bytes_ += bytes;
+	release_resident_(&data);
+}
+
+void IfcParse::IfcFile::release_resident_(const IfcEntityInstanceData* keep) {
+	// Every instance is visited at most twice, the first visit clears its
+	// access flag. Instances that are being loaded by other threads are skipped.
+	size_t steps = 2 * resident_.size() + 1;
+	while (memory_budget_ && resident_bytes_ > memory_budget_ && !resident_.empty() && steps--) {
+		if (resident_hand_ >= resident_.size()) {
+			resident_hand_ = 0;
+		}
+		const resident_instance& r = resident_[resident_hand_];
+		if (r.data == keep) {
+			++resident_hand_;
+			continue;
+		}
+		// The instance may have been removed from the file in the meantime
+		IfcUtil::IfcBaseClass* inst = byid.get(r.id);
+		Argument** attributes = nullptr;
+		const auto status = inst && &inst->data() == r.data
+			? r.data->release_attributes(attributes)
+			: IfcEntityInstanceData::not_releasable;
+		if (status == IfcEntityInstanceData::released) {
+			// Freed right away unless a lease may still refer to them
+			retired_.push_back({ attributes, r.data->getArgumentCount(), r.bytes, attribute_epoch_++ });
+			retired_bytes_ += r.bytes;
+			free_retired_();
+		}
+		if (status == IfcEntityInstanceData::released || status == IfcEntityInstanceData::not_releasable) {
+			// Order is not maintained, the last instance takes the place of
+			// this one and is visited next.
+			resident_bytes_ -= r.bytes;
+			resident_[resident_hand_] = resident_.back();
+			resident_.pop_back();
+		} else {
+			++resident_hand_;
+		}
 	}
 }
 
+void IfcParse::IfcFile::register_inverse(unsigned id_from, const IfcParse::entity* from_entity, Token t, int attribute_index) {
+	// Assume a check on token type has already been performed
+	register_inverse(id_from, from_entity, t.value_int, attribute_index);
+}
+
+void IfcParse::IfcFile::register_inverse(unsigned id_from, const IfcParse::entity* from_entity, IfcUtil::IfcBaseClass* inst, int attribute_index) {
+	register_inverse(id_from, from_entity, (int) inst->data().id(), attribute_index);
+}
+
+void IfcParse::IfcFile::register_inverse(unsigned id_from, const IfcParse::entity*, int id_to, int attribute_index) {
+	// The type of the referencing instance is not stored, inverses are filtered
+	// by the type of the instance when queried.
+	byref.add(id_to, (int) id_from, attribute_index);
+}
+
+void IfcParse::IfcFile::unregister_inverse(unsigned id_from, const IfcParse::entity*, IfcUtil::IfcBaseClass* inst, int attribute_index) {
+	// @todo inverses also need to be populated when multiple instances are added to a new file,
+	// until then a reference that is not found is silently ignored.
+	byref.remove((int) inst->data().id(), (int) id_from, attribute_index);
+}
+
 //
 // Returns a string representation of the entity
 // Note that this initializes the entity if it is not initialized
 //
 std::string IfcEntityInstanceData::toString(bool upper) const {
-	if (attributes_ == 0) {
+	if (!loaded_.load(std::memory_order_acquire)) {
 		load();
 	}
 
-	std::stringstream ss;
-	ss.imbue(std::locale::classic());
+	// Built without a string stream, so that threads formatting instances
+	// concurrently do not contend on the shared locale.
+	std::string str;
 	
 	std::string dt;
 	if (type_) {
@@ -1085,35 +2231,95 @@ std::string IfcEntityInstanceData::toString(bool upper) const {
 		}
 
 		if (type()->as_entity() || id_ != 0) {
-			ss << "#" << id_ << "=";
+			str += "#";
+			str += std::to_string(id_);
+			str += "=";
 		}
 	}
 
-	ss << dt << "(";
+	str += dt;
+	str += "(";
 
+	Argument** attributes = attributes_;
 	for (size_t i = 0; i < getArgumentCount(); ++i) {
 		if (i != 0) {
-			ss << ",";
+			str += ",";
 		}
-		if (attributes_[i] == 0) {
-			ss << "$";
+		if (attributes[i] == 0) {
+			str += "$";
 		} else {
-			ss << attributes_[i]->toString(upper);
+			str += attributes[i]->toString(upper);
 		}
 	}
-	ss << ")";
+	str += ")";
 
-	return ss.str();
+	return str;
+}
+
+namespace {
+	// Returns whether an argument contains a nested typed value that has been modified
+	bool has_modified_value(const Argument* a) {
+		if (auto list = dynamic_cast<const ArgumentList*>(a)) {
+			for (unsigned int i = 0; i < list->size(); ++i) {
+				if (has_modified_value((*list)[i])) {
+					return true;
+				}
+			}
+		} else if (auto ea = dynamic_cast<const EntityArgument*>(a)) {
+			return ((IfcUtil::IfcBaseClass*) *ea)->data().modified();
+		}
+		return false;
+	}
+}
+
+bool IfcEntityInstanceData::modified() const {
+	if (modified_) {
+		return true;
+	}
+	// Nested typed values only exist once the attributes are loaded
+	if (!loaded_.load(std::memory_order_acquire)) {
+		return false;
+	}
+	Argument** attributes = attributes_;
+	if (attributes == nullptr) {
+		return false;
+	}
+	for (size_t i = 0; i < getArgumentCount(); ++i) {
+		if (attributes[i] && has_modified_value(attributes[i])) {
+			return true;
+		}
+	}
+	return false;
 }
 
 void IfcEntityInstanceData::clearArguments()
 {
-	if (attributes_ != NULL) {
-		for (size_t i = 0; i < getArgumentCount(); ++i) {
-			delete attributes_[i];
+	if (attributes_ != NULL && !loaded_.load(std::memory_order_acquire)) {
+		// Released attributes, which are freed by the file
+		attributes_ = NULL;
+		residency_ = not_evictable;
+	} else if (attributes_ != NULL) {
+		if (in_arena_) {
+			// Parsed arguments are released together with the arena of the
+			// file, only arguments assigned afterwards need to be deleted.
+			if (modified_) {
+				for (size_t i = 0; i < getArgumentCount(); ++i) {
+					if (!file->in_arena(attributes_[i])) {
+						delete attributes_[i];
+					}
+				}
+			}
+		} else {
+			for (size_t i = 0; i < getArgumentCount(); ++i) {
+				delete attributes_[i];
+			}
+			delete[] attributes_;
 		}
-		delete[] attributes_;
 		attributes_ = NULL;
+		in_arena_ = false;
+		modified_ = false;
+		residency_ = not_evictable;
+		loaded_ = false;
 	}
 }
 
@@ -1140,12 +2346,26 @@ aggregate_of_instance::ptr IfcEntityInstanceData::getInverse(const IfcParse::dec
 }
 
 void IfcEntityInstanceData::load() const {
-	static std::recursive_mutex m;
-	std::lock_guard<std::recursive_mutex> lk(m);
+	reader_lease lease;
+	std::unique_lock<std::mutex> lock;
 
 	Argument** tmp_data = nullptr;
+
+	// See IfcFile::load(), instances on the heap can be released again
+	const bool on_heap = file->parsing_complete() && file->memory_budget();
+	const size_t bytes_before = heap_argument_bytes;
+	const size_t nested_before = nested_values_read;
 	
 	if (file->parsing_complete()) {
+		// Every thread reads with its own lexer. Instances nested in the one
+		// being loaded are private to the thread and do not need to be locked.
+		if (lease.acquire(file)) {
+			lock = std::unique_lock<std::mutex>(instance_mutex(this));
+			if (loaded_.load(std::memory_order_relaxed)) {
+				// Loaded by another thread in the meantime
+				return;
+			}
+		}
 		// only when parsing is fully complete we need to seek to the instance, otherwise
 		// we know the token cursor is currently at the keyword token
 		file->seek_to(*this);
@@ -1167,12 +2387,47 @@ void IfcEntityInstanceData::load() const {
 
 	file->try_read_semicolon();
 	
-	// @todo does this need to be atomic somehow?
+	// Instances with nested typed values are not released, as these values
+	// are instantiated again and added to the file when read.
+	const bool evictable = on_heap && tmp_data && id_ && nested_values_read == nested_before;
+
 	if (tmp_data) {
+		// Allocated from the arena of the file, see IfcFile::load()
 		attributes_ = tmp_data;
+		in_arena_ = !on_heap;
+	}
+	residency_.store(evictable ? evictable_referenced : not_evictable, std::memory_order_relaxed);
+	loaded_.store(true, std::memory_order_release);
+
+	if (evictable) {
+		// Registered without holding the lock on this instance, as others
+		// are locked to release their attributes.
+		if (lock.owns_lock()) {
+			lock.unlock();
+		}
+		file->add_resident(*this, heap_argument_bytes - bytes_before);
 	}
 }
 
+IfcEntityInstanceData::release_status IfcEntityInstanceData::release_attributes(Argument**& attributes) const {
+	std::unique_lock<std::mutex> lock(instance_mutex(this), std::try_to_lock);
+	if (!lock.owns_lock()) {
+		return in_use;
+	}
+	if (!loaded_.load(std::memory_order_acquire) || in_arena_ || residency_.load(std::memory_order_relaxed) == not_evictable || modified()) {
+		return not_releasable;
+	}
+	if (residency_.exchange(evictable, std::memory_order_relaxed) == evictable_referenced) {
+		return recently_used;
+	}
+	// attributes_ is left as is for threads that have just seen loaded_ set,
+	// it is overwritten when the instance is loaded again.
+	loaded_.store(false, std::memory_order_release);
+	residency_.store(not_evictable, std::memory_order_relaxed);
+	attributes = attributes_;
+	return released;
+}
+
 namespace {
 	// @todo remove redundancy with python wrapper code (which is not identical due to
 	// different handling of enumerations)
@@ -1197,7 +2452,14 @@ namespace {
 	}
 }
 
-IfcEntityInstanceData::IfcEntityInstanceData(const IfcEntityInstanceData& e) {
+IfcEntityInstanceData::IfcEntityInstanceData(const IfcEntityInstanceData& e)
+	: loaded_(true)
+	, in_arena_(false)
+	// A copy is not read from file, so it is never written verbatim
+	, modified_(true)
+	, residency_(not_evictable)
+	, offset_in_file_(0)
+{
 	file = 0;
 	type_ = e.type_;
 	id_ = 0;
@@ -1216,14 +2478,17 @@ IfcEntityInstanceData::IfcEntityInstanceData(const IfcEntityInstanceData& e) {
 static IfcParse::NullArgument static_null_attribute;
 
 Argument* IfcEntityInstanceData::getArgument(size_t i) const {
-	if (attributes_ == 0) {
+	if (!loaded_.load(std::memory_order_acquire)) {
 		load();
+	} else if (residency_.load(std::memory_order_relaxed) == evictable) {
+		residency_.store(evictable_referenced, std::memory_order_relaxed);
 	}
 	if (i < getArgumentCount()) {
-		if (attributes_[i] == nullptr) {
+		Argument* attribute = attributes_[i];
+		if (attribute == nullptr) {
 			return &static_null_attribute;
 		} else {
-			return attributes_[i];
+			return attribute;
 		}
 	} else {
 		throw IfcParse::IfcException("Attribute index out of range");
@@ -1327,7 +2592,7 @@ public:
 };
 
 void IfcEntityInstanceData::setArgument(size_t i, Argument* a, IfcUtil::ArgumentType attr_type, bool make_copy) {
-	if (attributes_ == 0) {
+	if (!loaded_.load(std::memory_order_acquire)) {
 		load();
 	}
 	Argument* new_attribute = a;
@@ -1498,9 +2763,9 @@ void IfcEntityInstanceData::setArgument(size_t i, Argument* a, IfcUtil::Argument
 			if (i == 0 && this->type() && this->file->ifcroot_type() && this->type()->is(*this->file->ifcroot_type())) {
 				try {
 					auto guid = (std::string) *current_attribute;
-					auto it = this->file->internal_guid_map().find(guid);
-					if (it != this->file->internal_guid_map().end() && &it->second->data() == this) {
-						this->file->internal_guid_map().erase(it);
+					auto inst = this->file->internal_guid_map().get(guid);
+					if (inst && &inst->data() == this) {
+						this->file->internal_guid_map().erase(guid);
 					}
 				} catch (IfcParse::IfcException& e) {
 					Logger::Error(e);
@@ -1513,9 +2778,16 @@ void IfcEntityInstanceData::setArgument(size_t i, Argument* a, IfcUtil::Argument
 				apply_individual_instance_visitor(current_attribute, i).apply(visitor);
 			}
 		}
-		delete attributes_[i];
+		// Arguments parsed from file are released together with the file
+		if (!(in_arena_ && file->in_arena(current_attribute))) {
+			delete current_attribute;
+		}
 	}
 
+	// Modified attributes can not be read again from file
+	modified_ = true;
+	residency_.store(not_evictable, std::memory_order_relaxed);
+
 	if (this->file && !inverses_handled) {
 		// Register inverse indices in file
 		register_inverse_visitor visitor(*this->file, *this);
@@ -1524,16 +2796,19 @@ void IfcEntityInstanceData::setArgument(size_t i, Argument* a, IfcUtil::Argument
 
 	attributes_[i] = new_attribute;
 
+	if (this->file && this->type()) {
+		this->file->invalidate_attribute_indices(this->type(), (int) i);
+	}
+
 	// Register new attribute guid in guid map
 	if (this->file) {
 		if (i == 0 && this->type() && this->file->ifcroot_type() && this->type()->is(*this->file->ifcroot_type())) {
 			try {
 				auto guid = (std::string) *new_attribute;
-				auto it = this->file->internal_guid_map().find(guid);
-				if (it != this->file->internal_guid_map().end()) {
+				if (this->file->internal_guid_map().get(guid)) {
 					Logger::Warning("Duplicate guid " + guid);
 				}
-				this->file->internal_guid_map()[guid] = this->file->instance_by_id(this->id());
+				this->file->internal_guid_map().insert_or_assign(guid, this->file->instance_by_id(this->id()));
 			} catch (IfcParse::IfcException& e) {
 				Logger::Error(e);
 			}
@@ -1546,25 +2821,59 @@ void IfcEntityInstanceData::setArgument(size_t i, Argument* a, IfcUtil::Argument
 // Creates the maps
 //
 #ifdef USE_MMAP
-IfcFile::IfcFile(const std::string& fn, bool mmap) {
-	initialize_(new IfcSpfStream(fn, mmap));
+IfcFile::IfcFile(const std::string& fn, bool mmap, unsigned int threads)
+	: filename_(fn)
+{
+	initialize_(new IfcSpfStream(fn, mmap), threads);
+}
+#else
+IfcFile::IfcFile(const std::string& fn, unsigned int threads)
+	: filename_(fn)
+{
+	initialize_(new IfcSpfStream(fn), threads);
+}
+#endif
+
+#ifdef USE_MMAP
+IfcFile::IfcFile(const std::string& fn, const std::vector<std::string>& root_types, bool mmap, unsigned int threads)
+	: filename_(fn)
+	, root_types_(root_types)
+{
+	initialize_(new IfcSpfStream(fn, mmap), threads);
 }
 #else
-IfcFile::IfcFile(const std::string& fn) {
-	initialize_(new IfcSpfStream(fn));
+IfcFile::IfcFile(const std::string& fn, const std::vector<std::string>& root_types, unsigned int threads)
+	: filename_(fn)
+	, root_types_(root_types)
+{
+	initialize_(new IfcSpfStream(fn), threads);
 }
 #endif
 
-IfcFile::IfcFile(std::istream& f, int len) {
-	initialize_(new IfcSpfStream(f, len));
+IfcFile::IfcFile(IfcParse::IfcSpfStream* s, const std::vector<std::string>& root_types, unsigned int threads)
+	: root_types_(root_types)
+{
+	initialize_(s, threads);
+}
+
+IfcFile::IfcFile(const std::string& fn, header_only_t)
+	: filename_(fn)
+	, header_only_(true)
+{
+	// Only the blocks that are accessed are read, not the file as a whole
+	initialize_(new IfcSpfStream(fn, IfcSpfStream::in_blocks_t{}), 1);
+}
+
+IfcFile::IfcFile(std::istream& f, size_t len, unsigned int threads) {
+	initialize_(new IfcSpfStream(f, len), threads);
 }
 
-IfcFile::IfcFile(void* data, int len) {
-	initialize_(new IfcSpfStream(data, len));
+IfcFile::IfcFile(void* data, size_t len, unsigned int threads) {
+	initialize_(new IfcSpfStream(data, len), threads);
 }
 
-IfcFile::IfcFile(IfcParse::IfcSpfStream* s) {
-	initialize_(s);
+IfcFile::IfcFile(IfcParse::IfcSpfStream* s, unsigned int threads) {
+	initialize_(s, threads);
 }
 
 IfcFile::IfcFile(const IfcParse::schema_definition* schema)
@@ -1576,13 +2885,59 @@ IfcFile::IfcFile(const IfcParse::schema_definition* schema)
 	, stream(0)
 {
 	setDefaultHeaderValues();
+	// Nothing to scan, references are added incrementally
+	byref.build();
 }
 
-void IfcFile::initialize_(IfcParse::IfcSpfStream* s) {
-	// Initialize a "C" locale for locale-independent
-	// number parsing. See comment above on line 41.
-	init_locale();
+namespace {
+	// The GlobalId of an instance encountered while scanning
+	struct scanned_guid {
+		boost::uuids::uuid binary;
+		// Only used when the GlobalId is not a valid compressed GUID
+		std::string text;
+		bool is_binary;
+
+		// Reads the GlobalId from a string token. Valid GlobalIds are decoded
+		// directly from the file contents, without creating an argument.
+		explicit scanned_guid(const Token& t)
+			: is_binary(false)
+		{
+			const IfcSpfStream* stream = t.lexer()->stream;
+			const size_t n = IfcGlobalId::length;
+			// Includes the character following the closing quote
+			const char* buffer = stream->compressed() ? nullptr : stream->Buffer((std::min)((size_t) t.startPos + n + 3, stream->Length()));
+			if (t.type == Token_STRING && buffer && t.startPos + n + 2 <= stream->Length()) {
+				const char* str = buffer + t.startPos;
+				// The closing quote should not be the start of an escaped quote
+				const bool terminated = str[0] == '\'' && str[n + 1] == '\'' &&
+					(t.startPos + n + 2 == stream->Length() || str[n + 2] != '\'');
+				is_binary = terminated && IfcGlobalId::decode(str + 1, n, binary);
+			}
+			if (!is_binary) {
+				text = TokenFunc::asString(t);
+			}
+		}
+
+		std::string to_string() const {
+			return is_binary ? IfcGlobalId::encode(binary) : text;
+		}
+
+		void add_to(IfcFile::entity_by_guid_t& guids, IfcUtil::IfcBaseClass* instance) const {
+			if (is_binary ? guids.get(binary) : guids.get(text)) {
+				std::stringstream ss;
+				ss << "Instance encountered with non-unique GlobalId " << to_string();
+				Logger::Message(Logger::LOG_WARNING, ss.str());
+			}
+			if (is_binary) {
+				guids.insert_or_assign(binary, instance);
+			} else {
+				guids.insert_or_assign(text, instance);
+			}
+		}
+	};
+}
 
+void IfcFile::initialize_(IfcParse::IfcSpfStream* s, unsigned int threads) {
 	// prevent heap allocations during parse
 	internal_attribute_vector_.reserve(64);
 	internal_attribute_vector_simple_type_.reserve(16);
@@ -1601,6 +2956,13 @@ void IfcFile::initialize_(IfcParse::IfcSpfStream* s) {
 		return;
 	}
 
+	if (stream->size > Token::max_offset) {
+		// Token offsets are stored in 40 bits
+		Logger::Error("File size exceeds the maximum of " + std::to_string(Token::max_offset + 1) + " bytes");
+		good_ = file_open_status::READ_ERROR;
+		return;
+	}
+
 	tokens = new IfcSpfLexer(stream, this);
 	
 	std::vector<std::string> schemas;
@@ -1616,6 +2978,10 @@ void IfcFile::initialize_(IfcParse::IfcSpfStream* s) {
 		good_ = file_open_status::NO_HEADER;
 	}
 
+	if (header_only_) {
+		return;
+	}
+
 	if (schemas.size() == 1) {
 		try {
 			schema_ = IfcParse::schema_by_name(schemas.front());
@@ -1633,6 +2999,21 @@ void IfcFile::initialize_(IfcParse::IfcSpfStream* s) {
 
 	ifcroot_type_ = schema_->declaration_by_name("IfcRoot");
 
+	if (!root_types_.empty()) {
+		// The persistent index covers all instances, it is not used here
+		scan_partial_(threads);
+		return;
+	}
+
+	if (persistent_index_ && !filename_.empty() && read_index_()) {
+		return;
+	}
+
+	if (threads > 1 && scan_parallel_(threads)) {
+		write_index_();
+		return;
+	}
+
 	boost::circular_buffer<Token> token_stream(3, Token());
 
 	IfcEntityInstanceData* data;
@@ -1644,19 +3025,30 @@ void IfcFile::initialize_(IfcParse::IfcSpfStream* s) {
 
 	int paren_stack_depth = 0;
 	int attribute_index = -1;
+	bool expect_guid = false;
 	
 	while (!stream->eof) {
+		if (expect_guid && paren_stack_depth == 1 && attribute_index == 0) {
+			expect_guid = false;
+			try {
+				scanned_guid(token_stream[0]).add_to(byguid, instance);
+			} catch (const IfcException& ex) {
+				Logger::Message(Logger::LOG_ERROR, ex.what());
+			}
+		}
+
 		if (token_stream[0].type == IfcParse::Token_IDENTIFIER &&
 			token_stream[1].type == IfcParse::Token_OPERATOR &&
 			token_stream[1].value_char == '=' &&
 			token_stream[2].type == IfcParse::Token_KEYWORD)
 		{
 			attribute_index = 0;
+			expect_guid = false;
 
 			current_id = (unsigned) TokenFunc::asIdentifier(token_stream[0]);
 			const IfcParse::declaration* entity_type;
 			try {
-				entity_type = schema_->declaration_by_name(TokenFunc::asStringRef(token_stream[2]));
+				entity_type = declaration_by_keyword(schema_, token_stream[2]);
 			} catch (const IfcException& ex) {
 				Logger::Message(Logger::LOG_ERROR, std::string(ex.what()) + " at offset " + std::to_string(token_stream[2].startPos));
 				goto advance;
@@ -1677,56 +3069,28 @@ void IfcFile::initialize_(IfcParse::IfcSpfStream* s) {
 			}
 
 			if (instance->declaration().is(*ifcroot_type_)) {
-				try {
-					const std::string guid = *instance->data().getArgument(0);
-					if ( byguid.find(guid) != byguid.end() ) {
-						std::stringstream ss;
-						ss << "Instance encountered with non-unique GlobalId " << guid;
-						Logger::Message(Logger::LOG_WARNING,ss.str());
-					}
-					byguid[guid] = instance;
-				} catch (const IfcException& ex) {
-					Logger::Message(Logger::LOG_ERROR,ex.what());
-				}
-				// this has consumed the instance tokens, set stack depth to 0
-				paren_stack_depth = 0;
-				attribute_index = -1;
-			}
-
-			const IfcParse::declaration* ty = &instance->declaration();
-
-			{
-				aggregate_of_instance::ptr insts = instances_by_type_excl_subtypes(ty);
-				if (!insts) {
-					insts = aggregate_of_instance::ptr(new aggregate_of_instance());
-					bytype_excl[ty] = insts;
-				}
-				insts->push(instance);
-			}
-
-			for (;;) {
-				aggregate_of_instance::ptr insts = instances_by_type(ty);
-				if (!insts) {
-					insts = aggregate_of_instance::ptr(new aggregate_of_instance());
-					bytype[ty] = insts;
-				}
-				insts->push(instance);
-				const IfcParse::declaration* pt = ty->as_entity()->supertype();
-				if (pt) {
-					ty = pt;
+				if (lazy_load_) {
+					// The GlobalId is taken from the token stream below
+					expect_guid = true;
 				} else {
-					break;
+					try {
+						const std::string guid = *instance->data().getArgument(0);
+						if (byguid.get(guid)) {
+							std::stringstream ss;
+							ss << "Instance encountered with non-unique GlobalId " << guid;
+							Logger::Message(Logger::LOG_WARNING,ss.str());
+						}
+						byguid.insert_or_assign(guid, instance);
+					} catch (const IfcException& ex) {
+						Logger::Message(Logger::LOG_ERROR,ex.what());
+					}
+					// this has consumed the instance tokens, set stack depth to 0
+					paren_stack_depth = 0;
+					attribute_index = -1;
 				}
 			}
 
-			if (byid.find(current_id) != byid.end()) {
-				std::stringstream ss;
-				ss << "Overwriting instance with name #" << current_id;
-				Logger::Message(Logger::LOG_WARNING,ss.str());
-			}
-			byid[current_id] = instance;
-			
-			MaxId = (std::max)(MaxId, current_id);
+			add_scanned_instance_(instance);
 		} else if (token_stream[0].type == IfcParse::Token_IDENTIFIER && instance) {
 			register_inverse(current_id, instance->declaration().as_entity(), token_stream[0], attribute_index);
 		} else if (token_stream[0].type == IfcParse::Token_OPERATOR && token_stream[0].value_char == '(') {
@@ -1758,19 +3122,497 @@ void IfcFile::initialize_(IfcParse::IfcSpfStream* s) {
 	Logger::Status("\rDone scanning file   ");
 
 	parsing_complete_ = true;
+	byref.build();
 
-	return;
+	write_index_();
 }
 
-void IfcFile::recalculate_id_counter() {
-	entity_by_id_t::key_type k = 0;
-	for (auto& p : byid) {
-		if (p.first > k) {
-			k = p.first;
+void IfcFile::add_scanned_instance_(IfcUtil::IfcBaseClass* instance) {
+	const IfcParse::declaration* ty = &instance->declaration();
+
+	{
+		aggregate_of_instance::ptr insts = instances_by_type_excl_subtypes(ty);
+		if (!insts) {
+			insts = aggregate_of_instance::ptr(new aggregate_of_instance());
+			bytype_excl[ty] = insts;
 		}
+		insts->push(instance);
 	}
-	MaxId = (unsigned int)k;
-}
+
+	for (;;) {
+		aggregate_of_instance::ptr insts = instances_by_type(ty);
+		if (!insts) {
+			insts = aggregate_of_instance::ptr(new aggregate_of_instance());
+			bytype[ty] = insts;
+		}
+		insts->push(instance);
+		const IfcParse::declaration* pt = ty->as_entity()->supertype();
+		if (pt) {
+			ty = pt;
+		} else {
+			break;
+		}
+	}
+
+	const unsigned current_id = instance->data().id();
+	if (byid.count(current_id)) {
+		std::stringstream ss;
+		ss << "Overwriting instance with name #" << current_id;
+		Logger::Message(Logger::LOG_WARNING,ss.str());
+	}
+	byid.insert_or_assign(current_id, instance);
+
+	MaxId = (std::max)(MaxId, current_id);
+}
+
+namespace {
+	// The result of scanning a section of the DATA section. References are
+	// stored by the index of the instance in this chunk, so that the chunks
+	// can be merged into the file maps in file order afterwards.
+	struct scanned_chunk {
+		struct reference {
+			unsigned instance;
+			int id;
+			int attribute_index;
+		};
+
+		// An instance that is only recorded, not created. The type is stored
+		// by its index in the schema to keep the record small.
+		struct record {
+			size_t offset;
+			unsigned id;
+			unsigned type;
+		};
+
+		size_t start, end, stop;
+		bool records_only;
+		std::vector<IfcUtil::IfcBaseClass*> instances;
+		std::vector<record> records;
+		std::vector<std::pair<size_t, scanned_guid>> guids;
+		std::vector<reference> references;
+		std::vector<std::string> errors;
+
+		scanned_chunk(size_t start_, size_t end_, bool records_only_)
+			: start(start_), end(end_), stop((std::numeric_limits<size_t>::max)()), records_only(records_only_)
+		{}
+
+		/// The number of instances scanned
+		size_t size() const {
+			return records_only ? records.size() : instances.size();
+		}
+
+		void discard() {
+			for (auto& inst : instances) {
+				delete inst;
+			}
+			instances.clear();
+			records.clear();
+			guids.clear();
+			references.clear();
+			errors.clear();
+		}
+	};
+
+	// Sections smaller than this are not worth the overhead of a thread
+	const size_t min_chunk_size = 1 << 20;
+
+	// Returns the offset of the first entity instance name following a ';'
+	// at or after offset, or the stream size when none is found. Note that
+	// this can be fooled by a string literal containing a ';', which is why
+	// the chunk boundaries are validated when merging.
+	size_t align_to_instance(IfcSpfStream* stream, size_t offset) {
+		bool after_semicolon = false;
+		for (; !stream->is_eof_at(offset); ++offset) {
+			const char c = stream->Read(offset);
+			if (after_semicolon) {
+				if (c == '#') {
+					return offset;
+				} else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+					after_semicolon = c == ';';
+				}
+			} else if (c == ';') {
+				after_semicolon = true;
+			}
+		}
+		return stream->size;
+	}
+
+	// Scans the instances starting at chunk.start up to the first instance
+	// located at or after chunk.end, using a private cursor on the stream
+	// buffer. This mirrors the sequential scan in IfcFile::initialize_() but
+	// does not modify the file.
+	void scan_chunk(IfcFile* file, const IfcSpfStream* parent, const IfcParse::declaration* ifcroot_type, scanned_chunk& chunk) {
+		IfcSpfStream stream(*parent, chunk.start);
+		IfcSpfLexer lexer(&stream, file);
+
+		boost::circular_buffer<Token> token_stream(3, Token());
+
+		bool expect_guid = false;
+
+		int paren_stack_depth = 0;
+		int attribute_index = -1;
+
+		while (!stream.eof) {
+			if (token_stream[0].type == IfcParse::Token_IDENTIFIER &&
+				token_stream[1].type == IfcParse::Token_OPERATOR &&
+				token_stream[1].value_char == '=' &&
+				token_stream[2].type == IfcParse::Token_KEYWORD)
+			{
+				if (token_stream[0].startPos >= chunk.end) {
+					chunk.stop = token_stream[0].startPos;
+					return;
+				}
+
+				attribute_index = 0;
+
+				const unsigned current_id = (unsigned) TokenFunc::asIdentifier(token_stream[0]);
+				const IfcParse::declaration* entity_type;
+				try {
+					entity_type = declaration_by_keyword(file->schema(), token_stream[2]);
+				} catch (const IfcException& ex) {
+					chunk.errors.push_back(std::string(ex.what()) + " at offset " + std::to_string(token_stream[2].startPos));
+					goto advance;
+				}
+
+				if (chunk.records_only) {
+					chunk.records.push_back({ token_stream[2].startPos, current_id, (unsigned) entity_type->index_in_schema() });
+				} else {
+					chunk.instances.push_back(file->schema()->instantiate(new IfcEntityInstanceData(entity_type, file, current_id, token_stream[2].startPos)));
+				}
+				expect_guid = entity_type->is(*ifcroot_type);
+			} else {
+				if (expect_guid && paren_stack_depth == 1 && attribute_index == 0) {
+					expect_guid = false;
+					try {
+						chunk.guids.push_back({ chunk.size() - 1, scanned_guid(token_stream[0]) });
+					} catch (const IfcException& ex) {
+						chunk.errors.push_back(ex.what());
+					}
+				}
+
+				if (token_stream[0].type == IfcParse::Token_IDENTIFIER && chunk.size()) {
+					chunk.references.push_back({ (unsigned) chunk.size() - 1, token_stream[0].value_int, attribute_index });
+				} else if (token_stream[0].type == IfcParse::Token_OPERATOR && token_stream[0].value_char == '(') {
+					paren_stack_depth++;
+				} else if (token_stream[0].type == IfcParse::Token_OPERATOR && token_stream[0].value_char == ')') {
+					paren_stack_depth--;
+					if (paren_stack_depth == 0) {
+						attribute_index = -1;
+					}
+				} else if (paren_stack_depth == 1 && token_stream[0].type == IfcParse::Token_OPERATOR && token_stream[0].value_char == ',') {
+					attribute_index++;
+				}
+			}
+
+		advance:
+			Token next_token;
+			try {
+				next_token = lexer.Next();
+			} catch (const IfcException& e) {
+				chunk.errors.push_back(std::string(e.what()) + ". Parsing terminated");
+			} catch (...) {
+				chunk.errors.push_back("Parsing terminated");
+			}
+
+			if (next_token.type == Token_NONE) break;
+
+			token_stream.push_back(next_token);
+		}
+	}
+
+	// Scans the DATA section of the stream, from its current position, in
+	// num_chunks sections concurrently. The sections are validated in file
+	// order and rescanned when a boundary did not coincide with the start of
+	// an instance. Sections following the end of the scan are left empty.
+	std::vector<scanned_chunk> scan_chunks(IfcFile* file, IfcSpfStream* stream, const IfcParse::declaration* ifcroot_type, unsigned int num_chunks, bool records_only) {
+		const size_t begin = stream->Tell();
+		const size_t size = stream->size > begin ? stream->size - begin : 0;
+
+		std::vector<size_t> boundaries;
+		boundaries.push_back(begin);
+		for (unsigned int i = 1; i < num_chunks; ++i) {
+			boundaries.push_back((std::max)(boundaries.back(), align_to_instance(stream, begin + size / num_chunks * i)));
+		}
+		boundaries.push_back((std::numeric_limits<size_t>::max)());
+
+		std::vector<scanned_chunk> chunks;
+		for (unsigned int i = 0; i < num_chunks; ++i) {
+			chunks.emplace_back(boundaries[i], boundaries[i + 1], records_only);
+		}
+
+		std::vector<std::thread> workers;
+		for (unsigned int i = 1; i < num_chunks; ++i) {
+			workers.emplace_back(scan_chunk, file, stream, ifcroot_type, std::ref(chunks[i]));
+		}
+		scan_chunk(file, stream, ifcroot_type, chunks.front());
+		for (auto& w : workers) {
+			w.join();
+		}
+
+		size_t position = begin;
+
+		for (auto& chunk : chunks) {
+			if (position == (std::numeric_limits<size_t>::max)()) {
+				// End of file or a fatal error has been encountered in a previous chunk
+				chunk.discard();
+				continue;
+			}
+
+			if (chunk.start != position) {
+				// The chunk boundary did not coincide with the start of an instance,
+				// e.g. because of a ';' in a string literal. Rescan sequentially from
+				// where the previous chunk ended.
+				chunk.discard();
+				chunk.start = position;
+				chunk.stop = (std::numeric_limits<size_t>::max)();
+				scan_chunk(file, stream, ifcroot_type, chunk);
+			}
+
+			position = chunk.stop;
+		}
+
+		return chunks;
+	}
+}
+
+bool IfcFile::scan_parallel_(unsigned int threads) {
+	const size_t begin = stream->Tell();
+	// Compressed files are decompressed sequentially
+	const size_t size = stream->size > begin && !stream->compressed() ? stream->size - begin : 0;
+	const unsigned int num_chunks = (unsigned int) (std::min)((size_t) threads, size / min_chunk_size);
+
+	if (num_chunks <= 1) {
+		return false;
+	}
+
+	Logger::Status("Scanning file...");
+
+	std::vector<scanned_chunk> chunks = scan_chunks(this, stream, ifcroot_type_, num_chunks, false);
+
+	int progress = 0;
+
+	for (auto& chunk : chunks) {
+		for (auto& e : chunk.errors) {
+			Logger::Message(Logger::LOG_ERROR, e);
+		}
+
+		auto guid_it = chunk.guids.begin();
+		auto ref_it = chunk.references.begin();
+
+		for (size_t i = 0; i < chunk.instances.size(); ++i) {
+			IfcUtil::IfcBaseClass* instance = chunk.instances[i];
+			const unsigned current_id = instance->data().id();
+
+			// Update the status after every 1000 instances parsed
+			if (!((++progress) % 1000)) {
+				std::stringstream ss; ss << "\r#" << current_id;
+				Logger::Status(ss.str(), false);
+			}
+
+			if (guid_it != chunk.guids.end() && guid_it->first == i) {
+				guid_it->second.add_to(byguid, instance);
+				++guid_it;
+			}
+
+			add_scanned_instance_(instance);
+
+			for (; ref_it != chunk.references.end() && ref_it->instance == i; ++ref_it) {
+				register_inverse(current_id, instance->declaration().as_entity(), ref_it->id, ref_it->attribute_index);
+			}
+		}
+	}
+
+	Logger::Status("\rDone scanning file   ");
+
+	parsing_complete_ = true;
+	byref.build();
+
+	if (!lazy_load_) {
+		load_scanned_instances_();
+	}
+
+	return true;
+}
+
+void IfcFile::scan_partial_(unsigned int threads) {
+	std::vector<const IfcParse::declaration*> roots;
+	for (auto& name : root_types_) {
+		try {
+			roots.push_back(schema_->declaration_by_name(name));
+		} catch (const IfcException& e) {
+			Logger::Error(e);
+		}
+	}
+
+	const size_t begin = stream->Tell();
+	// Compressed files are decompressed sequentially
+	const size_t size = stream->size > begin && !stream->compressed() ? stream->size - begin : 0;
+	const unsigned int num_chunks = (unsigned int) (std::max)((size_t) 1, (std::min)((size_t) threads, size / min_chunk_size));
+
+	Logger::Status("Scanning file...");
+
+	// Instances are only recorded while scanning, the records are numbered
+	// consecutively over the chunks.
+	std::vector<scanned_chunk> chunks = scan_chunks(this, stream, ifcroot_type_, num_chunks, true);
+
+	std::vector<size_t> chunk_begin;
+	// The references of the record at position i in a chunk are stored in
+	// its references starting at ref_begin[i]
+	std::vector<std::vector<uint32_t>> ref_begin;
+	// The ids of the records and their positions in the order of the file
+	std::vector<std::pair<unsigned, uint32_t>> record_by_id;
+	size_t num_records = 0;
+
+	for (auto& chunk : chunks) {
+		chunk_begin.push_back(num_records);
+		ref_begin.emplace_back();
+		auto& offsets = ref_begin.back();
+		offsets.reserve(chunk.records.size() + 1);
+		size_t j = 0;
+		for (size_t i = 0; i < chunk.records.size(); ++i) {
+			offsets.push_back((uint32_t) j);
+			for (; j < chunk.references.size() && chunk.references[j].instance == i; ++j) {}
+			record_by_id.push_back({ chunk.records[i].id, (uint32_t) (num_records + i) });
+		}
+		offsets.push_back((uint32_t) j);
+		num_records += chunk.records.size();
+	}
+
+	std::sort(record_by_id.begin(), record_by_id.end());
+
+	auto chunk_of = [&chunk_begin](size_t record) {
+		return (size_t) (std::upper_bound(chunk_begin.begin(), chunk_begin.end(), record) - chunk_begin.begin()) - 1;
+	};
+
+	// The forward-reference closure of the instances of the root types
+	std::vector<bool> included(num_records, false);
+	std::vector<size_t> queue;
+
+	for (size_t c = 0; c < chunks.size(); ++c) {
+		for (size_t i = 0; i < chunks[c].records.size(); ++i) {
+			const IfcParse::declaration* type = schema_->declaration_by_name((int) chunks[c].records[i].type);
+			if (std::any_of(roots.begin(), roots.end(), [type](const IfcParse::declaration* root) { return type->is(*root); })) {
+				included[chunk_begin[c] + i] = true;
+				queue.push_back(chunk_begin[c] + i);
+			}
+		}
+	}
+
+	while (!queue.empty()) {
+		const size_t record = queue.back();
+		queue.pop_back();
+		const size_t c = chunk_of(record);
+		const size_t i = record - chunk_begin[c];
+		for (uint32_t j = ref_begin[c][i]; j < ref_begin[c][i + 1]; ++j) {
+			const unsigned id = (unsigned) chunks[c].references[j].id;
+			auto it = std::lower_bound(record_by_id.begin(), record_by_id.end(), std::make_pair(id, (uint32_t) 0));
+			if (it != record_by_id.end() && it->first == id && !included[it->second]) {
+				included[it->second] = true;
+				queue.push_back(it->second);
+			}
+		}
+	}
+
+	std::vector<std::pair<unsigned, uint32_t>>().swap(record_by_id);
+	std::vector<size_t>().swap(queue);
+
+	// Only the records and references of the closure are retained, the
+	// instances are created from these afterwards
+	for (size_t c = 0; c < chunks.size(); ++c) {
+		auto& chunk = chunks[c];
+		size_t num_included = 0, num_included_refs = 0;
+		auto guid_it = chunk.guids.begin(), guid_out = chunk.guids.begin();
+		for (size_t i = 0; i < chunk.records.size(); ++i) {
+			for (; guid_it != chunk.guids.end() && guid_it->first < i; ++guid_it) {}
+			if (!included[chunk_begin[c] + i]) {
+				continue;
+			}
+			if (guid_it != chunk.guids.end() && guid_it->first == i) {
+				*guid_out++ = { num_included, guid_it->second };
+			}
+			for (uint32_t j = ref_begin[c][i]; j < ref_begin[c][i + 1]; ++j) {
+				chunk.references[num_included_refs] = chunk.references[j];
+				chunk.references[num_included_refs++].instance = (unsigned) num_included;
+			}
+			chunk.records[num_included++] = chunk.records[i];
+		}
+		chunk.records.resize(num_included);
+		chunk.records.shrink_to_fit();
+		chunk.references.resize(num_included_refs);
+		chunk.references.shrink_to_fit();
+		chunk.guids.erase(guid_out, chunk.guids.end());
+		chunk.guids.shrink_to_fit();
+		std::vector<uint32_t>().swap(ref_begin[c]);
+	}
+
+	std::vector<bool>().swap(included);
+
+	int progress = 0;
+
+	for (auto& chunk : chunks) {
+		for (auto& e : chunk.errors) {
+			Logger::Message(Logger::LOG_ERROR, e);
+		}
+
+		auto guid_it = chunk.guids.begin();
+		auto ref_it = chunk.references.begin();
+
+		for (size_t i = 0; i < chunk.records.size(); ++i) {
+			const scanned_chunk::record& r = chunk.records[i];
+			IfcUtil::IfcBaseClass* instance = schema_->instantiate(new IfcEntityInstanceData(schema_->declaration_by_name((int) r.type), this, r.id, r.offset));
+
+			if (!((++progress) % 1000)) {
+				std::stringstream ss; ss << "\r#" << r.id;
+				Logger::Status(ss.str(), false);
+			}
+
+			if (guid_it != chunk.guids.end() && guid_it->first == i) {
+				guid_it->second.add_to(byguid, instance);
+				++guid_it;
+			}
+
+			add_scanned_instance_(instance);
+
+			for (; ref_it != chunk.references.end() && ref_it->instance == i; ++ref_it) {
+				register_inverse(r.id, instance->declaration().as_entity(), ref_it->id, ref_it->attribute_index);
+			}
+		}
+
+		// Release the records of this chunk before continuing with the next
+		chunk.discard();
+	}
+
+	Logger::Status("\rDone scanning file   ");
+
+	parsing_complete_ = true;
+	byref.build();
+
+	if (!lazy_load_) {
+		load_scanned_instances_();
+	}
+}
+
+void IfcFile::load_scanned_instances_() {
+	// Loading may add instances to the file, so iterate over a copy
+	std::vector<IfcUtil::IfcBaseClass*> instances;
+	instances.reserve(byid.size());
+	for (auto& p : byid) {
+		instances.push_back(p.second);
+	}
+	for (auto& inst : instances) {
+		inst->data().load();
+	}
+}
+
+void IfcFile::recalculate_id_counter() {
+	entity_by_id_t::key_type k = 0;
+	for (auto& p : byid) {
+		if (p.first > k) {
+			k = p.first;
+		}
+	}
+	MaxId = (unsigned int)k;
+}
 
 class traversal_recorder {
 	aggregate_of_instance::ptr list_;
@@ -1811,55 +3653,227 @@ public:
 
 class traversal_visitor {
 private:
-	std::set<IfcUtil::IfcBaseClass*>& visited_;
-	traversal_recorder& list_;
-	int level_;
-	int max_level_;
+	std::vector<IfcUtil::IfcBaseClass*>& children_;
 
 public:
-	traversal_visitor(std::set<IfcUtil::IfcBaseClass*>& visited, traversal_recorder& list, int level, int max_level)
-		: visited_(visited)
-		, list_(list)
-		, level_(level)
-		, max_level_(max_level)
+	traversal_visitor(std::vector<IfcUtil::IfcBaseClass*>& children)
+		: children_(children)
 	{}
 
-	void operator()(IfcUtil::IfcBaseClass* inst, int index);
+	void operator()(IfcUtil::IfcBaseClass* inst, int /* index */) {
+		children_.push_back(inst);
+	}
 };
 
-void traverse_(IfcUtil::IfcBaseClass* instance, std::set<IfcUtil::IfcBaseClass*>& visited, traversal_recorder& list, int level, int max_level) {
-	if (visited.find(instance) != visited.end()) {
+namespace {
+	// Keeps track of the instances visited during traversal in a bitmap by id.
+	// Instances without an id or a file, or from another file than the first
+	// instance in the bitmap, are kept in a set, as their ids can coincide.
+	// As in instance_by_id_map, the bitmap only covers the ids justified by
+	// the number of instances in the file, sparse ids are kept in the set as
+	// well. Only the bits that were set are cleared, so that the same state
+	// can be reused cheaply for many small traversals.
+	class traversal_visited {
+		// The minimal number of ids covered by the bitmap before its size is
+		// limited relative to the number of instances in the file
+		static const size_t min_dense_size = 1 << 16;
+		// The bitmap covers at most this many ids per instance
+		static const size_t max_dense_ratio = 4;
+
+		const IfcParse::IfcFile* file_ = nullptr;
+		size_t limit_ = 0;
+		std::vector<bool> by_id_;
+		std::vector<unsigned> ids_;
+		std::set<IfcUtil::IfcBaseClass*> other_;
+
+	public:
+		/// Returns true when instance was not visited before
+		bool insert(IfcUtil::IfcBaseClass* instance) {
+			const unsigned id = instance->data().id();
+			const IfcParse::IfcFile* file = instance->data().file;
+			if (id == 0 || file == nullptr || (file_ && file != file_)) {
+				return other_.insert(instance).second;
+			}
+			if (file_ == nullptr) {
+				file_ = file;
+				limit_ = (std::max)(min_dense_size, max_dense_ratio * (file->instance_count() + 1));
+				if (by_id_.size() > limit_) {
+					// Left by the traversal of a larger file, the bits are all
+					// cleared so the bitmap can be released
+					std::vector<bool>().swap(by_id_);
+					std::vector<unsigned>().swap(ids_);
+				}
+			}
+			if (id >= limit_) {
+				return other_.insert(instance).second;
+			}
+			if (id >= by_id_.size()) {
+				by_id_.resize((std::min)(limit_, (std::max)((size_t) id + 1, by_id_.size() * 2)));
+			}
+			if (by_id_[id]) {
+				return false;
+			}
+			by_id_[id] = true;
+			ids_.push_back(id);
+			return true;
+		}
+
+		void clear() {
+			for (auto& id : ids_) {
+				by_id_[id] = false;
+			}
+			ids_.clear();
+			other_.clear();
+			file_ = nullptr;
+		}
+	};
+
+	const size_t traversal_visited::min_dense_size;
+	const size_t traversal_visited::max_dense_ratio;
+
+	// Hands out the visited state of the thread, so that it is reused by
+	// subsequent traversals, unless it is in use by an enclosing traversal.
+	class traversal_visited_lease {
+		std::unique_ptr<traversal_visited> visited_;
+
+		static std::unique_ptr<traversal_visited>& idle_() {
+			thread_local std::unique_ptr<traversal_visited> visited;
+			return visited;
+		}
+
+	public:
+		traversal_visited_lease()
+			: visited_(std::move(idle_()))
+		{
+			if (visited_) {
+				visited_->clear();
+			} else {
+				visited_.reset(new traversal_visited);
+			}
+		}
+
+		~traversal_visited_lease() {
+			idle_() = std::move(visited_);
+		}
+
+		traversal_visited& operator*() { return *visited_; }
+	};
+}
+
+void traverse_(IfcUtil::IfcBaseClass* instance, traversal_visited& visited, traversal_recorder& list, int level, int max_level) {
+	if (!visited.insert(instance)) {
 		return;
 	}
-	visited.insert(instance);
 	list.push_back(level, instance);
 
 	if (level >= max_level && max_level > 0) return;
 
-	traversal_visitor visit(visited, list, level + 1, max_level);
+	// The referenced instances are collected before descending, so that the
+	// attributes of this instance can be released while loading others.
+	std::vector<IfcUtil::IfcBaseClass*> children;
+	traversal_visitor visit(children);
 	apply_individual_instance_visitor(&instance->data()).apply(visit);
-}
 
-void traversal_visitor::operator()(IfcUtil::IfcBaseClass* inst, int /* index */) {
-	traverse_(inst, visited_, list_, level_, max_level_);
+	for (auto& child : children) {
+		traverse_(child, visited, list, level + 1, max_level);
+	}
 }
 
 aggregate_of_instance::ptr IfcParse::traverse(IfcUtil::IfcBaseClass* instance, int max_level) {
-	std::set<IfcUtil::IfcBaseClass*> visited;
 	traversal_recorder r(0);
-	traverse_(instance, visited, r, 0, max_level);
+	traversal_visited_lease visited;
+	traverse_(instance, *visited, r, 0, max_level);
 	return r.get_list();
 }
 
 // I'm cheating this isn't breadth-first, but rather we record visited instances
 // keeping track of their rank and return a list ordered by rank. Is this equivalent?
 aggregate_of_instance::ptr IfcParse::traverse_breadth_first(IfcUtil::IfcBaseClass* instance, int max_level) {
-	std::set<IfcUtil::IfcBaseClass*> visited;
 	traversal_recorder r(1);
-	traverse_(instance, visited, r, 0, max_level);
+	traversal_visited_lease visited;
+	traverse_(instance, *visited, r, 0, max_level);
 	return r.get_list();
 }
 
+aggregate_of_instance::ptr IfcParse::traverse_many(const aggregate_of_instance::ptr& roots, int max_level) {
+	traversal_recorder r(0);
+	traversal_visited_lease visited;
+	if (max_level <= 0) {
+		// Every instance reached is expanded fully, so instances visited for
+		// previous roots do not need to be visited again
+		for (auto& root : *roots) {
+			traverse_(root, *visited, r, 0, max_level);
+		}
+		return r.get_list();
+	}
+	// With a maximum level, an instance reached at the maximum level from one
+	// root is expanded further when it is reached at a lower level from
+	// another, so every root is traversed separately.
+	aggregate_of_instance::ptr list(new aggregate_of_instance);
+	for (auto& root : *roots) {
+		traversal_recorder root_recorder(0);
+		{
+			traversal_visited_lease root_visited;
+			traverse_(root, *root_visited, root_recorder, 0, max_level);
+		}
+		for (auto& instance : *root_recorder.get_list()) {
+			if ((*visited).insert(instance)) {
+				list->push(instance);
+			}
+		}
+	}
+	return list;
+}
+
+std::vector<aggregate_of_instance::ptr> IfcParse::traverse_each(const aggregate_of_instance::ptr& roots, int max_level, unsigned int threads) {
+	std::vector<aggregate_of_instance::ptr> closures(roots->size());
+
+	std::atomic<size_t> next(0);
+	std::exception_ptr error;
+	std::mutex error_mutex;
+
+	auto work = [&]() {
+		try {
+			for (size_t i; (i = next++) < closures.size();) {
+				IfcUtil::IfcBaseClass* root = *(roots->begin() + i);
+				// Held per root, so that attributes released by other threads
+				// to meet the memory budget of the file are freed in between
+				IfcFile::attribute_lease lease(root->data().file);
+				traversal_recorder r(0);
+				traversal_visited_lease visited;
+				traverse_(root, *visited, r, 0, max_level);
+				closures[i] = r.get_list();
+			}
+		} catch (...) {
+			std::lock_guard<std::mutex> lk(error_mutex);
+			error = std::current_exception();
+			// Have the other threads stop at their next root
+			next = closures.size();
+		}
+	};
+
+	threads = (unsigned int) (std::min)((size_t) (std::max)(threads, 1U), closures.size());
+	if (threads <= 1) {
+		work();
+	} else {
+		std::vector<std::thread> workers;
+		workers.reserve(threads - 1);
+		for (unsigned int i = 1; i < threads; ++i) {
+			workers.emplace_back(work);
+		}
+		work();
+		for (auto& w : workers) {
+			w.join();
+		}
+	}
+
+	if (error) {
+		std::rethrow_exception(error);
+	}
+
+	return closures;
+}
+
 /// @note: for backwards compatibility
 aggregate_of_instance::ptr IfcFile::traverse(IfcUtil::IfcBaseClass* instance, int max_level) {
 	return IfcParse::traverse(instance, max_level);
@@ -1870,6 +3884,10 @@ aggregate_of_instance::ptr IfcFile::traverse_breadth_first(IfcUtil::IfcBaseClass
 	return IfcParse::traverse_breadth_first(instance, max_level);
 }
 
+aggregate_of_instance::ptr IfcFile::traverse_many(const aggregate_of_instance::ptr& roots, int max_level) {
+	return IfcParse::traverse_many(roots, max_level);
+}
+
 void IfcFile::addEntities(aggregate_of_instance::ptr es) {
 	for( aggregate_of_instance::it i = es->begin(); i != es->end(); ++ i ) {
 		addEntity(*i);
@@ -1877,7 +3895,7 @@ void IfcFile::addEntities(aggregate_of_instance::ptr es) {
 }
 
 IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity, int id) {
-	if (id != -1 && byid.find((unsigned)id) != byid.end()) {
+	if (id != -1 && byid.count((unsigned)id)) {
 		throw IfcParse::IfcException("An instance with id " + boost::lexical_cast<std::string>(id) + " is already part of this file");
 	}
 
@@ -2054,12 +4072,12 @@ IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity, int id)
 	if (new_entity->declaration().is(*ifcroot_type_)) {
 		try {
 			const std::string guid = *new_entity->data().getArgument(0);
-			if ( byguid.find(guid) != byguid.end() ) {
+			if (byguid.get(guid)) {
 				std::stringstream ss;
 				ss << "Overwriting entity with guid " << guid;
 				Logger::Message(Logger::LOG_WARNING,ss.str());
 			}
-			byguid[guid] = new_entity;
+			byguid.insert_or_assign(guid, new_entity);
 		} catch (const IfcException& ex) {
 			Logger::Message(Logger::LOG_ERROR,ex.what());
 		}
@@ -2111,7 +4129,7 @@ IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity, int id)
 			new_id = new_entity->data().id();
 		}
 
-		if (byid.find(new_id) != byid.end()) {
+		if (byid.count(new_id)) {
 			// This should not happen
 			std::stringstream ss;
 			ss << "Overwriting entity with id " << new_id;
@@ -2119,7 +4137,7 @@ IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity, int id)
 		}
 
 		// The mapping by entity instance name is updated.
-		byid[new_id] = new_entity;
+		byid.insert_or_assign(new_id, new_entity);
 	} else if (!new_entity->data().file) {
 		// For non-entity instances, no mappings are updated, but the file
 		// pointer has to be set, so that actual copies are created in subsequent
@@ -2134,6 +4152,11 @@ IfcUtil::IfcBaseClass* IfcFile::addEntity(IfcUtil::IfcBaseClass* entity, int id)
 		build_inverses_(new_entity);
 	}
 
+	// Added typed values are not yet the value of any attribute of an indexed instance
+	if (new_entity->declaration().as_entity()) {
+		invalidate_attribute_indices(&new_entity->declaration());
+	}
+
 	return new_entity;
 }
 
@@ -2168,88 +4191,143 @@ void IfcFile::removeEntity(IfcUtil::IfcBaseClass* entity) {
 	}
 }
 
+namespace {
+	// Below this number of instances, membership of the instances being
+	// deleted is looked up in the ordered index instead of a bitmap by id
+	const size_t deletion_bitmap_threshold = 64;
+}
+
 void IfcFile::process_deletion_() {
+	if (batch_deletion_ids_.empty()) {
+		return;
+	}
 
-	for (auto& id : batch_deletion_ids_.get<0>()) {
-		auto entity = instance_by_id(id);
+	const auto& deleted_ids = batch_deletion_ids_.get<1>();
+	const bool use_bitmap = batch_deletion_ids_.size() >= deletion_bitmap_threshold;
+	std::vector<bool> deleted_bitmap;
+	if (use_bitmap) {
+		deleted_bitmap.resize((size_t) MaxId + 1);
+		for (auto& id : batch_deletion_ids_.get<0>()) {
+			if ((unsigned) id < deleted_bitmap.size()) {
+				deleted_bitmap[id] = true;
+			}
+		}
+	}
+	auto is_deleted = [&](unsigned id) {
+		if (use_bitmap) {
+			return id < deleted_bitmap.size() && deleted_bitmap[id];
+		}
+		return deleted_ids.find((int) id) != deleted_ids.end();
+	};
 
-		aggregate_of_instance::ptr references = instances_by_reference(id);
+	std::vector<IfcUtil::IfcBaseClass*> entities;
+	entities.reserve(batch_deletion_ids_.size());
+	std::set<const IfcParse::declaration*> deleted_types;
+	for (auto& id : batch_deletion_ids_.get<0>()) {
+		entities.push_back(instance_by_id(id));
+		deleted_types.insert(&entities.back()->declaration());
+	}
+	for (auto& type : deleted_types) {
+		invalidate_attribute_indices(type);
+	}
 
-		// Alter entity instances with INVERSE relations to the entity being 
-		// deleted. This is necessary to maintain a valid IFC file, because 
-		// dangling references to it's entities name should be removed. At this
-		// moment, inversely related instances affected by the removal of the
-		// entity being deleted are not deleted themselves.
-		if (references) {
-			for (aggregate_of_instance::it iit = references->begin(); iit != references->end(); ++iit) {
-				IfcUtil::IfcBaseEntity* related_instance = (IfcUtil::IfcBaseEntity*) *iit;
+	// For a few instances, comparing addresses avoids reading the id of
+	// every instance in the lists by type
+	std::vector<IfcUtil::IfcBaseClass*> sorted_entities;
+	if (!use_bitmap) {
+		sorted_entities = entities;
+		std::sort(sorted_entities.begin(), sorted_entities.end());
+	}
+	auto is_deleted_instance = [&](IfcUtil::IfcBaseClass* inst) {
+		if (use_bitmap) {
+			return is_deleted(inst->data().id());
+		}
+		return std::binary_search(sorted_entities.begin(), sorted_entities.end(), inst);
+	};
 
-				if (std::find(batch_deletion_ids_.begin(), batch_deletion_ids_.end(), related_instance->data().id()) != batch_deletion_ids_.end()) {
-					continue;
+	// The instances that refer to the instances being deleted, and are not
+	// deleted themselves, in the order they are encountered. These are
+	// updated once, regardless of the number of deleted instances they
+	// refer to.
+	std::vector<IfcUtil::IfcBaseClass*> referrers;
+	{
+		boost::unordered_set<unsigned> encountered;
+		for (auto& id : batch_deletion_ids_.get<0>()) {
+			byref.for_each(id, [&](const IfcParse::inverse_index::reference& r) {
+				if (!is_deleted((unsigned) r.instance) && encountered.insert((unsigned) r.instance).second) {
+					referrers.push_back(instance_by_id(r.instance));
 				}
+			});
+		}
+	}
+
+	// Alter entity instances with INVERSE relations to the entities being 
+	// deleted. This is necessary to maintain a valid IFC file, because 
+	// dangling references to it's entities name should be removed. At this
+	// moment, inversely related instances affected by the removal of the
+	// entities being deleted are not deleted themselves.
+	for (auto& related_instance : referrers) {
+		for (size_t i = 0; i < related_instance->data().getArgumentCount(); ++i) {
+			Argument* attr = related_instance->data().getArgument(i);
+			if (attr->isNull()) continue;
 
-				for (size_t i = 0; i < related_instance->data().getArgumentCount(); ++i) {
-					Argument* attr = related_instance->data().getArgument(i);
-					if (attr->isNull()) continue;
-
-					IfcUtil::ArgumentType attr_type = attr->type();
-					switch (attr_type) {
-					case IfcUtil::Argument_ENTITY_INSTANCE: {
-						IfcUtil::IfcBaseClass* instance_attribute = *attr;
-						if (instance_attribute == entity) {
-							IfcWrite::IfcWriteArgument* copy = new IfcWrite::IfcWriteArgument();
-							copy->set(boost::blank());
-							related_instance->data().setArgument(i, copy);
-						} }
-															break;
-					case IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE: {
-						aggregate_of_instance::ptr instance_list = *attr;
-						if (instance_list->contains(entity)) {
-							IfcWrite::IfcWriteArgument* copy = new IfcWrite::IfcWriteArgument();
-							instance_list->remove(entity);
-							if (!instance_list->size() && related_instance->declaration().as_entity()->attribute_by_index(i)->optional()) {
-								// @todo we can also check the lower bound of the attribute type before setting to null.
-								copy->set(boost::blank());
-							} else {
-								copy->set(instance_list);
-							}
-							related_instance->data().setArgument(i, copy);
-						} }
-																		 break;
-					case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: {
-						aggregate_of_aggregate_of_instance::ptr instance_list_list = *attr;
-						if (instance_list_list->contains(entity)) {
-							aggregate_of_aggregate_of_instance::ptr new_list(new aggregate_of_aggregate_of_instance);
-							for (aggregate_of_aggregate_of_instance::outer_it it = instance_list_list->begin(); it != instance_list_list->end(); ++it) {
-								std::vector<IfcUtil::IfcBaseClass*> instances = *it;
-								std::vector<IfcUtil::IfcBaseClass*>::iterator jt;
-								while ((jt = std::find(instances.begin(), instances.end(), entity)) != instances.end()) {
-									instances.erase(jt);
-								}
-								new_list->push(instances);
-							}
-
-							IfcWrite::IfcWriteArgument* copy = new IfcWrite::IfcWriteArgument();
-							copy->set(new_list);
-							related_instance->data().setArgument(i, copy);
-						} }
-																					  break;
-					default: break;
+			IfcUtil::ArgumentType attr_type = attr->type();
+			switch (attr_type) {
+			case IfcUtil::Argument_ENTITY_INSTANCE: {
+				IfcUtil::IfcBaseClass* instance_attribute = *attr;
+				if (is_deleted_instance(instance_attribute)) {
+					IfcWrite::IfcWriteArgument* copy = new IfcWrite::IfcWriteArgument();
+					copy->set(boost::blank());
+					related_instance->data().setArgument(i, copy);
+				} }
+				break;
+			case IfcUtil::Argument_AGGREGATE_OF_ENTITY_INSTANCE: {
+				aggregate_of_instance::ptr instance_list = *attr;
+				const unsigned int size = instance_list->size();
+				instance_list->remove_if(is_deleted_instance);
+				if (instance_list->size() != size) {
+					IfcWrite::IfcWriteArgument* copy = new IfcWrite::IfcWriteArgument();
+					if (!instance_list->size() && related_instance->declaration().as_entity()->attribute_by_index(i)->optional()) {
+						// @todo we can also check the lower bound of the attribute type before setting to null.
+						copy->set(boost::blank());
+					} else {
+						copy->set(instance_list);
 					}
+					related_instance->data().setArgument(i, copy);
+				} }
+				break;
+			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: {
+				aggregate_of_aggregate_of_instance::ptr instance_list_list = *attr;
+				aggregate_of_aggregate_of_instance::ptr new_list(new aggregate_of_aggregate_of_instance);
+				bool changed = false;
+				for (aggregate_of_aggregate_of_instance::outer_it it = instance_list_list->begin(); it != instance_list_list->end(); ++it) {
+					std::vector<IfcUtil::IfcBaseClass*> instances = *it;
+					const size_t size = instances.size();
+					instances.erase(std::remove_if(instances.begin(), instances.end(), is_deleted_instance), instances.end());
+					changed = changed || instances.size() != size;
+					new_list->push(instances);
 				}
+				if (changed) {
+					IfcWrite::IfcWriteArgument* copy = new IfcWrite::IfcWriteArgument();
+					copy->set(new_list);
+					related_instance->data().setArgument(i, copy);
+				} }
+				break;
+			default: break;
 			}
 		}
+	}
 
-		if (!batch_mode_) {
-			byref.erase(
-				byref.lower_bound({ id,-1,-1 }), 
-				byref.upper_bound({ id, std::numeric_limits<int>::max(), std::numeric_limits<int>::max() })
-			);
-
-			byref_excl.erase(id);
+	if (batch_mode_) {
+		byref.remove_if([&is_deleted](int to, const IfcParse::inverse_index::reference& r) {
+			return is_deleted((unsigned) to) || is_deleted((unsigned) r.instance);
+		});
+	} else {
+		for (auto& entity : entities) {
+			const unsigned id = entity->data().id();
+			byref.remove_instance(id);
 
 			// This is based on traversal which needs instances to still be contained in the map.
-			// another option would be to keep byid intact for the remainder of this loop
 			aggregate_of_instance::ptr entity_attributes = traverse(entity, 1);
 			for (aggregate_of_instance::it it = entity_attributes->begin(); it != entity_attributes->end(); ++it) {
 				IfcUtil::IfcBaseClass* entity_attribute = *it;
@@ -2257,112 +4335,68 @@ void IfcFile::process_deletion_() {
 				const unsigned int name = entity_attribute->data().id();
 				// Do not update inverses for simple types (which have id()==0 in IfcOpenShell).
 				if (name != 0) {
-					{
-						auto lower = byref.lower_bound({ name,-1,-1 });
-						auto upper = byref.upper_bound({ name, std::numeric_limits<int>::max(), std::numeric_limits<int>::max() });
-
-						for (auto byref_it = lower; byref_it != upper; ++byref_it) {
-							auto& ids = byref_it->second;
-							ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
-						}
-					}
-					{
-						auto byref_it = byref_excl.find(name);
-						if (byref_it != byref_excl.end()) {
-							auto& ids = byref_it->second;
-							ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
-						}
-					}
+					byref.remove_referrer((int) name, id);
 				}
 			}
 		}
+	}
 
-		if (entity->declaration().is(*ifcroot_type_) && !entity->data().getArgument(0)->isNull()) {
-			const std::string global_id = *entity->data().getArgument(0);
-			auto it = byguid.find(global_id);
-			if (it != byguid.end()) {
-				byguid.erase(it);
-			}
-			else {
-				Logger::Warning("GlobalId on rooted instance not encountered in map");
-			}
+	// The lists by type are compacted once, for all instances deleted. A
+	// single instance, the common case outside of batch mode, is looked up
+	// by address directly.
+	auto compact = [&](const aggregate_of_instance::ptr& instances) {
+		if (entities.size() == 1) {
+			instances->remove(entities.front());
+		} else {
+			instances->remove_if(is_deleted_instance);
 		}
-
-		byid.erase(byid.find(id));
-
+	};
+	std::set<const IfcParse::declaration*> types_excl, types;
+	for (auto& entity : entities) {
 		const IfcParse::declaration* ty = &entity->declaration();
-
-		{
-			aggregate_of_instance::ptr instances_of_same_type = instances_by_type_excl_subtypes(ty);
-			instances_of_same_type->remove(entity);
+		types_excl.insert(ty);
+		for (; ty && types.insert(ty).second; ty = ty->as_entity() ? ty->as_entity()->supertype() : nullptr) {}
+	}
+	for (auto& ty : types_excl) {
+		aggregate_of_instance::ptr instances_of_same_type = instances_by_type_excl_subtypes(ty);
+		if (instances_of_same_type) {
+			compact(instances_of_same_type);
 			if (instances_of_same_type->size() == 0) {
 				bytype_excl.erase(ty);
 			}
 		}
-
-		for (;;) {
-			aggregate_of_instance::ptr instances_of_same_type = instances_by_type(ty);
-			if (instances_of_same_type) {
-				instances_of_same_type->remove(entity);
-			}
+	}
+	for (auto& ty : types) {
+		aggregate_of_instance::ptr instances_of_same_type = instances_by_type(ty);
+		if (instances_of_same_type) {
+			compact(instances_of_same_type);
 			if (instances_of_same_type->size() == 0) {
 				bytype.erase(ty);
 			}
-
-			const IfcParse::declaration* pt = ty->as_entity()->supertype();
-			if (pt) {
-				ty = pt;
-			}
-			else {
-				break;
-			}
 		}
+	}
 
-		// entity_file_map is in place to prevent duplicate definitions with usage of add().
-		// Upon deletion the pairs need to be erased.
-		for (auto it = entity_file_map.begin(); it != entity_file_map.end();) {
-			if (it->second == entity) {
-				it = entity_file_map.erase(it);
-			} else {
-				++it;
-			}
+	// entity_file_map is in place to prevent duplicate definitions with usage of add().
+	// Upon deletion the pairs need to be erased.
+	for (auto it = entity_file_map.begin(); it != entity_file_map.end();) {
+		if (is_deleted_instance(it->second)) {
+			it = entity_file_map.erase(it);
+		} else {
+			++it;
 		}
-
-		delete entity;
-
 	}
-	
-	if (batch_mode_) {
-		for (auto it = byref.begin(); it != byref.end();) {
-			bool do_delete = batch_deletion_ids_.get<1>().find(std::get<INSTANCE_ID>(it->first)) != batch_deletion_ids_.get<1>().end();
-			if (!do_delete) {
-				it->second.erase(std::remove_if(it->second.begin(), it->second.end(), [this](int x) {
-					return batch_deletion_ids_.get<1>().find(x) != batch_deletion_ids_.get<1>().end();
-				}), it->second.end());
-				do_delete = it->second.empty();
-			}
-			if (do_delete) {
-				it = byref.erase(it);
-			}
-			else {
-				++it;
-			}
-		}
 
-		for (auto it = byref_excl.begin(); it != byref_excl.end();) {
-			bool do_delete = batch_deletion_ids_.get<1>().find(it->first) != batch_deletion_ids_.get<1>().end();
-			if (!do_delete) {
-				it->second.erase(std::remove_if(it->second.begin(), it->second.end(), [this](int x) {
-					return batch_deletion_ids_.get<1>().find(x) != batch_deletion_ids_.get<1>().end();
-				}), it->second.end());
-				do_delete = it->second.empty();
-			}
-			if (do_delete) {
-				it = byref_excl.erase(it);
-			} else {
-				++it;
+	for (auto& entity : entities) {
+		if (entity->declaration().is(*ifcroot_type_) && !entity->data().getArgument(0)->isNull()) {
+			const std::string global_id = *entity->data().getArgument(0);
+			if (!byguid.erase(global_id)) {
+				Logger::Warning("GlobalId on rooted instance not encountered in map");
 			}
 		}
+
+		byid.erase(entity->data().id());
+
+		delete entity;
 	}
 
 	batch_deletion_ids_.clear();
@@ -2388,41 +4422,349 @@ aggregate_of_instance::ptr IfcFile::instances_by_type_excl_subtypes(const std::s
 
 aggregate_of_instance::ptr IfcFile::instances_by_reference(int t) {
 	aggregate_of_instance::ptr ret(new aggregate_of_instance);
-	for (auto& i : byref_excl[t]) {
-		ret->push(instance_by_id(i));
-	}
+	byref.for_each(t, [this, &ret](const IfcParse::inverse_index::reference& r) {
+		ret->push(instance_by_id(r.instance));
+	});
 	return ret;
 }
 
+std::shared_ptr<const attribute_value_index> IfcFile::attribute_index_(const IfcParse::entity* type, size_t attribute_index) {
+	if (attribute_index >= type->attribute_count()) {
+		throw IfcAttributeOutOfRangeException("Attribute index out of range for " + type->name());
+	}
+	const attribute_indices_t::key_type key(type, attribute_index);
+	size_t generation;
+	{
+		std::lock_guard<std::mutex> lock(attribute_indices_mutex_);
+		auto it = attribute_indices_.find(key);
+		if (it != attribute_indices_.end()) {
+			return it->second;
+		}
+		generation = attribute_indices_generation_;
+	}
+	// Built without holding the lock, as reading the attributes loads instances
+	std::shared_ptr<const attribute_value_index> index = std::make_shared<const attribute_value_index>(instances_by_type(type), attribute_index);
+	{
+		std::lock_guard<std::mutex> lock(attribute_indices_mutex_);
+		if (generation == attribute_indices_generation_) {
+			attribute_indices_.insert({ key, index });
+		}
+	}
+	return index;
+}
+
+std::shared_ptr<const attribute_value_index> IfcFile::attribute_index_(const std::string& type, const std::string& attribute) {
+	const IfcParse::entity* entity = schema()->declaration_by_name(type)->as_entity();
+	if (entity == nullptr) {
+		throw IfcException(type + " is not an entity");
+	}
+	const ptrdiff_t attribute_index = entity->attribute_index(attribute);
+	if (attribute_index < 0) {
+		throw IfcException(attribute + " not found on " + entity->name());
+	}
+	return attribute_index_(entity, (size_t) attribute_index);
+}
+
+aggregate_of_instance::ptr IfcFile::instances_by_attribute_value(const IfcParse::entity* type, size_t attribute_index, const attribute_value& value) {
+	return attribute_index_(type, attribute_index)->find(value);
+}
+
+aggregate_of_instance::ptr IfcFile::instances_by_attribute_value(const std::string& type, const std::string& attribute, const attribute_value& value) {
+	return attribute_index_(type, attribute)->find(value);
+}
+
+aggregate_of_instance::ptr IfcFile::instances_by_attribute_prefix(const IfcParse::entity* type, size_t attribute_index, const std::string& prefix) {
+	return attribute_index_(type, attribute_index)->find_prefix(prefix);
+}
+
+aggregate_of_instance::ptr IfcFile::instances_by_attribute_prefix(const std::string& type, const std::string& attribute, const std::string& prefix) {
+	return attribute_index_(type, attribute)->find_prefix(prefix);
+}
+
+void IfcFile::invalidate_attribute_indices(const IfcParse::declaration* type, int attribute_index) {
+	std::lock_guard<std::mutex> lock(attribute_indices_mutex_);
+	++attribute_indices_generation_;
+	for (auto it = attribute_indices_.begin(); it != attribute_indices_.end();) {
+		const bool affected = type->as_entity() == nullptr || (
+			type->is(*it->first.first) &&
+			(attribute_index == -1 || (size_t) attribute_index == it->first.second));
+		if (affected) {
+			it = attribute_indices_.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
 IfcUtil::IfcBaseClass* IfcFile::instance_by_id(int id) {
-	entity_by_id_t::const_iterator it = byid.find(id);
-	if (it == byid.end()) {
+	IfcUtil::IfcBaseClass* inst = byid.get(id);
+	if (inst == nullptr) {
 		throw IfcException("Instance #" + boost::lexical_cast<std::string>(id) + " not found");
 	}
-	return it->second;
+	return inst;
 }
 
 IfcUtil::IfcBaseClass* IfcFile::instance_by_guid(const std::string& guid) {
-	entity_by_guid_t::const_iterator it = byguid.find(guid);
-	if ( it == byguid.end() ) {
+	IfcUtil::IfcBaseClass* inst = byguid.get(guid);
+	if (inst == nullptr) {
 		throw IfcException("Instance with GlobalId '" + guid + "' not found");
-	} else {
-		return it->second;
 	}
+	return inst;
+}
+
+namespace {
+	// Assigns the header value returned by fn, values that are not of the
+	// expected type are left empty
+	template <typename T, typename Fn>
+	void read_header_value(T& value, Fn fn) {
+		try {
+			value = fn();
+		} catch (const std::exception&) {
+			// Purposely empty catch block
+		}
+	}
+
+	bool is_whitespace(char c) {
+		return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+	}
+
+	// Random access to the file contents for the fast passes over the file
+	// below, one contiguous chunk at a time through a stream of its own: the
+	// buffer as a whole, or the blocks of files that are read in blocks.
+	class stream_contents {
+		std::unique_ptr<IfcSpfStream> cursor_;
+		const char* chunk_;
+		size_t begin_, end_;
+
+		bool load_(size_t i) {
+			chunk_ = cursor_->Chunk(i, begin_, end_);
+			if (chunk_ == nullptr) {
+				begin_ = end_ = 0;
+				return false;
+			}
+			return true;
+		}
+	public:
+		explicit stream_contents(const IfcSpfStream& stream)
+			: cursor_(new IfcSpfStream(stream, 0))
+			, chunk_(nullptr)
+			, begin_(0)
+			, end_(0)
+		{}
+
+		// Returns whether i is before the end of the contents
+		bool has(size_t i) {
+			return (i >= begin_ && i < end_) || load_(i);
+		}
+
+		// Only valid when has(i) returns true
+		char operator[](size_t i) {
+			has(i);
+			return chunk_[i - begin_];
+		}
+
+		// Returns the offset of the first character from chars at or after i,
+		// or the end of the contents
+		size_t find_first_of(size_t i, const character_set& chars) {
+			while (has(i)) {
+				const size_t j = begin_ + IfcParse::find_first_of(chunk_, i - begin_, end_ - begin_, chars);
+				if (j != end_) {
+					return j;
+				}
+				i = end_;
+			}
+			return i;
+		}
+
+		void append_to(std::string& str, size_t begin, size_t end) {
+			while (begin < end && has(begin)) {
+				const size_t n = (std::min)(end, end_) - begin;
+				str.append(chunk_ + (begin - begin_), n);
+				begin += n;
+			}
+		}
+	};
+
+	// Returns the offset of the character following i, line breaks are
+	// ignored as in IfcSpfStream::Inc()
+	size_t next_character(stream_contents& text, size_t i) {
+		for (++i; text.has(i) && (text[i] == '\n' || text[i] == '\r'); ++i) {}
+		return i;
+	}
+
+	// Returns whether a comment starts at i
+	bool is_comment_start(stream_contents& text, size_t i) {
+		if (!text.has(i) || text[i] != '/') {
+			return false;
+		}
+		i = next_character(text, i);
+		return text.has(i) && text[i] == '*';
+	}
+
+	// Advances i past whitespace and comments
+	void skip_whitespace_and_comments(stream_contents& text, size_t& i) {
+		static const character_set comment_end("*", 1);
+		for (;;) {
+			while (text.has(i) && is_whitespace(text[i])) {
+				++i;
+			}
+			if (!is_comment_start(text, i)) {
+				return;
+			}
+			i = next_character(text, next_character(text, i));
+			for (;;) {
+				i = text.find_first_of(i, comment_end);
+				if (!text.has(i)) {
+					return;
+				}
+				i = next_character(text, i);
+				if (text.has(i) && text[i] == '/') {
+					++i;
+					break;
+				}
+			}
+		}
+	}
+
+	// Counts the entity instances starting at offset by their keyword. Only
+	// the start of every statement is inspected, the remainder is skipped by
+	// searching for the terminating semicolon outside of strings and comments.
+	void count_instances(stream_contents& text, size_t offset, file_probe& result) {
+		static const character_set statement_delimiters(";'/", 3);
+		static const character_set quote("'", 1);
+
+		boost::unordered_map<std::string, size_t> counts;
+		std::string keyword;
+		size_t i = offset;
+		bool statement_start = true;
+
+		while (text.has(i)) {
+			if (statement_start) {
+				statement_start = false;
+				skip_whitespace_and_comments(text, i);
+				if (text.has(i) && text[i] == '#') {
+					uint64_t id = 0;
+					for (++i; text.has(i) && text[i] >= '0' && text[i] <= '9'; ++i) {
+						id = (std::min)(id * 10 + (uint64_t) (text[i] - '0'), (uint64_t) (std::numeric_limits<unsigned int>::max)());
+					}
+					skip_whitespace_and_comments(text, i);
+					if (text.has(i) && text[i] == '=') {
+						++i;
+						skip_whitespace_and_comments(text, i);
+						keyword.clear();
+						for (; text.has(i) && (isalnum((unsigned char) text[i]) || text[i] == '_'); ++i) {
+							keyword.push_back((char) toupper((unsigned char) text[i]));
+						}
+						result.instance_count++;
+						result.max_id = (std::max)(result.max_id, (unsigned int) id);
+						if (!keyword.empty()) {
+							counts[keyword]++;
+						}
+					}
+				}
+				continue;
+			}
+
+			i = text.find_first_of(i, statement_delimiters);
+			if (!text.has(i)) {
+				break;
+			}
+			if (text[i] == ';') {
+				++i;
+				statement_start = true;
+			} else if (text[i] == '\'') {
+				// Escaped quotes are skipped as two adjacent strings
+				i = text.find_first_of(i + 1, quote);
+				if (text.has(i)) {
+					++i;
+				}
+			} else if (is_comment_start(text, i)) {
+				skip_whitespace_and_comments(text, i);
+			} else {
+				++i;
+			}
+		}
+
+		result.entity_counts.insert(counts.begin(), counts.end());
+		result.has_statistics = true;
+	}
+}
+
+file_open_status IfcFile::good() const {
+	// The contents of large files are read in the background, failures
+	// are only known once the parser has reached them
+	if (good_.value() == file_open_status::SUCCESS && stream && stream->read_error()) {
+		return file_open_status::READ_ERROR;
+	}
+	return good_;
+}
+
+file_probe IfcFile::probe(const std::string& fn, bool statistics) {
+	file_probe result;
+
+	IfcFile file(fn, header_only_t{});
+	result.status = file.good();
+	if (!file.stream->valid) {
+		return result;
+	}
+	// Not known upfront for most compressed files
+	result.size = file.stream->size;
+	if (!file.good()) {
+		return result;
+	}
+
+	const IfcSpfHeader& header = file.header();
+	read_header_value(result.description, [&header]() { return header.file_description().description(); });
+	read_header_value(result.implementation_level, [&header]() { return header.file_description().implementation_level(); });
+	read_header_value(result.name, [&header]() { return header.file_name().name(); });
+	read_header_value(result.time_stamp, [&header]() { return header.file_name().time_stamp(); });
+	read_header_value(result.author, [&header]() { return header.file_name().author(); });
+	read_header_value(result.organization, [&header]() { return header.file_name().organization(); });
+	read_header_value(result.preprocessor_version, [&header]() { return header.file_name().preprocessor_version(); });
+	read_header_value(result.originating_system, [&header]() { return header.file_name().originating_system(); });
+	read_header_value(result.authorization, [&header]() { return header.file_name().authorization(); });
+	read_header_value(result.schema_identifiers, [&header]() { return header.file_schema().schema_identifiers(); });
+
+	// Same criterion as when opening the file, without logging errors
+	try {
+		if (result.schema_identifiers.size() != 1) {
+			throw IfcException("Expected a single schema identifier");
+		}
+		IfcParse::schema_by_name(result.schema_identifiers.front());
+	} catch (const IfcException&) {
+		result.status = file_open_status::UNSUPPORTED_SCHEMA;
+	}
+
+	if (statistics) {
+		stream_contents text(*file.stream);
+		count_instances(text, file.stream->Tell(), result);
+		// Known after the pass over the file, as are read errors
+		result.size = file.stream->Length();
+		if (file.stream->read_error()) {
+			result.status = file_open_status::READ_ERROR;
+		}
+	}
+
+	return result;
 }
 
 // FIXME: Test destructor to delete entity and arg allocations
 IfcFile::~IfcFile() {
-	std::set<IfcUtil::IfcBaseClass*> entities_to_delete;
+	// Instances can be present in both maps, so they are deduplicated
+	std::vector<IfcUtil::IfcBaseClass*> entities_to_delete;
+	entities_to_delete.reserve(byid.size() + byidentity.size());
 	for (const auto& pair : byid) {
-		entities_to_delete.insert(pair.second);
+		entities_to_delete.push_back(pair.second);
 	}
 	for (const auto& pair : byidentity) {
-		entities_to_delete.insert(pair.second);
+		entities_to_delete.push_back(pair.second);
 	}
+	std::sort(entities_to_delete.begin(), entities_to_delete.end());
+	entities_to_delete.erase(std::unique(entities_to_delete.begin(), entities_to_delete.end()), entities_to_delete.end());
 	for (auto entity : entities_to_delete) {
 		delete entity;
 	}
+	free_retired_();
 	delete stream;
 	delete tokens;
 }
@@ -2451,32 +4793,201 @@ IfcFile::type_iterator IfcFile::types_incl_super_end() const {
 	return bytype.end();
 }
 
+std::ostream& operator<< (std::ostream& os, const IfcParse::IfcFile& f) {
+	f.write(os);
+	return os;
+}
+
 namespace {
-	struct id_instance_pair_sorter {
-		bool operator()(const IfcParse::IfcFile::entity_by_id_t::value_type& a, const IfcParse::IfcFile::entity_by_id_t::value_type& b) const {
-			return a.first < b.first;
+	// The number of instances formatted together by a thread when writing
+	const size_t write_block_size = 1024;
+
+	// Returns the offset just past the closing parenthesis of the instance
+	// that starts with the keyword at offset, or 0 when it is not found.
+	size_t instance_text_end(stream_contents& text, size_t offset) {
+		int depth = 0;
+		bool in_string = false;
+		for (size_t i = offset; text.has(i); ++i) {
+			const char c = text[i];
+			if (in_string) {
+				// An escaped apostrophe ('') leaves and enters the string again
+				if (c == '\'') {
+					in_string = false;
+				}
+			} else if (c == '\'') {
+				in_string = true;
+			} else if (c == '/' && text.has(i + 1) && text[i + 1] == '*') {
+				for (i += 2; text.has(i + 1) && !(text[i] == '*' && text[i + 1] == '/'); ++i) {}
+				if (!text.has(i + 1)) {
+					return 0;
+				}
+				++i;
+			} else if (c == '(') {
+				++depth;
+			} else if (c == ')') {
+				if (--depth == 0) {
+					return i + 1;
+				}
+			} else if (c == ';') {
+				return 0;
+			}
 		}
-	};
+		return 0;
+	}
+
+	void format_instances(const IfcUtil::IfcBaseClass* const* begin, const IfcUtil::IfcBaseClass* const* end, std::string& text) {
+		text.clear();
+		// The contents of the file the instances were read from
+		std::unique_ptr<stream_contents> contents;
+		const IfcParse::IfcFile* contents_file = nullptr;
+		for (auto it = begin; it != end; ++it) {
+			const IfcEntityInstanceData& data = (*it)->data();
+			// Instances that are unchanged since they were read are copied
+			// from the file contents as is, without decoding the attributes.
+			size_t text_end = 0;
+			if (data.offset_in_file() && data.file && data.file->stream && !data.modified()) {
+				if (data.file != contents_file) {
+					contents.reset(new stream_contents(*data.file->stream));
+					contents_file = data.file;
+				}
+				text_end = instance_text_end(*contents, data.offset_in_file());
+			}
+			if (text_end) {
+				text += '#';
+				text += std::to_string(data.id());
+				text += '=';
+				contents->append_to(text, data.offset_in_file(), text_end);
+			} else {
+				text += data.toString(true);
+			}
+			text += ";\n";
+		}
+	}
 }
 
-std::ostream& operator<< (std::ostream& os, const IfcParse::IfcFile& f) {
-	f.header().write(os);
+void IfcFile::write(std::ostream& os, unsigned int threads) const {
+	header().write(os);
+
+	// Instances are written in order of their name
+	std::vector<const IfcUtil::IfcBaseClass*> instances;
+	instances.reserve(byid.size());
+	for (const auto& p : byid) {
+		if (p.second->declaration().as_entity()) {
+			instances.push_back(p.second);
+		}
+	}
+
+	const size_t num_blocks = (instances.size() + write_block_size - 1) / write_block_size;
+	auto block_begin = [&instances](size_t b) {
+		return instances.data() + b * write_block_size;
+	};
+	auto block_end = [&instances](size_t b) {
+		return instances.data() + (std::min)((b + 1) * write_block_size, instances.size());
+	};
+
+	threads = (unsigned int) (std::min)((size_t) threads, num_blocks);
+
+	// Blocks are formatted while holding a lease, so that attributes released
+	// by other threads to meet the memory budget are not freed while in use.
+	// Attributes released during a block can be freed once it is formatted.
+	if (threads <= 1) {
+		std::string text;
+		for (size_t b = 0; b < num_blocks; ++b) {
+			{
+				attribute_lease lease(this);
+				format_instances(block_begin(b), block_end(b), text);
+			}
+			os.write(text.data(), text.size());
+		}
+	} else {
+		// Blocks are formatted by the worker threads and written by this one
+		// in order. Workers do not run ahead of the block being written by
+		// more than the number of slots, to bound the memory used.
+		const size_t num_slots = 4 * (size_t) threads;
+		std::vector<std::string> slots(num_slots);
+		std::vector<bool> formatted(num_slots, false);
+		size_t next_block = 0, blocks_written = 0;
+		std::exception_ptr error;
+		std::mutex m;
+		std::condition_variable block_formatted, slot_available;
+
+		auto work = [&]() {
+			std::string text;
+			for (;;) {
+				size_t b;
+				{
+					std::unique_lock<std::mutex> lk(m);
+					slot_available.wait(lk, [&]() {
+						return error || next_block == num_blocks || next_block < blocks_written + num_slots;
+					});
+					if (error || next_block == num_blocks) {
+						return;
+					}
+					b = next_block++;
+				}
+				try {
+					attribute_lease lease(this);
+					format_instances(block_begin(b), block_end(b), text);
+				} catch (...) {
+					std::lock_guard<std::mutex> lk(m);
+					error = std::current_exception();
+					block_formatted.notify_all();
+					slot_available.notify_all();
+					return;
+				}
+				std::lock_guard<std::mutex> lk(m);
+				slots[b % num_slots].swap(text);
+				formatted[b % num_slots] = true;
+				block_formatted.notify_all();
+			}
+		};
 
-	typedef std::vector<std::pair<unsigned int, IfcUtil::IfcBaseClass*> > vector_t;
-	vector_t sorted(f.begin(), f.end());
-	std::sort(sorted.begin(), sorted.end(), id_instance_pair_sorter());
+		std::vector<std::thread> workers;
+		workers.reserve(threads);
+		for (unsigned int i = 0; i < threads; ++i) {
+			workers.emplace_back(work);
+		}
+
+		std::string text;
+		for (size_t b = 0; b < num_blocks; ++b) {
+			{
+				std::unique_lock<std::mutex> lk(m);
+				block_formatted.wait(lk, [&]() {
+					return error || formatted[b % num_slots];
+				});
+				if (error) {
+					break;
+				}
+				text.swap(slots[b % num_slots]);
+				formatted[b % num_slots] = false;
+				blocks_written = b + 1;
+				slot_available.notify_all();
+			}
+			os.write(text.data(), text.size());
+		}
 
-	for (vector_t::const_iterator it = sorted.begin(); it != sorted.end(); ++ it) {
-		const IfcUtil::IfcBaseClass* e = it->second;
-		if (e->declaration().as_entity()) {
-			os << e->data().toString(true) << ";" << std::endl;
+		for (auto& w : workers) {
+			w.join();
+		}
+		if (error) {
+			std::rethrow_exception(error);
 		}
 	}
 
 	os << "ENDSEC;" << std::endl;
 	os << "END-ISO-10303-21;" << std::endl;
+}
 
-	return os;
+void IfcFile::write(const std::string& path, unsigned int threads) const {
+	std::ofstream os(IfcUtil::path::from_utf8(path).c_str());
+	if (!os.is_open()) {
+		throw IfcException("Unable to open " + path + " for writing");
+	}
+	write(os, threads);
+	os.close();
+	if (os.fail()) {
+		throw IfcException("Failed to write " + path);
+	}
 }
 
 std::string IfcFile::createTimestamp() const {
@@ -2497,42 +5008,9 @@ std::string IfcFile::createTimestamp() const {
 
 std::vector<int> IfcFile::get_inverse_indices(int instance_id) {
 	std::vector<int> return_value;
-	
-	auto lower = byref.lower_bound({ instance_id, -1, -1 });
-	auto upper = byref.upper_bound({ instance_id, std::numeric_limits<int>::max(), std::numeric_limits<int>::max() });
-
-	// Mapping of instance id to attribute offset.
-	std::map<int, std::vector<int>> mapping;
-	
-	for (auto it = lower; it != upper; ++it) {
-		for (auto& i : it->second) {
-			// We only take the tuple for the type that id=i actually is, in order not
-			// to count double. Because byref contains mappings for every supertype of id=i.
-			if (instance_by_id(i)->declaration().index_in_schema() == std::get<1>(it->first)) {
-				mapping[i].push_back(std::get<2>(it->first));
-			}
-		}
-	}
-
-	auto refs = instances_by_reference(instance_id);
-
-	for (auto& r : *refs) {
-		auto it = mapping.find(r->data().id());
-		if (it == mapping.end() || it->second.empty()) {
-			throw IfcException("Internal error");
-		}
-		return_value.push_back(it->second.front());
-		it->second.erase(it->second.begin());
-		if (it->second.empty()) {
-			mapping.erase(it);
-		}
-	}
-
-	// Test whether all mappings where indeed used.
-	if (!mapping.empty()) {
-		throw IfcException("Internal error");
-	}
-
+	byref.for_each(instance_id, [&return_value](const IfcParse::inverse_index::reference& r) {
+		return_value.push_back(r.attribute_index);
+	});
 	return return_value;
 }
 
@@ -2541,33 +5019,37 @@ aggregate_of_instance::ptr IfcFile::getInverse(int instance_id, const IfcParse::
 		return instances_by_reference(instance_id);
 	}
 	
-	aggregate_of_instance::ptr return_value(new aggregate_of_instance);
-	
-	if (attribute_index == -1) {
-		auto lower = byref.lower_bound({ instance_id, type->index_in_schema(), -1 });
-		auto upper = byref.upper_bound({ instance_id, type->index_in_schema(), std::numeric_limits<int>::max() });
+	// Referencing instances along with the attribute index through which they refer
+	std::vector<std::pair<int, IfcUtil::IfcBaseClass*> > matches;
 
-		for (auto it = lower; it != upper; ++it) {
-			for (auto& i : it->second) {
-				return_value->push(instance_by_id(i));
-			}
+	byref.for_each(instance_id, [this, type, attribute_index, &matches](const IfcParse::inverse_index::reference& r) {
+		if (attribute_index != -1 && r.attribute_index != attribute_index) {
+			return;
 		}
-	} else {
-		auto it = byref.find({ instance_id, type->index_in_schema(), attribute_index });
-		if (it != byref.end()) {
-			for (auto& i : it->second) {
-				return_value->push(instance_by_id(i));
-			}
+		IfcUtil::IfcBaseClass* inst = instance_by_id(r.instance);
+		if (type == nullptr || inst->declaration().is(*type)) {
+			matches.push_back({ r.attribute_index, inst });
 		}
+	});
+
+	if (attribute_index == -1) {
+		// Inverses over all attributes are grouped by attribute
+		std::stable_sort(matches.begin(), matches.end(), [](const std::pair<int, IfcUtil::IfcBaseClass*>& a, const std::pair<int, IfcUtil::IfcBaseClass*>& b) {
+			return a.first < b.first;
+		});
 	}
 
+	aggregate_of_instance::ptr return_value(new aggregate_of_instance);
+	for (auto& p : matches) {
+		return_value->push(p.second);
+	}
 
 	return return_value;
 }
 
 
 int IfcFile::getTotalInverses(int instance_id) {
-	return byref_excl[instance_id].size();
+	return (int) byref.count(instance_id);
 }
 
 
@@ -2671,12 +5153,7 @@ void IfcParse::IfcFile::build_inverses_(IfcUtil::IfcBaseClass* inst) {
 	std::function<void(IfcUtil::IfcBaseClass*,int)> fn = [this, inst](IfcUtil::IfcBaseClass* attr, int idx) {
 		if (attr->declaration().as_entity()) {
 			unsigned entity_attribute_id = attr->data().id();
-			auto decl = inst->declaration().as_entity();
-			byref_excl[entity_attribute_id].push_back(inst->data().id());
-			while (decl) {
-				byref[{entity_attribute_id, decl->index_in_schema(), idx}].push_back(inst->data().id());
-				decl = decl->supertype();
-			}
+			byref.add((int) entity_attribute_id, (int) inst->data().id(), idx);
 		}
 	};
 	
@@ -2687,9 +5164,11 @@ void IfcParse::IfcFile::build_inverses() {
 	for (auto& pair : *this) {
 		build_inverses_(pair.second);	
 	}
+	byref.build();
 }
 
 std::atomic_uint32_t IfcUtil::IfcBaseClass::counter_(0);
 
 bool IfcParse::IfcFile::lazy_load_ = true;
 bool IfcParse::IfcFile::guid_map_ = true;
+bool IfcParse::IfcFile::persistent_index_ = false;
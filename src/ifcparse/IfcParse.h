@@ -39,6 +39,7 @@
 #include <sstream>
 #include <iostream>
 #include <vector>
+#include <atomic>
 #include <fstream>
 #include <cstring>
 #include <map>
@@ -74,18 +75,25 @@ namespace IfcParse {
 	};
 
 	struct Token {
-		IfcSpfLexer* lexer; //TODO: remove it from here
-		unsigned startPos;
-		TokenType type;
+		// The offset, the lexer it was read by and the TokenType are packed in a
+		// single 64-bit word, the parsed value is stored inline. This keeps a Token
+		// at 16 bytes while allowing for files of up to 2^40 bytes.
+		uint64_t startPos : 40;
+		uint64_t lexer_index : 16;
+		uint64_t type : 8;
 		union {
 			char value_char;      //types: OPERATOR
-			int value_int;        //types: INT, IDENTIFIER
+			int value_int;        //types: INT, IDENTIFIER, BOOL, ENUMERATION (see TokenArgument::enumeration_index())
 			double value_double;  //types: FLOAT
 		};
 
-		Token() : lexer(0), startPos(0), type(Token_NONE) {}
-		Token(IfcSpfLexer* _lexer, unsigned _startPos, unsigned /*_endPos*/, TokenType _type)
-			: lexer(_lexer), startPos(_startPos), type(_type) {}
+		static const uint64_t max_offset = (uint64_t(1) << 40) - 1;
+
+		Token() : startPos(0), lexer_index(0), type(Token_NONE) {}
+		inline Token(IfcSpfLexer* _lexer, size_t _startPos, size_t /*_endPos*/, TokenType _type);
+
+		/// Returns the lexer the token was read by, or nullptr for the none token
+		IfcSpfLexer* lexer() const;
 	};
 
 	/// Provides functions to convert Tokens to binary data
@@ -142,10 +150,16 @@ namespace IfcParse {
 	// Functions for creating Tokens from an arbitary file offset
 	// The first 4 bits are reserved for Tokens of type ()=,;$*
 	//
-	Token OperatorTokenPtr(IfcSpfLexer* tokens, unsigned start, unsigned end);
-	Token GeneralTokenPtr(IfcSpfLexer* tokens, unsigned start, unsigned end);
+	Token OperatorTokenPtr(IfcSpfLexer* tokens, size_t start, size_t end);
+	Token GeneralTokenPtr(IfcSpfLexer* tokens, size_t start, size_t end);
 	Token NoneTokenPtr();
 
+	// Functions for parsing the text of INT and REAL tokens, independent of the
+	// current locale. Return false when the text is not a number.
+	//
+	IFC_PARSE_API bool ParseInt(const char* pStart, int& val);
+	IFC_PARSE_API bool ParseFloat(const char* pStart, double& val);
+
 	/// A stream of tokens to be read from a IfcSpfStream.
 	class IFC_PARSE_API IfcSpfLexer {
 	private:
@@ -162,9 +176,27 @@ namespace IfcParse {
 		IfcSpfLexer(IfcSpfStream* s, IfcFile* f);
 		Token Next();
 		~IfcSpfLexer();
-		void TokenString(unsigned int offset, std::string &result);
+		void TokenString(size_t offset, std::string &result);
+
+		/// Returns the index by which tokens refer to this lexer
+		unsigned index() const { return index_; }
+		/// Returns the lexer for an index obtained from index()
+		static IfcSpfLexer* by_index(unsigned i);
+
+	private:
+		unsigned index_;
+
+		IfcSpfLexer(const IfcSpfLexer&) = delete;
+		IfcSpfLexer& operator=(const IfcSpfLexer&) = delete;
 	};
 
+	inline Token::Token(IfcSpfLexer* _lexer, size_t _startPos, size_t /*_endPos*/, TokenType _type)
+		: startPos(_startPos), lexer_index(_lexer->index()), type(_type) {}
+
+	inline IfcSpfLexer* Token::lexer() const {
+		return IfcSpfLexer::by_index(lexer_index);
+	}
+
 	/// Argument of type list, e.g.
 	/// #1=IfcDirection((1.,0.,0.));
 	///                 ==========
@@ -204,6 +236,113 @@ namespace IfcParse {
 	};
 
 
+	/// A view of a contiguous range of numbers, such as a row of a
+	/// NumericAggregateArgument
+	template <typename T>
+	class numeric_span {
+	private:
+		const T* begin_;
+		size_t size_;
+
+	public:
+		numeric_span(const T* begin, size_t size) : begin_(begin), size_(size) {}
+
+		const T* begin() const { return begin_; }
+		const T* end() const { return begin_ + size_; }
+		size_t size() const { return size_; }
+		const T& operator[](size_t i) const { return begin_[i]; }
+	};
+
+	/// Argument of type list of lists of numbers of equal length, read from
+	/// file directly into a single contiguous row-major array of values, e.g.
+	/// #1=IfcCartesianPointList3D(((0.,0.,0.),(1.,0.,0.),(1.,1.,0.)));
+	///                            ================================
+	class IFC_PARSE_API NumericAggregateArgument : public Argument {
+	private:
+		// The opening parenthesis, used to reproduce the original text
+		Token token_;
+		size_t rows_, columns_;
+		bool integral_;
+		union {
+			double* doubles_;
+			int* integers_;
+		};
+		// The rows as generic lists of TokenArguments, only created when
+		// the rows are accessed individually through operator[]
+		mutable std::atomic<ArgumentList*> row_arguments_;
+
+		const double* values_(const double*) const { return doubles(); }
+		const int* values_(const int*) const { return integers(); }
+
+		ArgumentList* create_row_arguments_() const;
+
+	public:
+		NumericAggregateArgument(const Token& t, size_t rows, size_t columns, double* values)
+			: token_(t), rows_(rows), columns_(columns), integral_(false), doubles_(values), row_arguments_(nullptr) {}
+		NumericAggregateArgument(const Token& t, size_t rows, size_t columns, int* values)
+			: token_(t), rows_(rows), columns_(columns), integral_(true), integers_(values), row_arguments_(nullptr) {}
+		~NumericAggregateArgument();
+
+		IfcUtil::ArgumentType type() const;
+
+		operator std::vector< std::vector<int> >() const;
+		operator std::vector< std::vector<double> >() const;
+
+		bool isNull() const { return false; }
+		unsigned int size() const { return (unsigned int) rows_; }
+
+		/// Returns row i as an ArgumentList, like for a list read generically.
+		/// The rows are created on first access and live as long as this
+		/// argument, prefer row_spans() to read the values.
+		Argument* operator [] (unsigned int i) const;
+
+		std::string toString(bool upper=false) const;
+
+		size_t rows() const { return rows_; }
+		size_t columns() const { return columns_; }
+
+		/// Returns the values, row after row, or nullptr when these are integers
+		const double* doubles() const { return integral_ ? nullptr : doubles_; }
+		/// Returns the values, row after row, or nullptr when these are reals
+		const int* integers() const { return integral_ ? integers_ : nullptr; }
+
+		/// Returns views of the rows, or an empty vector when the values are not of type T
+		template <typename T>
+		std::vector< numeric_span<T> > row_spans() const {
+			std::vector< numeric_span<T> > spans;
+			const T* values = values_(static_cast<const T*>(nullptr));
+			if (values) {
+				spans.reserve(rows_);
+				for (size_t i = 0; i < rows_; ++i) {
+					spans.emplace_back(values + i * columns_, columns_);
+				}
+			}
+			return spans;
+		}
+	};
+
+	/// Returns views of the rows of an argument of type list of lists of
+	/// numbers. These refer directly to the values when the argument is
+	/// stored contiguously, otherwise the values are converted into storage,
+	/// which then needs to outlive the views.
+	template <typename T>
+	std::vector< numeric_span<T> > numeric_row_spans(const Argument* argument, std::vector< std::vector<T> >& storage) {
+		if (auto numeric = dynamic_cast<const NumericAggregateArgument*>(argument)) {
+			std::vector< numeric_span<T> > spans = numeric->row_spans<T>();
+			if (!spans.empty()) {
+				return spans;
+			}
+		}
+		std::vector< std::vector<T> > converted = *argument;
+		storage.swap(converted);
+		std::vector< numeric_span<T> > spans;
+		spans.reserve(storage.size());
+		for (auto& row : storage) {
+			spans.emplace_back(row.data(), row.size());
+		}
+		return spans;
+	}
+
 	/// Argument being null, e.g. '$'
 	///              == ===
 	class IFC_PARSE_API NullArgument : public Argument {
@@ -236,6 +375,8 @@ namespace IfcParse {
 		operator boost::dynamic_bitset<>() const;
 		operator IfcUtil::IfcBaseClass*() const;
 
+		int enumeration_index() const;
+
 		bool isNull() const;
 		unsigned int size() const;
 
@@ -264,11 +405,21 @@ namespace IfcParse {
 		std::string toString(bool upper=false) const;
 	};
 	
-	IFC_PARSE_API IfcEntityInstanceData* read(unsigned int i, IfcFile* t, boost::optional<unsigned> offset = boost::none);
+	IFC_PARSE_API IfcEntityInstanceData* read(unsigned int i, IfcFile* t, boost::optional<size_t> offset = boost::none);
 
 	IFC_PARSE_API aggregate_of_instance::ptr traverse(IfcUtil::IfcBaseClass* instance, int max_level = -1);
 
 	IFC_PARSE_API aggregate_of_instance::ptr traverse_breadth_first(IfcUtil::IfcBaseClass* instance, int max_level = -1);
+
+	/// Returns the union of the closures of the instances in roots, in the
+	/// order of traverse() for every root, without duplicates. Without a
+	/// maximum level every instance is visited once for all roots.
+	IFC_PARSE_API aggregate_of_instance::ptr traverse_many(const aggregate_of_instance::ptr& roots, int max_level = -1);
+
+	/// Traverses from every instance in roots separately, returning the
+	/// closure of each root in the same order. Roots are distributed over
+	/// the specified number of threads.
+	IFC_PARSE_API std::vector<aggregate_of_instance::ptr> traverse_each(const aggregate_of_instance::ptr& roots, int max_level = -1, unsigned int threads = 1);
 }
 
 IFC_PARSE_API std::ostream& operator<< (std::ostream& os, const IfcParse::IfcFile& f);
@@ -54,10 +54,11 @@ IfcParse::entity::~entity() {
 }
 static std::map<std::string, const IfcParse::schema_definition*> schemas;
 
-IfcParse::schema_definition::schema_definition(const std::string& name, const std::vector<const declaration*>& declarations, instance_factory* factory)
+IfcParse::schema_definition::schema_definition(const std::string& name, const std::vector<const declaration*>& declarations, instance_factory* factory, const keyword_table* keywords)
 	: name_(name)
 	, declarations_(declarations)
 	, factory_(factory)
+	, keywords_(keywords)
 {
 	std::sort(declarations_.begin(), declarations_.end(), declaration_by_index_sort());
 	for (std::vector<const declaration*>::iterator it = declarations_.begin(); it != declarations_.end(); ++it) {
@@ -68,6 +69,9 @@ IfcParse::schema_definition::schema_definition(const std::string& name, const st
 		if ((**it).as_enumeration_type()) enumeration_types_.push_back((**it).as_enumeration_type());
 		if ((**it).as_entity()) entities_.push_back((**it).as_entity());
 	}
+	for (auto& e : entities_) {
+		e->attribute_count_ = e->count_attributes_();
+	}
 	schemas[name_] = this;
 }
 
@@ -78,6 +82,69 @@ IfcParse::schema_definition::~schema_definition() {
 	delete factory_;
 }
 
+namespace {
+	inline unsigned char to_upper(char c) {
+		return (c >= 'a' && c <= 'z') ? (unsigned char) (c - 'a' + 'A') : (unsigned char) c;
+	}
+
+	// FNV-1a over the upper case name. The schema code generator builds the
+	// keyword tables with the same functions, see codegen.py.
+	uint32_t keyword_hash(const char* name, size_t length) {
+		uint32_t h = 2166136261u;
+		for (size_t i = 0; i < length; ++i) {
+			h ^= to_upper(name[i]);
+			h *= 16777619u;
+		}
+		return h;
+	}
+
+	// Mixes the hash of a name with the displacement of its bucket
+	uint32_t keyword_rehash(uint32_t h, uint32_t seed) {
+		h ^= seed * 0x9E3779B9u;
+		h ^= h >> 16;
+		h *= 0x85EBCA6Bu;
+		h ^= h >> 13;
+		h *= 0xC2B2AE35u;
+		h ^= h >> 16;
+		return h;
+	}
+
+	// Compares the upper case name of a declaration to a name in any case
+	int compare_name(const std::string& name_uc, const char* name, size_t length) {
+		const size_t n = (std::min)(name_uc.size(), length);
+		for (size_t i = 0; i < n; ++i) {
+			const unsigned char a = (unsigned char) name_uc[i], b = to_upper(name[i]);
+			if (a != b) {
+				return a < b ? -1 : 1;
+			}
+		}
+		return name_uc.size() < length ? -1 : (name_uc.size() > length ? 1 : 0);
+	}
+}
+
+int IfcParse::keyword_table::lookup(const char* name, size_t length) const {
+	const uint32_t h = keyword_hash(name, length);
+	return slots[keyword_rehash(h, displacements[h % num_buckets]) % num_slots];
+}
+
+const IfcParse::declaration* IfcParse::schema_definition::declaration_by_name(const char* name, size_t length) const {
+	if (keywords_) {
+		const int index = keywords_->lookup(name, length);
+		if (index >= 0 && compare_name(declarations_[index]->name_uc(), name, length) == 0) {
+			return declarations_[index];
+		}
+	} else {
+		// Schemas defined at runtime have no keyword table
+		auto it = std::partition_point(declarations_.begin(), declarations_.end(), [name, length](const declaration* decl) {
+			return compare_name(decl->name_uc(), name, length) < 0;
+		});
+		if (it != declarations_.end() && compare_name((**it).name_uc(), name, length) == 0) {
+			return *it;
+		}
+	}
+	throw IfcParse::IfcException("Entity with name '" + std::string(name, length) + "' not found in schema '" + name_ + "'");
+}
+
 IfcUtil::IfcBaseClass* IfcParse::schema_definition::instantiate(IfcEntityInstanceData * data) const {
 	if (factory_) {
 		return (*factory_)(data);
@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <iterator>
 #include <cctype>
+#include <cstdint>
 
 #include <boost/algorithm/string.hpp>
 
@@ -200,6 +201,17 @@ namespace IfcParse {
 
 		const std::vector<std::string>& enumeration_items() const { return enumeration_items_; }
 
+		/// Returns the offset of value in the (sorted) enumeration items, or -1
+		int lookup_enum_offset(const char* value, size_t length) const {
+			auto it = std::lower_bound(enumeration_items_.begin(), enumeration_items_.end(), value, [length](const std::string& item, const char* v) {
+				return item.compare(0, std::string::npos, v, length) < 0;
+			});
+			if (it != enumeration_items_.end() && it->compare(0, std::string::npos, value, length) == 0) {
+				return (int) std::distance(enumeration_items_.begin(), it);
+			}
+			return -1;
+		}
+
 		virtual const enumeration_type* as_enumeration_type() const { return this; }
 	};
 
@@ -249,6 +261,8 @@ namespace IfcParse {
 	};
 
 	class IFC_PARSE_API entity : public declaration {
+		friend class schema_definition;
+
 	protected:
 		bool is_abstract_;
 		const entity* supertype_; /* NB: IFC explicitly allows only single inheritance */
@@ -257,6 +271,19 @@ namespace IfcParse {
 		std::vector<const attribute*> attributes_;
 		std::vector<bool> derived_;
 
+		// The number of attributes including those of the supertypes, stored
+		// by the schema once its declarations are complete, as it is looked
+		// up on every attribute access. Zero when not stored.
+		mutable size_t attribute_count_;
+
+		size_t count_attributes_() const {
+			size_t super_count = 0;
+			if (supertype_) {
+				super_count = supertype_->attribute_count();
+			}
+			return super_count + attributes_.size();
+		}
+
 		std::vector<const inverse_attribute*> inverse_attributes_;
 
 		class attribute_by_name_cmp {
@@ -289,6 +316,7 @@ namespace IfcParse {
 			: declaration(name, index_in_schema)
 			, is_abstract_(is_abstract)
 			, supertype_(supertype)
+			, attribute_count_(0)
 		{}
 
 		virtual ~entity();
@@ -302,6 +330,7 @@ namespace IfcParse {
 		void set_attributes(const std::vector<const attribute*>& attributes, const std::vector<bool>& derived) {
 			attributes_ = attributes;
 			derived_ = derived;
+			attribute_count_ = 0;
 		}
 
 		void set_inverse_attributes(const std::vector<const inverse_attribute*>& inverse_attributes) {
@@ -342,11 +371,7 @@ namespace IfcParse {
 		}
 
 		size_t attribute_count() const {
-			size_t super_count = 0;
-			if (supertype_) {
-				super_count = supertype_->attribute_count();
-			}
-			return super_count + attributes_.size();
+			return attribute_count_ ? attribute_count_ : count_attributes_();
 		}
 
 		ptrdiff_t attribute_index(const attribute* attr) const {
@@ -389,6 +414,22 @@ namespace IfcParse {
 		virtual const entity* as_entity() const { return this; }
 	};
 
+	/// A perfect hash of the declaration names in a schema or the values of
+	/// an enumeration, generated along with the schema definition. Names are
+	/// assigned to buckets by their hash, the hash mixed with the displacement
+	/// of the bucket selects the slot, which holds the index of the name.
+	struct IFC_PARSE_API keyword_table {
+		const uint16_t* displacements;
+		size_t num_buckets;
+		const int16_t* slots;
+		size_t num_slots;
+
+		/// Returns the index in the only slot the case-insensitive name can
+		/// be stored in, or -1. Names not in the table map to arbitrary slots,
+		/// so the caller needs to compare the name at the index returned.
+		int lookup(const char* name, size_t length) const;
+	};
+
 	class IFC_PARSE_API instance_factory {
 	public:
 		virtual ~instance_factory() {}
@@ -407,13 +448,6 @@ namespace IfcParse {
 		std::vector<const enumeration_type*> enumeration_types_;
 		std::vector<const entity*> entities_;
 
-		class declaration_by_name_cmp {
-		public:
-			bool operator()(const declaration* decl, const std::string& name) {
-				return decl->name_uc() < name;
-			}
-		};
-
 		class declaration_by_index_sort  {
 		public:
 			bool operator()(const declaration* a, const declaration* b) {
@@ -422,31 +456,20 @@ namespace IfcParse {
 		};
 
 		instance_factory* factory_;
-
-		std::string& temp_string_() const {
-			static my_thread_local std::string s;
-			return s;
-		}
+		const keyword_table* keywords_;
 
 	public:
 
-		schema_definition(const std::string& name, const std::vector<const declaration*>& declarations, instance_factory* factory);
+		schema_definition(const std::string& name, const std::vector<const declaration*>& declarations, instance_factory* factory, const keyword_table* keywords = nullptr);
 
 		~schema_definition();
 
+		/// Returns the declaration with the case-insensitive name of length
+		/// characters at name, which does not need to be null-terminated
+		const declaration* declaration_by_name(const char* name, size_t length) const;
+
 		const declaration* declaration_by_name(const std::string& name) const {
-			const std::string* name_ptr = &name;
-			if (std::any_of(name.begin(), name.end(), [](char c) { return std::islower(c); })) {
-				temp_string_() = name;
-				boost::to_upper(temp_string_());
-				name_ptr = &temp_string_();
-			}
-			std::vector<const declaration*>::const_iterator it = std::lower_bound(declarations_.begin(), declarations_.end(), *name_ptr, declaration_by_name_cmp());
-			if (it == declarations_.end() || (**it).name_uc() != *name_ptr) {
-				throw IfcParse::IfcException("Entity with name '" + name + "' not found in schema '" + name_ + "'");
-			} else {
-				return *it;
-			}
+			return declaration_by_name(name.data(), name.size());
 		}
 
 		const declaration* declaration_by_name(int name) const {
@@ -0,0 +1,897 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcSpfCompression.h"
+#include "../ifcparse/IfcLogger.h"
+
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <cctype>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+
+using namespace IfcParse;
+
+compression::format compression::detect(const unsigned char* magic, size_t n) {
+	if (n >= 2 && magic[0] == 0x1f && magic[1] == 0x8b) {
+		return gzip;
+	}
+	if (n >= 4 && magic[0] == 'P' && magic[1] == 'K' && magic[2] == 0x03 && magic[3] == 0x04) {
+		return zip;
+	}
+	if (n >= 4 && magic[0] == 0x28 && magic[1] == 0xb5 && magic[2] == 0x2f && magic[3] == 0xfd) {
+		return zstd;
+	}
+	return uncompressed;
+}
+
+compression::format compression::detect(FILE* f) {
+	unsigned char magic[4];
+	const size_t n = fread(magic, 1, sizeof(magic), f);
+	rewind(f);
+	return detect(magic, n);
+}
+
+
+namespace {
+
+	// Amount of compressed data read from the file at once
+	const size_t compressed_chunk_size = 1 << 16;
+
+	// The minimum size of the decompressed blocks. Blocks of deflate streams
+	// are extended up to the next deflate block boundary.
+	const size_t block_size = 1 << 18;
+
+	// The number of decompressed blocks that are cached
+	const size_t max_cached_blocks = 128;
+
+	// The history that is needed to resume inflating a deflate stream
+	const size_t deflate_window_size = 1 << 15;
+
+	// A Zstandard frame that ends at least this far into a block ends the
+	// block, so that an access point can be recorded at the next frame
+	const size_t min_frame_block_size = block_size / 8;
+
+	// Compression level of the Zstandard blocks that are kept recompressed
+	const int recompression_level = 1;
+
+	const uint32_t zip_local_header_signature = 0x04034b50;
+	const uint32_t zip_central_header_signature = 0x02014b50;
+	const uint32_t zip_end_of_central_directory_signature = 0x06054b50;
+	const size_t zip_local_header_size = 30;
+	const size_t zip_central_header_size = 46;
+	const size_t zip_end_of_central_directory_size = 22;
+
+	uint16_t read_u16(const unsigned char* p) {
+		return (uint16_t) (p[0] | (p[1] << 8));
+	}
+
+	uint32_t read_u32(const unsigned char* p) {
+		return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+	}
+
+	bool seek(FILE* f, uint64_t offset, int whence = SEEK_SET) {
+#ifdef _MSC_VER
+		return _fseeki64(f, (__int64) offset, whence) == 0;
+#else
+		return fseeko(f, (off_t) offset, whence) == 0;
+#endif
+	}
+
+	uint64_t file_size(FILE* f) {
+		seek(f, 0, SEEK_END);
+#ifdef _MSC_VER
+		const uint64_t size = (uint64_t) _ftelli64(f);
+#else
+		const uint64_t size = (uint64_t) ftello(f);
+#endif
+		rewind(f);
+		return size;
+	}
+
+	bool ends_with_ifc(const std::string& name) {
+		static const char extension[] = ".ifc";
+		const size_t n = sizeof(extension) - 1;
+		if (name.size() <= n) {
+			return false;
+		}
+		for (size_t i = 0; i < n; ++i) {
+			if (tolower((unsigned char) name[name.size() - n + i]) != extension[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	struct zip_entry {
+		// Offset of the compressed data in the archive
+		uint64_t offset;
+		uint32_t compressed_size;
+		uint32_t uncompressed_size;
+		uint16_t method;
+	};
+
+	// Locates the data of the first .ifc entry in the zip archive f
+	bool locate_zip_entry(FILE* f, zip_entry& result) {
+		const uint64_t size = file_size(f);
+
+		// The end of central directory record is followed by a comment of at most 64KiB
+		const size_t tail_size = (size_t) std::min<uint64_t>(size, zip_end_of_central_directory_size + 0xffff);
+		std::unique_ptr<unsigned char[]> tail(new unsigned char[tail_size]);
+		if (!seek(f, size - tail_size) || fread(tail.get(), 1, tail_size, f) != tail_size) {
+			Logger::Error("Unable to read zip archive");
+			return false;
+		}
+
+		const unsigned char* eocd = nullptr;
+		if (tail_size >= zip_end_of_central_directory_size) {
+			for (size_t i = tail_size - zip_end_of_central_directory_size + 1; i-- > 0;) {
+				if (read_u32(tail.get() + i) == zip_end_of_central_directory_signature) {
+					eocd = tail.get() + i;
+					break;
+				}
+			}
+		}
+		if (eocd == nullptr) {
+			Logger::Error("Unable to locate the central directory of zip archive");
+			return false;
+		}
+
+		const uint16_t num_entries = read_u16(eocd + 10);
+		const uint32_t directory_size = read_u32(eocd + 12);
+		const uint32_t directory_offset = read_u32(eocd + 16);
+		if (num_entries == 0xffff || directory_size == 0xffffffff || directory_offset == 0xffffffff) {
+			Logger::Error("Zip64 archives are not supported");
+			return false;
+		}
+		if ((uint64_t) directory_offset + directory_size > size) {
+			Logger::Error("Invalid central directory in zip archive");
+			return false;
+		}
+
+		std::unique_ptr<unsigned char[]> directory(new unsigned char[directory_size]);
+		if (!seek(f, directory_offset) || fread(directory.get(), 1, directory_size, f) != directory_size) {
+			Logger::Error("Unable to read the central directory of zip archive");
+			return false;
+		}
+
+		// Find the first .ifc entry in the archive
+		const unsigned char* entry = nullptr;
+		size_t offset = 0;
+		for (uint16_t i = 0; i < num_entries; ++i) {
+			if (offset + zip_central_header_size > directory_size || read_u32(directory.get() + offset) != zip_central_header_signature) {
+				Logger::Error("Invalid central directory in zip archive");
+				return false;
+			}
+			const unsigned char* header = directory.get() + offset;
+			const uint16_t name_length = read_u16(header + 28);
+			const size_t header_size = zip_central_header_size + name_length + read_u16(header + 30) + read_u16(header + 32);
+			if (offset + header_size > directory_size) {
+				Logger::Error("Invalid central directory in zip archive");
+				return false;
+			}
+			if (ends_with_ifc(std::string((const char*) header + zip_central_header_size, name_length))) {
+				entry = header;
+				break;
+			}
+			offset += header_size;
+		}
+		if (entry == nullptr) {
+			Logger::Error("No .ifc file found in zip archive");
+			return false;
+		}
+
+		const uint16_t flags = read_u16(entry + 8);
+		result.method = read_u16(entry + 10);
+		result.compressed_size = read_u32(entry + 20);
+		result.uncompressed_size = read_u32(entry + 24);
+		const uint32_t local_header_offset = read_u32(entry + 42);
+
+		if (flags & 1) {
+			Logger::Error("Encrypted zip archives are not supported");
+			return false;
+		}
+		if (result.compressed_size == 0xffffffff || result.uncompressed_size == 0xffffffff || local_header_offset == 0xffffffff) {
+			Logger::Error("Zip64 archives are not supported");
+			return false;
+		}
+		if (result.method != 0 && result.method != 8) {
+			Logger::Error("Unsupported compression method " + std::to_string(result.method) + " in zip archive");
+			return false;
+		}
+
+		// The file name and extra field lengths of the local header can differ
+		// from those in the central directory
+		unsigned char local_header[zip_local_header_size];
+		if (!seek(f, local_header_offset) || fread(local_header, 1, zip_local_header_size, f) != zip_local_header_size ||
+			read_u32(local_header) != zip_local_header_signature)
+		{
+			Logger::Error("Invalid local file header in zip archive");
+			return false;
+		}
+		result.offset = (uint64_t) local_header_offset + zip_local_header_size + read_u16(local_header + 26) + read_u16(local_header + 28);
+		if (result.offset + result.compressed_size > size) {
+			Logger::Error("Invalid local file header in zip archive");
+			return false;
+		}
+
+		return true;
+	}
+
+	// A position in the compressed data from where decompression can be resumed
+	struct access_point {
+		// Offset in the decompressed contents
+		uint64_t out;
+		// Offset in the file of the first compressed byte that has not been consumed
+		uint64_t in;
+		// The number of bits of the byte preceding in that have not been consumed
+		int bits;
+		// Whether decompression starts with a gzip member header
+		bool header;
+		// The deflate window preceding the point, itself compressed
+		std::vector<unsigned char> window;
+		size_t window_size;
+
+		access_point()
+			: out(0), in(0), bits(0), header(false), window_size(0)
+		{}
+	};
+
+	class decoder {
+	public:
+		virtual ~decoder() {}
+
+		// Decompresses the next block into out, which is at least min_size bytes
+		// unless the end of the contents is reached, in which case at_end is set.
+		// When the block ends at a position from where decompression can be
+		// resumed, point is filled in, except for its out member, and has_point
+		// is set. Returns false when the contents cannot be decompressed.
+		virtual bool next_block(std::vector<char>& out, size_t min_size, bool& at_end, bool& has_point, access_point& point) = 0;
+
+		// Decompresses exactly n bytes into out
+		virtual bool read(char* out, size_t n) = 0;
+	};
+
+	// Reads the compressed data in a range of a file in chunks. The file can
+	// be shared by multiple instances, but not concurrently.
+	class compressed_input {
+		FILE* file_;
+		uint64_t position_, end_;
+		std::unique_ptr<unsigned char[]> data_;
+		size_t begin_, size_;
+	public:
+		compressed_input(FILE* f, uint64_t begin, uint64_t end)
+			: file_(f)
+			, position_(begin)
+			, end_(end)
+			, data_(new unsigned char[compressed_chunk_size])
+			, begin_(0)
+			, size_(0)
+		{}
+
+		// Reads until at least n bytes are available or the end of the range
+		// is reached, returns the number of bytes available
+		size_t fill(size_t n = 1) {
+			while (available() < n && position_ < end_) {
+				if (begin_) {
+					memmove(data_.get(), data_.get() + begin_, available());
+					size_ -= begin_;
+					begin_ = 0;
+				}
+				const size_t m = (size_t) std::min<uint64_t>(compressed_chunk_size - size_, end_ - position_);
+				const size_t read = seek(file_, position_) ? fread(data_.get() + size_, 1, m, file_) : 0;
+				if (read == 0) {
+					// Truncated file, treated as the end of the range
+					end_ = position_;
+					break;
+				}
+				position_ += read;
+				size_ += read;
+			}
+			return available();
+		}
+
+		const unsigned char* data() const { return data_.get() + begin_; }
+		size_t available() const { return size_ - begin_; }
+		void consume(size_t n) { begin_ += n; }
+
+		// Offset in the file of the first byte that has not been consumed
+		uint64_t position() const { return position_ - available(); }
+	};
+
+	// The entry data of zip archives that is stored without compression
+	class stored_reader : public decoder {
+		FILE* file_;
+		uint64_t position_, end_;
+	public:
+		stored_reader(FILE* f, uint64_t begin, uint64_t end)
+			: file_(f)
+			, position_(begin)
+			, end_(end)
+		{}
+
+		bool next_block(std::vector<char>& out, size_t min_size, bool& at_end, bool& has_point, access_point& point) {
+			out.resize((size_t) std::min<uint64_t>(min_size, end_ - position_));
+			if (!read(out.data(), out.size())) {
+				out.clear();
+				return false;
+			}
+			at_end = position_ == end_;
+			has_point = true;
+			point.in = position_;
+			return true;
+		}
+
+		bool read(char* out, size_t n) {
+			if (n > end_ - position_ || !seek(file_, position_) || fread(out, 1, n, file_) != n) {
+				return false;
+			}
+			position_ += n;
+			return true;
+		}
+	};
+
+#ifdef WITH_ZLIB
+
+	// Inflates gzip members or the raw deflate data of zip archives. Like
+	// zran.c from the zlib examples, decompression is resumed within a deflate
+	// stream by priming the bits of a partially consumed byte and by setting
+	// the preceding window as the dictionary.
+	class inflater : public decoder {
+		compressed_input input_;
+		z_stream zs_;
+		bool initialized_, failed_, ended_;
+		// Whether the input consists of gzip members
+		const bool gzip_;
+		// Whether the gzip header and trailer are skipped by zlib, which is not
+		// the case when decompression is resumed within a member
+		bool raw_;
+		// Whether the last call to inflate() ended at a deflate block boundary
+		bool at_boundary_;
+
+		bool end_of_member_() {
+			if (!gzip_) {
+				ended_ = true;
+				return true;
+			}
+			if (raw_) {
+				// CRC-32 and ISIZE
+				if (input_.fill(8) < 8) {
+					return false;
+				}
+				input_.consume(8);
+			}
+			// Members can be concatenated, trailing data is ignored like gzip does
+			if (input_.fill(2) < 2 || input_.data()[0] != 0x1f || input_.data()[1] != 0x8b) {
+				ended_ = true;
+				return true;
+			}
+			raw_ = false;
+			return inflateReset2(&zs_, 16 + MAX_WBITS) == Z_OK;
+		}
+
+		// Inflates at most n bytes into out. With flush Z_BLOCK inflate() also
+		// returns at deflate block boundaries.
+		bool inflate_(char* out, size_t n, int flush, size_t& produced) {
+			at_boundary_ = false;
+			// Pending output can be produced without input, but a Z_BUF_ERROR
+			// below means that the input is truncated
+			input_.fill();
+			zs_.next_in = (Bytef*) input_.data();
+			zs_.avail_in = (uInt) input_.available();
+			zs_.next_out = (Bytef*) out;
+			zs_.avail_out = (uInt) n;
+			const int status = inflate(&zs_, flush);
+			input_.consume(input_.available() - zs_.avail_in);
+			produced = n - zs_.avail_out;
+			if (status == Z_STREAM_END) {
+				return end_of_member_();
+			}
+			if (status != Z_OK) {
+				return false;
+			}
+			// Bit 7 is set at the end of a block or a header, bit 6 in the last block
+			at_boundary_ = (zs_.data_type & 128) && !(zs_.data_type & 64);
+			return true;
+		}
+
+	public:
+		inflater(FILE* f, uint64_t end, bool gzip, const access_point& p)
+			: input_(f, p.in - (p.bits ? 1 : 0), end)
+			, initialized_(false)
+			, failed_(true)
+			, ended_(false)
+			, gzip_(gzip)
+			, raw_(!p.header)
+			, at_boundary_(false)
+		{
+			memset(&zs_, 0, sizeof(zs_));
+			if (inflateInit2(&zs_, raw_ ? -MAX_WBITS : 16 + MAX_WBITS) != Z_OK) {
+				return;
+			}
+			initialized_ = true;
+			if (p.bits) {
+				if (input_.fill() == 0) {
+					return;
+				}
+				const int c = input_.data()[0];
+				input_.consume(1);
+				if (inflatePrime(&zs_, p.bits, c >> (8 - p.bits)) != Z_OK) {
+					return;
+				}
+			}
+			if (p.window_size) {
+				std::unique_ptr<unsigned char[]> window(new unsigned char[p.window_size]);
+				uLongf n = (uLongf) p.window_size;
+				if (uncompress(window.get(), &n, p.window.data(), (uLong) p.window.size()) != Z_OK || n != p.window_size ||
+					inflateSetDictionary(&zs_, window.get(), (uInt) n) != Z_OK)
+				{
+					return;
+				}
+			}
+			failed_ = false;
+		}
+
+		~inflater() {
+			if (initialized_) {
+				inflateEnd(&zs_);
+			}
+		}
+
+		bool next_block(std::vector<char>& out, size_t min_size, bool& at_end, bool& has_point, access_point& point) {
+			out.clear();
+			for (;;) {
+				if (failed_) {
+					return false;
+				}
+				if (ended_) {
+					at_end = true;
+					return true;
+				}
+				if (at_boundary_ && out.size() >= min_size) {
+					point.in = input_.position();
+					point.bits = zs_.data_type & 7;
+					point.header = false;
+					point.window_size = std::min(out.size(), deflate_window_size);
+					uLongf n = compressBound((uLong) point.window_size);
+					point.window.resize(n);
+					if (compress2(point.window.data(), &n, (const Bytef*) out.data() + out.size() - point.window_size, (uLong) point.window_size, Z_BEST_SPEED) != Z_OK) {
+						return false;
+					}
+					point.window.resize(n);
+					point.window.shrink_to_fit();
+					has_point = true;
+					return true;
+				}
+				const size_t size = out.size();
+				out.resize(size + compressed_chunk_size);
+				size_t produced;
+				failed_ = !inflate_(out.data() + size, compressed_chunk_size, Z_BLOCK, produced);
+				out.resize(size + produced);
+			}
+		}
+
+		bool read(char* out, size_t n) {
+			while (n) {
+				if (failed_ || ended_) {
+					return false;
+				}
+				size_t produced;
+				failed_ = !inflate_(out, n, Z_NO_FLUSH, produced);
+				out += produced;
+				n -= produced;
+			}
+			return true;
+		}
+	};
+
+#endif
+
+#ifdef WITH_ZSTD
+
+	// Decompresses Zstandard frames, which can only be started at their beginning
+	class zstd_decoder : public decoder {
+		compressed_input input_;
+		ZSTD_DStream* stream_;
+		// Whether the last frame has been decompressed and flushed completely
+		bool frame_end_;
+
+		bool ended_() {
+			return frame_end_ && input_.fill() == 0;
+		}
+
+		bool decompress_(char* out, size_t n, size_t& produced) {
+			produced = 0;
+			if (stream_ == nullptr) {
+				return false;
+			}
+			// Pending output can be flushed without input
+			input_.fill();
+			ZSTD_inBuffer in = { input_.data(), input_.available(), 0 };
+			ZSTD_outBuffer o = { out, n, 0 };
+			const size_t status = ZSTD_decompressStream(stream_, &o, &in);
+			input_.consume(in.pos);
+			produced = o.pos;
+			if (ZSTD_isError(status)) {
+				Logger::Error(std::string("Zstandard: ") + ZSTD_getErrorName(status));
+				return false;
+			}
+			frame_end_ = status == 0;
+			// No progress within a frame means that the input is truncated
+			return frame_end_ || in.pos || o.pos;
+		}
+
+	public:
+		zstd_decoder(FILE* f, uint64_t end, const access_point& p)
+			: input_(f, p.in, end)
+			, stream_(ZSTD_createDStream())
+			, frame_end_(true)
+		{
+			if (stream_ && ZSTD_isError(ZSTD_initDStream(stream_))) {
+				ZSTD_freeDStream(stream_);
+				stream_ = nullptr;
+			}
+		}
+
+		~zstd_decoder() {
+			if (stream_) {
+				ZSTD_freeDStream(stream_);
+			}
+		}
+
+		bool next_block(std::vector<char>& out, size_t min_size, bool& at_end, bool& has_point, access_point& point) {
+			out.resize(min_size);
+			size_t size = 0;
+			bool ok = true;
+			for (;;) {
+				if (ended_()) {
+					at_end = true;
+					break;
+				}
+				if (frame_end_ && size >= min_frame_block_size) {
+					point.in = input_.position();
+					has_point = true;
+					break;
+				}
+				if (size == min_size) {
+					break;
+				}
+				size_t produced;
+				ok = decompress_(out.data() + size, min_size - size, produced);
+				size += produced;
+				if (!ok) {
+					break;
+				}
+			}
+			out.resize(size);
+			return ok;
+		}
+
+		bool read(char* out, size_t n) {
+			while (n) {
+				size_t produced;
+				if (ended_() || !decompress_(out, n, produced)) {
+					return false;
+				}
+				out += produced;
+				n -= produced;
+			}
+			return true;
+		}
+	};
+
+#endif
+
+}
+
+class compression::block_reader::impl {
+	FILE* file_;
+	const format format_;
+	// Whether the zip archive entry is stored without compression
+	const bool stored_;
+	// The range of the compressed data in the file
+	const uint64_t end_;
+	// The length of the decompressed contents stored in the zip archive
+	const bool length_stored_;
+	const uint64_t stored_length_;
+
+	std::mutex mutex_;
+
+	std::vector<access_point> points_;
+
+	struct block_info {
+		// Offset in the decompressed contents
+		uint64_t begin;
+		// The access point from which the block is decompressed
+		size_t point;
+		// The block compressed on its own, for blocks within Zstandard frames
+		std::vector<char> recompressed;
+	};
+	std::vector<block_info> blocks_;
+
+	// The end of the contents decompressed so far and the decoder that
+	// continues from there
+	uint64_t frontier_;
+	std::unique_ptr<decoder> frontier_decoder_;
+	bool finished_, failed_;
+
+	// The cached blocks, the most recently used first
+	typedef std::list<std::pair<size_t, block_ptr> > lru_list;
+	lru_list lru_;
+	std::unordered_map<size_t, lru_list::iterator> cached_;
+
+	std::unique_ptr<decoder> decoder_at_(const access_point& p) {
+		if (stored_) {
+			return std::unique_ptr<decoder>(new stored_reader(file_, p.in, end_));
+		}
+#ifdef WITH_ZSTD
+		if (format_ == zstd) {
+			return std::unique_ptr<decoder>(new zstd_decoder(file_, end_, p));
+		}
+#endif
+#ifdef WITH_ZLIB
+		return std::unique_ptr<decoder>(new inflater(file_, end_, format_ == gzip, p));
+#else
+		return nullptr;
+#endif
+	}
+
+	void cache_(size_t index, const block_ptr& block) {
+		lru_.emplace_front(index, block);
+		cached_[index] = lru_.begin();
+		if (lru_.size() > max_cached_blocks) {
+			cached_.erase(lru_.back().first);
+			lru_.pop_back();
+		}
+	}
+
+	void fail_(const std::string& message, uint64_t offset) {
+		Logger::Error(message + " at offset " + std::to_string(offset));
+		failed_ = finished_ = true;
+		frontier_decoder_.reset();
+	}
+
+	// Decompresses the block at the frontier
+	void advance_() {
+		std::shared_ptr<std::vector<char> > block = std::make_shared<std::vector<char> >();
+		block->reserve(block_size + compressed_chunk_size);
+		bool at_end = false, has_point = false;
+		access_point point;
+		const bool ok = frontier_decoder_->next_block(*block, block_size, at_end, has_point, point);
+
+		if (!block->empty()) {
+			block_info info = { frontier_, points_.size() - 1, std::vector<char>() };
+#ifdef WITH_ZSTD
+			if (format_ == zstd && frontier_ != points_.back().out) {
+				// Zstandard frames can only be decompressed from their start,
+				// which would be repeated for every block of the frame that is
+				// evicted. Instead these blocks are kept, recompressed so that
+				// they can be decompressed independently.
+				info.recompressed.resize(ZSTD_compressBound(block->size()));
+				const size_t n = ZSTD_compress(info.recompressed.data(), info.recompressed.size(), block->data(), block->size(), recompression_level);
+				if (ZSTD_isError(n)) {
+					info.recompressed.clear();
+				} else {
+					info.recompressed.resize(n);
+				}
+				info.recompressed.shrink_to_fit();
+			}
+#endif
+			blocks_.push_back(std::move(info));
+			frontier_ += block->size();
+			cache_(blocks_.size() - 1, block);
+		}
+
+		if (!ok) {
+			fail_("Unable to decompress file contents", frontier_);
+		} else if (at_end) {
+			finished_ = true;
+			frontier_decoder_.reset();
+			if (length_stored_ && frontier_ != stored_length_) {
+				fail_("Decompressed size does not match the size stored in zip archive", frontier_);
+			}
+		} else if (has_point) {
+			point.out = frontier_;
+			points_.push_back(std::move(point));
+		}
+	}
+
+	// Decompresses an evicted block again from the preceding access point
+	block_ptr decompress_again_(size_t index) {
+#ifdef WITH_ZSTD
+		const std::vector<char>& recompressed = blocks_[index].recompressed;
+		if (!recompressed.empty()) {
+			const uint64_t end = index + 1 < blocks_.size() ? blocks_[index + 1].begin : frontier_;
+			std::shared_ptr<std::vector<char> > block = std::make_shared<std::vector<char> >((size_t) (end - blocks_[index].begin));
+			if (ZSTD_decompress(block->data(), block->size(), recompressed.data(), recompressed.size()) != block->size()) {
+				Logger::Error("Unable to decompress file contents at offset " + std::to_string(blocks_[index].begin));
+				failed_ = true;
+				return nullptr;
+			}
+			cache_(index, block);
+			return block;
+		}
+#endif
+		const size_t point = blocks_[index].point;
+		size_t first = index;
+		while (first > 0 && blocks_[first - 1].point == point) {
+			--first;
+		}
+
+		std::unique_ptr<decoder> d = decoder_at_(points_[point]);
+		std::shared_ptr<std::vector<char> > block = std::make_shared<std::vector<char> >();
+		for (size_t i = first; i <= index; ++i) {
+			const uint64_t end = i + 1 < blocks_.size() ? blocks_[i + 1].begin : frontier_;
+			block->resize((size_t) (end - blocks_[i].begin));
+			if (!d->read(block->data(), block->size())) {
+				Logger::Error("Unable to decompress file contents at offset " + std::to_string(blocks_[i].begin));
+				failed_ = true;
+				return nullptr;
+			}
+		}
+
+		cache_(index, block);
+		return block;
+	}
+
+public:
+	impl(FILE* f, format fmt, bool stored, uint64_t begin, uint64_t end, bool length_stored, uint64_t stored_length)
+		: file_(f)
+		, format_(fmt)
+		, stored_(stored)
+		, end_(end)
+		, length_stored_(length_stored)
+		, stored_length_(stored_length)
+		, frontier_(0)
+		, finished_(false)
+		, failed_(false)
+	{
+		access_point start;
+		start.in = begin;
+		start.header = fmt == gzip;
+		points_.push_back(start);
+		frontier_decoder_ = decoder_at_(start);
+	}
+
+	~impl() {
+		frontier_decoder_.reset();
+		fclose(file_);
+	}
+
+	block_ptr block_at(size_t offset, size_t& begin) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		while (offset >= frontier_ && !finished_) {
+			advance_();
+		}
+		if (offset >= frontier_) {
+			return nullptr;
+		}
+
+		// The last block that starts at or before offset
+		auto it = std::upper_bound(blocks_.begin(), blocks_.end(), (uint64_t) offset, [](uint64_t o, const block_info& b) {
+			return o < b.begin;
+		});
+		const size_t index = (size_t) (it - blocks_.begin()) - 1;
+		begin = (size_t) blocks_[index].begin;
+
+		auto c = cached_.find(index);
+		if (c != cached_.end()) {
+			lru_.splice(lru_.begin(), lru_, c->second);
+			return c->second->second;
+		}
+		return decompress_again_(index);
+	}
+
+	bool length_known() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return finished_ || length_stored_;
+	}
+
+	size_t length() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (length_stored_ && !finished_) {
+			return (size_t) stored_length_;
+		}
+		while (!finished_) {
+			advance_();
+		}
+		return (size_t) frontier_;
+	}
+
+	bool failed() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return failed_;
+	}
+};
+
+compression::block_reader::block_reader(impl* i)
+	: impl_(i)
+{}
+
+compression::block_reader::~block_reader() {
+	delete impl_;
+}
+
+compression::block_reader* compression::block_reader::open(FILE* f, format fmt) {
+	impl* i = nullptr;
+
+	if (fmt == zip) {
+		zip_entry entry;
+		if (locate_zip_entry(f, entry)) {
+#ifdef WITH_ZLIB
+			i = new impl(f, zip, entry.method == 0, entry.offset, entry.offset + entry.compressed_size, true, entry.uncompressed_size);
+#else
+			if (entry.method == 0) {
+				i = new impl(f, zip, true, entry.offset, entry.offset + entry.compressed_size, true, entry.uncompressed_size);
+			} else {
+				Logger::Error("Deflate compressed zip archives are not supported, IfcOpenShell was built without zlib");
+			}
+#endif
+		}
+	} else if (fmt == uncompressed) {
+		const uint64_t size = file_size(f);
+		i = new impl(f, uncompressed, true, 0, size, true, size);
+	} else if (fmt == gzip) {
+#ifdef WITH_ZLIB
+		i = new impl(f, gzip, false, 0, file_size(f), false, 0);
+#else
+		Logger::Error("Gzip compressed files are not supported, IfcOpenShell was built without zlib");
+#endif
+	} else if (fmt == zstd) {
+#ifdef WITH_ZSTD
+		i = new impl(f, zstd, false, 0, file_size(f), false, 0);
+#else
+		Logger::Error("Zstandard compressed files are not supported, IfcOpenShell was built without libzstd");
+#endif
+	}
+
+	if (i == nullptr) {
+		fclose(f);
+		return nullptr;
+	}
+	return new block_reader(i);
+}
+
+compression::block_reader::block_ptr compression::block_reader::block_at(size_t offset, size_t& begin) {
+	return impl_->block_at(offset, begin);
+}
+
+bool compression::block_reader::length_known() {
+	return impl_->length_known();
+}
+
+size_t compression::block_reader::length() {
+	return impl_->length();
+}
+
+bool compression::block_reader::failed() {
+	return impl_->failed();
+}
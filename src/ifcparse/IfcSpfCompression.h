@@ -0,0 +1,105 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Detection and random access decompression of gzip, zip (.ifczip) and         *
+* Zstandard compressed IFC-SPF files. The decompressed contents are divided    *
+* into blocks that are decompressed on demand and cached, so that a file is    *
+* never held in memory as a whole, neither compressed nor decompressed.        *
+*                                                                              *
+* While a file is read for the first time, access points are recorded from    *
+* which decompression can be resumed. For deflate (gzip and zip) these are     *
+* placed at deflate block boundaries and store the preceding 32KiB window.     *
+* Zstandard frames can only be decompressed from their start, so the blocks    *
+* that do not start a frame are kept recompressed independently instead, as   *
+* a file usually consists of a single frame.                                   *
+*                                                                              *
+********************************************************************************/
+
+#ifndef IFCSPFCOMPRESSION_H
+#define IFCSPFCOMPRESSION_H
+
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace IfcParse {
+	namespace compression {
+
+		enum format { uncompressed, gzip, zip, zstd };
+
+		/// Returns the compression format based on the first n bytes of a file
+		format detect(const unsigned char* magic, size_t n);
+
+		/// Returns the compression format of a file opened for reading in binary
+		/// mode, the file is rewound afterwards.
+		format detect(FILE* f);
+
+		/// Random access to the decompressed contents of a file, or of the first
+		/// .ifc entry in case of a zip archive. Blocks are decompressed when they
+		/// are first accessed and a limited number of them is cached. The reader
+		/// can be used from multiple threads, decompression is serialized.
+		/// Uncompressed files are read in blocks in the same way, so that only
+		/// the part of the file that is accessed is held in memory.
+		class block_reader {
+		public:
+			typedef std::shared_ptr<const std::vector<char> > block_ptr;
+
+			/// Opens f, of which the contents are compressed in fmt, and takes
+			/// ownership of it. Returns nullptr and logs an error when the file
+			/// cannot be read or when support for the format has not been
+			/// compiled in.
+			static block_reader* open(FILE* f, format fmt);
+
+			~block_reader();
+
+			/// Returns the block that contains offset and sets begin to the
+			/// offset of its first byte, or nullptr when offset is past the end
+			/// of the contents. The block remains valid while it is referenced.
+			block_ptr block_at(size_t offset, size_t& begin);
+
+			/// Returns whether the length of the decompressed contents is known
+			/// without decompressing them, i.e. when stored in the zip archive,
+			/// or after they have been decompressed completely.
+			bool length_known();
+
+			/// Returns the length of the decompressed contents, decompresses the
+			/// remainder of the file when it is not known.
+			size_t length();
+
+			/// Returns whether the contents could not be decompressed completely,
+			/// e.g. because the file is truncated or corrupt. The contents end at
+			/// the point of the failure.
+			bool failed();
+
+		private:
+			class impl;
+			impl* impl_;
+
+			explicit block_reader(impl* i);
+			block_reader(const block_reader&);
+			block_reader& operator=(const block_reader&);
+		};
+
+	}
+}
+
+#endif
@@ -0,0 +1,492 @@
+/********************************************************************************
+*                                                                              *
+* This file is part of IfcOpenShell.                                           *
+*                                                                              *
+* IfcOpenShell is free software: you can redistribute it and/or modify         *
+* it under the terms of the Lesser GNU General Public License as published by  *
+* the Free Software Foundation, either version 3.0 of the License, or          *
+* (at your option) any later version.                                          *
+*                                                                              *
+* IfcOpenShell is distributed in the hope that it will be useful,              *
+* but WITHOUT ANY WARRANTY; without even the implied warranty of               *
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                 *
+* Lesser GNU General Public License for more details.                          *
+*                                                                              *
+* You should have received a copy of the Lesser GNU General Public License     *
+* along with this program. If not, see <http://www.gnu.org/licenses/>.         *
+*                                                                              *
+********************************************************************************/
+
+/********************************************************************************
+*                                                                              *
+* Persistent index of the entity instances and references in an IFC-SPF file, *
+* stored next to the file so that subsequent reads can skip scanning the file. *
+*                                                                              *
+********************************************************************************/
+
+#include "../ifcparse/IfcFile.h"
+#include "../ifcparse/IfcLogger.h"
+#include "../ifcparse/utils.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _MSC_VER
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <set>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+
+using namespace IfcParse;
+
+namespace {
+
+	// Increment when the layout of the index or the semantics of the scan change
+	const uint32_t index_version = 4;
+	const char index_magic[8] = { 'I', 'F', 'C', 'S', 'P', 'F', 'I', 'X' };
+
+	// The modification time is in nanoseconds, with the precision of the platform
+	bool file_size_and_mtime(const std::string& fn, uint64_t& size, int64_t& mtime) {
+#ifdef _MSC_VER
+		struct _stat64 st;
+#ifdef _UNICODE
+		if (_wstat64(IfcUtil::path::from_utf8(fn).c_str(), &st) != 0) {
+#else
+		if (_stat64(fn.c_str(), &st) != 0) {
+#endif
+			return false;
+		}
+		mtime = (int64_t) st.st_mtime * 1000000000;
+#elif defined(__GLIBC__)
+		// Explicitly 64-bit, as off_t is 32-bit on 32-bit platforms unless
+		// compiled with _FILE_OFFSET_BITS=64, which fails for files over 2 GB
+		struct stat64 st;
+		if (stat64(fn.c_str(), &st) != 0) {
+			return false;
+		}
+		mtime = (int64_t) st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#else
+		struct stat st;
+		static_assert(sizeof(st.st_size) >= 8, "64-bit file offsets are required");
+		if (stat(fn.c_str(), &st) != 0) {
+			return false;
+		}
+#ifdef __APPLE__
+		mtime = (int64_t) st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+		mtime = (int64_t) st.st_mtime * 1000000000;
+#endif
+#endif
+		size = (uint64_t) st.st_size;
+		return true;
+	}
+
+	inline uint64_t rotl(uint64_t v, int r) {
+		return (v << r) | (v >> (64 - r));
+	}
+
+	// A non-cryptographic 64-bit hash to detect modifications of the file contents.
+	// Four independent lanes are used so that multiple words are processed in parallel.
+	uint64_t hash_contents(const char* data, size_t n) {
+		const uint64_t k1 = 0x9E3779B185EBCA87ULL;
+		const uint64_t k2 = 0xC2B2AE3D27D4EB4FULL;
+		const uint64_t k3 = 0x165667B19E3779F9ULL;
+
+		uint64_t lanes[4] = { k1, k2, k3, k1 ^ k2 };
+		size_t i = 0;
+		for (; i + 32 <= n; i += 32) {
+			for (int j = 0; j < 4; ++j) {
+				uint64_t w;
+				std::memcpy(&w, data + i + 8 * j, 8);
+				lanes[j] = rotl(lanes[j] + w * k2, 31) * k1;
+			}
+		}
+
+		uint64_t h = (uint64_t) n * k3;
+		for (int j = 0; j < 4; ++j) {
+			h = rotl(h ^ rotl(lanes[j] * k2, 31) * k1, 27) * k1 + k3;
+		}
+		for (; i < n; ++i) {
+			h = rotl(h ^ ((uint64_t) (unsigned char) data[i] * k3), 11) * k1;
+		}
+
+		h ^= h >> 33;
+		h *= k2;
+		h ^= h >> 29;
+		h *= k3;
+		h ^= h >> 32;
+		return h;
+	}
+
+	// The file contents are validated by hashing this many samples, evenly
+	// spaced and including the start and the end of the file
+	const size_t num_samples = 64;
+	const size_t sample_size = 4096;
+
+	// Hashes samples of the file contents rather than all of it, so that
+	// validating the index does not require reading the file. Together with
+	// the size and modification time this detects changes to the file, except
+	// for those that preserve both and only affect the parts not sampled.
+	bool hash_samples(const std::string& fn, uint64_t size, uint64_t& hash) {
+		std::ifstream ifs(IfcUtil::path::from_utf8(fn).c_str(), std::ios_base::binary);
+		if (!ifs.good()) {
+			return false;
+		}
+		std::vector<char> samples;
+		if (size <= num_samples * sample_size) {
+			samples.resize((size_t) size);
+			ifs.read(samples.data(), (std::streamsize) samples.size());
+		} else {
+			samples.resize(num_samples * sample_size);
+			for (size_t i = 0; i < num_samples && ifs.good(); ++i) {
+				const uint64_t offset = (size - sample_size) * i / (num_samples - 1);
+				ifs.seekg((std::streamoff) offset);
+				ifs.read(samples.data() + i * sample_size, (std::streamsize) sample_size);
+			}
+		}
+		if (!ifs.good()) {
+			return false;
+		}
+		hash = hash_contents(samples.data(), samples.size());
+		return true;
+	}
+
+	// Read-only mapping of the index, so that it is not copied into memory
+	// as a whole before being parsed
+	class mapped_index {
+	private:
+		const char* data_;
+		size_t size_;
+#ifdef _MSC_VER
+		HANDLE mapping_;
+#endif
+	public:
+		explicit mapped_index(const std::string& fn)
+			: data_(nullptr)
+			, size_(0)
+#ifdef _MSC_VER
+			, mapping_(NULL)
+#endif
+		{
+#ifdef _MSC_VER
+#ifdef _UNICODE
+			HANDLE file = CreateFileW(IfcUtil::path::from_utf8(fn).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+			HANDLE file = CreateFileA(fn.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#endif
+			if (file == INVALID_HANDLE_VALUE) {
+				return;
+			}
+			LARGE_INTEGER size;
+			if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+				mapping_ = CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+				if (mapping_ != NULL) {
+					data_ = (const char*) MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+					size_ = data_ ? (size_t) size.QuadPart : 0;
+				}
+			}
+			// The mapping keeps the file open
+			CloseHandle(file);
+#else
+			const int fd = open(fn.c_str(), O_RDONLY);
+			if (fd == -1) {
+				return;
+			}
+			struct stat st;
+			if (fstat(fd, &st) == 0 && st.st_size > 0) {
+				void* p = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if (p != MAP_FAILED) {
+					data_ = (const char*) p;
+					size_ = (size_t) st.st_size;
+				}
+			}
+			// The mapping remains valid after the file is closed
+			close(fd);
+#endif
+		}
+
+		~mapped_index() {
+#ifdef _MSC_VER
+			if (data_) {
+				UnmapViewOfFile(data_);
+			}
+			if (mapping_ != NULL) {
+				CloseHandle(mapping_);
+			}
+#else
+			if (data_) {
+				munmap((void*) data_, size_);
+			}
+#endif
+		}
+
+		const char* data() const { return data_; }
+		size_t size() const { return size_; }
+
+	private:
+		mapped_index(const mapped_index&);
+		mapped_index& operator=(const mapped_index&);
+	};
+
+	class index_writer {
+	private:
+		std::string buffer_;
+	public:
+		template <typename T>
+		void write(const T& t) {
+			buffer_.append((const char*) &t, sizeof(T));
+		}
+
+		void write(const std::string& s) {
+			write((uint32_t) s.size());
+			buffer_.append(s);
+		}
+
+		const std::string& buffer() const { return buffer_; }
+	};
+
+	class index_reader {
+	private:
+		const char* begin_;
+		const char* end_;
+	public:
+		index_reader(const char* begin, const char* end)
+			: begin_(begin), end_(end)
+		{}
+
+		template <typename T>
+		T read() {
+			if ((size_t) (end_ - begin_) < sizeof(T)) {
+				throw IfcException("Unexpected end of index");
+			}
+			T t;
+			std::memcpy(&t, begin_, sizeof(T));
+			begin_ += sizeof(T);
+			return t;
+		}
+
+		std::string read_string() {
+			const uint32_t n = read<uint32_t>();
+			if ((size_t) (end_ - begin_) < n) {
+				throw IfcException("Unexpected end of index");
+			}
+			std::string s(begin_, n);
+			begin_ += n;
+			return s;
+		}
+
+		bool at_end() const { return begin_ == end_; }
+	};
+
+}
+
+bool IfcFile::read_index_() {
+	const std::string index_filename = filename_ + ".idx";
+
+	// The offsets in the index are those of the decompressed contents, which
+	// are not worth decompressing a compressed file for to validate them
+	if (stream->compressed()) {
+		return false;
+	}
+
+	mapped_index contents(index_filename);
+	if (contents.size() < sizeof(index_magic) + sizeof(uint64_t) || std::memcmp(contents.data(), index_magic, sizeof(index_magic)) != 0) {
+		return false;
+	}
+
+	uint64_t file_size;
+	int64_t file_mtime;
+	if (!file_size_and_mtime(filename_, file_size, file_mtime) || file_size != stream->Length()) {
+		return false;
+	}
+
+	// The index ends with a hash of its own contents to detect incomplete or interleaved writes
+	const char* payload_end = contents.data() + contents.size() - sizeof(uint64_t);
+	uint64_t index_hash;
+	std::memcpy(&index_hash, payload_end, sizeof(uint64_t));
+	if (index_hash != hash_contents(contents.data(), contents.size() - sizeof(uint64_t))) {
+		Logger::Notice("Ignoring corrupt index " + index_filename);
+		return false;
+	}
+
+	index_reader reader(contents.data() + sizeof(index_magic), payload_end);
+
+	try {
+		uint64_t samples_hash;
+		if (reader.read<uint32_t>() != index_version ||
+			reader.read<uint64_t>() != file_size ||
+			reader.read<int64_t>() != file_mtime ||
+			!hash_samples(filename_, file_size, samples_hash) ||
+			reader.read<uint64_t>() != samples_hash ||
+			reader.read_string() != schema_->name())
+		{
+			return false;
+		}
+
+		const size_t num_declarations = schema_->declarations().size();
+
+		const uint64_t num_instances = reader.read<uint64_t>();
+		for (uint64_t i = 0; i < num_instances; ++i) {
+			const uint32_t id = reader.read<uint32_t>();
+			const uint32_t type = reader.read<uint32_t>();
+			const uint64_t offset = reader.read<uint64_t>();
+			if (type >= num_declarations || !schema_->declaration_by_name((int) type)->as_entity() || offset >= stream->Length()) {
+				throw IfcException("Invalid instance in index");
+			}
+			add_scanned_instance_(schema_->instantiate(new IfcEntityInstanceData(schema_->declaration_by_name((int) type), this, id, (size_t) offset)));
+		}
+
+		const uint64_t num_refs = reader.read<uint64_t>();
+		for (uint64_t i = 0; i < num_refs; ++i) {
+			const int32_t to = reader.read<int32_t>();
+			const int32_t from = reader.read<int32_t>();
+			const int32_t attribute_index = reader.read<int32_t>();
+			byref.add(to, from, attribute_index);
+		}
+		byref.build();
+
+		const uint64_t num_guids = reader.read<uint64_t>();
+		for (uint64_t i = 0; i < num_guids; ++i) {
+			IfcUtil::IfcBaseClass* inst = byid.get(reader.read<uint32_t>());
+			if (inst == nullptr) {
+				throw IfcException("Invalid GlobalId in index");
+			}
+			byguid.insert_or_assign(reader.read<boost::uuids::uuid>(), inst);
+		}
+
+		const uint64_t num_text_guids = reader.read<uint64_t>();
+		for (uint64_t i = 0; i < num_text_guids; ++i) {
+			IfcUtil::IfcBaseClass* inst = byid.get(reader.read<uint32_t>());
+			if (inst == nullptr) {
+				throw IfcException("Invalid GlobalId in index");
+			}
+			byguid.insert_or_assign(reader.read_string(), inst);
+		}
+
+		if (!reader.at_end()) {
+			throw IfcException("Trailing data in index");
+		}
+	} catch (const IfcException& e) {
+		Logger::Notice("Ignoring invalid index " + index_filename + ": " + e.what());
+
+		std::set<IfcUtil::IfcBaseClass*> instances;
+		for (auto& p : bytype_excl) {
+			instances.insert(p.second->begin(), p.second->end());
+		}
+		for (auto& inst : instances) {
+			delete inst;
+		}
+		byid.clear();
+		bytype.clear();
+		bytype_excl.clear();
+		byref.clear();
+		byguid.clear();
+		MaxId = 0;
+
+		return false;
+	}
+
+	parsing_complete_ = true;
+
+	if (!lazy_load_) {
+		load_scanned_instances_();
+	}
+
+	return true;
+}
+
+void IfcFile::write_index_() {
+	if (!persistent_index_ || filename_.empty() || stream->compressed()) {
+		return;
+	}
+
+	uint64_t file_size, samples_hash;
+	int64_t file_mtime;
+	if (!file_size_and_mtime(filename_, file_size, file_mtime) || file_size != stream->Length() || !hash_samples(filename_, file_size, samples_hash)) {
+		return;
+	}
+
+	index_writer writer;
+	writer.write(index_magic);
+	writer.write(index_version);
+	writer.write(file_size);
+	writer.write(file_mtime);
+	writer.write(samples_hash);
+	writer.write(schema_->name());
+
+	// Instances are stored in file order, so that the order of instances by type is retained
+	std::vector<IfcUtil::IfcBaseClass*> instances;
+	instances.reserve(byid.size());
+	for (auto& p : byid) {
+		instances.push_back(p.second);
+	}
+	std::sort(instances.begin(), instances.end(), [](IfcUtil::IfcBaseClass* a, IfcUtil::IfcBaseClass* b) {
+		return a->data().offset_in_file() < b->data().offset_in_file();
+	});
+
+	writer.write((uint64_t) instances.size());
+	for (auto& inst : instances) {
+		writer.write((uint32_t) inst->data().id());
+		writer.write((uint32_t) inst->declaration().index_in_schema());
+		writer.write((uint64_t) inst->data().offset_in_file());
+	}
+
+	uint64_t num_refs = 0;
+	byref.for_each([&num_refs](int, const inverse_index::reference&) {
+		++num_refs;
+	});
+	writer.write(num_refs);
+	// References are written grouped by the instance referred to, in the
+	// order in which they were encountered
+	byref.for_each([&writer](int to, const inverse_index::reference& r) {
+		writer.write((int32_t) to);
+		writer.write((int32_t) r.instance);
+		writer.write((int32_t) r.attribute_index);
+	});
+
+	const auto& text_guids = byguid.text_entries();
+	writer.write((uint64_t) (byguid.size() - text_guids.size()));
+	byguid.for_each([&writer](const boost::uuids::uuid& guid, IfcUtil::IfcBaseClass* inst) {
+		writer.write((uint32_t) inst->data().id());
+		writer.write(guid);
+	});
+
+	writer.write((uint64_t) text_guids.size());
+	for (auto& p : text_guids) {
+		writer.write((uint32_t) p.second->data().id());
+		writer.write(p.first);
+	}
+
+	const uint64_t index_hash = hash_contents(writer.buffer().data(), writer.buffer().size());
+
+	// Write to a temporary file first, so that readers never observe a partially written index
+	const std::string index_filename = filename_ + ".idx";
+	const std::string temp_filename = index_filename + ".tmp";
+	{
+		std::ofstream ofs(IfcUtil::path::from_utf8(temp_filename).c_str(), std::ios_base::binary);
+		ofs.write(writer.buffer().data(), writer.buffer().size());
+		ofs.write((const char*) &index_hash, sizeof(index_hash));
+		if (!ofs.good()) {
+			Logger::Notice("Unable to write index " + index_filename);
+			return;
+		}
+	}
+	if (!IfcUtil::path::rename_file(temp_filename, index_filename)) {
+		Logger::Notice("Unable to write index " + index_filename);
+		IfcUtil::path::delete_file(temp_filename);
+	}
+}
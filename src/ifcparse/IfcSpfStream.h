@@ -27,14 +27,19 @@
 #ifndef IFCSPFSTREAM_H
 #define IFCSPFSTREAM_H
 
+#include <atomic>
 #include <fstream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #ifdef USE_MMAP
 #include <boost/iostreams/device/mapped_file.hpp>
 #endif
 
 #include "ifc_parse_api.h"
+#include "IfcCharacterScan.h"
+#include "IfcSpfCompression.h"
 
 namespace IfcParse {
 	/// The IfcSpfStream class represents a ISO 10303-21 IFC-SPF file in memory.
@@ -47,35 +52,118 @@ namespace IfcParse {
 #endif
 		FILE* stream;
 		const char* buffer;
-		unsigned int ptr;
-		unsigned int len;
+		size_t ptr;
+		size_t len;
+		bool owns_buffer_;
+
+		/// Reads the file into the buffer on a background thread, so that the
+		/// contents can be lexed while the remainder of the file is being read.
+		class read_ahead;
+		read_ahead* read_ahead_;
+		/// The number of bytes at the start of the buffer known to have been read
+		mutable std::atomic<size_t> available_;
+		/// Set when the file could not be read completely
+		bool read_error_ = false;
+
+		/// The decompressed contents of compressed files, or the contents of
+		/// files opened with in_blocks_t, which are accessed in blocks instead
+		/// of through the buffer. Shared with the streams created from this
+		/// stream.
+		std::shared_ptr<compression::block_reader> compressed_;
+		/// The block of the decompressed contents last accessed
+		std::shared_ptr<const std::vector<char> > block_;
+		size_t block_begin_, block_end_;
+
+		/// Makes the block that contains offset current, returns false when
+		/// offset is past the end of the decompressed contents
+		bool load_block_(size_t offset);
+		bool in_block_(size_t offset) {
+			return (offset >= block_begin_ && offset < block_end_) || load_block_(offset);
+		}
+		char compressed_at_(size_t offset);
+		/// Accesses the contents of f in blocks, takes ownership of f
+		void open_blocks_(FILE* f, compression::format format);
+
+		/// Blocks until at least the first end bytes have been read
+		void wait_(size_t end) const;
+		void require_(size_t end) const {
+			if (end > available_.load(std::memory_order_acquire)) {
+				wait_(end);
+			}
+		}
 	public:
 		bool valid;
 		bool eof;
-		unsigned int size;
+		/// The number of bytes in the file contents, 0 for compressed files of
+		/// which the length is not known upfront
+		size_t size;
 #ifdef USE_MMAP
 		IfcSpfStream(const std::string& fn, bool mmap=false);
 #else
 		IfcSpfStream(const std::string& fn);
 #endif
-		IfcSpfStream(std::istream& f, int len);
-		IfcSpfStream(void* data, int len);
+		struct in_blocks_t {};
+		/// Opens the file to be read in blocks, of which a limited number is
+		/// held in memory, also when it is not compressed. For reading the
+		/// header or making a single pass over a file of any size.
+		IfcSpfStream(const std::string& fn, in_blocks_t);
+		IfcSpfStream(std::istream& f, size_t len);
+		IfcSpfStream(void* data, size_t len);
+		/// Creates a stream that shares the buffer of another stream, but
+		/// has its own cursor positioned at offset. The buffer is not owned
+		/// and needs to outlive this stream. Used to read from multiple
+		/// threads concurrently.
+		IfcSpfStream(const IfcSpfStream& other, size_t offset);
 		~IfcSpfStream();
 		/// Returns the character at the cursor 
 		char Peek();
 		/// Returns the character at specified offset
-		char Read(unsigned int offset);
+		char Read(size_t offset);
 		/// Increment the file cursor and reads new page if necessary
 		void Inc();
 		void Close();
 		/// Moves the file cursor to an arbitrary offset in the file
-		void Seek(unsigned int offset);
+		void Seek(size_t offset);
 		/// Returns the cursor position
-		unsigned int Tell();
+		size_t Tell();
+		/// Moves the file cursor to the first character from chars at or after
+		/// the cursor, or to the end of the file
+		void SeekFirstOf(const character_set& chars);
+		/// Returns the file contents, blocks until the file has been read
+		/// completely. Returns nullptr for compressed files.
+		const char* Buffer() const { require_(len); return buffer; }
+		/// Returns the file contents, blocks until at least the first end bytes
+		/// have been read. Returns nullptr for compressed files.
+		const char* Buffer(size_t end) const { require_(end); return buffer; }
+		/// Returns the file contents without waiting for the file to be read
+		/// completely. Only the characters up to and including the ones
+		/// that have been accessed through this stream, such as those of
+		/// lexed tokens and their delimiters, are guaranteed to be read.
+		/// Returns nullptr for compressed files.
+		const char* PartialBuffer() const { return buffer; }
+		/// Returns the contiguous part of the file contents that contains
+		/// offset and sets [begin, end) to its range: a single block for
+		/// compressed files and files opened with in_blocks_t, otherwise the
+		/// whole contents once read completely. Returns nullptr when offset is
+		/// past the end. The part remains valid until another block is
+		/// accessed through this stream.
+		const char* Chunk(size_t offset, size_t& begin, size_t& end);
+		/// Returns the number of bytes in the file contents. For compressed
+		/// files of which the length is not stored, the remainder of the
+		/// file is decompressed to determine it.
+		size_t Length() const;
+		/// Returns whether the file is compressed or opened with in_blocks_t,
+		/// in which case its contents are read in blocks on demand and are not
+		/// contiguous in memory. See IfcSpfCompression.h.
+		bool compressed() const { return !!compressed_; }
+		/// Returns whether reading the file contents failed after the stream
+		/// was opened, e.g. because the file was truncated in the meantime.
+		/// The contents that could not be read are blanked.
+		bool read_error() const;
 
-		bool is_eof_at(unsigned int);
-		void increment_at(unsigned int&);
-		char peek_at(unsigned int);
+		bool is_eof_at(size_t);
+		void increment_at(size_t&);
+		char peek_at(size_t);
 	};
 }
 
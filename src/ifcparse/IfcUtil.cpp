@@ -138,6 +138,7 @@ Argument::operator aggregate_of_instance::ptr() const { throw IfcParse::IfcExcep
 Argument::operator std::vector< std::vector<int> >() const { throw IfcParse::IfcException("Argument is not a list of list of ints"); }
 Argument::operator std::vector< std::vector<double> >() const { throw IfcParse::IfcException("Argument is not a list of list of floats"); }
 Argument::operator aggregate_of_aggregate_of_instance::ptr() const { throw IfcParse::IfcException("Argument is not a list of list of entity instances"); }
+int Argument::enumeration_index() const { return -1; }
 
 
 static const char* const argument_type_string[] = {
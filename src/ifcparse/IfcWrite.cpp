@@ -17,6 +17,10 @@
  *                                                                              *
  ********************************************************************************/
 
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iomanip>
 #include <locale>
 #include <limits>
@@ -71,26 +75,35 @@ private:
 	// The REAL token definition from the IFC SPF standard does not necessarily match
 	// the output of the C++ ostream formatting operation.
 	// REAL = [ SIGN ] DIGIT { DIGIT } "." { DIGIT } [ "E" [ SIGN ] DIGIT { DIGIT } ] .
+	// The least number of significant digits is used with which the value is read
+	// back exactly, which is at most 17 for a double.
 	std::string format_double(const double& d) {
-		std::ostringstream oss;
-		oss.imbue(std::locale::classic());
-		oss << std::setprecision(std::numeric_limits<double>::digits10) << d;
-		const std::string str = oss.str();
-		oss.str("");
-		std::string::size_type e = str.find('e');
-		if (e == std::string::npos) {
-			e = str.find('E');
+		char buffer[40];
+		for (int precision = std::numeric_limits<double>::digits10;; ++precision) {
+			snprintf(buffer, sizeof(buffer), "%.*g", precision, d);
+			// Formatting and reading back both use the decimal point of the current locale
+			if (precision >= std::numeric_limits<double>::max_digits10 || strtod(buffer, nullptr) == d) {
+				break;
+			}
 		}
-		const std::string mantissa = str.substr(0,e);
-		oss << mantissa;
-		if (mantissa.find('.') == std::string::npos) {
-			oss << ".";
+		std::string str = buffer;
+		const char* decimal_point = localeconv()->decimal_point;
+		if (decimal_point && strcmp(decimal_point, ".") != 0 && *decimal_point) {
+			std::string::size_type p = str.find(decimal_point);
+			if (p != std::string::npos) {
+				str.replace(p, strlen(decimal_point), ".");
+			}
+		}
+		const std::string::size_type e = str.find('e');
+		std::string result = str.substr(0, e);
+		if (result.find('.') == std::string::npos) {
+			result += '.';
 		}
 		if (e != std::string::npos) {
-			oss << "E";
-			oss << str.substr(e+1);
+			result += 'E';
+			result.append(str, e + 1, std::string::npos);
 		}
-		return oss.str();
+		return result;
 	}
 
 	std::string format_binary(const boost::dynamic_bitset<>& b) {
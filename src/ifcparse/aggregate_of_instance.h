@@ -25,10 +25,15 @@
 #include <boost/shared_ptr.hpp>
 
 #include <set>
+#include <algorithm>
+#include <iterator>
 
 template <class T>
 class aggregate_of;
 
+template <class T>
+class typed_range;
+
 class IFC_PARSE_API aggregate_of_instance {
 	std::vector<IfcUtil::IfcBaseClass*> ls;
 public:
@@ -53,8 +58,57 @@ public:
 		return r;
 	}
 	void remove(IfcUtil::IfcBaseClass*);
+	/// Removes the instances for which fn returns true in a single pass
+	template <typename Fn>
+	void remove_if(Fn fn) {
+		ls.erase(std::remove_if(ls.begin(), ls.end(), fn), ls.end());
+	}
 	aggregate_of_instance::ptr filtered(const std::set<const IfcParse::declaration*>& entities);
 	aggregate_of_instance::ptr unique();
+
+	template <class T>
+	friend class typed_range;
+};
+
+/// A view of the instances in an aggregate_of_instance as instances of T,
+/// which does not copy them into a new list like aggregate_of_instance::as()
+/// does. Instances are cast statically, so the aggregate must only contain
+/// instances of T or its subtypes, such as the lists by type of a file.
+/// Instances appended to the aggregate after creating the view are not part
+/// of it, removing instances from the aggregate invalidates the view.
+template <class T>
+class typed_range {
+	aggregate_of_instance::ptr ls_;
+	size_t size_;
+
+public:
+	class iterator {
+		const aggregate_of_instance* ls_;
+		size_t i_;
+
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef T* value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef T* const* pointer;
+		typedef T* reference;
+
+		iterator(const aggregate_of_instance* ls, size_t i) : ls_(ls), i_(i) {}
+		T* operator*() const { return static_cast<T*>(ls_->ls[i_]); }
+		iterator& operator++() { ++i_; return *this; }
+		iterator operator++(int) { iterator it = *this; ++i_; return it; }
+		bool operator==(const iterator& other) const { return i_ == other.i_; }
+		bool operator!=(const iterator& other) const { return i_ != other.i_; }
+	};
+
+	typed_range() : size_(0) {}
+	explicit typed_range(const aggregate_of_instance::ptr& ls) : ls_(ls), size_(ls ? ls->size() : 0) {}
+
+	iterator begin() const { return iterator(ls_.get(), 0); }
+	iterator end() const { return iterator(ls_.get(), size_); }
+	size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	T* operator[](size_t i) const { return static_cast<T*>(ls_->ls[i]); }
 };
 
 template <class T>
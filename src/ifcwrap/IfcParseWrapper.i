@@ -26,9 +26,26 @@ private:
 
 %ignore IfcParse::IfcFile::register_inverse;
 %ignore IfcParse::IfcFile::unregister_inverse;
+%ignore IfcParse::IfcFile::instance_reader;
+%ignore IfcParse::IfcFile::acquire_reader;
+%ignore IfcParse::IfcFile::release_reader;
+%ignore IfcParse::IfcFile::add_resident;
+%ignore IfcParse::IfcFile::attribute_lease;
+%ignore IfcParse::IfcFile::probe;
+%ignore IfcParse::file_probe;
+%ignore IfcParse::IfcFile::write(std::ostream&, unsigned int) const;
 %ignore IfcParse::IfcFile::schema;
 %ignore IfcParse::IfcFile::begin;
 %ignore IfcParse::IfcFile::end;
+%ignore IfcParse::IfcFile::instances_by_attribute_value;
+%ignore IfcParse::IfcFile::instances_by_attribute_prefix;
+%ignore IfcParse::IfcFile::invalidate_attribute_indices;
+%ignore IfcParse::attribute_value;
+%ignore IfcParse::attribute_value_index;
+
+%ignore IfcParse::keyword_table;
+%ignore IfcParse::schema_definition::declaration_by_name(const char*, size_t) const;
+%ignore IfcParse::enumeration_type::lookup_enum_offset;
 
 %ignore operator<<;
 
@@ -113,6 +130,85 @@ static IfcUtil::ArgumentType helper_fn_attribute_type(const IfcUtil::IfcBaseClas
 		return IfcUtil::from_parameter_type(pt);
 	}
 }
+
+// Read-only buffer with a copy of the values of a NumericAggregateArgument.
+// The values are copied, as the argument can be freed while the buffer is
+// in use, e.g. when the attribute is assigned, the instance is removed or
+// its attributes are released to meet the memory budget of the file.
+struct numeric_aggregate_buffer {
+	PyObject_HEAD
+	void* values;
+	bool integral;
+	Py_ssize_t shape[2];
+	Py_ssize_t strides[2];
+};
+
+static int numeric_aggregate_buffer_getbuffer(PyObject* self, Py_buffer* view, int flags) {
+	if (flags & PyBUF_WRITABLE) {
+		PyErr_SetString(PyExc_BufferError, "Attribute buffer is read-only");
+		view->obj = NULL;
+		return -1;
+	}
+	numeric_aggregate_buffer* b = (numeric_aggregate_buffer*) self;
+	view->buf = b->values;
+	view->obj = self;
+	Py_INCREF(self);
+	view->itemsize = b->integral ? sizeof(int) : sizeof(double);
+	view->len = b->shape[0] * b->shape[1] * view->itemsize;
+	view->readonly = 1;
+	view->format = (flags & PyBUF_FORMAT) ? (char*) (b->integral ? "i" : "d") : NULL;
+	view->ndim = 2;
+	view->shape = (flags & PyBUF_ND) == PyBUF_ND ? b->shape : NULL;
+	view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? b->strides : NULL;
+	view->suboffsets = NULL;
+	view->internal = NULL;
+	if (!view->shape) {
+		view->ndim = 1;
+	}
+	return 0;
+}
+
+static void numeric_aggregate_buffer_dealloc(PyObject* self) {
+	PyMem_Free(((numeric_aggregate_buffer*) self)->values);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* numeric_aggregate_buffer_new(const IfcParse::NumericAggregateArgument* argument) {
+	static PyBufferProcs buffer_procs = { numeric_aggregate_buffer_getbuffer, NULL };
+	static PyTypeObject buffer_type = { PyVarObject_HEAD_INIT(NULL, 0) };
+	if (buffer_type.tp_name == NULL) {
+		buffer_type.tp_name = "ifcopenshell_wrapper.numeric_aggregate_buffer";
+		buffer_type.tp_basicsize = sizeof(numeric_aggregate_buffer);
+		buffer_type.tp_dealloc = numeric_aggregate_buffer_dealloc;
+		buffer_type.tp_as_buffer = &buffer_procs;
+		buffer_type.tp_flags = Py_TPFLAGS_DEFAULT;
+		if (PyType_Ready(&buffer_type) < 0) {
+			buffer_type.tp_name = NULL;
+			return NULL;
+		}
+	}
+	const bool integral = argument->integers() != nullptr;
+	const Py_ssize_t itemsize = integral ? sizeof(int) : sizeof(double);
+	const size_t len = argument->rows() * argument->columns() * itemsize;
+	// At least one byte is allocated, so that empty lists have a valid address
+	void* values = PyMem_Malloc(len ? len : 1);
+	if (values == NULL) {
+		return PyErr_NoMemory();
+	}
+	memcpy(values, integral ? (const void*) argument->integers() : (const void*) argument->doubles(), len);
+	numeric_aggregate_buffer* b = PyObject_New(numeric_aggregate_buffer, &buffer_type);
+	if (b == NULL) {
+		PyMem_Free(values);
+		return NULL;
+	}
+	b->values = values;
+	b->integral = integral;
+	b->shape[0] = (Py_ssize_t) argument->rows();
+	b->shape[1] = (Py_ssize_t) argument->columns();
+	b->strides[0] = b->shape[1] * itemsize;
+	b->strides[1] = itemsize;
+	return (PyObject*) b;
+}
 %}
 
 %extend IfcParse::IfcFile {
@@ -130,6 +226,40 @@ static IfcUtil::ArgumentType helper_fn_attribute_type(const IfcUtil::IfcBaseClas
 		return $self->getInverse(e->data().id(), 0, -1);
 	}
 
+	aggregate_of_instance::ptr by_attribute_value(const std::string& type, const std::string& attribute, PyObject* value) {
+		// Bool is checked before int, as it is a subtype of int in Python
+		if (PyUnicode_Check(value)) {
+			return $self->instances_by_attribute_value(type, attribute, std::string(PyUnicode_AsUTF8(value)));
+		} else if (PyBool_Check(value)) {
+			return $self->instances_by_attribute_value(type, attribute, value == Py_True);
+		} else if (PyLong_Check(value)) {
+			// Numbers are compared as doubles, which represent integers up to
+			// 2^53 exactly, larger integers are rejected rather than rounded
+			int overflow = 0;
+			const long long v = PyLong_AsLongLongAndOverflow(value, &overflow);
+			if (v == -1 && PyErr_Occurred()) {
+				PyErr_Clear();
+				throw IfcParse::IfcException("Value could not be converted to an integer");
+			}
+			const long long max_exact = 1LL << 53;
+			if (overflow != 0 || v > max_exact || v < -max_exact) {
+				throw std::overflow_error("Integer value is too large to be compared exactly");
+			}
+			return $self->instances_by_attribute_value(type, attribute, static_cast<double>(v));
+		} else if (PyFloat_Check(value)) {
+			return $self->instances_by_attribute_value(type, attribute, PyFloat_AsDouble(value));
+		}
+		void* ptr = 0;
+		if (!SWIG_IsOK(SWIG_ConvertPtr(value, &ptr, SWIGTYPE_p_IfcUtil__IfcBaseClass, 0))) {
+			throw IfcParse::IfcException("Value should be a string, number, boolean or entity instance");
+		}
+		return $self->instances_by_attribute_value(type, attribute, reinterpret_cast<IfcUtil::IfcBaseClass*>(ptr));
+	}
+
+	aggregate_of_instance::ptr by_attribute_prefix(const std::string& type, const std::string& attribute, const std::string& prefix) {
+		return $self->instances_by_attribute_prefix(type, attribute, prefix);
+	}
+
 	std::vector<int> get_inverse_indices(IfcUtil::IfcBaseClass* e) {
 		return $self->get_inverse_indices(e->data().id());
 	}
@@ -138,11 +268,6 @@ static IfcUtil::ArgumentType helper_fn_attribute_type(const IfcUtil::IfcBaseClas
 		return $self->getTotalInverses(e->data().id());
 	}
 
-	void write(const std::string& fn) {
-		std::ofstream f(IfcUtil::path::from_utf8(fn).c_str());
-		f << (*$self);
-	}
-
 	std::string to_string() {
 		std::stringstream s;
 		s << (*$self);
@@ -288,6 +413,18 @@ static IfcUtil::ArgumentType helper_fn_attribute_type(const IfcUtil::IfcBaseClas
 		return std::pair<IfcUtil::ArgumentType,Argument*>($self->data().getArgument(i)->type(), $self->data().getArgument(i));
 	}
 
+	// Returns an object exposing the values of a list of lists of numbers
+	// through the buffer protocol with a single copy of the contiguous values,
+	// or None when the attribute is not stored contiguously.
+	PyObject* get_argument_buffer(unsigned i) {
+		auto numeric = dynamic_cast<const IfcParse::NumericAggregateArgument*>($self->data().getArgument(i));
+		if (numeric == nullptr) {
+			Py_INCREF(Py_None);
+			return Py_None;
+		}
+		return numeric_aggregate_buffer_new(numeric);
+	}
+
 	bool __eq__(IfcUtil::IfcBaseClass* other) const {
 		return $self->identity() == other->identity();
 	}
@@ -589,6 +726,15 @@ static IfcUtil::ArgumentType helper_fn_attribute_type(const IfcUtil::IfcBaseClas
 		return f;
 	}
 
+	// Only loads the instances of root_types and the instances they refer to
+	IfcParse::IfcFile* open(const std::string& fn, const std::vector<std::string>& root_types) {
+		IfcParse::IfcFile* f;
+		Py_BEGIN_ALLOW_THREADS;
+		f = new IfcParse::IfcFile(fn, root_types);
+		Py_END_ALLOW_THREADS;
+		return f;
+	}
+
     IfcParse::IfcFile* read(const std::string& data) {
 		char* copiedData = new char[data.length()];
 		memcpy(copiedData, data.c_str(), data.length());
@@ -599,6 +745,44 @@ static IfcUtil::ArgumentType helper_fn_attribute_type(const IfcUtil::IfcBaseClas
 		return f;
 	}
 
+	// Returns the result of IfcFile::probe() as a dictionary
+	PyObject* probe(const std::string& fn, bool statistics = false) {
+		IfcParse::file_probe p;
+		Py_BEGIN_ALLOW_THREADS;
+		p = IfcParse::IfcFile::probe(fn, statistics);
+		Py_END_ALLOW_THREADS;
+
+		PyObject* d = PyDict_New();
+		auto set_item = [d](const char* key, PyObject* value) {
+			PyDict_SetItemString(d, key, value);
+			Py_DECREF(value);
+		};
+		set_item("status", pythonize((int) p.status.value()));
+		set_item("size", PyLong_FromSize_t(p.size));
+		set_item("description", pythonize_vector(p.description));
+		set_item("implementation_level", pythonize(p.implementation_level));
+		set_item("name", pythonize(p.name));
+		set_item("time_stamp", pythonize(p.time_stamp));
+		set_item("author", pythonize_vector(p.author));
+		set_item("organization", pythonize_vector(p.organization));
+		set_item("preprocessor_version", pythonize(p.preprocessor_version));
+		set_item("originating_system", pythonize(p.originating_system));
+		set_item("authorization", pythonize(p.authorization));
+		set_item("schema_identifiers", pythonize_vector(p.schema_identifiers));
+		if (p.has_statistics) {
+			set_item("instance_count", PyLong_FromSize_t(p.instance_count));
+			set_item("max_id", pythonize(p.max_id));
+			PyObject* counts = PyDict_New();
+			for (const auto& pair : p.entity_counts) {
+				PyObject* count = PyLong_FromSize_t(pair.second);
+				PyDict_SetItemString(counts, pair.first.c_str(), count);
+				Py_DECREF(count);
+			}
+			set_item("entity_counts", counts);
+		}
+		return d;
+	}
+
 	const char* version() {
 		return IFCOPENSHELL_VERSION;
 	}
@@ -847,12 +1031,10 @@ static IfcUtil::ArgumentType helper_fn_attribute_type(const IfcUtil::IfcBaseClas
 				return pythonize_vector(v);
 			break; }
 			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_INT: {
-				std::vector< std::vector<int> > v = arg;
-				return pythonize_vector2(v);
+				return pythonize_numeric_aggregate<int>(arg);
 			break; }
 			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_DOUBLE: {
-				std::vector< std::vector<double> > v = arg;
-				return pythonize_vector2(v);
+				return pythonize_numeric_aggregate<double>(arg);
 			break; }
 			case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: {
 				aggregate_of_aggregate_of_instance::ptr vs = arg;
@@ -65,6 +65,8 @@
 		SWIG_exception(SWIG_IndexError, e.what());
 	} catch(const IfcParse::IfcException& e) {
 		SWIG_exception(SWIG_RuntimeError, e.what());
+	} catch(const std::overflow_error& e) {
+		SWIG_exception(SWIG_OverflowError, e.what());
 	} catch(const std::runtime_error& e) {
 		SWIG_exception(SWIG_RuntimeError, e.what());
 	} catch(...) {
@@ -183,6 +183,28 @@
 		return pyobj;
 	}
 
+	// Lists of lists of numbers stored contiguously by the parser are
+	// converted without constructing the intermediate nested vectors.
+	template <typename T>
+	PyObject* pythonize_numeric_aggregate(const Argument& arg) {
+		if (auto numeric = dynamic_cast<const IfcParse::NumericAggregateArgument*>(&arg)) {
+			const std::vector< IfcParse::numeric_span<T> > spans = numeric->row_spans<T>();
+			if (!spans.empty()) {
+				PyObject* pyobj = PyTuple_New(spans.size());
+				for (size_t i = 0; i < spans.size(); ++i) {
+					PyObject* row = PyTuple_New(spans[i].size());
+					for (size_t j = 0; j < spans[i].size(); ++j) {
+						PyTuple_SetItem(row, j, pythonize(spans[i][j]));
+					}
+					PyTuple_SetItem(pyobj, i, row);
+				}
+				return pyobj;
+			}
+		}
+		std::vector< std::vector<T> > v = arg;
+		return pythonize_vector2(v);
+	}
+
 	PyObject* pythonize(const aggregate_of_aggregate_of_instance::ptr& t) {
 		unsigned int i = 0;
 		PyObject* pyobj = PyTuple_New(t->size());
@@ -100,12 +100,10 @@
 			$result = pythonize_vector(v);
 		break; }
 		case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_INT: {
-			std::vector< std::vector<int> > v = arg;
-			$result = pythonize_vector2(v);
+			$result = pythonize_numeric_aggregate<int>(arg);
 		break; }
 		case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_DOUBLE: {
-			std::vector< std::vector<double> > v = arg;
-			$result = pythonize_vector2(v);
+			$result = pythonize_numeric_aggregate<double>(arg);
 		break; }
 		case IfcUtil::Argument_AGGREGATE_OF_AGGREGATE_OF_ENTITY_INSTANCE: {
 			aggregate_of_aggregate_of_instance::ptr v = arg;
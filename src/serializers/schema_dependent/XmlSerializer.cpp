@@ -533,12 +533,12 @@ void format_tasks(IfcSchema::IfcTask* task, ptree& node) {
 void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 	MAKE_TYPE_NAME(argument_name_map).insert(std::make_pair("GlobalId", "id"));
 
-	IfcSchema::IfcProject::list::ptr projects = file->instances_by_type<IfcSchema::IfcProject>();
-	if (projects->size() != 1) {
+	auto projects = file->instances_by_type_range<IfcSchema::IfcProject>();
+	if (projects.size() != 1) {
 		Logger::Message(Logger::LOG_ERROR, "Expected a single IfcProject");
 		return;
 	}
-	IfcSchema::IfcProject* project = *projects->begin();
+	IfcSchema::IfcProject* project = *projects.begin();
 
 	ptree root, header, units, decomposition, properties, quantities, types, layers, materials, work, calendars, connections, groups;
 
@@ -608,8 +608,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 	descend(project, decomposition);
 
 	// Write all property sets and values as XML nodes.
-	IfcSchema::IfcPropertySet::list::ptr psets = file->instances_by_type<IfcSchema::IfcPropertySet>();
-	for (IfcSchema::IfcPropertySet::list::it it = psets->begin(); it != psets->end(); ++it) {
+	auto psets = file->instances_by_type_range<IfcSchema::IfcPropertySet>();
+	for (auto it = psets.begin(); it != psets.end(); ++it) {
 		IfcSchema::IfcPropertySet* pset = *it;
 		ptree* node = format_entity_instance(pset, properties);
 		if (node) {
@@ -618,9 +618,9 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 	}
 
 	// Write all group sets and values as XML nodes.
-	IfcSchema::IfcGroup::list::ptr gsets = file->instances_by_type<IfcSchema::IfcGroup>();
+	auto gsets = file->instances_by_type_range<IfcSchema::IfcGroup>();
 	std::set<std::string> notRootGroups; //selfname, fathername
-	for (IfcSchema::IfcGroup::list::it it = gsets->begin(); it != gsets->end(); ++it) {
+	for (auto it = gsets.begin(); it != gsets.end(); ++it) {
 		writeGroupToNode(*it, groups, notRootGroups);
 	}
 	for (auto it = groups.begin(); it != groups.end();) {
@@ -632,8 +632,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 	}
 
 	// Write all quantities and values as XML nodes.
-	IfcSchema::IfcElementQuantity::list::ptr qtosets = file->instances_by_type<IfcSchema::IfcElementQuantity>();
-	for (IfcSchema::IfcElementQuantity::list::it it = qtosets->begin(); it != qtosets->end(); ++it) {
+	auto qtosets = file->instances_by_type_range<IfcSchema::IfcElementQuantity>();
+	for (auto it = qtosets.begin(); it != qtosets.end(); ++it) {
 		IfcSchema::IfcElementQuantity* qto = *it;
 		ptree* node = format_entity_instance(qto, quantities);
 		if (node) {
@@ -643,8 +643,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 
 	// Write all work schedules and values as XML nodes.
 	ptree pwork_schedules;
-	IfcSchema::IfcWorkSchedule::list::ptr pschedules = file->instances_by_type<IfcSchema::IfcWorkSchedule>();
-	for (IfcSchema::IfcWorkSchedule::list::it it = pschedules->begin(); it != pschedules->end(); ++it) {
+	auto pschedules = file->instances_by_type_range<IfcSchema::IfcWorkSchedule>();
+	for (auto it = pschedules.begin(); it != pschedules.end(); ++it) {
 		IfcSchema::IfcWorkSchedule* schedule = *it;
 		ptree* nschedule = format_entity_instance(schedule, pwork_schedules);
 		
@@ -669,8 +669,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 
 	// Write all work plans and values as XML nodes.
 	ptree pwork_plans;
-	IfcSchema::IfcWorkPlan::list::ptr pplans = file->instances_by_type<IfcSchema::IfcWorkPlan>();
-	for (IfcSchema::IfcWorkPlan::list::it it = pplans->begin(); it != pplans->end(); ++it) {
+	auto pplans = file->instances_by_type_range<IfcSchema::IfcWorkPlan>();
+	for (auto it = pplans.begin(); it != pplans.end(); ++it) {
 		IfcSchema::IfcWorkPlan* plan = *it;
 		ptree* nschedule = format_entity_instance(plan, pwork_plans);
 
@@ -695,8 +695,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 	
 	// Write all work calendars and values as XML nodes.
 #ifdef SCHEMA_HAS_IfcWorkCalendar
-	IfcSchema::IfcWorkCalendar::list::ptr pcalendars = file->instances_by_type<IfcSchema::IfcWorkCalendar>();
-	for (IfcSchema::IfcWorkCalendar::list::it it = pcalendars->begin(); it != pcalendars->end(); ++it) {
+	auto pcalendars = file->instances_by_type_range<IfcSchema::IfcWorkCalendar>();
+	for (auto it = pcalendars.begin(); it != pcalendars.end(); ++it) {
 		IfcSchema::IfcWorkCalendar* calendar = *it;
 		ptree* ncalendar = format_entity_instance(calendar, calendars);
 		
@@ -713,8 +713,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 	}
 #endif
 	
-	IfcSchema::IfcRelConnectsElements::list::ptr pconnections = file->instances_by_type<IfcSchema::IfcRelConnectsElements>();
-	for (IfcSchema::IfcRelConnectsElements::list::it it = pconnections->begin(); it != pconnections->end(); ++it) {
+	auto pconnections = file->instances_by_type_range<IfcSchema::IfcRelConnectsElements>();
+	for (auto it = pconnections.begin(); it != pconnections.end(); ++it) {
 		IfcSchema::IfcRelConnectsElements* connection = *it;
 
 		ptree* nconnection = format_entity_instance(connection, connections);
@@ -730,8 +730,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
 	}
 
 	// Write all type objects as XML nodes.
-	IfcSchema::IfcTypeObject::list::ptr type_objects = file->instances_by_type<IfcSchema::IfcTypeObject>();
-	for (IfcSchema::IfcTypeObject::list::it it = type_objects->begin(); it != type_objects->end(); ++it) {
+	auto type_objects = file->instances_by_type_range<IfcSchema::IfcTypeObject>();
+	for (auto it = type_objects.begin(); it != type_objects.end(); ++it) {
 		IfcSchema::IfcTypeObject* type_object = *it;
 		ptree* node = descend(type_object, types);
 		
@@ -764,8 +764,8 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
     // so use names as the IDs and only insert those with unique names. In case of possible duplicate names/IDs
     // the first IfcPresentationLayerAssignment occurrence takes precedence.
     std::set<std::string> layer_names;
-	IfcSchema::IfcPresentationLayerAssignment::list::ptr layer_assignments = file->instances_by_type<IfcSchema::IfcPresentationLayerAssignment>();
-    for (IfcSchema::IfcPresentationLayerAssignment::list::it it = layer_assignments->begin(); it != layer_assignments->end(); ++it) {
+	auto layer_assignments = file->instances_by_type_range<IfcSchema::IfcPresentationLayerAssignment>();
+    for (auto it = layer_assignments.begin(); it != layer_assignments.end(); ++it) {
         const std::string& name = (*it)->Name();
         if (layer_names.find(name) == layer_names.end()) {
             layer_names.insert(name);
@@ -775,9 +775,9 @@ void MAKE_TYPE_NAME(XmlSerializer)::finalize() {
         }
     }
 
-	IfcSchema::IfcRelAssociatesMaterial::list::ptr materal_associations = file->instances_by_type<IfcSchema::IfcRelAssociatesMaterial>();
+	auto materal_associations = file->instances_by_type_range<IfcSchema::IfcRelAssociatesMaterial>();
 	std::set<IfcSchema::IfcMaterialSelect*> emitted_materials;
-	for (IfcSchema::IfcRelAssociatesMaterial::list::it it = materal_associations->begin(); it != materal_associations->end(); ++it) {
+	for (auto it = materal_associations.begin(); it != materal_associations.end(); ++it) {
 		IfcSchema::IfcMaterialSelect* mat = (**it).RelatingMaterial();
 		if (emitted_materials.find(mat) == emitted_materials.end()) {
 			emitted_materials.insert(mat);